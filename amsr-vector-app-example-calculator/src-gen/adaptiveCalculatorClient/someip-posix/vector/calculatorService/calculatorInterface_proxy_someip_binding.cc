@@ -62,16 +62,13 @@ void CalculatorInterfaceProxySomeIpBinding::SendMethodRequest(someip_posix_commo
 void CalculatorInterfaceProxySomeIpBinding::SubscribeEvent(
     someip_posix_common::someip::EventId event_id,
     ara::com::someip_posix::ServiceProxySomeIpEventInterface* event_manager) {
-  std::pair<EventSubscriptionsMap::iterator, bool> insert_pair{event_subscriptions_.end(), false};
-  {
-    // Protect concurrent modification of event_subscriptions_
-    std::lock_guard<std::mutex> guard(event_subscriptions_lock_);
+  EventSubscription* subscription{FindEventSubscription(event_id)};
+  ara::com::someip_posix::ServiceProxySomeIpEventInterface* expected{nullptr};
 
-    // Subscribe to event
-    insert_pair = event_subscriptions_.emplace(event_id, event_manager);
-  }
-
-  if (insert_pair.second) {
+  if (subscription == nullptr) {
+    logger_.LogError() << "Event with ID " << event_id << " is not part of the service interface. Subscription is "
+                       << "dropped.";
+  } else if (subscription->compare_exchange_strong(expected, event_manager, std::memory_order_acq_rel)) {
     someip_binding_.SubscribeEvent(CalculatorInterfaceProxySomeIpBinding::kServiceId, instance_id_, event_id);
   } else {
     logger_.LogWarn() << "Event with ID " << event_id << " already subscribed! Subscription is dropped.";
@@ -79,29 +76,16 @@ void CalculatorInterfaceProxySomeIpBinding::SubscribeEvent(
 }
 
 void CalculatorInterfaceProxySomeIpBinding::UnsubscribeEvent(someip_posix_common::someip::EventId event_id) {
-  ara::com::someip_posix::ServiceProxySomeIpEventInterface* event_manager = nullptr;
-  {
-    // Protect concurrent modification of event_subscriptions_
-    std::lock_guard<std::mutex> guard(event_subscriptions_lock_);
-
-    // Search event by ID
-    auto it = event_subscriptions_.find(event_id);
-
-    if (it != event_subscriptions_.end()) {
-      // Store related event handler for later notification of subscription state update
-      event_manager = it->second;
-
-      // Delete route and unsubscribe from event
-      event_subscriptions_.erase(it);
-      someip_binding_.UnsubscribeEvent(CalculatorInterfaceProxySomeIpBinding::kServiceId, instance_id_, event_id);
-    }
-  }
-
-  /* Notify the related event manager about subscription state update.
-   * Done outside of event_subscriptions_lock_ due to possible dead-locks in case the event
-   * subscription state update handler directly calls SubscribeEvent API. A possible unexpected
-   * event notification in case of a Subscribe call between lock_guard and handler call is accepted. */
+  EventSubscription* subscription{FindEventSubscription(event_id)};
+  // Delete route and unsubscribe from event. Keep the related event handler for the notification of the subscription
+  // state update.
+  ara::com::someip_posix::ServiceProxySomeIpEventInterface* event_manager{
+      (subscription != nullptr) ? subscription->exchange(nullptr, std::memory_order_acq_rel) : nullptr};
+
+  /* Notify the related event manager about subscription state update. A possible unexpected event notification in
+   * case of a concurrent event notification by the reactor is accepted. */
   if (event_manager) {
+    someip_binding_.UnsubscribeEvent(CalculatorInterfaceProxySomeIpBinding::kServiceId, instance_id_, event_id);
     event_manager->HandleEventSubscriptionStateUpdate(ara::com::SubscriptionState::kNotSubscribed);
   } else {
     logger_.LogWarn() << "No subscription active for event with SOME/IP event ID " << event_id
@@ -150,24 +134,12 @@ void CalculatorInterfaceProxySomeIpBinding::HandleEventNotification(
   // The method / event ID and the session ID.
   const someip_posix_common::someip::MethodId event_id = header.method_id_;
 
-  ara::com::someip_posix::ServiceProxySomeIpEventInterface* event_manager = nullptr;
-  {
-    // Protect concurrent modification of event_subscriptions_ container.
-    // Required in case of concurrent reception of new event notifications by reactor and Subscribe/Unsubscribe by
-    // Application
-    std::lock_guard<std::mutex> guard(event_subscriptions_lock_);
-
-    // Search event subscription and call event notification handler
-    auto it = event_subscriptions_.find(event_id);
-    if (it != event_subscriptions_.end()) {
-      event_manager = it->second;
-    }
-  }
+  // Search event subscription and call event notification handler. Subscribe/Unsubscribe by the application only
+  // exchange the event manager of the subscription, so no lock is needed.
+  EventSubscription* subscription{FindEventSubscription(event_id)};
+  ara::com::someip_posix::ServiceProxySomeIpEventInterface* event_manager{
+      (subscription != nullptr) ? subscription->load(std::memory_order_acquire) : nullptr};
 
-  /* Call event notification handler. Explicitly done outside of event_subscriptions_lock_ to avoid
-   * potential dead-locks in case application handler calls other event subscribe/unsubscribe APIs.
-   * A possible unexpected event notification in case of Unsubscribe call between lock_guard and handler
-   * call is accepted. */
   if (event_manager) {
     event_manager->HandleEventNotification(std::move(deserializer));
   } else {
@@ -178,22 +150,11 @@ void CalculatorInterfaceProxySomeIpBinding::HandleEventNotification(
 
 void CalculatorInterfaceProxySomeIpBinding::HandleEventSubscriptionStateUpdate(
     const someip_posix_common::someip::MethodId event_id, ara::com::SubscriptionState state) {
-  ara::com::someip_posix::ServiceProxySomeIpEventInterface* event_manager = nullptr;
-  {
-    // Protect concurrent modification of event_subscriptions_ container.
-    // Required in case of concurrent subscription state update by reactor and Subscribe/Unsubscribe by Application
-    std::lock_guard<std::mutex> guard(event_subscriptions_lock_);
-
-    // Search event subscription and call subscription state update handler
-    auto it = event_subscriptions_.find(event_id);
-    if (it != event_subscriptions_.end()) {
-      event_manager = it->second;
-    }
-  }
+  // Search event subscription and call subscription state update handler
+  EventSubscription* subscription{FindEventSubscription(event_id)};
+  ara::com::someip_posix::ServiceProxySomeIpEventInterface* event_manager{
+      (subscription != nullptr) ? subscription->load(std::memory_order_acquire) : nullptr};
 
-  /* Call event subscription state change handler. Explicitely done outside of event_subscriptions_lock_ to avoid
-   * potential dead-locks in case application handler calls other event subscribe/unsubscribe APIs. A possible
-   * unexpected state change update in case of Unsubscribe call between lock_guard and handler call is accepted. */
   if (event_manager) {
     event_manager->HandleEventSubscriptionStateUpdate(state);
   } else {
@@ -206,5 +167,25 @@ void CalculatorInterfaceProxySomeIpBinding::HandleEventSubscriptionStateUpdate(
   }
 }
 
+CalculatorInterfaceProxySomeIpBinding::EventSubscription* CalculatorInterfaceProxySomeIpBinding::FindEventSubscription(
+    someip_posix_common::someip::EventId event_id) {
+  EventSubscription* subscription{nullptr};
+  // Based on the event id -> static dispatching to the subscription of the event manager
+  switch (event_id) {
+    case CalculatorInterfaceProxySomeIpEventManagerDivisionByZero::event_id_: {
+      subscription = &event_subscription_divisionByZero_;
+      break;
+    }
+    case CalculatorInterfaceProxySomeIpFieldNotifierDivideResult::event_id_: {
+      subscription = &field_notifier_subscription_divideResult_;
+      break;
+    }
+    default: {
+      break;
+    }
+  }
+  return subscription;
+}
+
 }  // namespace calculatorService
 }  // namespace vector
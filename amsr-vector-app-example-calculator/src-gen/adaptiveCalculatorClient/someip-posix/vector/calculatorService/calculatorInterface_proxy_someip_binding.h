@@ -24,7 +24,7 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
-#include <map>
+#include <atomic>
 #include <memory>
 #include <tuple>
 #include "ara-someip-posix/aracom_someip_binding_interface.h"
@@ -206,9 +206,15 @@ class CalculatorInterfaceProxySomeIpBinding : public CalculatorInterfaceProxyImp
   }
 
  private:
-  /** Subscribed events with the related event manager */
-  using EventSubscriptionsMap =
-      std::map<someip_posix_common::someip::EventId, ara::com::someip_posix::ServiceProxySomeIpEventInterface*>;
+  /** Event manager of a subscribed event, nullptr if the event is not subscribed */
+  using EventSubscription = std::atomic<ara::com::someip_posix::ServiceProxySomeIpEventInterface*>;
+
+  /**
+   * \brief Look up the subscription of an event. The look-up is a switch over the event IDs of the service interface.
+   * \param event_id The SOME/IP event ID
+   * \return The subscription, or nullptr if the service interface has no event with this ID.
+   */
+  EventSubscription* FindEventSubscription(someip_posix_common::someip::EventId event_id);
 
   /** SOME/IP instance ID used by this binding. */
   someip_posix_common::someip::InstanceId instance_id_;
@@ -222,11 +228,13 @@ class CalculatorInterfaceProxySomeIpBinding : public CalculatorInterfaceProxyImp
   /** Logger for tracing and debugging */
   ara::log::Logger& logger_;
 
-  /** Event subscriptions */
-  EventSubscriptionsMap event_subscriptions_;
+  /* ---- Event subscriptions ------------------------------------------------------------------------------------ */
+
+  /** Subscription of the event 'divisionByZero' */
+  EventSubscription event_subscription_divisionByZero_{nullptr};
 
-  /** Mutex for protection of event_subscriptions_ */
-  std::mutex event_subscriptions_lock_;
+  /** Subscription of the field notifier 'divideResult' */
+  EventSubscription field_notifier_subscription_divideResult_{nullptr};
 
   /* ---- Methods manager ------------------------------------------------------------------------------------------ */
 
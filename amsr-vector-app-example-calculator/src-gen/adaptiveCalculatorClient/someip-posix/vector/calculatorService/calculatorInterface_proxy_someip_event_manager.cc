@@ -33,6 +33,11 @@ namespace calculatorService {
 
 /* ---- Event 'divisionByZero' ------------------------------------------- */
 
+/**
+ * \brief Wire layout of the sample of event 'divisionByZero'.
+ */
+using DivisionByZeroSampleLayout = someip_posix_common::someip::serialization::FixedLayout<boolean>;
+
 CalculatorInterfaceProxySomeIpEventManagerDivisionByZero::CalculatorInterfaceProxySomeIpEventManagerDivisionByZero(
     CalculatorInterfaceProxySomeIpBinding& proxy_binding)
     : proxy_binding_(proxy_binding), service_event_(nullptr) {}
@@ -45,8 +50,7 @@ void CalculatorInterfaceProxySomeIpEventManagerDivisionByZero::Subscribe(
   }
 
   service_event_ = service_event;
-  policy_ = cache_policy;
-  cache_size_ = cache_size;
+  this->ResetSampleCache(cache_policy, cache_size);
   proxy_binding_.SubscribeEvent(event_id_, this);
 }
 
@@ -55,45 +59,17 @@ void CalculatorInterfaceProxySomeIpEventManagerDivisionByZero::Unsubscribe() {
   service_event_ = nullptr;
 }
 
-template <typename RootDeserializer>
-class DeserializeCalculatorInterfaceDivisionByZerodata {
- public:
-  explicit DeserializeCalculatorInterfaceDivisionByZerodata(RootDeserializer* root) : deserializer_{root} {}
-
-  /* ImplementationDataTypeValue deserialization for element 'data' (/AUTOSAR_Platform/ImplementationDataTypes/boolean)
-   */
-  template <typename ParentDeserializer>
-  std::pair<boolean, bool> Deserializedata(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    boolean data{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer> deserializer__data{parent};
-    deserialization_ok = deserializer__data.PopFront(data) > 0U;
-    return std::make_pair(data, deserialization_ok);
-  }
-
-  boolean StartDeserialization() {
-    auto ret = Deserializedata<RootDeserializer>(deserializer_);
-    return ret.first;
-  }
-
- private:
-  RootDeserializer* deserializer_;
-};
-
 void CalculatorInterfaceProxySomeIpEventManagerDivisionByZero::HandleEventNotification(
     RootDeserializerAlias&& deserializer) {
   // shortening
   namespace marshaller = someip_posix_common::someip::serialization;
 
   // Deserialize event sample
-  // Create one deserializer object for argument data
-  DeserializeCalculatorInterfaceDivisionByZerodata<typename std::decay<decltype(deserializer)>::type>
-      arg_data_deserializer{&deserializer};
-  boolean data = arg_data_deserializer.StartDeserialization();
+  boolean data{};
+  deserializer.PopFrontFixed<DivisionByZeroSampleLayout>(data);
 
   // Store data in invisible sample cache
-  this->push(data);
+  this->push(std::move(data));
 
   if (service_event_) {
     // Notify EventReceiveHandler
@@ -120,6 +96,11 @@ void CalculatorInterfaceProxySomeIpEventManagerDivisionByZero::HandleEventSubscr
 
 /* ---- Field notifier 'divideResult' ------------------------------------------- */
 
+/**
+ * \brief Wire layout of the sample of field notifier 'divideResult'.
+ */
+using DivideResultSampleLayout = someip_posix_common::someip::serialization::FixedLayout<uint32>;
+
 CalculatorInterfaceProxySomeIpFieldNotifierDivideResult::CalculatorInterfaceProxySomeIpFieldNotifierDivideResult(
     CalculatorInterfaceProxySomeIpBinding& proxy_binding)
     : proxy_binding_(proxy_binding), service_event_(nullptr) {}
@@ -132,8 +113,7 @@ void CalculatorInterfaceProxySomeIpFieldNotifierDivideResult::Subscribe(
   }
 
   service_event_ = service_event;
-  policy_ = cache_policy;
-  cache_size_ = cache_size;
+  this->ResetSampleCache(cache_policy, cache_size);
   proxy_binding_.SubscribeEvent(event_id_, this);
 }
 
@@ -142,45 +122,17 @@ void CalculatorInterfaceProxySomeIpFieldNotifierDivideResult::Unsubscribe() {
   service_event_ = nullptr;
 }
 
-template <typename RootDeserializer>
-class DeserializeCalculatorInterfaceDivideResultdata {
- public:
-  explicit DeserializeCalculatorInterfaceDivideResultdata(RootDeserializer* root) : deserializer_{root} {}
-
-  /* ImplementationDataTypeValue deserialization for element 'data' (/AUTOSAR_Platform/ImplementationDataTypes/uint32)
-   */
-  template <typename ParentDeserializer>
-  std::pair<uint32, bool> Deserializedata(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    uint32 data{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer> deserializer__data{parent};
-    deserialization_ok = deserializer__data.PopFront(data) > 0U;
-    return std::make_pair(data, deserialization_ok);
-  }
-
-  uint32 StartDeserialization() {
-    auto ret = Deserializedata<RootDeserializer>(deserializer_);
-    return ret.first;
-  }
-
- private:
-  RootDeserializer* deserializer_;
-};
-
 void CalculatorInterfaceProxySomeIpFieldNotifierDivideResult::HandleEventNotification(
     RootDeserializerAlias&& deserializer) {
   // shortening
   namespace marshaller = someip_posix_common::someip::serialization;
 
   // Deserialize event sample
-  // Create one deserializer object for argument data
-  DeserializeCalculatorInterfaceDivideResultdata<typename std::decay<decltype(deserializer)>::type>
-      arg_data_deserializer{&deserializer};
-  uint32 data = arg_data_deserializer.StartDeserialization();
+  uint32 data{};
+  deserializer.PopFrontFixed<DivideResultSampleLayout>(data);
 
   // Store data in invisible sample cache
-  this->push(data);
+  this->push(std::move(data));
 
   if (service_event_) {
     // Notify EventReceiveHandler
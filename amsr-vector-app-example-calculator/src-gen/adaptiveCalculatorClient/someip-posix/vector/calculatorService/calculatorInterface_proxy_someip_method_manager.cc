@@ -36,6 +36,16 @@ namespace calculatorService {
 
 /* ---- Method 'subtract' ------------------------------------------- */
 
+/**
+ * \brief Wire layout of the request payload of method 'subtract'.
+ */
+using SubtractRequestLayout = someip_posix_common::someip::serialization::FixedLayout<uint32, uint32>;
+
+/**
+ * \brief Wire layout of the response payload of method 'subtract'.
+ */
+using SubtractResponseLayout = someip_posix_common::someip::serialization::FixedLayout<uint32>;
+
 CalculatorInterfaceProxySomeIpMethodManagerSubtract::CalculatorInterfaceProxySomeIpMethodManagerSubtract(
     CalculatorInterfaceProxySomeIpBinding& proxy_binding)
     : next_session_id_(0U), proxy_binding_(proxy_binding) {}
@@ -79,18 +89,8 @@ CalculatorInterfaceProxySomeIpMethodManagerSubtract::HandleMethodRequest(uint32&
       &serializer, header};
 
   // Serialize payload
-  /* ImplementationDataTypeValue serialization for element 'arg1' (/AUTOSAR_Platform/ImplementationDataTypes/uint32) */
-  {
-    marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> serializer_arg1{&serializer};
-    serializer_arg1.PushBack(arg1);
-    serializer_arg1.Close();
-  }
-  /* ImplementationDataTypeValue serialization for element 'arg2' (/AUTOSAR_Platform/ImplementationDataTypes/uint32) */
-  {
-    marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> serializer_arg2{&serializer};
-    serializer_arg2.PushBack(arg2);
-    serializer_arg2.Close();
-  }
+  /* Fixed layout serialization of element(s) 'arg1', 'arg2' */
+  serializer.PushBackFixed<SubtractRequestLayout>(arg1, arg2);
 
   // Close SOME/IP header serializer, update the SOME/IP length field
   header_serializer.Close();
@@ -109,32 +109,6 @@ CalculatorInterfaceProxySomeIpMethodManagerSubtract::HandleMethodRequest(uint32&
   return future;
 }
 
-template <typename RootDeserializer>
-class DeserializecalculatorInterfaceSubtractresult {
- public:
-  explicit DeserializecalculatorInterfaceSubtractresult(RootDeserializer* root) : deserializer_{root} {}
-
-  /* ImplementationDataTypeValue deserialization for element 'result' (/AUTOSAR_Platform/ImplementationDataTypes/uint32)
-   */
-  template <typename ParentDeserializer>
-  std::pair<uint32, bool> Deserializeresult(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    uint32 result{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer> deserializer__result{parent};
-    deserialization_ok = deserializer__result.PopFront(result) > 0U;
-    return std::make_pair(result, deserialization_ok);
-  }
-
-  uint32 StartDeserialization() {
-    auto ret = Deserializeresult<RootDeserializer>(deserializer_);
-    return ret.first;
-  }
-
- private:
-  RootDeserializer* deserializer_;
-};
-
 void CalculatorInterfaceProxySomeIpMethodManagerSubtract::HandleMethodResponse(
     const ::someip_posix_common::someip::SomeIpMessageHeader& header, RootDeserializerAlias&& deserializer) {
   // Shortening
@@ -178,10 +152,8 @@ void CalculatorInterfaceProxySomeIpMethodManagerSubtract::HandleMethodResponseOk
                                                                                  Promise&& p) {
   proxy::methods::Subtract::Output ret{};
   // Deserialize method return value(s)
-  // Create one deserializer object for argument result
-  DeserializecalculatorInterfaceSubtractresult<typename std::decay<RootDeserializer>::type> arg_result_deserializer{
-      &deserializer};
-  uint32 result = arg_result_deserializer.StartDeserialization();
+  uint32 result{};
+  deserializer.template PopFrontFixed<SubtractResponseLayout>(result);
 
   ret.result = result;
 
@@ -191,6 +163,16 @@ void CalculatorInterfaceProxySomeIpMethodManagerSubtract::HandleMethodResponseOk
 
 /* ---- Method 'add' ------------------------------------------- */
 
+/**
+ * \brief Wire layout of the request payload of method 'add'.
+ */
+using AddRequestLayout = someip_posix_common::someip::serialization::FixedLayout<uint32, uint32>;
+
+/**
+ * \brief Wire layout of the response payload of method 'add'.
+ */
+using AddResponseLayout = someip_posix_common::someip::serialization::FixedLayout<uint32>;
+
 CalculatorInterfaceProxySomeIpMethodManagerAdd::CalculatorInterfaceProxySomeIpMethodManagerAdd(
     CalculatorInterfaceProxySomeIpBinding& proxy_binding)
     : next_session_id_(0U), proxy_binding_(proxy_binding) {}
@@ -234,18 +216,8 @@ ara::com::Future<proxy::methods::Add::Output> CalculatorInterfaceProxySomeIpMeth
       &serializer, header};
 
   // Serialize payload
-  /* ImplementationDataTypeValue serialization for element 'arg1' (/AUTOSAR_Platform/ImplementationDataTypes/uint32) */
-  {
-    marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> serializer_arg1{&serializer};
-    serializer_arg1.PushBack(arg1);
-    serializer_arg1.Close();
-  }
-  /* ImplementationDataTypeValue serialization for element 'arg2' (/AUTOSAR_Platform/ImplementationDataTypes/uint32) */
-  {
-    marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> serializer_arg2{&serializer};
-    serializer_arg2.PushBack(arg2);
-    serializer_arg2.Close();
-  }
+  /* Fixed layout serialization of element(s) 'arg1', 'arg2' */
+  serializer.PushBackFixed<AddRequestLayout>(arg1, arg2);
 
   // Close SOME/IP header serializer, update the SOME/IP length field
   header_serializer.Close();
@@ -264,32 +236,6 @@ ara::com::Future<proxy::methods::Add::Output> CalculatorInterfaceProxySomeIpMeth
   return future;
 }
 
-template <typename RootDeserializer>
-class DeserializecalculatorInterfaceAddresult {
- public:
-  explicit DeserializecalculatorInterfaceAddresult(RootDeserializer* root) : deserializer_{root} {}
-
-  /* ImplementationDataTypeValue deserialization for element 'result' (/AUTOSAR_Platform/ImplementationDataTypes/uint32)
-   */
-  template <typename ParentDeserializer>
-  std::pair<uint32, bool> Deserializeresult(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    uint32 result{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer> deserializer__result{parent};
-    deserialization_ok = deserializer__result.PopFront(result) > 0U;
-    return std::make_pair(result, deserialization_ok);
-  }
-
-  uint32 StartDeserialization() {
-    auto ret = Deserializeresult<RootDeserializer>(deserializer_);
-    return ret.first;
-  }
-
- private:
-  RootDeserializer* deserializer_;
-};
-
 void CalculatorInterfaceProxySomeIpMethodManagerAdd::HandleMethodResponse(
     const ::someip_posix_common::someip::SomeIpMessageHeader& header, RootDeserializerAlias&& deserializer) {
   // Shortening
@@ -333,10 +279,8 @@ void CalculatorInterfaceProxySomeIpMethodManagerAdd::HandleMethodResponseOk(Root
                                                                             Promise&& p) {
   proxy::methods::Add::Output ret{};
   // Deserialize method return value(s)
-  // Create one deserializer object for argument result
-  DeserializecalculatorInterfaceAddresult<typename std::decay<RootDeserializer>::type> arg_result_deserializer{
-      &deserializer};
-  uint32 result = arg_result_deserializer.StartDeserialization();
+  uint32 result{};
+  deserializer.template PopFrontFixed<AddResponseLayout>(result);
 
   ret.result = result;
 
@@ -346,6 +290,16 @@ void CalculatorInterfaceProxySomeIpMethodManagerAdd::HandleMethodResponseOk(Root
 
 /* ---- Method 'divide' ------------------------------------------- */
 
+/**
+ * \brief Wire layout of the request payload of method 'divide'.
+ */
+using DivideRequestLayout = someip_posix_common::someip::serialization::FixedLayout<uint32, uint32>;
+
+/**
+ * \brief Wire layout of the response payload of method 'divide'.
+ */
+using DivideResponseLayout = someip_posix_common::someip::serialization::FixedLayout<uint32>;
+
 CalculatorInterfaceProxySomeIpMethodManagerDivide::CalculatorInterfaceProxySomeIpMethodManagerDivide(
     CalculatorInterfaceProxySomeIpBinding& proxy_binding)
     : next_session_id_(0U), proxy_binding_(proxy_binding) {}
@@ -389,22 +343,8 @@ ara::com::Future<proxy::methods::Divide::Output> CalculatorInterfaceProxySomeIpM
       &serializer, header};
 
   // Serialize payload
-  /* ImplementationDataTypeValue serialization for element 'divident' (/AUTOSAR_Platform/ImplementationDataTypes/uint32)
-   */
-  {
-    marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> serializer_divident{
-        &serializer};
-    serializer_divident.PushBack(divident);
-    serializer_divident.Close();
-  }
-  /* ImplementationDataTypeValue serialization for element 'divisor' (/AUTOSAR_Platform/ImplementationDataTypes/uint32)
-   */
-  {
-    marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> serializer_divisor{
-        &serializer};
-    serializer_divisor.PushBack(divisor);
-    serializer_divisor.Close();
-  }
+  /* Fixed layout serialization of element(s) 'divident', 'divisor' */
+  serializer.PushBackFixed<DivideRequestLayout>(divident, divisor);
 
   // Close SOME/IP header serializer, update the SOME/IP length field
   header_serializer.Close();
@@ -423,32 +363,6 @@ ara::com::Future<proxy::methods::Divide::Output> CalculatorInterfaceProxySomeIpM
   return future;
 }
 
-template <typename RootDeserializer>
-class DeserializecalculatorInterfaceDivideresult {
- public:
-  explicit DeserializecalculatorInterfaceDivideresult(RootDeserializer* root) : deserializer_{root} {}
-
-  /* ImplementationDataTypeValue deserialization for element 'result' (/AUTOSAR_Platform/ImplementationDataTypes/uint32)
-   */
-  template <typename ParentDeserializer>
-  std::pair<uint32, bool> Deserializeresult(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    uint32 result{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer> deserializer__result{parent};
-    deserialization_ok = deserializer__result.PopFront(result) > 0U;
-    return std::make_pair(result, deserialization_ok);
-  }
-
-  uint32 StartDeserialization() {
-    auto ret = Deserializeresult<RootDeserializer>(deserializer_);
-    return ret.first;
-  }
-
- private:
-  RootDeserializer* deserializer_;
-};
-
 void CalculatorInterfaceProxySomeIpMethodManagerDivide::HandleMethodResponse(
     const ::someip_posix_common::someip::SomeIpMessageHeader& header, RootDeserializerAlias&& deserializer) {
   // Shortening
@@ -492,10 +406,8 @@ void CalculatorInterfaceProxySomeIpMethodManagerDivide::HandleMethodResponseOk(R
                                                                                Promise&& p) {
   proxy::methods::Divide::Output ret{};
   // Deserialize method return value(s)
-  // Create one deserializer object for argument result
-  DeserializecalculatorInterfaceDivideresult<typename std::decay<RootDeserializer>::type> arg_result_deserializer{
-      &deserializer};
-  uint32 result = arg_result_deserializer.StartDeserialization();
+  uint32 result{};
+  deserializer.template PopFrontFixed<DivideResponseLayout>(result);
 
   ret.result = result;
 
@@ -505,6 +417,11 @@ void CalculatorInterfaceProxySomeIpMethodManagerDivide::HandleMethodResponseOk(R
 
 /* ---- Field method 'divideResultGet' ------------------------------------------- */
 
+/**
+ * \brief Wire layout of the response payload of field method 'divideResultGet'.
+ */
+using DivideResultGetResponseLayout = someip_posix_common::someip::serialization::FixedLayout<uint32>;
+
 CalculatorInterfaceProxySomeIpFieldManagerDivideResultGet::CalculatorInterfaceProxySomeIpFieldManagerDivideResultGet(
     CalculatorInterfaceProxySomeIpBinding& proxy_binding)
     : next_session_id_(0U), proxy_binding_(proxy_binding) {}
@@ -567,33 +484,6 @@ CalculatorInterfaceProxySomeIpFieldManagerDivideResultGet::HandleMethodRequest()
   return future;
 }
 
-template <typename RootDeserializer>
-class DeserializecalculatorInterfaceDivideResultGetout_val {
- public:
-  explicit DeserializecalculatorInterfaceDivideResultGetout_val(RootDeserializer* root) : deserializer_{root} {}
-
-  /* ImplementationDataTypeValue deserialization for element 'out_val'
-   * (/AUTOSAR_Platform/ImplementationDataTypes/uint32) */
-  template <typename ParentDeserializer>
-  std::pair<uint32, bool> Deserializeout_val(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    uint32 out_val{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer> deserializer__out_val{
-        parent};
-    deserialization_ok = deserializer__out_val.PopFront(out_val) > 0U;
-    return std::make_pair(out_val, deserialization_ok);
-  }
-
-  uint32 StartDeserialization() {
-    auto ret = Deserializeout_val<RootDeserializer>(deserializer_);
-    return ret.first;
-  }
-
- private:
-  RootDeserializer* deserializer_;
-};
-
 void CalculatorInterfaceProxySomeIpFieldManagerDivideResultGet::HandleMethodResponse(
     const ::someip_posix_common::someip::SomeIpMessageHeader& header, RootDeserializerAlias&& deserializer) {
   // Shortening
@@ -637,10 +527,8 @@ void CalculatorInterfaceProxySomeIpFieldManagerDivideResultGet::HandleMethodResp
                                                                                        Promise&& p) {
   proxy::fields::DivideResult::Output ret{};
   // Deserialize method return value(s)
-  // Create one deserializer object for argument out_val
-  DeserializecalculatorInterfaceDivideResultGetout_val<typename std::decay<RootDeserializer>::type>
-      arg_out_val_deserializer{&deserializer};
-  uint32 out_val = arg_out_val_deserializer.StartDeserialization();
+  uint32 out_val{};
+  deserializer.template PopFrontFixed<DivideResultGetResponseLayout>(out_val);
 
   ret = out_val;
 
@@ -650,6 +538,16 @@ void CalculatorInterfaceProxySomeIpFieldManagerDivideResultGet::HandleMethodResp
 
 /* ---- Field method 'divideResultSet' ------------------------------------------- */
 
+/**
+ * \brief Wire layout of the request payload of field method 'divideResultSet'.
+ */
+using DivideResultSetRequestLayout = someip_posix_common::someip::serialization::FixedLayout<uint32>;
+
+/**
+ * \brief Wire layout of the response payload of field method 'divideResultSet'.
+ */
+using DivideResultSetResponseLayout = someip_posix_common::someip::serialization::FixedLayout<uint32>;
+
 CalculatorInterfaceProxySomeIpFieldManagerDivideResultSet::CalculatorInterfaceProxySomeIpFieldManagerDivideResultSet(
     CalculatorInterfaceProxySomeIpBinding& proxy_binding)
     : next_session_id_(0U), proxy_binding_(proxy_binding) {}
@@ -694,14 +592,8 @@ CalculatorInterfaceProxySomeIpFieldManagerDivideResultSet::HandleMethodRequest(
       &serializer, header};
 
   // Serialize payload
-  /* ImplementationDataTypeValue serialization for element 'in_val' (/AUTOSAR_Platform/ImplementationDataTypes/uint32)
-   */
-  {
-    marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> serializer_in_val{
-        &serializer};
-    serializer_in_val.PushBack(in_val);
-    serializer_in_val.Close();
-  }
+  /* Fixed layout serialization of element(s) 'in_val' */
+  serializer.PushBackFixed<DivideResultSetRequestLayout>(in_val);
 
   // Close SOME/IP header serializer, update the SOME/IP length field
   header_serializer.Close();
@@ -720,33 +612,6 @@ CalculatorInterfaceProxySomeIpFieldManagerDivideResultSet::HandleMethodRequest(
   return future;
 }
 
-template <typename RootDeserializer>
-class DeserializecalculatorInterfaceDivideResultSetout_val {
- public:
-  explicit DeserializecalculatorInterfaceDivideResultSetout_val(RootDeserializer* root) : deserializer_{root} {}
-
-  /* ImplementationDataTypeValue deserialization for element 'out_val'
-   * (/AUTOSAR_Platform/ImplementationDataTypes/uint32) */
-  template <typename ParentDeserializer>
-  std::pair<uint32, bool> Deserializeout_val(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    uint32 out_val{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer> deserializer__out_val{
-        parent};
-    deserialization_ok = deserializer__out_val.PopFront(out_val) > 0U;
-    return std::make_pair(out_val, deserialization_ok);
-  }
-
-  uint32 StartDeserialization() {
-    auto ret = Deserializeout_val<RootDeserializer>(deserializer_);
-    return ret.first;
-  }
-
- private:
-  RootDeserializer* deserializer_;
-};
-
 void CalculatorInterfaceProxySomeIpFieldManagerDivideResultSet::HandleMethodResponse(
     const ::someip_posix_common::someip::SomeIpMessageHeader& header, RootDeserializerAlias&& deserializer) {
   // Shortening
@@ -790,10 +655,8 @@ void CalculatorInterfaceProxySomeIpFieldManagerDivideResultSet::HandleMethodResp
                                                                                        Promise&& p) {
   proxy::fields::DivideResult::Output ret{};
   // Deserialize method return value(s)
-  // Create one deserializer object for argument out_val
-  DeserializecalculatorInterfaceDivideResultSetout_val<typename std::decay<RootDeserializer>::type>
-      arg_out_val_deserializer{&deserializer};
-  uint32 out_val = arg_out_val_deserializer.StartDeserialization();
+  uint32 out_val{};
+  deserializer.template PopFrontFixed<DivideResultSetResponseLayout>(out_val);
 
   ret = out_val;
 
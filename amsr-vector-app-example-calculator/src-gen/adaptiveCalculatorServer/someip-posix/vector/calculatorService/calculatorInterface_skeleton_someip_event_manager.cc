@@ -31,10 +31,15 @@ namespace calculatorService {
 
 /* ---- Event 'divisionByZero' ------------------------------------------- */
 
+/**
+ * \brief Wire layout of the sample of event 'divisionByZero'.
+ */
+using DivisionByZeroSampleLayout = someip_posix_common::someip::serialization::FixedLayout<boolean>;
+
 CalculatorInterfaceSkeletonSomeIpEventManagerDivisionByZero::
     CalculatorInterfaceSkeletonSomeIpEventManagerDivisionByZero(
         CalculatorInterfaceSkeletonSomeIpBinding& skeleton_binding)
-    : skeleton_binding_(skeleton_binding) {}
+    : skeleton_binding_(skeleton_binding), packet_size_hint_(0U) {}
 
 void CalculatorInterfaceSkeletonSomeIpEventManagerDivisionByZero::Send(const vector::calculatorService::boolean& data) {
   // Shortening
@@ -52,8 +57,12 @@ void CalculatorInterfaceSkeletonSomeIpEventManagerDivisionByZero::Send(const vec
   header.return_code_ = someip_posix_common::someip::SomeIpReturnCode::kOk;
   header.length_ = 0U;  // We cannot set the correct length yet
 
-  // Create packet and serialize the header
-  ::someip_posix_common::someip::SomeIpPacket buffer{new ::someip_posix_common::someip::PacketBuffer};
+  // Take the wire buffer from the pool with the capacity of the last notification, so the sample is serialized in place
+  // without growing the buffer.
+  ::someip_posix_common::someip::SomeIpPacket buffer{
+      ::someip_posix_common::someip::PacketBufferPool::GetInstance().AcquirePtr(
+          packet_size_hint_.load(std::memory_order_relaxed))};
+  buffer->clear();
 
   // Create root serializer
   marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy> serializer{std::move(buffer)};
@@ -63,27 +72,29 @@ void CalculatorInterfaceSkeletonSomeIpEventManagerDivisionByZero::Send(const vec
       &serializer, header};
 
   // Serialize payload
-  /* ImplementationDataTypeValue serialization for element 'data' (/AUTOSAR_Platform/ImplementationDataTypes/boolean) */
-  {
-    marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> serializer_data{&serializer};
-    serializer_data.PushBack(data);
-    serializer_data.Close();
-  }
+  /* Fixed layout serialization of element(s) 'data' */
+  serializer.PushBackFixed<DivisionByZeroSampleLayout>(data);
 
   // Close SOME/IP header serializer, update the SOME/IP length field
   header_serializer.Close();
 
   // Transfer back the ownership
   buffer = serializer.Close();
+  packet_size_hint_.store(buffer->size(), std::memory_order_relaxed);
 
   // Send packet to the SkeletonBinding, which forwards the packet together with the instance id to AraComSomeIpBinding.
   skeleton_binding_.SendEventNotification(std::move(buffer));
 }
 /* ---- Field notifier 'divideResult' ------------------------------------------- */
 
+/**
+ * \brief Wire layout of the sample of field notifier 'divideResult'.
+ */
+using DivideResultSampleLayout = someip_posix_common::someip::serialization::FixedLayout<uint32>;
+
 CalculatorInterfaceSkeletonSomeIpFieldNotifierDivideResult::CalculatorInterfaceSkeletonSomeIpFieldNotifierDivideResult(
     CalculatorInterfaceSkeletonSomeIpBinding& skeleton_binding)
-    : skeleton_binding_(skeleton_binding) {}
+    : skeleton_binding_(skeleton_binding), packet_size_hint_(0U) {}
 
 void CalculatorInterfaceSkeletonSomeIpFieldNotifierDivideResult::Send(const vector::calculatorService::uint32& data) {
   // Shortening
@@ -101,8 +112,12 @@ void CalculatorInterfaceSkeletonSomeIpFieldNotifierDivideResult::Send(const vect
   header.return_code_ = someip_posix_common::someip::SomeIpReturnCode::kOk;
   header.length_ = 0U;  // We cannot set the correct length yet
 
-  // Create packet and serialize the header
-  ::someip_posix_common::someip::SomeIpPacket buffer{new ::someip_posix_common::someip::PacketBuffer};
+  // Take the wire buffer from the pool with the capacity of the last notification, so the sample is serialized in place
+  // without growing the buffer.
+  ::someip_posix_common::someip::SomeIpPacket buffer{
+      ::someip_posix_common::someip::PacketBufferPool::GetInstance().AcquirePtr(
+          packet_size_hint_.load(std::memory_order_relaxed))};
+  buffer->clear();
 
   // Create root serializer
   marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy> serializer{std::move(buffer)};
@@ -112,18 +127,15 @@ void CalculatorInterfaceSkeletonSomeIpFieldNotifierDivideResult::Send(const vect
       &serializer, header};
 
   // Serialize payload
-  /* ImplementationDataTypeValue serialization for element 'data' (/AUTOSAR_Platform/ImplementationDataTypes/uint32) */
-  {
-    marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> serializer_data{&serializer};
-    serializer_data.PushBack(data);
-    serializer_data.Close();
-  }
+  /* Fixed layout serialization of element(s) 'data' */
+  serializer.PushBackFixed<DivideResultSampleLayout>(data);
 
   // Close SOME/IP header serializer, update the SOME/IP length field
   header_serializer.Close();
 
   // Transfer back the ownership
   buffer = serializer.Close();
+  packet_size_hint_.store(buffer->size(), std::memory_order_relaxed);
 
   // Send packet to the SkeletonBinding, which forwards the packet together with the instance id to AraComSomeIpBinding.
   skeleton_binding_.SendEventNotification(std::move(buffer));
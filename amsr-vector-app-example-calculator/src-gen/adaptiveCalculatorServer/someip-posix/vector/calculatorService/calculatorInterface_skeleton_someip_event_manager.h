@@ -24,6 +24,8 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <atomic>
+#include <cstddef>
 #include "ara-someip-posix/e2e_marshalling.h"
 #include "someip-posix-common/someip/marshalling.h"
 #include "vector/calculatorService/calculatorInterface.h"
@@ -60,6 +62,9 @@ class CalculatorInterfaceSkeletonSomeIpEventManagerDivisionByZero {
  private:
   /** Skeleton binding for event transmission */
   CalculatorInterfaceSkeletonSomeIpBinding& skeleton_binding_;
+
+  /** Size of the last serialized notification, used to take a large enough wire buffer from the pool */
+  std::atomic<std::size_t> packet_size_hint_;
 };
 
 /* ---- Field notifier 'divideResult' ------------------------------------------- */
@@ -88,6 +93,9 @@ class CalculatorInterfaceSkeletonSomeIpFieldNotifierDivideResult {
  private:
   /** Skeleton binding for event transmission */
   CalculatorInterfaceSkeletonSomeIpBinding& skeleton_binding_;
+
+  /** Size of the last serialized notification, used to take a large enough wire buffer from the pool */
+  std::atomic<std::size_t> packet_size_hint_;
 };
 
 }  // namespace calculatorService
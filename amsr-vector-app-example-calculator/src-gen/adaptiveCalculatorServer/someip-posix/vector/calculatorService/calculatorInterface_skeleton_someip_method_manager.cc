@@ -33,56 +33,16 @@ namespace vector {
 namespace calculatorService {
 
 /* ---- Method 'subtract' ------------------------------------------- */
-template <typename RootDeserializer>
-class DeserializecalculatorInterfaceSubtractarg1 {
- public:
-  explicit DeserializecalculatorInterfaceSubtractarg1(RootDeserializer* root) : deserializer_{root} {}
-
-  /* ImplementationDataTypeValue deserialization for element 'arg1' (/AUTOSAR_Platform/ImplementationDataTypes/uint32)
-   */
-  template <typename ParentDeserializer>
-  std::pair<uint32, bool> Deserializearg1(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    uint32 arg1{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer> deserializer__arg1{parent};
-    deserialization_ok = deserializer__arg1.PopFront(arg1) > 0U;
-    return std::make_pair(arg1, deserialization_ok);
-  }
-
-  uint32 StartDeserialization() {
-    auto ret = Deserializearg1<RootDeserializer>(deserializer_);
-    return ret.first;
-  }
-
- private:
-  RootDeserializer* deserializer_;
-};
-template <typename RootDeserializer>
-class DeserializecalculatorInterfaceSubtractarg2 {
- public:
-  explicit DeserializecalculatorInterfaceSubtractarg2(RootDeserializer* root) : deserializer_{root} {}
-
-  /* ImplementationDataTypeValue deserialization for element 'arg2' (/AUTOSAR_Platform/ImplementationDataTypes/uint32)
-   */
-  template <typename ParentDeserializer>
-  std::pair<uint32, bool> Deserializearg2(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    uint32 arg2{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer> deserializer__arg2{parent};
-    deserialization_ok = deserializer__arg2.PopFront(arg2) > 0U;
-    return std::make_pair(arg2, deserialization_ok);
-  }
 
-  uint32 StartDeserialization() {
-    auto ret = Deserializearg2<RootDeserializer>(deserializer_);
-    return ret.first;
-  }
+/**
+ * \brief Wire layout of the request payload of method 'subtract'.
+ */
+using SubtractRequestLayout = someip_posix_common::someip::serialization::FixedLayout<uint32, uint32>;
 
- private:
-  RootDeserializer* deserializer_;
-};
+/**
+ * \brief Wire layout of the response payload of method 'subtract'.
+ */
+using SubtractResponseLayout = someip_posix_common::someip::serialization::FixedLayout<uint32>;
 
 /**
  * \brief This functor is given to the frontend. Any functor (generic part) can
@@ -182,14 +142,9 @@ void CalculatorInterfaceSkeletonSomeIpMethodManagerSubtract::HandleMethodRequest
     namespace marshaller = someip_posix_common::someip::serialization;
 
     // Deserialize the method parameter(s) from payload
-    // Create one deserializer object for argument arg1
-    DeserializecalculatorInterfaceSubtractarg1<typename std::decay<decltype(deserializer)>::type> arg_arg1_deserializer{
-        &deserializer};
-    uint32 arg1 = arg_arg1_deserializer.StartDeserialization();
-    // Create one deserializer object for argument arg2
-    DeserializecalculatorInterfaceSubtractarg2<typename std::decay<decltype(deserializer)>::type> arg_arg2_deserializer{
-        &deserializer};
-    uint32 arg2 = arg_arg2_deserializer.StartDeserialization();
+    uint32 arg1{};
+    uint32 arg2{};
+    deserializer.PopFrontFixed<SubtractRequestLayout>(arg1, arg2);
 
     // Get the header to save it in the functor; this is needed, because on the return path session ID and client
     // ID must match with the given info from the request.
@@ -228,14 +183,8 @@ void CalculatorInterfaceSkeletonSomeIpMethodManagerSubtract::SendMethodResponse(
   marshaller::SomeIpHeaderSerializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> header_serializer{
       &serializer, header_response};
   // Serialize return value(s) of skeleton method call
-  /* ImplementationDataTypeValue serialization for element 'result' (/AUTOSAR_Platform/ImplementationDataTypes/uint32)
-   */
-  {
-    marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> serializer_result{
-        &serializer};
-    serializer_result.PushBack(out_val.result);
-    serializer_result.Close();
-  }
+  /* Fixed layout serialization of element(s) 'result' */
+  serializer.PushBackFixed<SubtractResponseLayout>(out_val.result);
 
   // Will fill in the length field of the payload serialized.
   header_serializer.Close();
@@ -248,56 +197,16 @@ void CalculatorInterfaceSkeletonSomeIpMethodManagerSubtract::SendMethodResponse(
 }
 
 /* ---- Method 'add' ------------------------------------------- */
-template <typename RootDeserializer>
-class DeserializecalculatorInterfaceAddarg1 {
- public:
-  explicit DeserializecalculatorInterfaceAddarg1(RootDeserializer* root) : deserializer_{root} {}
-
-  /* ImplementationDataTypeValue deserialization for element 'arg1' (/AUTOSAR_Platform/ImplementationDataTypes/uint32)
-   */
-  template <typename ParentDeserializer>
-  std::pair<uint32, bool> Deserializearg1(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    uint32 arg1{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer> deserializer__arg1{parent};
-    deserialization_ok = deserializer__arg1.PopFront(arg1) > 0U;
-    return std::make_pair(arg1, deserialization_ok);
-  }
-
-  uint32 StartDeserialization() {
-    auto ret = Deserializearg1<RootDeserializer>(deserializer_);
-    return ret.first;
-  }
-
- private:
-  RootDeserializer* deserializer_;
-};
-template <typename RootDeserializer>
-class DeserializecalculatorInterfaceAddarg2 {
- public:
-  explicit DeserializecalculatorInterfaceAddarg2(RootDeserializer* root) : deserializer_{root} {}
 
-  /* ImplementationDataTypeValue deserialization for element 'arg2' (/AUTOSAR_Platform/ImplementationDataTypes/uint32)
-   */
-  template <typename ParentDeserializer>
-  std::pair<uint32, bool> Deserializearg2(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    uint32 arg2{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer> deserializer__arg2{parent};
-    deserialization_ok = deserializer__arg2.PopFront(arg2) > 0U;
-    return std::make_pair(arg2, deserialization_ok);
-  }
-
-  uint32 StartDeserialization() {
-    auto ret = Deserializearg2<RootDeserializer>(deserializer_);
-    return ret.first;
-  }
+/**
+ * \brief Wire layout of the request payload of method 'add'.
+ */
+using AddRequestLayout = someip_posix_common::someip::serialization::FixedLayout<uint32, uint32>;
 
- private:
-  RootDeserializer* deserializer_;
-};
+/**
+ * \brief Wire layout of the response payload of method 'add'.
+ */
+using AddResponseLayout = someip_posix_common::someip::serialization::FixedLayout<uint32>;
 
 /**
  * \brief This functor is given to the frontend. Any functor (generic part) can
@@ -397,14 +306,9 @@ void CalculatorInterfaceSkeletonSomeIpMethodManagerAdd::HandleMethodRequest(
     namespace marshaller = someip_posix_common::someip::serialization;
 
     // Deserialize the method parameter(s) from payload
-    // Create one deserializer object for argument arg1
-    DeserializecalculatorInterfaceAddarg1<typename std::decay<decltype(deserializer)>::type> arg_arg1_deserializer{
-        &deserializer};
-    uint32 arg1 = arg_arg1_deserializer.StartDeserialization();
-    // Create one deserializer object for argument arg2
-    DeserializecalculatorInterfaceAddarg2<typename std::decay<decltype(deserializer)>::type> arg_arg2_deserializer{
-        &deserializer};
-    uint32 arg2 = arg_arg2_deserializer.StartDeserialization();
+    uint32 arg1{};
+    uint32 arg2{};
+    deserializer.PopFrontFixed<AddRequestLayout>(arg1, arg2);
 
     // Get the header to save it in the functor; this is needed, because on the return path session ID and client
     // ID must match with the given info from the request.
@@ -443,14 +347,8 @@ void CalculatorInterfaceSkeletonSomeIpMethodManagerAdd::SendMethodResponse(
   marshaller::SomeIpHeaderSerializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> header_serializer{
       &serializer, header_response};
   // Serialize return value(s) of skeleton method call
-  /* ImplementationDataTypeValue serialization for element 'result' (/AUTOSAR_Platform/ImplementationDataTypes/uint32)
-   */
-  {
-    marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> serializer_result{
-        &serializer};
-    serializer_result.PushBack(out_val.result);
-    serializer_result.Close();
-  }
+  /* Fixed layout serialization of element(s) 'result' */
+  serializer.PushBackFixed<AddResponseLayout>(out_val.result);
 
   // Will fill in the length field of the payload serialized.
   header_serializer.Close();
@@ -463,58 +361,16 @@ void CalculatorInterfaceSkeletonSomeIpMethodManagerAdd::SendMethodResponse(
 }
 
 /* ---- Method 'divide' ------------------------------------------- */
-template <typename RootDeserializer>
-class DeserializecalculatorInterfaceDividedivident {
- public:
-  explicit DeserializecalculatorInterfaceDividedivident(RootDeserializer* root) : deserializer_{root} {}
-
-  /* ImplementationDataTypeValue deserialization for element 'divident'
-   * (/AUTOSAR_Platform/ImplementationDataTypes/uint32) */
-  template <typename ParentDeserializer>
-  std::pair<uint32, bool> Deserializedivident(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    uint32 divident{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer> deserializer__divident{
-        parent};
-    deserialization_ok = deserializer__divident.PopFront(divident) > 0U;
-    return std::make_pair(divident, deserialization_ok);
-  }
-
-  uint32 StartDeserialization() {
-    auto ret = Deserializedivident<RootDeserializer>(deserializer_);
-    return ret.first;
-  }
-
- private:
-  RootDeserializer* deserializer_;
-};
-template <typename RootDeserializer>
-class DeserializecalculatorInterfaceDividedivisor {
- public:
-  explicit DeserializecalculatorInterfaceDividedivisor(RootDeserializer* root) : deserializer_{root} {}
 
-  /* ImplementationDataTypeValue deserialization for element 'divisor'
-   * (/AUTOSAR_Platform/ImplementationDataTypes/uint32) */
-  template <typename ParentDeserializer>
-  std::pair<uint32, bool> Deserializedivisor(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    uint32 divisor{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer> deserializer__divisor{
-        parent};
-    deserialization_ok = deserializer__divisor.PopFront(divisor) > 0U;
-    return std::make_pair(divisor, deserialization_ok);
-  }
-
-  uint32 StartDeserialization() {
-    auto ret = Deserializedivisor<RootDeserializer>(deserializer_);
-    return ret.first;
-  }
+/**
+ * \brief Wire layout of the request payload of method 'divide'.
+ */
+using DivideRequestLayout = someip_posix_common::someip::serialization::FixedLayout<uint32, uint32>;
 
- private:
-  RootDeserializer* deserializer_;
-};
+/**
+ * \brief Wire layout of the response payload of method 'divide'.
+ */
+using DivideResponseLayout = someip_posix_common::someip::serialization::FixedLayout<uint32>;
 
 /**
  * \brief This functor is given to the frontend. Any functor (generic part) can
@@ -614,14 +470,9 @@ void CalculatorInterfaceSkeletonSomeIpMethodManagerDivide::HandleMethodRequest(
     namespace marshaller = someip_posix_common::someip::serialization;
 
     // Deserialize the method parameter(s) from payload
-    // Create one deserializer object for argument divident
-    DeserializecalculatorInterfaceDividedivident<typename std::decay<decltype(deserializer)>::type>
-        arg_divident_deserializer{&deserializer};
-    uint32 divident = arg_divident_deserializer.StartDeserialization();
-    // Create one deserializer object for argument divisor
-    DeserializecalculatorInterfaceDividedivisor<typename std::decay<decltype(deserializer)>::type>
-        arg_divisor_deserializer{&deserializer};
-    uint32 divisor = arg_divisor_deserializer.StartDeserialization();
+    uint32 divident{};
+    uint32 divisor{};
+    deserializer.PopFrontFixed<DivideRequestLayout>(divident, divisor);
 
     // Get the header to save it in the functor; this is needed, because on the return path session ID and client
     // ID must match with the given info from the request.
@@ -660,14 +511,8 @@ void CalculatorInterfaceSkeletonSomeIpMethodManagerDivide::SendMethodResponse(
   marshaller::SomeIpHeaderSerializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> header_serializer{
       &serializer, header_response};
   // Serialize return value(s) of skeleton method call
-  /* ImplementationDataTypeValue serialization for element 'result' (/AUTOSAR_Platform/ImplementationDataTypes/uint32)
-   */
-  {
-    marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> serializer_result{
-        &serializer};
-    serializer_result.PushBack(out_val.result);
-    serializer_result.Close();
-  }
+  /* Fixed layout serialization of element(s) 'result' */
+  serializer.PushBackFixed<DivideResponseLayout>(out_val.result);
 
   // Will fill in the length field of the payload serialized.
   header_serializer.Close();
@@ -681,6 +526,11 @@ void CalculatorInterfaceSkeletonSomeIpMethodManagerDivide::SendMethodResponse(
 
 /* ---- Field method 'divideResultGet' ------------------------------------------- */
 
+/**
+ * \brief Wire layout of the response payload of field method 'divideResultGet'.
+ */
+using DivideResultGetResponseLayout = someip_posix_common::someip::serialization::FixedLayout<uint32>;
+
 /**
  * \brief This functor is given to the frontend. Any functor (generic part) can
  * then be stored.
@@ -804,14 +654,8 @@ void CalculatorInterfaceSkeletonSomeIpFieldManagerDivideResultGet::SendMethodRes
   marshaller::SomeIpHeaderSerializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> header_serializer{
       &serializer, header_response};
   // Serialize return value(s) of skeleton method call
-  /* ImplementationDataTypeValue serialization for element 'out_val' (/AUTOSAR_Platform/ImplementationDataTypes/uint32)
-   */
-  {
-    marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> serializer_out_val{
-        &serializer};
-    serializer_out_val.PushBack(out_val);
-    serializer_out_val.Close();
-  }
+  /* Fixed layout serialization of element(s) 'out_val' */
+  serializer.PushBackFixed<DivideResultGetResponseLayout>(out_val);
 
   // Will fill in the length field of the payload serialized.
   header_serializer.Close();
@@ -824,31 +668,16 @@ void CalculatorInterfaceSkeletonSomeIpFieldManagerDivideResultGet::SendMethodRes
 }
 
 /* ---- Field method 'divideResultSet' ------------------------------------------- */
-template <typename RootDeserializer>
-class DeserializecalculatorInterfaceDivideResultSetin_val {
- public:
-  explicit DeserializecalculatorInterfaceDivideResultSetin_val(RootDeserializer* root) : deserializer_{root} {}
 
-  /* ImplementationDataTypeValue deserialization for element 'in_val' (/AUTOSAR_Platform/ImplementationDataTypes/uint32)
-   */
-  template <typename ParentDeserializer>
-  std::pair<uint32, bool> Deserializein_val(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    uint32 in_val{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer> deserializer__in_val{parent};
-    deserialization_ok = deserializer__in_val.PopFront(in_val) > 0U;
-    return std::make_pair(in_val, deserialization_ok);
-  }
-
-  uint32 StartDeserialization() {
-    auto ret = Deserializein_val<RootDeserializer>(deserializer_);
-    return ret.first;
-  }
+/**
+ * \brief Wire layout of the request payload of field method 'divideResultSet'.
+ */
+using DivideResultSetRequestLayout = someip_posix_common::someip::serialization::FixedLayout<uint32>;
 
- private:
-  RootDeserializer* deserializer_;
-};
+/**
+ * \brief Wire layout of the response payload of field method 'divideResultSet'.
+ */
+using DivideResultSetResponseLayout = someip_posix_common::someip::serialization::FixedLayout<uint32>;
 
 /**
  * \brief This functor is given to the frontend. Any functor (generic part) can
@@ -941,10 +770,8 @@ void CalculatorInterfaceSkeletonSomeIpFieldManagerDivideResultSet::HandleMethodR
     namespace marshaller = someip_posix_common::someip::serialization;
 
     // Deserialize the method parameter(s) from payload
-    // Create one deserializer object for argument in_val
-    DeserializecalculatorInterfaceDivideResultSetin_val<typename std::decay<decltype(deserializer)>::type>
-        arg_in_val_deserializer{&deserializer};
-    uint32 in_val = arg_in_val_deserializer.StartDeserialization();
+    uint32 in_val{};
+    deserializer.PopFrontFixed<DivideResultSetRequestLayout>(in_val);
 
     // Get the header to save it in the functor; this is needed, because on the return path session ID and client
     // ID must match with the given info from the request.
@@ -984,14 +811,8 @@ void CalculatorInterfaceSkeletonSomeIpFieldManagerDivideResultSet::SendMethodRes
   marshaller::SomeIpHeaderSerializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> header_serializer{
       &serializer, header_response};
   // Serialize return value(s) of skeleton method call
-  /* ImplementationDataTypeValue serialization for element 'out_val' (/AUTOSAR_Platform/ImplementationDataTypes/uint32)
-   */
-  {
-    marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer)> serializer_out_val{
-        &serializer};
-    serializer_out_val.PushBack(out_val);
-    serializer_out_val.Close();
-  }
+  /* Fixed layout serialization of element(s) 'out_val' */
+  serializer.PushBackFixed<DivideResultSetResponseLayout>(out_val);
 
   // Will fill in the length field of the payload serialized.
   header_serializer.Close();
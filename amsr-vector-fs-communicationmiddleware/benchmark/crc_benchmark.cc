@@ -0,0 +1,136 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  crc_benchmark.cc
+ *        \brief  Compares the CRC engines of ara::crc::Crc with the byte-wise table look-up.
+ *
+ *      \details  For payload sizes from 8 B to 64 KiB the benchmark measures the throughput of CRC32 (Profile 04) and
+ *                CRC64 (Profile 07) and checks that both implementations calculate the same CRC.
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "ara/crc/crc.h"
+
+namespace {
+
+using ara::crc::Crc;
+
+/**
+ * \brief Number of bytes processed per measurement, independent of the payload size.
+ */
+constexpr std::size_t kBytesPerRun = 64U * 1024U * 1024U;
+
+/**
+ * \brief Byte-wise table driven reflected CRC, as used before the slicing and folding engines were introduced.
+ */
+template <typename CrcType>
+class ByteWiseCrc {
+ public:
+  /**
+   * \brief Constructor.
+   * \param reflected_polynomial The polynomial in reflected bit order.
+   */
+  explicit ByteWiseCrc(CrcType reflected_polynomial) : table_() {
+    for (std::size_t index = 0U; index < table_.size(); ++index) {
+      CrcType crc = static_cast<CrcType>(index);
+      for (std::size_t bit = 0U; bit < 8U; ++bit) {
+        crc = ((crc & 1U) != 0U) ? static_cast<CrcType>((crc >> 1U) ^ reflected_polynomial) : (crc >> 1U);
+      }
+      table_[index] = crc;
+    }
+  }
+
+  /**
+   * \brief Calculate the CRC with initial value and final XOR value of all ones.
+   */
+  CrcType Calculate(const std::uint8_t* data, std::size_t length) const {
+    CrcType crc = static_cast<CrcType>(~CrcType{0U});
+    for (std::size_t i = 0U; i < length; ++i) {
+      crc = table_[static_cast<std::uint8_t>(data[i] ^ crc)] ^ static_cast<CrcType>(crc >> 8U);
+    }
+    return static_cast<CrcType>(~crc);
+  }
+
+ private:
+  std::array<CrcType, 256U> table_;
+};
+
+/**
+ * \brief Measure the throughput of a CRC function in MiB/s.
+ *
+ * \param checksum Receives the CRC of the last run so it is not optimized away.
+ */
+template <typename CrcType, typename Function>
+double MeasureMiBPerSecond(const std::vector<std::uint8_t>& payload, Function calculate, CrcType& checksum) {
+  const std::size_t runs = kBytesPerRun / payload.size();
+  CrcType result{0U};
+  const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+  for (std::size_t run = 0U; run < runs; ++run) {
+    result ^= calculate(payload.data(), payload.size());
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+  checksum = result;
+  return (static_cast<double>(runs * payload.size()) / (1024.0 * 1024.0)) / elapsed.count();
+}
+
+/**
+ * \brief Benchmark one polynomial for one payload size and report mismatching results.
+ */
+template <typename CrcType, typename Function>
+bool Compare(const char* name, const std::vector<std::uint8_t>& payload, const ByteWiseCrc<CrcType>& reference,
+             Function engine) {
+  CrcType reference_checksum{0U};
+  CrcType engine_checksum{0U};
+  const double reference_speed = MeasureMiBPerSecond(
+      payload, [&reference](const std::uint8_t* data, std::size_t length) { return reference.Calculate(data, length); },
+      reference_checksum);
+  const double engine_speed = MeasureMiBPerSecond(payload, engine, engine_checksum);
+  const bool equal = reference_checksum == engine_checksum;
+  std::printf("%-6s %8zu %14.1f %14.1f %8.1fx %s\n", name, payload.size(), reference_speed, engine_speed,
+              engine_speed / reference_speed, equal ? "" : "MISMATCH");
+  return equal;
+}
+
+}  // namespace
+
+int main() {
+  const ByteWiseCrc<std::uint32_t> reference_crc32{0xC8DF352FU};
+  const ByteWiseCrc<std::uint64_t> reference_crc64{0xC96C5795D7870F42ULL};
+  std::mt19937 random(42);
+  bool all_equal = true;
+
+  std::printf("%-6s %8s %14s %14s %9s\n", "crc", "bytes", "byte [MiB/s]", "engine [MiB/s]", "speedup");
+  for (std::size_t size = 8U; size <= 64U * 1024U; size *= 2U) {
+    std::vector<std::uint8_t> payload(size);
+    for (std::uint8_t& byte : payload) {
+      byte = static_cast<std::uint8_t>(random());
+    }
+    all_equal &= Compare("crc32", payload, reference_crc32, [](const std::uint8_t* data, std::size_t length) {
+      return Crc::CalculateCRC32P04(Crc::BufferView(data, length), Crc::kInitialValueCRC32P04);
+    });
+    all_equal &= Compare("crc64", payload, reference_crc64, [](const std::uint8_t* data, std::size_t length) {
+      return Crc::CalculateCRC64P07(Crc::BufferView(data, length), Crc::kInitialValueCRC64);
+    });
+  }
+  return all_equal ? 0 : 1;
+}
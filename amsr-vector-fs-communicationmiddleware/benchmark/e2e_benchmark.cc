@@ -0,0 +1,135 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  e2e_benchmark.cc
+ *        \brief  Compares serializing and E2E protecting a payload in one pass with protecting it afterwards.
+ *
+ *      \details  For payload sizes from 1 KiB to 16 MiB the benchmark serializes a byte array with a length field and
+ *                protects it with E2E Profile 07. The two-pass variant serializes the payload and calculates the CRC
+ *                over the serialized buffer afterwards. The fused variant calculates the CRC while serializing and
+ *                only patches the E2E header on close. The benchmark checks that both produce the same bytes.
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "ara-someip-posix/e2e_marshalling.h"
+#include "ara/e2e/e2exf/transformer.h"
+#include "someip-posix-common/someip/marshalling.h"
+
+namespace {
+
+namespace serialization = someip_posix_common::someip::serialization;
+
+/**
+ * \brief Transformer protecting with Profile 07. The E2E header starts at the beginning of the protected data.
+ */
+using Protector = ara::e2e::e2exf::Transformer<ara::e2e::e2exf::E2ExfConfiguration<
+    ara::e2e::profiles::Profile07Protector, ara::e2e::End2EndEventProtectionProps<0x0815U>>>;
+
+/**
+ * \brief Serialization configuration of the payload: big endian with a 32 bit length field.
+ */
+using PayloadConfig = serialization::BEPayloadUint32LengthFieldPolicy;
+
+/**
+ * \brief Serialization configuration of the root and the E2E header.
+ */
+using RootConfig = serialization::BEPayloadNoLengthFieldPolicy;
+
+/**
+ * \brief Number of bytes protected per measurement, independent of the payload size.
+ */
+constexpr std::size_t kBytesPerRun = 256U * 1024U * 1024U;
+
+/**
+ * \brief Serialize the payload behind the E2E header, then protect the serialized buffer.
+ */
+serialization::PacketBuffer SerializeThenProtect(Protector& protector, const std::vector<std::uint8_t>& payload) {
+  serialization::Serializer<RootConfig> root;
+  root.Extend(protector.GetHeaderSize());
+  {
+    serialization::ComplexDataTypeSerializer<PayloadConfig, serialization::Serializer<RootConfig>> array{&root};
+    array.PushBackRange(payload);
+    array.Close();
+  }
+  protector.Protect(root.GetBuffer());
+  return *root.Close();
+}
+
+/**
+ * \brief Calculate the CRC while serializing the payload and only patch the E2E header on close.
+ */
+serialization::PacketBuffer SerializeAndProtect(Protector& protector, const std::vector<std::uint8_t>& payload) {
+  using RootSerializer = serialization::Serializer<RootConfig>;
+  RootSerializer root;
+  {
+    ara::com::someip_posix::E2EHeaderSerializer<Protector, RootSerializer> e2e{&root, protector};
+    {
+      serialization::ComplexDataTypeSerializer<PayloadConfig, RootSerializer> array{&root};
+      array.PushBackRange(payload);
+      array.Close();
+    }
+    e2e.Close();
+  }
+  return *root.Close();
+}
+
+/**
+ * \brief Measure the throughput of a serialize function in MiB/s.
+ *
+ * \param result Receives the buffer of the last run.
+ */
+template <typename Function>
+double MeasureMiBPerSecond(const std::vector<std::uint8_t>& payload, Function serialize,
+                           serialization::PacketBuffer& result) {
+  const std::size_t runs = kBytesPerRun / payload.size();
+  Protector protector;
+  const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+  for (std::size_t run = 0U; run < runs; ++run) {
+    result = serialize(protector, payload);
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+  return (static_cast<double>(runs * payload.size()) / (1024.0 * 1024.0)) / elapsed.count();
+}
+
+}  // namespace
+
+int main() {
+  std::mt19937 random(42);
+  bool all_equal = true;
+
+  std::printf("%8s %16s %16s %9s\n", "bytes", "2-pass [MiB/s]", "fused [MiB/s]", "speedup");
+  for (std::size_t size = 1024U; size <= 16U * 1024U * 1024U; size *= 4U) {
+    std::vector<std::uint8_t> payload(size);
+    for (std::uint8_t& byte : payload) {
+      byte = static_cast<std::uint8_t>(random());
+    }
+    serialization::PacketBuffer two_pass_result;
+    serialization::PacketBuffer fused_result;
+    const double two_pass_speed = MeasureMiBPerSecond(payload, &SerializeThenProtect, two_pass_result);
+    const double fused_speed = MeasureMiBPerSecond(payload, &SerializeAndProtect, fused_result);
+    const bool equal = two_pass_result == fused_result;
+    std::printf("%8zu %16.1f %16.1f %8.1fx %s\n", size, two_pass_speed, fused_speed, fused_speed / two_pass_speed,
+                equal ? "" : "MISMATCH");
+    all_equal &= equal;
+  }
+  return all_equal ? 0 : 1;
+}
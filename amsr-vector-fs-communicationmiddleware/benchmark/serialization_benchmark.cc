@@ -0,0 +1,356 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  serialization_benchmark.cc
+ *        \brief  Compares per-element serialization of fixed-size data types with the fixed layout path.
+ *
+ *      \details  Two messages are measured: the request of the calculator method 'subtract' (two uint32 arguments)
+ *                and a sample of a struct with twelve mixed fixed-size members. The per-element variant serializes
+ *                the SOME/IP header field by field and every member with its own nested serializer, as the
+ *                generated code did before. The fixed variant serializes header and payload each with a single
+ *                PushBackFixed(). Deserialization is compared the same way. The benchmark checks that both variants
+ *                produce the same bytes and values.
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include "someip-posix-common/someip/marshalling.h"
+
+namespace {
+
+namespace serialization = someip_posix_common::someip::serialization;
+namespace someip = someip_posix_common::someip;
+
+/**
+ * \brief Serialization configuration used by the generated code for all fixed-size members.
+ */
+using Config = serialization::BEPayloadNoLengthFieldPolicy;
+
+/**
+ * \brief Number of messages serialized and deserialized per measurement.
+ */
+constexpr std::size_t kRuns = 4U * 1024U * 1024U;
+
+/**
+ * \brief Payload of the calculator request 'subtract'.
+ */
+struct SubtractRequest {
+  std::uint32_t arg1;  ///< Minuend
+  std::uint32_t arg2;  ///< Subtrahend
+};
+
+/**
+ * \brief Wire layout of SubtractRequest.
+ */
+using SubtractRequestLayout = serialization::FixedLayout<std::uint32_t, std::uint32_t>;
+
+/**
+ * \brief Struct with mixed fixed-size members.
+ */
+struct Sample {
+  std::uint64_t timestamp;   ///< Member 1
+  std::uint32_t id;          ///< Member 2
+  std::uint16_t counter;     ///< Member 3
+  std::uint8_t status;       ///< Member 4
+  bool valid;                ///< Member 5
+  double x;                  ///< Member 6
+  double y;                  ///< Member 7
+  double z;                  ///< Member 8
+  float speed;               ///< Member 9
+  float heading;             ///< Member 10
+  std::int32_t offset;       ///< Member 11
+  std::int16_t temperature;  ///< Member 12
+};
+
+/**
+ * \brief Wire layout of Sample.
+ */
+using SampleLayout = serialization::FixedLayout<std::uint64_t, std::uint32_t, std::uint16_t, std::uint8_t, bool, double,
+                                                double, double, float, float, std::int32_t, std::int16_t>;
+
+/**
+ * \brief Serialize a single member with its own nested serializer, as the generated code did per element.
+ */
+template <typename Root, typename DataType>
+void SerializeElement(Root& root, const DataType& value) {
+  serialization::Serializer<Config, Root> serializer{&root};
+  serializer.PushBack(value);
+  serializer.Close();
+}
+
+/**
+ * \brief Deserialize a single member with its own nested deserializer, as the generated code did per element.
+ */
+template <typename Root, typename DataType>
+bool DeserializeElement(Root& root, DataType& value) {
+  serialization::Deserializer<Config, Root> deserializer{&root};
+  return deserializer.PopFront(value) > 0U;
+}
+
+/**
+ * \brief Serialize the SOME/IP header field by field. The length is known in advance here.
+ */
+template <typename Root>
+void SerializeHeaderPerElement(Root& root, const someip::SomeIpMessageHeader& header) {
+  root.template PushBack<Config>(header.service_id_);
+  root.template PushBack<Config>(header.method_id_);
+  root.template PushBack<Config>(header.length_);
+  root.template PushBack<Config>(header.client_id_);
+  root.template PushBack<Config>(header.session_id_);
+  root.template PushBack<Config>(header.protocol_version_);
+  root.template PushBack<Config>(header.interface_version_);
+  root.template PushBack<Config>(header.message_type_);
+  root.template PushBack<Config>(header.return_code_);
+}
+
+/**
+ * \brief Deserialize the SOME/IP header field by field.
+ */
+template <typename Root>
+void DeserializeHeaderPerElement(Root& root, someip::SomeIpMessageHeader& header) {
+  root.template PopFront<Config>(header.service_id_);
+  root.template PopFront<Config>(header.method_id_);
+  root.template PopFront<Config>(header.length_);
+  root.template PopFront<Config>(header.client_id_);
+  root.template PopFront<Config>(header.session_id_);
+  root.template PopFront<Config>(header.protocol_version_);
+  root.template PopFront<Config>(header.interface_version_);
+  root.template PopFront<Config>(header.message_type_);
+  root.template PopFront<Config>(header.return_code_);
+}
+
+/**
+ * \brief Header of all messages of the benchmark.
+ */
+someip::SomeIpMessageHeader MakeHeader(std::size_t payload_size) {
+  someip::SomeIpMessageHeader header{};
+  header.service_id_ = 0x1234U;
+  header.method_id_ = 0x0001U;
+  header.client_id_ = 0x0042U;
+  header.session_id_ = 0x0001U;
+  header.protocol_version_ = someip::kProtocolVersion;
+  header.interface_version_ = 1U;
+  header.message_type_ = someip::SomeIpMessageType::kRequest;
+  header.return_code_ = someip::SomeIpReturnCode::kOk;
+  header.length_ = static_cast<someip::LengthField>(payload_size + someip::kHeaderLength);
+  return header;
+}
+
+/**
+ * \brief Per-element serialization of the request 'subtract'.
+ */
+someip::PacketBufferPtr SerializePerElement(const someip::SomeIpMessageHeader& header, const SubtractRequest& request) {
+  serialization::Serializer<Config> root;
+  SerializeHeaderPerElement(root, header);
+  SerializeElement(root, request.arg1);
+  SerializeElement(root, request.arg2);
+  return root.Close();
+}
+
+/**
+ * \brief Fixed layout serialization of the request 'subtract'.
+ */
+someip::PacketBufferPtr SerializeFixed(const someip::SomeIpMessageHeader& header, const SubtractRequest& request) {
+  serialization::Serializer<Config> root;
+  {
+    serialization::SomeIpHeaderSerializer<Config, decltype(root)> header_serializer{&root, header};
+    root.PushBackFixed<SubtractRequestLayout>(request.arg1, request.arg2);
+    header_serializer.Close();
+  }
+  return root.Close();
+}
+
+/**
+ * \brief Per-element serialization of the struct sample.
+ */
+someip::PacketBufferPtr SerializePerElement(const someip::SomeIpMessageHeader& header, const Sample& sample) {
+  serialization::Serializer<Config> root;
+  SerializeHeaderPerElement(root, header);
+  SerializeElement(root, sample.timestamp);
+  SerializeElement(root, sample.id);
+  SerializeElement(root, sample.counter);
+  SerializeElement(root, sample.status);
+  SerializeElement(root, sample.valid);
+  SerializeElement(root, sample.x);
+  SerializeElement(root, sample.y);
+  SerializeElement(root, sample.z);
+  SerializeElement(root, sample.speed);
+  SerializeElement(root, sample.heading);
+  SerializeElement(root, sample.offset);
+  SerializeElement(root, sample.temperature);
+  return root.Close();
+}
+
+/**
+ * \brief Fixed layout serialization of the struct sample.
+ */
+someip::PacketBufferPtr SerializeFixed(const someip::SomeIpMessageHeader& header, const Sample& sample) {
+  serialization::Serializer<Config> root;
+  {
+    serialization::SomeIpHeaderSerializer<Config, decltype(root)> header_serializer{&root, header};
+    root.PushBackFixed<SampleLayout>(sample.timestamp, sample.id, sample.counter, sample.status, sample.valid,
+                                     sample.x, sample.y, sample.z, sample.speed, sample.heading, sample.offset,
+                                     sample.temperature);
+    header_serializer.Close();
+  }
+  return root.Close();
+}
+
+/**
+ * \brief Per-element deserialization of the request 'subtract'.
+ */
+bool DeserializePerElement(someip::PacketBufferPtr packet, someip::SomeIpMessageHeader& header,
+                           SubtractRequest& request) {
+  serialization::Deserializer<Config> root{std::move(packet)};
+  DeserializeHeaderPerElement(root, header);
+  bool ok{DeserializeElement(root, request.arg1)};
+  ok = DeserializeElement(root, request.arg2) && ok;
+  return ok;
+}
+
+/**
+ * \brief Fixed layout deserialization of the request 'subtract'.
+ */
+bool DeserializeFixed(someip::PacketBufferPtr packet, someip::SomeIpMessageHeader& header, SubtractRequest& request) {
+  serialization::Deserializer<Config> root{std::move(packet)};
+  {
+    serialization::SomeIpHeaderDeserializer<Config, decltype(root)> header_deserializer{&root};
+    header = header_deserializer.GetDeserializedHeader();
+  }
+  return root.PopFrontFixed<SubtractRequestLayout>(request.arg1, request.arg2) > 0U;
+}
+
+/**
+ * \brief Per-element deserialization of the struct sample.
+ */
+bool DeserializePerElement(someip::PacketBufferPtr packet, someip::SomeIpMessageHeader& header, Sample& sample) {
+  serialization::Deserializer<Config> root{std::move(packet)};
+  DeserializeHeaderPerElement(root, header);
+  bool ok{DeserializeElement(root, sample.timestamp)};
+  ok = DeserializeElement(root, sample.id) && ok;
+  ok = DeserializeElement(root, sample.counter) && ok;
+  ok = DeserializeElement(root, sample.status) && ok;
+  ok = DeserializeElement(root, sample.valid) && ok;
+  ok = DeserializeElement(root, sample.x) && ok;
+  ok = DeserializeElement(root, sample.y) && ok;
+  ok = DeserializeElement(root, sample.z) && ok;
+  ok = DeserializeElement(root, sample.speed) && ok;
+  ok = DeserializeElement(root, sample.heading) && ok;
+  ok = DeserializeElement(root, sample.offset) && ok;
+  ok = DeserializeElement(root, sample.temperature) && ok;
+  return ok;
+}
+
+/**
+ * \brief Fixed layout deserialization of the struct sample.
+ */
+bool DeserializeFixed(someip::PacketBufferPtr packet, someip::SomeIpMessageHeader& header, Sample& sample) {
+  serialization::Deserializer<Config> root{std::move(packet)};
+  {
+    serialization::SomeIpHeaderDeserializer<Config, decltype(root)> header_deserializer{&root};
+    header = header_deserializer.GetDeserializedHeader();
+  }
+  return root.PopFrontFixed<SampleLayout>(sample.timestamp, sample.id, sample.counter, sample.status, sample.valid,
+                                          sample.x, sample.y, sample.z, sample.speed, sample.heading, sample.offset,
+                                          sample.temperature) > 0U;
+}
+
+/**
+ * \brief Compare two samples member by member.
+ */
+bool operator==(const Sample& lhs, const Sample& rhs) {
+  return (lhs.timestamp == rhs.timestamp) && (lhs.id == rhs.id) && (lhs.counter == rhs.counter) &&
+         (lhs.status == rhs.status) && (lhs.valid == rhs.valid) && (lhs.x == rhs.x) && (lhs.y == rhs.y) &&
+         (lhs.z == rhs.z) && (lhs.speed == rhs.speed) && (lhs.heading == rhs.heading) && (lhs.offset == rhs.offset) &&
+         (lhs.temperature == rhs.temperature);
+}
+
+/**
+ * \brief Compare two subtract requests.
+ */
+bool operator==(const SubtractRequest& lhs, const SubtractRequest& rhs) {
+  return (lhs.arg1 == rhs.arg1) && (lhs.arg2 == rhs.arg2);
+}
+
+/**
+ * \brief Measure the time per message of a function in ns.
+ */
+template <typename Function>
+double MeasureNsPerMessage(Function function) {
+  const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+  for (std::size_t run = 0U; run < kRuns; ++run) {
+    function(run);
+  }
+  const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - begin;
+  return elapsed.count() / static_cast<double>(kRuns);
+}
+
+/**
+ * \brief Run serialization and deserialization of one message type with both variants and print the results.
+ *
+ * \return true if both variants produce the same bytes and values.
+ */
+template <typename Payload>
+bool Compare(const char* name, const Payload& payload, std::size_t payload_size) {
+  const someip::SomeIpMessageHeader header = MakeHeader(payload_size);
+  const serialization::PacketBuffer per_element_bytes = *SerializePerElement(header, payload);
+  const serialization::PacketBuffer fixed_bytes = *SerializeFixed(header, payload);
+
+  volatile std::size_t sink{0U};
+  const double serialize_per_element =
+      MeasureNsPerMessage([&](std::size_t) { sink = SerializePerElement(header, payload)->size(); });
+  const double serialize_fixed =
+      MeasureNsPerMessage([&](std::size_t) { sink = SerializeFixed(header, payload)->size(); });
+
+  someip::SomeIpMessageHeader per_element_header{};
+  someip::SomeIpMessageHeader fixed_header{};
+  Payload per_element_payload{};
+  Payload fixed_payload{};
+  bool ok{true};
+  const double deserialize_per_element = MeasureNsPerMessage([&](std::size_t) {
+    someip::PacketBufferPtr packet{someip::PacketBufferPool::GetInstance().AcquirePtr(0U)};
+    *packet = per_element_bytes;
+    ok = DeserializePerElement(std::move(packet), per_element_header, per_element_payload) && ok;
+  });
+  const double deserialize_fixed = MeasureNsPerMessage([&](std::size_t) {
+    someip::PacketBufferPtr packet{someip::PacketBufferPool::GetInstance().AcquirePtr(0U)};
+    *packet = fixed_bytes;
+    ok = DeserializeFixed(std::move(packet), fixed_header, fixed_payload) && ok;
+  });
+
+  const bool equal = ok && (per_element_bytes == fixed_bytes) && (per_element_payload == payload) &&
+                     (fixed_payload == payload) && (fixed_header.length_ == header.length_);
+  std::printf("%-16s %12s %10.1f ns %10.1f ns %8.2fx\n", name, "serialize", serialize_per_element, serialize_fixed,
+              serialize_per_element / serialize_fixed);
+  std::printf("%-16s %12s %10.1f ns %10.1f ns %8.2fx %s\n", name, "deserialize", deserialize_per_element,
+              deserialize_fixed, deserialize_per_element / deserialize_fixed, equal ? "" : "MISMATCH");
+  return equal;
+}
+
+}  // namespace
+
+int main() {
+  const SubtractRequest request{42U, 17U};
+  const Sample sample{0x0102030405060708ULL, 0xCAFEU, 513U, 7U, true, 1.5, -2.25, 1e10, 13.75F, -0.5F, -123456, -40};
+
+  std::printf("%-16s %12s %13s %13s %9s\n", "message", "operation", "per-element", "fixed", "speedup");
+  bool all_equal = Compare("subtract request", request, SubtractRequestLayout::kSize);
+  all_equal = Compare("mixed sample", sample, SampleLayout::kSize) && all_equal;
+  return all_equal ? 0 : 1;
+}
@@ -25,9 +25,12 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <algorithm>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include "ara-someip-posix/aracom_someip_binding_interface.h"
@@ -386,7 +389,8 @@ class AraComSomeIpBinding : public ara::com::someip_posix::AraComSomeIpBindingIn
       const someip_posix_common::someip::ReturnCode return_code,
       const someip_posix_common::someip::InstanceId instance_id,
       const someip_posix_common::someip::SomeIpMessageHeader& request_header) override {
-    someip_posix_common::someip::SomeIpPacket packet_response{new ::someip_posix_common::someip::PacketBuffer{}};
+    someip_posix_common::someip::SomeIpPacket packet_response{
+        ::someip_posix_common::someip::PacketBufferPool::GetInstance().AcquirePtr(0U)};
     packet_response =
         someip_posix_common::someip::CreateSomeIpErrorHeader(return_code, request_header, std::move(packet_response));
 
@@ -583,11 +587,10 @@ class AraComSomeIpBinding : public ara::com::someip_posix::AraComSomeIpBindingIn
       }
     }
 
-    for (auto& proxy_binding : proxy_bindings_) {
-      // Filter for service ID and instance ID, before the subscription state update is routed
-      const auto& proxy_identity = proxy_binding.first;
-      if ((std::get<0>(proxy_identity) == service_id) && (std::get<1>(proxy_identity) == instance_id)) {
-        proxy_binding.second->HandleEventSubscriptionStateUpdate(event_id, state);
+    auto it = proxy_dispatch_index_.find(MakeServiceInstanceKey(service_id, instance_id));
+    if (it != proxy_dispatch_index_.end()) {
+      for (AraComSomeIpProxyInterface* proxy_binding : it->second) {
+        proxy_binding->HandleEventSubscriptionStateUpdate(event_id, state);
       }
     }
   }
@@ -655,7 +658,11 @@ class AraComSomeIpBinding : public ara::com::someip_posix::AraComSomeIpBindingIn
    */
   void RegisterProxyBinding(ProxyBindingIdentity proxy_identity, AraComSomeIpProxyInterface* proxy_binding) override {
     assert(proxy_binding != nullptr);
-    proxy_bindings_.emplace(proxy_identity, proxy_binding);
+    // Only a binding known to proxy_bindings_ may be reached by dispatching, a duplicate identity is not stored.
+    if (proxy_bindings_.emplace(proxy_identity, proxy_binding).second) {
+      proxy_dispatch_index_[MakeServiceInstanceKey(std::get<0>(proxy_identity), std::get<1>(proxy_identity))]
+          .push_back(proxy_binding);
+    }
 
     someip_posix_.RequestService(std::get<0>(proxy_identity), std::get<1>(proxy_identity));
   }
@@ -669,6 +676,15 @@ class AraComSomeIpBinding : public ara::com::someip_posix::AraComSomeIpBindingIn
     auto it = proxy_bindings_.find(proxy_identity);
     assert(it != proxy_bindings_.end());
 
+    auto index_it =
+        proxy_dispatch_index_.find(MakeServiceInstanceKey(std::get<0>(proxy_identity), std::get<1>(proxy_identity)));
+    assert(index_it != proxy_dispatch_index_.end());
+    ProxyBindingList& proxies = index_it->second;
+    proxies.erase(std::remove(proxies.begin(), proxies.end(), it->second), proxies.end());
+    if (proxies.empty()) {
+      proxy_dispatch_index_.erase(index_it);
+    }
+
     someip_posix_.ReleaseService(std::get<0>(proxy_identity), std::get<1>(proxy_identity));
     const someip_posix_common::someip::ClientId client_id = std::get<2>(proxy_identity);
     if (someip_posix_.IsRunning()) {
@@ -742,6 +758,17 @@ class AraComSomeIpBinding : public ara::com::someip_posix::AraComSomeIpBindingIn
       someipposix_config.processing_mode_ = someip_posix_common::config::SomeIpBindingProcessingMode::kPolling;
     }
 
+    // Shared memory transport to the SOME/IP daemon. Default: disabled
+    someipposix_config.shared_memory_slot_count_ = config.GetSharedMemorySlotCount();
+    if (config.GetSharedMemorySlotSize() > 0U) {
+      someipposix_config.shared_memory_slot_size_ = config.GetSharedMemorySlotSize();
+    }
+
+    // Receive buffer for the routing socket. Default: kDefaultRoutingReceiveBufferSize
+    if (config.GetRoutingReceiveBufferSize() > 0U) {
+      someipposix_config.routing_receive_buffer_size_ = config.GetRoutingReceiveBufferSize();
+    }
+
     return someipposix_config;
   }
 
@@ -834,15 +861,28 @@ class AraComSomeIpBinding : public ara::com::someip_posix::AraComSomeIpBindingIn
                               RootDeserializerAlias&& deserializer) {
     const someip_posix_common::someip::ServiceId sid = header.service_id_;
 
-    for (auto& proxy_binding : proxy_bindings_) {
-      const auto& proxy_identity = proxy_binding.first;
-      // Filter for service ID and instance ID, before an event is routed
-      if ((std::get<0>(proxy_identity) == sid) && (std::get<1>(proxy_identity) == instance_id)) {
-        proxy_binding.second->HandleEventNotification(header, std::move(deserializer));
+    // Only the proxy bindings of this service instance are visited.
+    auto it = proxy_dispatch_index_.find(MakeServiceInstanceKey(sid, instance_id));
+    if (it != proxy_dispatch_index_.end()) {
+      for (AraComSomeIpProxyInterface* proxy_binding : it->second) {
+        proxy_binding->HandleEventNotification(header, std::move(deserializer));
       }
     }
   }
 
+  /**
+   * \brief Build the key of proxy_dispatch_index_.
+   *
+   * \param service_id The SOME/IP service ID.
+   * \param instance_id The SOME/IP instance ID.
+   *
+   * \return The service ID in the upper and the instance ID in the lower 16 bits.
+   */
+  static std::uint32_t MakeServiceInstanceKey(someip_posix_common::someip::ServiceId service_id,
+                                              someip_posix_common::someip::InstanceId instance_id) {
+    return (static_cast<std::uint32_t>(service_id) << 16U) | static_cast<std::uint32_t>(instance_id);
+  }
+
   /**
    * \brief Obtain a reference-counted ProxyInstanceFactory
    *
@@ -910,22 +950,53 @@ class AraComSomeIpBinding : public ara::com::someip_posix::AraComSomeIpBindingIn
   SkeletonFactoryContainer skeleton_factories_;
 
   /**
-   * \brief Registered proxy binding objects. This back-link is needed for the routing of method responses,
-   * event notifications.
+   * \brief Hash of ProxyBindingIdentity and SkeletonBindingIdentity. The 16-bit IDs are packed into one integer.
    */
-  using ServiceProxySomeIpBindings = std::map<ProxyBindingIdentity, AraComSomeIpProxyInterface*>;
+  struct BindingIdentityHash {
+    std::size_t operator()(const ProxyBindingIdentity& identity) const noexcept {
+      return static_cast<std::size_t>((static_cast<std::uint64_t>(std::get<0>(identity)) << 32U) |
+                                      (static_cast<std::uint64_t>(std::get<1>(identity)) << 16U) |
+                                      static_cast<std::uint64_t>(std::get<2>(identity)));
+    }
+    std::size_t operator()(const SkeletonBindingIdentity& identity) const noexcept {
+      return static_cast<std::size_t>(MakeServiceInstanceKey(std::get<0>(identity), std::get<1>(identity)));
+    }
+  };
+
+  /**
+   * \brief Registered proxy binding objects. This back-link is needed for the routing of method responses.
+   */
+  using ServiceProxySomeIpBindings =
+      std::unordered_map<ProxyBindingIdentity, AraComSomeIpProxyInterface*, BindingIdentityHash>;
 
   /**
    * \brief Registered skeleton binding objects. This back-link is needed for the routing of method requests,
    * event requests.
    */
-  using ServiceSkeletonSomeIpBindings = std::map<SkeletonBindingIdentity, AraComSomeIpSkeletonInterface*>;
+  using ServiceSkeletonSomeIpBindings =
+      std::unordered_map<SkeletonBindingIdentity, AraComSomeIpSkeletonInterface*, BindingIdentityHash>;
+
+  /**
+   * \brief Proxy bindings of one service instance.
+   */
+  using ProxyBindingList = std::vector<AraComSomeIpProxyInterface*>;
+
+  /**
+   * \brief Proxy bindings grouped by service instance (see MakeServiceInstanceKey()). Needed for the routing of event
+   * notifications and event subscription state updates, which are not addressed to a client ID.
+   */
+  using ProxyDispatchIndex = std::unordered_map<std::uint32_t, ProxyBindingList>;
 
   /**
    * Container of all proxy bindings registered.
    */
   ServiceProxySomeIpBindings proxy_bindings_;
 
+  /**
+   * \brief Index of proxy_bindings_ by service instance.
+   */
+  ProxyDispatchIndex proxy_dispatch_index_;
+
   /**
    * \brief Container of all skeleton bindings registered after an OfferService from a service instance.
    */
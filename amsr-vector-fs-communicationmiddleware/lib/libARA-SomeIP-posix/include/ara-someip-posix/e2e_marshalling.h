@@ -23,6 +23,7 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include "ara/crc/crc.h"
 #include "ara/e2e/e2exf/transformer.h"
 #include "someip-posix-common/someip/marshalling.h"
 
@@ -44,6 +45,8 @@ constexpr std::size_t kE2EHeaderSomeIpBitOffset =
 
 /**
  * \brief Serializer for the E2E protection header.
+ * \details The CRC of the payload is calculated while the payload is serialized, so protecting the payload on close
+ * only writes and reads the E2E header instead of reading the whole payload again.
  * \tparam TransformerType Type of used E2E transformer
  * \tparam Config Serialization properties not required for E2E header serializer because E2E format defined by
  * protocol
@@ -52,7 +55,8 @@ constexpr std::size_t kE2EHeaderSomeIpBitOffset =
  */
 template <typename TransformerType, typename Root = void,
           typename Config = ::someip_posix_common::someip::serialization::BEPayloadNoLengthFieldPolicy>
-class E2EHeaderSerializer : public ::someip_posix_common::someip::serialization::Serializer<Config, Root> {
+class E2EHeaderSerializer : public ::someip_posix_common::someip::serialization::Serializer<Config, Root>,
+                            public ::someip_posix_common::someip::serialization::SerializationObserver {
  public:
   /// Type-alias for the base template class of this specialized serializer.
   using Base = ::someip_posix_common::someip::serialization::Serializer<Config, Root>;
@@ -65,9 +69,24 @@ class E2EHeaderSerializer : public ::someip_posix_common::someip::serialization:
    * \param non_protected_offset Byte offset in the packet buffer to the protected parts
    */
   explicit E2EHeaderSerializer(Root* root, TransformerType& transformer, const std::uint8_t non_protected_offset = 0U)
-      : Base{root}, transformer_{transformer}, non_protected_offset_{non_protected_offset} {
+      : Base{root}, transformer_{transformer}, non_protected_offset_{non_protected_offset}, payload_crc_{} {
     /* Allocate the E2E header in packet. Header will be written in context of CloseHandler() */
     Base::template Extend(transformer_.GetHeaderSize());
+    /* Calculate the CRC of the payload following the E2E header while it is serialized */
+    Base::SetObserver(this);
+    observing_ = true;
+  }
+
+  E2EHeaderSerializer(const E2EHeaderSerializer&) = delete;
+  E2EHeaderSerializer& operator=(const E2EHeaderSerializer&) = delete;
+
+  /**
+   * \brief Detaches from the root serializer if the serializer has not been closed.
+   */
+  ~E2EHeaderSerializer() override {
+    if (observing_) {
+      Base::SetObserver(nullptr);
+    }
   }
 
   /**
@@ -80,8 +99,43 @@ class E2EHeaderSerializer : public ::someip_posix_common::someip::serialization:
    * This handler protects the payload and updates the E2E header with CRC, length, etc. information
    */
   void CloseHandler() {
-    /* Protect the payload byte stream and update the E2E header */
-    transformer_.Protect(Base::GetBuffer(), non_protected_offset_);
+    if (payload_crc_.GetLength() == 0U) {
+      /* The payload did not fill a single chunk. Calculating its CRC in one go is cheaper than combining the CRCs */
+      Base::SetObserver(nullptr);
+      observing_ = false;
+      transformer_.Protect(Base::GetBuffer(), non_protected_offset_);
+    } else {
+      /* Hand the rest of the payload to the CRC calculation */
+      Base::FlushObserver();
+      Base::SetObserver(nullptr);
+      observing_ = false;
+      /* Protect the payload byte stream and update the E2E header */
+      transformer_.Protect(Base::GetBuffer(), non_protected_offset_, payload_crc_.GetCRC());
+    }
+  }
+
+  /**
+   * \brief Feeds the serialized payload into the CRC calculation.
+   *
+   * \param data Pointer to the first serialized byte.
+   * \param length Number of serialized bytes.
+   */
+  void OnSerialized(const std::uint8_t* data, std::size_t length) override {
+    payload_crc_.Update(ara::crc::Crc::BufferView(data, length));
+  }
+
+  /**
+   * \brief Corrects the CRC calculation for overwritten payload, e.g. length fields.
+   *
+   * \param position Position of the overwritten bytes in the payload.
+   * \param previous The bytes as they were fed into the CRC calculation.
+   * \param current The bytes as they are now.
+   * \param length Number of overwritten bytes.
+   */
+  void OnOverwritten(std::size_t position, const std::uint8_t* previous, const std::uint8_t* current,
+                     std::size_t length) override {
+    payload_crc_.Patch(position, ara::crc::Crc::BufferView(previous, length),
+                       ara::crc::Crc::BufferView(current, length));
   }
 
   /// Reference to used transformer object which handles E2E protection and update of E2E header
@@ -89,6 +143,13 @@ class E2EHeaderSerializer : public ::someip_posix_common::someip::serialization:
 
   /// Byte offset to the packet buffer part which shall be protected, previous bytes will not be protected.
   const std::uint8_t non_protected_offset_;
+
+ private:
+  /// CRC of the payload serialized so far.
+  ara::crc::Crc::Context<typename TransformerType::CRCType> payload_crc_;
+
+  /// Flag if this serializer is attached as observer to the root serializer.
+  bool observing_{false};
 };
 
 /* ---- E2E checker deserializer --------------------------------------------------------------- */
@@ -131,6 +192,16 @@ class E2EHeaderDeserializer : public ::someip_posix_common::someip::serializatio
     return transformer_.Check(Base::GetBuffer(), non_checked_offset_);
   }
 
+  /**
+   * \brief Check the E2E header against the packet payload, whose CRC has been calculated while it was received.
+   * Only the E2E header is read.
+   * \param payload_crc CRC of the payload following the E2E header.
+   * \return E2E transformer check result.
+   */
+  ara::e2e::e2exf::Result Check(const typename TransformerType::CRCType payload_crc) {
+    return transformer_.Check(Base::GetBuffer(), non_checked_offset_, payload_crc);
+  }
+
   /// Reference to used transformer object which handles E2E protection and update of E2E header
   TransformerType& transformer_;
 
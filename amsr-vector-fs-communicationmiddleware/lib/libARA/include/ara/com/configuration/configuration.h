@@ -24,6 +24,7 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <cstdint>
 #include <string>
 #include <vector>
 #include "ara/com/configuration/thread_pool_config.h"
@@ -89,6 +90,30 @@ class Configuration {
    */
   RuntimeProcessingMode GetProcessingMode() const noexcept;
 
+  /**
+   * \brief Returns the number of slots per shared memory ring used to exchange SOME/IP messages with the daemon.
+   * \return The number of slots. Zero if the shared memory transport is disabled.
+   */
+  std::uint32_t GetSharedMemorySlotCount() const noexcept;
+
+  /**
+   * \brief Returns the maximum SOME/IP message size per shared memory slot.
+   * \return The slot size in bytes. Zero if the default slot size shall be used.
+   */
+  std::uint32_t GetSharedMemorySlotSize() const noexcept;
+
+  /**
+   * \brief Returns the size of the receive buffer for routing messages from the SOME/IP daemon.
+   * \return The buffer size in bytes. Zero if the default size shall be used.
+   */
+  std::uint32_t GetRoutingReceiveBufferSize() const noexcept;
+
+  /**
+   * \brief Returns the number of samples pre-allocated per skeleton event for SkeletonEvent::Allocate().
+   * \return The number of samples. Zero if Allocate() shall not use a pool.
+   */
+  std::uint32_t GetSamplePoolSize() const noexcept;
+
   /**
    * \brief Get configured thread pools.
    * \return Container of thread pool configurations
@@ -120,6 +145,26 @@ class Configuration {
    */
   RuntimeProcessingMode processing_mode_;
 
+  /**
+   * \brief Number of slots per shared memory ring. Zero disables the shared memory transport.
+   */
+  std::uint32_t shared_memory_slot_count_{0U};
+
+  /**
+   * \brief Maximum SOME/IP message size per shared memory slot. Zero selects the default slot size.
+   */
+  std::uint32_t shared_memory_slot_size_{0U};
+
+  /**
+   * \brief Size of the receive buffer for routing messages from the SOME/IP daemon. Zero selects the default size.
+   */
+  std::uint32_t routing_receive_buffer_size_{0U};
+
+  /**
+   * \brief Number of samples pre-allocated per skeleton event. Zero disables the pool.
+   */
+  std::uint32_t sample_pool_size_{4U};
+
   /**
    * \brief All thread-pools are hold in the Runtime object.
    */
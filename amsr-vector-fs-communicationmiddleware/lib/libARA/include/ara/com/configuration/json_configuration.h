@@ -74,6 +74,12 @@ class JsonConfiguration : public Configuration {
    */
   void ReadProcessingMode(const ara::per::internal::json::JsonObject& application_json);
 
+  /**
+   * \brief Parse the optional shared memory transport parameters from JSON
+   * \param application_json Application JSON configuration
+   */
+  void ReadSharedMemory(const ara::per::internal::json::JsonObject& application_json);
+
   /**
    * \brief Parse a single ara::com application thread pool configuration from JSON
    * \tparam ConfigObject type template for thread_pool_configuration parameter to avoid complex RapidJSON object type.
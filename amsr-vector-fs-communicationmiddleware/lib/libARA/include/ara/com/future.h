@@ -15,7 +15,8 @@
  *        \brief  Specific implementation of a future for ara::com
  *
  *      \details  ara::com::Future is a composition of basic features of std::future
- *                and methods borrowed from facebook folly::Future.
+ *                and methods borrowed from facebook folly::Future. Instead of the shared state of std::future it
+ *                uses internal::FutureState, which supports continuations without blocking a thread.
  *          \see  SWS_CM_00321
  *
  *********************************************************************************************************************/
@@ -26,9 +27,17 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <future>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
 #include <utility>
+#include <vector>
+#include "ara/com/internal/future_state.h"
 #include "ara/com/types.h"
 
 namespace ara {
@@ -40,20 +49,196 @@ namespace com {
  */
 enum class FutureStatus : uint8_t { ready, timeout };
 
+template <typename T>
+class Future;
+
+namespace internal {
+
+/**
+ * \brief Access to the shared state of a Future for Promise and the continuation tasks.
+ */
+class FutureAccess {
+ public:
+  /**
+   * \brief Creates a Future sharing the given state.
+   *
+   * \param state The shared state.
+   * \return The Future.
+   */
+  template <typename T>
+  static Future<T> Make(std::shared_ptr<FutureState<T>> state) noexcept {
+    return Future<T>(std::move(state));
+  }
+
+  /**
+   * \brief Takes the shared state out of a Future. The Future is invalid afterwards.
+   *
+   * \param future The Future.
+   * \return The shared state.
+   * \throws std::future_error if the Future has no shared state.
+   */
+  template <typename T>
+  static std::shared_ptr<FutureState<T>> Release(Future<T>& future) {
+    if (!future.state_) {
+      throw std::future_error(std::future_errc::no_state);
+    }
+    return std::move(future.state_);
+  }
+};
+
+/**
+ * \brief Continuation calling the function passed to Future::then().
+ *
+ * \tparam T Type of the value of the Future the function is attached to.
+ * \tparam Function Type of the function.
+ * \tparam Result Return type of the function.
+ */
+template <typename T, typename Function, typename Result>
+class ThenTask {
+ public:
+  /**
+   * \brief Constructor.
+   *
+   * \param state The state the function is attached to.
+   * \param function The function. Called with a ready Future<T>.
+   * \param next The state receiving the result of the function.
+   */
+  ThenTask(std::shared_ptr<FutureState<T>> state, Function function, std::shared_ptr<FutureState<Result>> next)
+      : state_{std::move(state)}, function_(std::move(function)), next_{std::move(next)} {}
+
+  /**
+   * \brief Calls the function and stores its result.
+   */
+  void operator()() { Fulfill(*next_, function_, FutureAccess::Make(std::move(state_))); }
+
+  /**
+   * \brief Access the state receiving the result of the function.
+   */
+  const std::shared_ptr<FutureState<Result>>& GetNext() const noexcept { return next_; }
+
+ private:
+  std::shared_ptr<FutureState<T>> state_;      ///< The ready state
+  Function function_;                          ///< The function
+  std::shared_ptr<FutureState<Result>> next_;  ///< The state receiving the result
+};
+
+/**
+ * \brief Continuation queueing a ThenTask to an executor.
+ *
+ * \tparam Executor Type of the executor, e.g. ara::com::internal::ThreadPool. It must provide a function
+ * bool AddTask(Task&&).
+ * \tparam Task Type of the queued ThenTask.
+ */
+template <typename Executor, typename Task>
+class ScheduleTask {
+ public:
+  /**
+   * \brief Constructor.
+   *
+   * \param executor The executor.
+   * \param task The task to queue.
+   */
+  ScheduleTask(Executor& executor, Task task) : executor_{&executor}, task_(std::move(task)) {}
+
+  /**
+   * \brief Queues the task. Stores an exception as result if the executor rejects it.
+   */
+  void operator()() {
+    auto next = task_.GetNext();
+    if (!executor_->AddTask(std::move(task_))) {
+      next->SetException(std::make_exception_ptr(std::runtime_error("Continuation could not be queued to executor.")));
+    }
+  }
+
+ private:
+  Executor* executor_;  ///< The executor
+  Task task_;           ///< The task to queue
+};
+
+/**
+ * \brief Continuation moving the result of one state into another.
+ *
+ * \tparam T Type of the value.
+ */
+template <typename T>
+class ForwardTask {
+ public:
+  /**
+   * \brief Constructor.
+   *
+   * \param from The ready state the result is taken from.
+   * \param to The state receiving the result.
+   */
+  ForwardTask(std::shared_ptr<FutureState<T>> from, std::shared_ptr<FutureState<T>> to)
+      : from_{std::move(from)}, to_{std::move(to)} {}
+
+  /**
+   * \brief Moves the result.
+   */
+  void operator()() {
+    FutureState<T>& from = *from_;
+    auto take = [&from]() { return from.Take(); };
+    Fulfill(*to_, take);
+  }
+
+ private:
+  std::shared_ptr<FutureState<T>> from_;  ///< The ready state
+  std::shared_ptr<FutureState<T>> to_;    ///< The state receiving the result
+};
+
+/**
+ * \brief Continuation of Future<Future<T>> forwarding the result of the inner Future.
+ *
+ * \tparam T Type of the value of the inner Future.
+ */
+template <typename T>
+class UnwrapTask {
+ public:
+  /**
+   * \brief Constructor.
+   *
+   * \param outer The state of the outer Future.
+   * \param to The state receiving the result of the inner Future.
+   */
+  UnwrapTask(std::shared_ptr<FutureState<Future<T>>> outer, std::shared_ptr<FutureState<T>> to)
+      : outer_{std::move(outer)}, to_{std::move(to)} {}
+
+  /**
+   * \brief Attaches the forwarding of the result to the inner Future.
+   */
+  void operator()() {
+    try {
+      Future<T> inner{outer_->Take()};
+      std::shared_ptr<FutureState<T>> inner_state{FutureAccess::Release(inner)};
+      FutureState<T>& state = *inner_state;
+      state.SetContinuation(InplaceTask(ForwardTask<T>(std::move(inner_state), std::move(to_))));
+    } catch (...) {
+      to_->SetException(std::current_exception());
+    }
+  }
+
+ private:
+  std::shared_ptr<FutureState<Future<T>>> outer_;  ///< The ready state of the outer Future
+  std::shared_ptr<FutureState<T>> to_;             ///< The state receiving the result
+};
+
+}  // namespace internal
+
 /**
  * \brief ara::com specific Future
  */
 template <typename T>
 class Future {
  public:
+  /**
+   * \brief Type of the value
+   */
+  using value_type = T;
+
   /** \brief Default constructor
    *
    */
-  Future() {}
-  /**
-   * \brief Default constructor
-   */
-  explicit Future(std::future<T>&& delegate_future) noexcept : delegate_future_(std::move(delegate_future)) {}
+  Future() noexcept : state_{} {}
 
   /**
    * \brief Move constructor
@@ -66,7 +251,7 @@ class Future {
   /**
    * \brief Specialized unwrapping constructor
    */
-  explicit Future(Future<Future<T>>&&) noexcept;
+  explicit Future(Future<Future<T>>&& other);
   /**
    * \brief Destructor
    */
@@ -82,28 +267,25 @@ class Future {
   /**
    * \brief Returns the result
    */
-  T get() { return delegate_future_.get(); }
+  T get() {
+    std::shared_ptr<State> state{internal::FutureAccess::Release(*this)};
+    state->Wait();
+    return state->Take();
+  }
   /**
    * \brief Check if the Future has any shared state
    */
-  bool valid() const noexcept { return delegate_future_.valid(); }
+  bool valid() const noexcept { return static_cast<bool>(state_); }
   /**
    * \brief Block until the shared state is ready
    */
-  void wait() const { delegate_future_.wait(); }
+  void wait() const { GetState().Wait(); }
   /**
    * \brief Wait for a specified relative time
    */
   template <class Rep, class Period>
   FutureStatus wait_for(const std::chrono::duration<Rep, Period>& timeout_duration) const {
-    FutureStatus retval;
-    auto f_stat = delegate_future_.wait_for(timeout_duration);
-    if (std::future_status::ready == f_stat) {
-      retval = FutureStatus::ready;
-    } else {
-      retval = FutureStatus::timeout;
-    }
-    return retval;
+    return wait_until(std::chrono::steady_clock::now() + timeout_duration);
   }
   /**
    * \brief Wait until a specified absolute time
@@ -111,8 +293,7 @@ class Future {
   template <class Clock, class Duration>
   FutureStatus wait_until(const std::chrono::time_point<Clock, Duration>& abs_time) const {
     FutureStatus retval;
-    auto f_stat = delegate_future_.wait_until(abs_time);
-    if (std::future_status::ready == f_stat) {
+    if (GetState().WaitUntil(abs_time)) {
       retval = FutureStatus::ready;
     } else {
       retval = FutureStatus::timeout;
@@ -121,27 +302,293 @@ class Future {
   }
   /**
    * \brief Set a continuation for when the shared state is ready
+   *
+   * \details The continuation is called with this Future, which is ready then. It is called by the thread making the
+   * shared state ready, or immediately by the calling thread if the state is ready already. The Future is invalid
+   * afterwards.
+   *
+   * \param func The continuation.
+   * \return A Future for the result of the continuation. Holds the exception if the continuation throws.
    */
   template <typename F>
-  auto then(F&& func) -> Future<decltype(func(std::move(*this)))>;
+  auto then(F&& func) -> Future<decltype(func(std::move(*this)))> {
+    using Result = decltype(func(std::move(*this)));
+    using Task = internal::ThenTask<T, typename std::decay<F>::type, Result>;
+    std::shared_ptr<State> state{internal::FutureAccess::Release(*this)};
+    std::shared_ptr<internal::FutureState<Result>> next{std::make_shared<internal::FutureState<Result>>()};
+    State& ready_state = *state;
+    ready_state.SetContinuation(internal::InplaceTask(Task(std::move(state), std::forward<F>(func), next)));
+    return internal::FutureAccess::Make(std::move(next));
+  }
+  /**
+   * \brief Set a continuation which is executed by the given executor when the shared state is ready
+   *
+   * \details The thread making the shared state ready only queues the continuation to the executor.
+   *
+   * \param executor The executor, e.g. an ara::com::internal::ThreadPool. It must provide bool AddTask(Task&&).
+   * \param func The continuation.
+   * \return A Future for the result of the continuation. Holds a std::runtime_error if the executor rejects the
+   * continuation.
+   */
+  template <typename Executor, typename F>
+  auto then(Executor& executor, F&& func) -> Future<decltype(func(std::move(*this)))> {
+    using Result = decltype(func(std::move(*this)));
+    using Task = internal::ThenTask<T, typename std::decay<F>::type, Result>;
+    std::shared_ptr<State> state{internal::FutureAccess::Release(*this)};
+    std::shared_ptr<internal::FutureState<Result>> next{std::make_shared<internal::FutureState<Result>>()};
+    State& ready_state = *state;
+    ready_state.SetContinuation(internal::InplaceTask(
+        internal::ScheduleTask<Executor, Task>(executor, Task(std::move(state), std::forward<F>(func), next))));
+    return internal::FutureAccess::Make(std::move(next));
+  }
   /**
    * \brief Return true only when the shared state is ready. This method will
    * return immediately and shall not do a blocking wait.
    *
-   * \remark Because the std::future
-   * has no future::get_state, we will use the capabilities we have and use
-   * future::wait_for to check for the current status.
-   *
    * \uptrace SWS_CM_00332
    *
    * \return true if the future contains a value (or exception), false if not.
    */
-  bool is_ready() const { return std::future_status::ready == delegate_future_.wait_for(std::chrono::seconds::zero()); }
+  bool is_ready() const { return state_ && state_->IsReady(); }
+
+ private:
+  friend class internal::FutureAccess;
+
+  /**
+   * \brief Type of the shared state
+   */
+  using State = internal::FutureState<T>;
+
+  /**
+   * \brief Constructs a Future sharing the given state.
+   */
+  explicit Future(std::shared_ptr<State> state) noexcept : state_{std::move(state)} {}
+
+  /**
+   * \brief Access the shared state.
+   * \throws std::future_error if the Future has no shared state.
+   */
+  State& GetState() const {
+    if (!state_) {
+      throw std::future_error(std::future_errc::no_state);
+    }
+    return *state_;
+  }
+
+  /**
+   * \brief The shared state
+   */
+  std::shared_ptr<State> state_;
+};
+
+template <typename T>
+Future<T>::Future(Future<Future<T>>&& other) : state_{std::make_shared<State>()} {
+  std::shared_ptr<internal::FutureState<Future<T>>> outer{internal::FutureAccess::Release(other)};
+  internal::FutureState<Future<T>>& outer_state = *outer;
+  outer_state.SetContinuation(internal::InplaceTask(internal::UnwrapTask<T>(std::move(outer), state_)));
+}
+
+/**
+ * \brief Result of when_any()
+ *
+ * \tparam Sequence Type of the container of futures.
+ */
+template <typename Sequence>
+struct WhenAnyResult {
+  /**
+   * \brief Position of the first ready future, or std::numeric_limits<std::size_t>::max() if no future was passed.
+   */
+  std::size_t index;
+
+  /**
+   * \brief The futures passed to when_any().
+   */
+  Sequence futures;
+};
+
+namespace internal {
+
+/**
+ * \brief Shared data of the continuations attached by when_all() and when_any().
+ *
+ * \tparam T Type of the value of the combined futures.
+ * \tparam Result Type of the value of the combined Future.
+ */
+template <typename T, typename Result>
+struct CombinedState {
+  /**
+   * \brief Constructor.
+   *
+   * \param count Number of combined futures.
+   */
+  explicit CombinedState(std::size_t count)
+      : results{}, remaining{count}, done{false}, combined{std::make_shared<FutureState<Result>>()} {
+    results.reserve(count);
+    for (std::size_t i{0U}; i < count; ++i) {
+      results.emplace_back(std::make_shared<FutureState<T>>());
+    }
+  }
+
+  /**
+   * \brief Creates the futures handed to the user. They receive the results of the combined futures.
+   */
+  std::vector<Future<T>> MakeFutures() const {
+    std::vector<Future<T>> futures;
+    futures.reserve(results.size());
+    for (const std::shared_ptr<FutureState<T>>& result : results) {
+      futures.emplace_back(FutureAccess::Make(result));
+    }
+    return futures;
+  }
+
+  std::vector<std::shared_ptr<FutureState<T>>> results;  ///< States of the futures handed to the user
+  std::atomic<std::size_t> remaining;                    ///< Number of combined futures which are not ready yet
+  std::atomic<bool> done;                                ///< Set when the first combined future is ready
+  std::shared_ptr<FutureState<Result>> combined;         ///< State of the combined Future
+};
+
+/**
+ * \brief Continuation attached to each future passed to when_all().
+ */
+template <typename T>
+class WhenAllTask {
+ public:
+  /**
+   * \brief Type of the shared data.
+   */
+  using Shared = CombinedState<T, std::vector<Future<T>>>;
+
+  /**
+   * \brief Constructor.
+   *
+   * \param state The state of the future.
+   * \param shared The shared data.
+   * \param index The position of the future.
+   */
+  WhenAllTask(std::shared_ptr<FutureState<T>> state, std::shared_ptr<Shared> shared, std::size_t index)
+      : forward_{std::move(state), shared->results[index]}, shared_{std::move(shared)} {}
+
+  /**
+   * \brief Forwards the result and makes the combined Future ready after the last one.
+   */
+  void operator()() {
+    forward_();
+    if (shared_->remaining.fetch_sub(1U, std::memory_order_acq_rel) == 1U) {
+      shared_->combined->SetValue(shared_->MakeFutures());
+    }
+  }
 
  private:
-  std::future<T> delegate_future_;
+  ForwardTask<T> forward_;          ///< Forwards the result to the future handed to the user
+  std::shared_ptr<Shared> shared_;  ///< The shared data
 };
 
+/**
+ * \brief Continuation attached to each future passed to when_any().
+ */
+template <typename T>
+class WhenAnyTask {
+ public:
+  /**
+   * \brief Type of the shared data.
+   */
+  using Shared = CombinedState<T, WhenAnyResult<std::vector<Future<T>>>>;
+
+  /**
+   * \brief Constructor.
+   *
+   * \param state The state of the future.
+   * \param shared The shared data.
+   * \param index The position of the future.
+   */
+  WhenAnyTask(std::shared_ptr<FutureState<T>> state, std::shared_ptr<Shared> shared, std::size_t index)
+      : forward_{std::move(state), shared->results[index]}, shared_{std::move(shared)}, index_{index} {}
+
+  /**
+   * \brief Forwards the result and makes the combined Future ready for the first one.
+   */
+  void operator()() {
+    forward_();
+    if (!shared_->done.exchange(true, std::memory_order_acq_rel)) {
+      shared_->combined->SetValue(WhenAnyResult<std::vector<Future<T>>>{index_, shared_->MakeFutures()});
+    }
+  }
+
+ private:
+  ForwardTask<T> forward_;          ///< Forwards the result to the future handed to the user
+  std::shared_ptr<Shared> shared_;  ///< The shared data
+  std::size_t index_;               ///< The position of the future
+};
+
+/**
+ * \brief Attaches a combining continuation to each future of a range.
+ *
+ * \tparam Task WhenAllTask or WhenAnyTask.
+ * \param first Begin of the range.
+ * \param last End of the range.
+ * \return The shared data of the continuations.
+ */
+template <template <typename> class Task, typename InputIt>
+std::shared_ptr<typename Task<typename std::iterator_traits<InputIt>::value_type::value_type>::Shared> Combine(
+    InputIt first, InputIt last) {
+  using T = typename std::iterator_traits<InputIt>::value_type::value_type;
+  using Shared = typename Task<T>::Shared;
+  std::shared_ptr<Shared> shared{std::make_shared<Shared>(static_cast<std::size_t>(std::distance(first, last)))};
+  std::size_t index{0U};
+  for (InputIt it = first; it != last; ++it) {
+    std::shared_ptr<FutureState<T>> state{FutureAccess::Release(*it)};
+    FutureState<T>& input = *state;
+    input.SetContinuation(InplaceTask(Task<T>(std::move(state), shared, index)));
+    ++index;
+  }
+  return shared;
+}
+
+}  // namespace internal
+
+/**
+ * \brief Creates a Future which becomes ready when all futures of a range are ready.
+ *
+ * \details The futures of the range are invalid afterwards. No thread is blocked while waiting.
+ *
+ * \param first Begin of a range of valid futures.
+ * \param last End of the range.
+ * \return A Future holding futures with the results of the futures of the range, in the same order.
+ */
+template <typename InputIt>
+auto when_all(InputIt first, InputIt last) -> Future<std::vector<typename std::iterator_traits<InputIt>::value_type>> {
+  using T = typename std::iterator_traits<InputIt>::value_type::value_type;
+  using Shared = typename internal::WhenAllTask<T>::Shared;
+  std::shared_ptr<Shared> shared{internal::Combine<internal::WhenAllTask>(first, last)};
+  if (shared->results.empty()) {
+    shared->combined->SetValue();
+  }
+  return internal::FutureAccess::Make(shared->combined);
+}
+
+/**
+ * \brief Creates a Future which becomes ready when the first future of a range is ready.
+ *
+ * \details The futures of the range are invalid afterwards. No thread is blocked while waiting.
+ *
+ * \param first Begin of a range of valid futures.
+ * \param last End of the range.
+ * \return A Future holding the index of the first ready future and futures with the results of the futures of the
+ * range, in the same order.
+ */
+template <typename InputIt>
+auto when_any(InputIt first, InputIt last)
+    -> Future<WhenAnyResult<std::vector<typename std::iterator_traits<InputIt>::value_type>>> {
+  using T = typename std::iterator_traits<InputIt>::value_type::value_type;
+  using Shared = typename internal::WhenAnyTask<T>::Shared;
+  std::shared_ptr<Shared> shared{internal::Combine<internal::WhenAnyTask>(first, last)};
+  if (shared->results.empty()) {
+    shared->combined->SetValue(
+        WhenAnyResult<std::vector<Future<T>>>{std::numeric_limits<std::size_t>::max(), std::vector<Future<T>>{}});
+  }
+  return internal::FutureAccess::Make(shared->combined);
+}
+
 }  // namespace com
 }  // namespace ara
 
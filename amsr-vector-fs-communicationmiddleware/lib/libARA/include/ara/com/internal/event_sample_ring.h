@@ -0,0 +1,238 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  event_sample_ring.h
+ *        \brief  Bounded lock-free ring of received event samples between a binding and ProxyImplEvent::Update()
+ *
+ *      \details  One producer (the reactor thread of the binding) pushes samples, one consumer (the application thread
+ *                calling Update()) pops them. If the ring is full, the producer drops the oldest sample by advancing
+ *                the read position, so the ring always holds the newest samples. Every slot owns a reference-counted
+ *                sample which is allocated in reserve() and overwritten in place as long as the application does not
+ *                hold it anymore. The producer never waits for the consumer: a sample whose slot is still being
+ *                read by a preempted consumer is dropped.
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_LIBARA_INCLUDE_ARA_COM_INTERNAL_EVENT_SAMPLE_RING_H_
+#define LIB_LIBARA_INCLUDE_ARA_COM_INTERNAL_EVENT_SAMPLE_RING_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include "ara/e2e/e2e_types.h"
+
+namespace ara {
+namespace com {
+namespace internal {
+
+/**
+ * \brief Bounded lock-free single-producer single-consumer ring of event samples.
+ *
+ * \details reserve() must not be called concurrently to push() or pop(). push() may be called by one thread and pop()
+ * by another thread at the same time.
+ *
+ * \tparam SampleType Type of a single event sample. Must be default-constructible.
+ */
+template <typename SampleType>
+class EventSampleRing {
+ public:
+  /**
+   * \brief Size type
+   */
+  using size_type = std::size_t;
+
+  /**
+   * \brief Constructs a ring without slots. reserve() must be called before samples are pushed.
+   */
+  EventSampleRing() : slots_{}, mask_{0U}, capacity_{0U}, write_position_{0U}, read_position_{0U} {}
+
+  EventSampleRing(const EventSampleRing&) = delete;
+  EventSampleRing& operator=(const EventSampleRing&) = delete;
+  ~EventSampleRing() = default;
+
+  /**
+   * \brief Allocates the slots and their samples. Queued samples are discarded.
+   * \note Not thread-safe.
+   *
+   * \param capacity Maximum number of queued samples. A capacity of 0 is treated as 1.
+   */
+  void reserve(size_type capacity) {
+    capacity_ = (capacity != 0U) ? capacity : 1U;
+    // Twice the capacity, so a slot is only reused after the application had the chance to drop the sample of the
+    // previous lap from its visible cache. A power of two keeps the slot index valid if the positions wrap around.
+    size_type slot_count{1U};
+    while (slot_count < (2U * capacity_)) {
+      slot_count <<= 1U;
+    }
+    slots_.reset(new Slot[slot_count]);
+    for (size_type i{0U}; i < slot_count; ++i) {
+      slots_[i].sequence_.store(i, std::memory_order_relaxed);
+      slots_[i].sample_ = std::make_shared<SampleType>();
+    }
+    mask_ = slot_count - 1U;
+    write_position_.store(0U, std::memory_order_relaxed);
+    read_position_.store(0U, std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Queues a sample. Drops the oldest queued sample if the ring is full.
+   * \note Must only be called by the producer thread, after reserve().
+   *
+   * \param data The sample. Moved into the sample of the slot.
+   * \param check_status E2E check status of the sample.
+   * \return true if the sample was queued, false if it was dropped because its slot was still being read.
+   */
+  bool push(SampleType&& data, ara::e2e::state_machine::E2ECheckStatus check_status) {
+    assert(slots_ && "EventSampleRing::push() called before reserve()");
+    bool result{false};
+    if (slots_) {
+      const size_type position{write_position_.load(std::memory_order_relaxed)};
+      size_type read_position{read_position_.load(std::memory_order_acquire)};
+      while ((position - read_position) >= capacity_) {
+        if (read_position_.compare_exchange_weak(read_position, read_position + 1U, std::memory_order_acquire)) {
+          Release(read_position);
+          read_position += 1U;
+        }
+      }
+
+      Slot& slot = slots_[position & mask_];
+      // The slot may still be held by a consumer copying the sample of the previous lap. Waiting for it would stall
+      // all event delivery of the reactor thread if that consumer has been preempted, so drop the sample instead.
+      if (slot.sequence_.load(std::memory_order_acquire) == position) {
+        if (slot.sample_.use_count() == 1) {
+          // No SamplePtr refers to the sample anymore. Synchronize with the release of the last one before reusing it.
+          std::atomic_thread_fence(std::memory_order_acquire);
+          *slot.sample_ = std::move(data);
+        } else {
+          slot.sample_ = std::make_shared<SampleType>(std::move(data));
+        }
+        slot.check_status_ = check_status;
+        slot.sequence_.store(position + 1U, std::memory_order_release);
+        write_position_.store(position + 1U, std::memory_order_release);
+        result = true;
+      }
+    }
+    return result;
+  }
+
+  /**
+   * \brief Removes the oldest queued sample.
+   * \note Must only be called by the consumer thread.
+   *
+   * \param sample Assigned a reference to the sample. The slot keeps its reference to reuse the sample later.
+   * \param check_status Assigned the E2E check status of the sample.
+   * \return true if a sample was removed, false if the ring was empty.
+   */
+  bool pop(std::shared_ptr<const SampleType>& sample, ara::e2e::state_machine::E2ECheckStatus& check_status) {
+    bool result{false};
+    size_type position{read_position_.load(std::memory_order_acquire)};
+    while ((!result) && (position != write_position_.load(std::memory_order_acquire))) {
+      // Claim the position first, the producer may drop the same sample concurrently.
+      if (read_position_.compare_exchange_weak(position, position + 1U, std::memory_order_acquire)) {
+        const Slot& slot = slots_[position & mask_];
+        sample = slot.sample_;
+        check_status = slot.check_status_;
+        Release(position);
+        result = true;
+      }
+    }
+    return result;
+  }
+
+  /**
+   * \brief Get the number of queued samples.
+   *
+   * \return The number of queued samples. The result may be outdated as soon as it is returned if the producer pushes
+   * concurrently.
+   */
+  size_type size() const noexcept {
+    return write_position_.load(std::memory_order_acquire) - read_position_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * \brief Get the maximum number of queued samples.
+   *
+   * \return The capacity passed to reserve().
+   */
+  size_type capacity() const noexcept { return capacity_; }
+
+ private:
+  /**
+   * \brief Storage of one sample.
+   */
+  struct Slot {
+    std::atomic<size_type> sequence_;                       ///< Position the slot is free or filled for
+    std::shared_ptr<SampleType> sample_;                    ///< The sample, shared with the application
+    ara::e2e::state_machine::E2ECheckStatus check_status_;  ///< E2E check status of the sample
+  };
+
+  /**
+   * \brief Hands a claimed slot back to the producer for the next lap.
+   *
+   * \param position The claimed position.
+   */
+  void Release(size_type position) {
+    slots_[position & mask_].sequence_.store(position + mask_ + 1U, std::memory_order_release);
+  }
+
+  /**
+   * \brief Size of a cache line, used to keep the positions of producer and consumer apart.
+   */
+  static constexpr std::size_t kCacheLineSize = 64U;
+
+  /**
+   * \brief Slots of the ring.
+   */
+  std::unique_ptr<Slot[]> slots_;
+
+  /**
+   * \brief Number of slots minus one. The number of slots is a power of two.
+   */
+  size_type mask_;
+
+  /**
+   * \brief Maximum number of queued samples.
+   */
+  size_type capacity_;
+
+  /**
+   * \brief Keeps write_position_ off the cache line of the fields above.
+   */
+  char padding0_[kCacheLineSize];
+
+  /**
+   * \brief Next position to push to. Only modified by the producer.
+   */
+  std::atomic<size_type> write_position_;
+
+  /**
+   * \brief Keeps the producer and consumer positions on separate cache lines.
+   */
+  char padding1_[kCacheLineSize];
+
+  /**
+   * \brief Next position to pop from. Advanced by the consumer and by the producer when dropping samples.
+   */
+  std::atomic<size_type> read_position_;
+};
+
+}  // namespace internal
+}  // namespace com
+}  // namespace ara
+
+#endif  // LIB_LIBARA_INCLUDE_ARA_COM_INTERNAL_EVENT_SAMPLE_RING_H_
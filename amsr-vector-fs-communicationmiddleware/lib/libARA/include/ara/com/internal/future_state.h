@@ -0,0 +1,387 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  future_state.h
+ *        \brief  Shared state of ara::com::Promise and ara::com::Future
+ *
+ *      \details  The state is a set of flags in one atomic. The promise side claims the state, stores the result and
+ *                marks it ready; the future side either registers a single continuation or a waiter. Whoever sets its
+ *                flag second runs the continuation or wakes the waiter, so no lock is taken as long as nobody blocks.
+ *                The continuation is stored inline in the state. Mutex and condition variable are only created when a
+ *                thread actually waits for the result.
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_LIBARA_INCLUDE_ARA_COM_INTERNAL_FUTURE_STATE_H_
+#define LIB_LIBARA_INCLUDE_ARA_COM_INTERNAL_FUTURE_STATE_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "ara/com/internal/inplace_task.h"
+
+namespace ara {
+namespace com {
+namespace internal {
+
+/**
+ * \brief Storage of the value of a FutureState.
+ *
+ * \tparam T Type of the value.
+ */
+template <typename T>
+class FutureValue {
+ public:
+  FutureValue() noexcept : storage_{}, has_value_{false} {}
+  FutureValue(const FutureValue&) = delete;
+  FutureValue& operator=(const FutureValue&) = delete;
+
+  /**
+   * \brief Destroys the value, if any.
+   */
+  ~FutureValue() {
+    if (has_value_) {
+      Get().~T();
+    }
+  }
+
+  /**
+   * \brief Constructs the value.
+   *
+   * \param args Constructor arguments of the value.
+   */
+  template <typename... Args>
+  void Set(Args&&... args) {
+    new (&storage_) T(std::forward<Args>(args)...);
+    has_value_ = true;
+  }
+
+  /**
+   * \brief Moves the value out of the storage. A value must have been set.
+   *
+   * \return The value.
+   */
+  T Take() { return std::move(Get()); }
+
+ private:
+  /**
+   * \brief Access the stored value.
+   */
+  T& Get() noexcept { return *reinterpret_cast<T*>(&storage_); }
+
+  /**
+   * \brief Storage of the value.
+   */
+  typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_;
+
+  /**
+   * \brief Indicates whether a value has been constructed in storage_.
+   */
+  bool has_value_;
+};
+
+/**
+ * \brief Storage of a FutureState without value.
+ */
+template <>
+class FutureValue<void> {
+ public:
+  /**
+   * \brief Marks the result as set.
+   */
+  void Set() noexcept {}
+
+  /**
+   * \brief Nothing to take.
+   */
+  void Take() noexcept {}
+};
+
+/**
+ * \brief Shared state of a Promise and its Future.
+ *
+ * \details The promise side calls one of the Set functions exactly once from any thread. The future side calls
+ * SetContinuation() at most once, or the wait functions and Take() from one thread.
+ *
+ * \tparam T Type of the value. May be void.
+ */
+template <typename T>
+class FutureState {
+ public:
+  FutureState() : flags_{0U}, value_{}, exception_{}, continuation_{}, waiter_{} {}
+  FutureState(const FutureState&) = delete;
+  FutureState& operator=(const FutureState&) = delete;
+  ~FutureState() = default;
+
+  /**
+   * \brief Stores the value and makes the state ready.
+   *
+   * \param args Constructor arguments of the value.
+   * \throws std::future_error if a result has already been stored.
+   */
+  template <typename... Args>
+  void SetValue(Args&&... args) {
+    Claim();
+    value_.Set(std::forward<Args>(args)...);
+    MakeReady();
+  }
+
+  /**
+   * \brief Stores an exception and makes the state ready.
+   *
+   * \param exception The exception.
+   * \throws std::future_error if a result has already been stored.
+   */
+  void SetException(std::exception_ptr exception) {
+    Claim();
+    exception_ = std::move(exception);
+    MakeReady();
+  }
+
+  /**
+   * \brief Stores a std::future_error with broken_promise as result if no result has been stored yet.
+   */
+  void Abandon() {
+    if ((flags_.fetch_or(kClaimed, std::memory_order_acq_rel) & kClaimed) == 0U) {
+      exception_ = std::make_exception_ptr(std::future_error(std::future_errc::broken_promise));
+      MakeReady();
+    }
+  }
+
+  /**
+   * \brief Registers the continuation, which is run once the state is ready.
+   *
+   * \details If the state is ready already, the continuation is run immediately in the calling thread. Otherwise it is
+   * run by the thread storing the result.
+   *
+   * \param continuation The continuation.
+   */
+  void SetContinuation(InplaceTask&& continuation) {
+    continuation_ = std::move(continuation);
+    if ((flags_.fetch_or(kContinuation, std::memory_order_acq_rel) & kReady) != 0U) {
+      RunContinuation();
+    }
+  }
+
+  /**
+   * \brief Indicates whether a result has been stored.
+   *
+   * \return true if the state is ready.
+   */
+  bool IsReady() const noexcept { return (flags_.load(std::memory_order_acquire) & kReady) != 0U; }
+
+  /**
+   * \brief Blocks until the state is ready.
+   */
+  void Wait() {
+    if (!IsReady()) {
+      Waiter& waiter = RegisterWaiter();
+      std::unique_lock<std::mutex> lock(waiter.mutex_);
+      waiter.condition_.wait(lock, [&waiter]() { return waiter.ready_; });
+    }
+  }
+
+  /**
+   * \brief Blocks until the state is ready or the given time point is reached.
+   *
+   * \param abs_time The time point.
+   * \return true if the state is ready.
+   */
+  template <typename Clock, typename Duration>
+  bool WaitUntil(const std::chrono::time_point<Clock, Duration>& abs_time) {
+    bool ready{IsReady()};
+    if (!ready) {
+      Waiter& waiter = RegisterWaiter();
+      std::unique_lock<std::mutex> lock(waiter.mutex_);
+      ready = waiter.condition_.wait_until(lock, abs_time, [&waiter]() { return waiter.ready_; });
+    }
+    return ready;
+  }
+
+  /**
+   * \brief Takes the result. The state must be ready.
+   *
+   * \return The stored value.
+   * \throws The stored exception.
+   */
+  T Take() {
+    if (exception_) {
+      std::rethrow_exception(exception_);
+    }
+    return value_.Take();
+  }
+
+ private:
+  /**
+   * \brief A result is being stored.
+   */
+  static constexpr std::uint8_t kClaimed = 0x01U;
+
+  /**
+   * \brief The result is stored.
+   */
+  static constexpr std::uint8_t kReady = 0x02U;
+
+  /**
+   * \brief A continuation is registered.
+   */
+  static constexpr std::uint8_t kContinuation = 0x04U;
+
+  /**
+   * \brief A thread may be blocked in one of the wait functions.
+   */
+  static constexpr std::uint8_t kWaiter = 0x08U;
+
+  /**
+   * \brief Blocking support, only allocated when somebody waits.
+   */
+  struct Waiter {
+    std::mutex mutex_;                   ///< Protects ready_
+    std::condition_variable condition_;  ///< Signalled when the state becomes ready
+    bool ready_{false};                  ///< Set when the state becomes ready
+  };
+
+  /**
+   * \brief Claims the state for storing the result.
+   */
+  void Claim() {
+    if ((flags_.fetch_or(kClaimed, std::memory_order_acq_rel) & kClaimed) != 0U) {
+      throw std::future_error(std::future_errc::promise_already_satisfied);
+    }
+  }
+
+  /**
+   * \brief Publishes the stored result and runs the continuation or wakes the waiter.
+   */
+  void MakeReady() {
+    const std::uint8_t previous{flags_.fetch_or(kReady, std::memory_order_acq_rel)};
+    if ((previous & kWaiter) != 0U) {
+      std::lock_guard<std::mutex> guard(waiter_->mutex_);
+      waiter_->ready_ = true;
+      waiter_->condition_.notify_all();
+    }
+    if ((previous & kContinuation) != 0U) {
+      RunContinuation();
+    }
+  }
+
+  /**
+   * \brief Runs the continuation and releases it.
+   */
+  void RunContinuation() {
+    // Take the continuation out first: it may hand the state on to code registering a new continuation.
+    InplaceTask continuation{std::move(continuation_)};
+    continuation();
+  }
+
+  /**
+   * \brief Creates the waiter on first use and announces it to the promise side.
+   *
+   * \return The waiter.
+   */
+  Waiter& RegisterWaiter() {
+    if (!waiter_) {
+      waiter_.reset(new Waiter());
+      if ((flags_.fetch_or(kWaiter, std::memory_order_acq_rel) & kReady) != 0U) {
+        waiter_->ready_ = true;
+      }
+    }
+    return *waiter_;
+  }
+
+  /**
+   * \brief Combination of kClaimed, kReady, kContinuation and kWaiter.
+   */
+  std::atomic<std::uint8_t> flags_;
+
+  /**
+   * \brief The value, valid once kReady is set and no exception is stored.
+   */
+  FutureValue<T> value_;
+
+  /**
+   * \brief The exception, valid once kReady is set.
+   */
+  std::exception_ptr exception_;
+
+  /**
+   * \brief The continuation, valid once kContinuation is set.
+   */
+  InplaceTask continuation_;
+
+  /**
+   * \brief The waiter, valid once kWaiter is set.
+   */
+  std::unique_ptr<Waiter> waiter_;
+};
+
+template <typename T>
+constexpr std::uint8_t FutureState<T>::kClaimed;
+template <typename T>
+constexpr std::uint8_t FutureState<T>::kReady;
+template <typename T>
+constexpr std::uint8_t FutureState<T>::kContinuation;
+template <typename T>
+constexpr std::uint8_t FutureState<T>::kWaiter;
+
+/**
+ * \brief Stores the result of a function call in a state.
+ *
+ * \param state The state.
+ * \param function The function.
+ * \param args Arguments of the function.
+ */
+template <typename T, typename Function, typename... Args>
+typename std::enable_if<!std::is_void<T>::value>::type Fulfill(FutureState<T>& state, Function& function,
+                                                                Args&&... args) {
+  try {
+    state.SetValue(function(std::forward<Args>(args)...));
+  } catch (...) {
+    state.SetException(std::current_exception());
+  }
+}
+
+/**
+ * \brief Calls a function without result and makes the state ready.
+ *
+ * \param state The state.
+ * \param function The function.
+ * \param args Arguments of the function.
+ */
+template <typename T, typename Function, typename... Args>
+typename std::enable_if<std::is_void<T>::value>::type Fulfill(FutureState<T>& state, Function& function,
+                                                               Args&&... args) {
+  try {
+    function(std::forward<Args>(args)...);
+    state.SetValue();
+  } catch (...) {
+    state.SetException(std::current_exception());
+  }
+}
+
+}  // namespace internal
+}  // namespace com
+}  // namespace ara
+
+#endif  // LIB_LIBARA_INCLUDE_ARA_COM_INTERNAL_FUTURE_STATE_H_
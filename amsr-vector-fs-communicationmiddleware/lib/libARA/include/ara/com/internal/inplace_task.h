@@ -0,0 +1,223 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  inplace_task.h
+ *        \brief  Type-erased callable with inline storage
+ *
+ *      \details  Callables up to kInlineTaskSize bytes are stored inside the InplaceTask object itself, so that
+ *                queueing a task into the thread-pool does not allocate. Larger callables are moved to the heap.
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_LIBARA_INCLUDE_ARA_COM_INTERNAL_INPLACE_TASK_H_
+#define LIB_LIBARA_INCLUDE_ARA_COM_INTERNAL_INPLACE_TASK_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ara {
+namespace com {
+namespace internal {
+
+/**
+ * \brief Move-only type-erased callable without arguments and return value.
+ */
+class InplaceTask {
+ public:
+  /**
+   * \brief Size of the inline storage. Larger callables are allocated on the heap.
+   */
+  static constexpr std::size_t kInlineTaskSize = 128U;
+
+  /**
+   * \brief Constructs an empty task.
+   */
+  InplaceTask() noexcept : ops_{nullptr} {}
+
+  /**
+   * \brief Constructs a task from a callable.
+   *
+   * \tparam Callable Type of the callable, it must be move-constructible.
+   * \param callable The callable. It is moved into the task.
+   */
+  template <typename Callable,
+            typename = typename std::enable_if<
+                !std::is_same<typename std::decay<Callable>::type, InplaceTask>::value>::type>
+  explicit InplaceTask(Callable&& callable) : ops_{nullptr} {
+    using Stored = typename std::decay<Callable>::type;
+    Emplace<Stored>(std::forward<Callable>(callable), IsStoredInline<Stored>());
+  }
+
+  /**
+   * \brief Move constructor.
+   *
+   * \param other The task to move from. It is empty afterwards.
+   */
+  InplaceTask(InplaceTask&& other) noexcept : ops_{nullptr} { MoveFrom(other); }
+
+  /**
+   * \brief Move assignment.
+   *
+   * \param other The task to move from. It is empty afterwards.
+   * \return This task.
+   */
+  InplaceTask& operator=(InplaceTask&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      MoveFrom(other);
+    }
+    return *this;
+  }
+
+  InplaceTask(const InplaceTask&) = delete;
+  InplaceTask& operator=(const InplaceTask&) = delete;
+
+  /**
+   * \brief Destroys the stored callable.
+   */
+  ~InplaceTask() { Reset(); }
+
+  /**
+   * \brief Indicates whether a callable is stored.
+   *
+   * \return true if the task is not empty.
+   */
+  explicit operator bool() const noexcept { return ops_ != nullptr; }
+
+  /**
+   * \brief Invokes the stored callable. The task must not be empty.
+   */
+  void operator()() { ops_->invoke_(&storage_); }
+
+  /**
+   * \brief Destroys the stored callable. The task is empty afterwards.
+   */
+  void Reset() noexcept {
+    if (ops_ != nullptr) {
+      ops_->destroy_(&storage_);
+      ops_ = nullptr;
+    }
+  }
+
+ private:
+  /**
+   * \brief Inline storage of a callable.
+   */
+  using Storage = typename std::aligned_storage<kInlineTaskSize, alignof(std::max_align_t)>::type;
+
+  /**
+   * \brief Operations on the stored callable.
+   */
+  struct Operations {
+    void (*invoke_)(Storage*);                   ///< Invokes the callable
+    void (*move_)(Storage* from, Storage* to);  ///< Move-constructs the callable into other storage and destroys it
+    void (*destroy_)(Storage*);                  ///< Destroys the callable
+  };
+
+  /**
+   * \brief Indicates whether a callable type fits into the inline storage.
+   */
+  template <typename Stored>
+  using IsStoredInline =
+      std::integral_constant<bool, (sizeof(Stored) <= sizeof(Storage)) && (alignof(Stored) <= alignof(Storage)) &&
+                                       std::is_nothrow_move_constructible<Stored>::value>;
+
+  /**
+   * \brief Operations on a callable stored in the inline storage.
+   */
+  template <typename Stored>
+  struct InlineOperations {
+    static Stored* Get(Storage* storage) { return reinterpret_cast<Stored*>(storage); }
+    static void Invoke(Storage* storage) { (*Get(storage))(); }
+    static void Move(Storage* from, Storage* to) {
+      new (to) Stored(std::move(*Get(from)));
+      Destroy(from);
+    }
+    static void Destroy(Storage* storage) { Get(storage)->~Stored(); }
+    static const Operations kOperations;
+  };
+
+  /**
+   * \brief Operations on a callable stored on the heap. The inline storage holds the pointer to it.
+   */
+  template <typename Stored>
+  struct HeapOperations {
+    static Stored*& Get(Storage* storage) { return *reinterpret_cast<Stored**>(storage); }
+    static void Invoke(Storage* storage) { (*Get(storage))(); }
+    static void Move(Storage* from, Storage* to) { new (to) Stored*(Get(from)); }
+    static void Destroy(Storage* storage) { delete Get(storage); }
+    static const Operations kOperations;
+  };
+
+  /**
+   * \brief Stores a callable inline.
+   */
+  template <typename Stored, typename Callable>
+  void Emplace(Callable&& callable, std::true_type) {
+    new (&storage_) Stored(std::forward<Callable>(callable));
+    ops_ = &InlineOperations<Stored>::kOperations;
+  }
+
+  /**
+   * \brief Stores a callable on the heap.
+   */
+  template <typename Stored, typename Callable>
+  void Emplace(Callable&& callable, std::false_type) {
+    std::unique_ptr<Stored> stored{new Stored(std::forward<Callable>(callable))};
+    new (&storage_) Stored*(stored.release());
+    ops_ = &HeapOperations<Stored>::kOperations;
+  }
+
+  /**
+   * \brief Takes over the callable of another task. This task must be empty.
+   */
+  void MoveFrom(InplaceTask& other) noexcept {
+    if (other.ops_ != nullptr) {
+      other.ops_->move_(&other.storage_, &storage_);
+      ops_ = other.ops_;
+      other.ops_ = nullptr;
+    }
+  }
+
+  /**
+   * \brief Storage of the callable or of the pointer to it.
+   */
+  Storage storage_;
+
+  /**
+   * \brief Operations on the stored callable or nullptr if the task is empty.
+   */
+  const Operations* ops_;
+};
+
+template <typename Stored>
+const InplaceTask::Operations InplaceTask::InlineOperations<Stored>::kOperations{
+    &InplaceTask::InlineOperations<Stored>::Invoke, &InplaceTask::InlineOperations<Stored>::Move,
+    &InplaceTask::InlineOperations<Stored>::Destroy};
+
+template <typename Stored>
+const InplaceTask::Operations InplaceTask::HeapOperations<Stored>::kOperations{
+    &InplaceTask::HeapOperations<Stored>::Invoke, &InplaceTask::HeapOperations<Stored>::Move,
+    &InplaceTask::HeapOperations<Stored>::Destroy};
+
+}  // namespace internal
+}  // namespace com
+}  // namespace ara
+
+#endif  // LIB_LIBARA_INCLUDE_ARA_COM_INTERNAL_INPLACE_TASK_H_
@@ -0,0 +1,238 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  mpmc_queue.h
+ *        \brief  Bounded lock-free multi-producer multi-consumer queue
+ *
+ *      \details  Ring of slots, each carrying a sequence number which tells producers and consumers whether the slot
+ *                is free or filled for the current lap. Producers and consumers claim positions with a compare-and-swap
+ *                on the enqueue and dequeue counters and never block each other. Elements are constructed in place
+ *                inside the slots, the slot memory is allocated once in reserve().
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_LIBARA_INCLUDE_ARA_COM_INTERNAL_MPMC_QUEUE_H_
+#define LIB_LIBARA_INCLUDE_ARA_COM_INTERNAL_MPMC_QUEUE_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ara {
+namespace com {
+namespace internal {
+
+/**
+ * \brief Bounded lock-free multi-producer multi-consumer queue.
+ *
+ * \details All functions except reserve() and the destructor are thread-safe.
+ *
+ * \tparam T Type of value to store within this queue. It must be nothrow move-constructible.
+ */
+template <typename T>
+class MpmcQueue {
+ public:
+  /**
+   * \brief Type of value to store.
+   */
+  using value_type = T;
+
+  /**
+   * \brief Size type
+   */
+  using size_type = std::size_t;
+
+  /**
+   * \brief Constructs a queue without capacity. reserve() must be called before the queue is used.
+   */
+  MpmcQueue() : slots_{}, capacity_{0U}, enqueue_position_{0U}, dequeue_position_{0U} {}
+
+  MpmcQueue(const MpmcQueue&) = delete;
+  MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+  /**
+   * \brief Destroys all queued elements.
+   */
+  ~MpmcQueue() { clear(); }
+
+  /**
+   * \brief Allocates the slots of the queue. Queued elements are destroyed.
+   * \note Not thread-safe.
+   *
+   * \param capacity Maximum number of elements in the queue.
+   */
+  void reserve(size_type capacity) {
+    clear();
+    slots_.reset((capacity != 0U) ? new Slot[capacity] : nullptr);
+    for (size_type i{0U}; i < capacity; ++i) {
+      slots_[i].sequence_.store(i, std::memory_order_relaxed);
+    }
+    capacity_ = capacity;
+    enqueue_position_.store(0U, std::memory_order_relaxed);
+    dequeue_position_.store(0U, std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Constructs an element at the end of the queue.
+   *
+   * \param args Constructor arguments of the element.
+   * \return true If queueing was possible, false if the maximum capacity is reached.
+   */
+  template <typename... Args>
+  bool emplace(Args&&... args) {
+    Slot* slot{nullptr};
+    size_type position{enqueue_position_.load(std::memory_order_relaxed)};
+    while (slot == nullptr) {
+      if (capacity_ == 0U) {
+        return false;
+      }
+      Slot& candidate = slots_[position % capacity_];
+      const size_type sequence{candidate.sequence_.load(std::memory_order_acquire)};
+      if (sequence == position) {
+        // The slot is free for this lap, try to claim it.
+        if (enqueue_position_.compare_exchange_weak(position, position + 1U, std::memory_order_relaxed)) {
+          slot = &candidate;
+        }
+      } else if (sequence < position) {
+        // The slot still holds the element of the previous lap: the queue is full.
+        return false;
+      } else {
+        position = enqueue_position_.load(std::memory_order_relaxed);
+      }
+    }
+    new (&slot->storage_) value_type(std::forward<Args>(args)...);
+    slot->sequence_.store(position + 1U, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * \brief Removes the first element of the queue.
+   *
+   * \param value Assigned the removed element.
+   * \return true if an element was removed, false if the queue was empty.
+   */
+  bool pop(value_type& value) {
+    Slot* slot{nullptr};
+    size_type position{dequeue_position_.load(std::memory_order_relaxed)};
+    while (slot == nullptr) {
+      if (capacity_ == 0U) {
+        return false;
+      }
+      Slot& candidate = slots_[position % capacity_];
+      const size_type sequence{candidate.sequence_.load(std::memory_order_acquire)};
+      if (sequence == (position + 1U)) {
+        // The slot is filled for this lap, try to claim it.
+        if (dequeue_position_.compare_exchange_weak(position, position + 1U, std::memory_order_relaxed)) {
+          slot = &candidate;
+        }
+      } else if (sequence < (position + 1U)) {
+        return false;
+      } else {
+        position = dequeue_position_.load(std::memory_order_relaxed);
+      }
+    }
+    value_type* element = reinterpret_cast<value_type*>(&slot->storage_);
+    value = std::move(*element);
+    element->~value_type();
+    // Free the slot for the producer of the next lap.
+    slot->sequence_.store(position + capacity_, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * \brief Test if this queue is empty.
+   *
+   * \return true if this queue is empty, false if there are elements queued. The result may be outdated as soon as it
+   * is returned if other threads access the queue concurrently.
+   */
+  bool empty() const noexcept {
+    if (capacity_ == 0U) {
+      return true;
+    }
+    const size_type position{dequeue_position_.load(std::memory_order_acquire)};
+    return slots_[position % capacity_].sequence_.load(std::memory_order_acquire) != (position + 1U);
+  }
+
+  /**
+   * \brief Get the maximum number of elements this queue can hold.
+   *
+   * \return The capacity passed to reserve().
+   */
+  size_type capacity() const noexcept { return capacity_; }
+
+ private:
+  /**
+   * \brief Storage of one element.
+   */
+  struct Slot {
+    std::atomic<size_type> sequence_;                                                ///< Lap state of the slot
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_;  ///< Element storage
+  };
+
+  /**
+   * \brief Destroys all queued elements.
+   * \note Not thread-safe.
+   */
+  void clear() {
+    value_type value;
+    while (pop(value)) {
+    }
+  }
+
+  /**
+   * \brief Size of a cache line, used to keep the counters of producers and consumers apart.
+   */
+  static constexpr std::size_t kCacheLineSize = 64U;
+
+  /**
+   * \brief Slots of the ring.
+   */
+  std::unique_ptr<Slot[]> slots_;
+
+  /**
+   * \brief Number of slots.
+   */
+  size_type capacity_;
+
+  /**
+   * \brief Keeps enqueue_position_ off the cache line of the fields above.
+   */
+  char padding0_[kCacheLineSize];
+
+  /**
+   * \brief Next position to enqueue to.
+   */
+  std::atomic<size_type> enqueue_position_;
+
+  /**
+   * \brief Keeps the producer and consumer counters on separate cache lines.
+   */
+  char padding1_[kCacheLineSize];
+
+  /**
+   * \brief Next position to dequeue from.
+   */
+  std::atomic<size_type> dequeue_position_;
+};
+
+}  // namespace internal
+}  // namespace com
+}  // namespace ara
+
+#endif  // LIB_LIBARA_INCLUDE_ARA_COM_INTERNAL_MPMC_QUEUE_H_
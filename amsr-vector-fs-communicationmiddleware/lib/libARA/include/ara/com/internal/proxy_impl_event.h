@@ -24,11 +24,13 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
-#include <deque>
-#include <mutex>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
 #include <utility>
 
-#include "ara/com/internal/event_sample.h"
+#include "ara/com/internal/event_sample_ring.h"
 #include "ara/com/internal/proxy_event_base.h"
 #include "ara/com/types.h"
 #include "ara/e2e/e2exf/transformer.h"
@@ -79,29 +81,25 @@ class ProxyImplEvent {
    * \return true if the number of copied events is greater than 0 and false otherwise.
    */
   bool Update(const FilterFunction& filter, SampleContainer& visible_cache) {
-    std::lock_guard<std::mutex> guard(sample_cache_lock_);
     bool result = false;
     if (policy_ == ara::com::EventCacheUpdatePolicy::kNewestN) {
       visible_cache.clear();
-      for (auto it = invisible_sample_cache_.begin(); it != invisible_sample_cache_.end(); ++it) {
-        if (filter.filter(it->GetData())) {
-          visible_cache.emplace_back(std::move(it->GetData()), it->GetE2ECheckStatus());
-          result = true;
-        }
-      }
-      invisible_sample_cache_.clear();
     } else {
       assert(this->policy_ == ara::com::EventCacheUpdatePolicy::kLastN);
-      for (auto it = invisible_sample_cache_.begin(); it != invisible_sample_cache_.end(); ++it) {
-        if (filter.filter(it->GetData())) {
-          if (visible_cache.size() >= cache_size_) {
-            visible_cache.erase(visible_cache.begin());
-          }
-          visible_cache.emplace_back(std::move(it->GetData()), it->GetE2ECheckStatus());
-          result = true;
-        }
+    }
+    std::shared_ptr<const SampleType> sample;
+    ara::e2e::state_machine::E2ECheckStatus check_status{ara::e2e::state_machine::E2ECheckStatus::NotAvailable};
+    while (sample_ring_.pop(sample, check_status)) {
+      if (filter.filter(*sample)) {
+        visible_cache.emplace_back(std::move(sample), check_status);
+        result = true;
       }
-      invisible_sample_cache_.clear();
+    }
+    if (visible_cache.size() > cache_size_) {
+      // Keep the newest cache_size_ samples and drop the older ones at once.
+      const std::size_t excess{visible_cache.size() - cache_size_};
+      visible_cache.erase(visible_cache.begin(),
+                          visible_cache.begin() + static_cast<typename SampleContainer::difference_type>(excess));
     }
     return result;
   }
@@ -110,10 +108,7 @@ class ProxyImplEvent {
    * \brief Access the E2EState of the recent E2ECheck.
    * \return The E2E status of the latest E2E check.
    */
-  ara::e2e::state_machine::State GetE2EState() const {
-    std::lock_guard<std::mutex> guard(sample_cache_lock_);
-    return e2e_state_;
-  }
+  ara::e2e::state_machine::State GetE2EState() const { return e2e_state_.load(std::memory_order_acquire); }
 
   /**
    * \brief Gets the current subscribed event cache update policy, if the event is currently subscribed.
@@ -126,25 +121,35 @@ class ProxyImplEvent {
 
  protected:
   /**
-   * \brief Event sample cache
+   * \brief Sets up the sample cache for a new subscription. Samples received before are discarded.
+   * \note Must be called by Subscribe() before the binding starts pushing samples.
+   *
+   * \param policy An event cache policy.
+   * \param cache_size The maximum number of cached events.
    */
-  using SampleCache = std::deque<EventSample<SampleType>>;
+  void ResetSampleCache(ara::com::EventCacheUpdatePolicy policy, std::size_t cache_size) {
+    policy_ = policy;
+    cache_size_ = cache_size;
+    sample_ring_.reserve(cache_size);
+  }
 
   /**
    * \brief Stores a new event sample.
    *
    * \param data An event sample.
    */
-  void push(SampleType const& data) {
-    std::lock_guard<std::mutex> guard(sample_cache_lock_);
-    if (invisible_sample_cache_.size() >= cache_size_) {
-      invisible_sample_cache_.pop_front();
-    }
+  void push(SampleType const& data) { push(SampleType(data)); }
 
+  /**
+   * \brief Stores a new event sample without copying it.
+   *
+   * \param data An event sample.
+   */
+  void push(SampleType&& data) {
     // No E2E handling for this event. Therefore set default state and check result
-    invisible_sample_cache_.emplace_back(data, ara::e2e::state_machine::E2ECheckStatus::NotAvailable);
+    sample_ring_.push(std::move(data), ara::e2e::state_machine::E2ECheckStatus::NotAvailable);
     // Update the event specific E2E state machine state
-    e2e_state_ = ara::e2e::state_machine::E2EState::NoData;
+    e2e_state_.store(ara::e2e::state_machine::E2EState::NoData, std::memory_order_release);
   }
 
   /**
@@ -154,39 +159,41 @@ class ProxyImplEvent {
    * \param e2e_result E2E check result
    */
   void push(SampleType const& data, const ara::e2e::e2exf::Result e2e_result) {
-    std::lock_guard<std::mutex> guard(sample_cache_lock_);
-    if (invisible_sample_cache_.size() >= cache_size_) {
-      invisible_sample_cache_.pop_front();
-    }
-    invisible_sample_cache_.emplace_back(data, e2e_result.GetCheckStatus());
-    // Update the event specific E2E state machine state
-    e2e_state_ = e2e_result.GetState();
+    push(SampleType(data), e2e_result);
   }
 
   /**
-   * \brief An event update policy.
+   * \brief Stores a new pair of event sample and E2E result without copying the sample.
+   *
+   * \param data An event sample.
+   * \param e2e_result E2E check result
    */
-  ara::com::EventCacheUpdatePolicy policy_;
+  void push(SampleType&& data, const ara::e2e::e2exf::Result e2e_result) {
+    sample_ring_.push(std::move(data), e2e_result.GetCheckStatus());
+    // Update the event specific E2E state machine state
+    e2e_state_.store(e2e_result.GetState(), std::memory_order_release);
+  }
 
   /**
-   * \brief Maximum number of stored events.
+   * \brief An event update policy.
    */
-  std::size_t cache_size_;
+  ara::com::EventCacheUpdatePolicy policy_{ara::com::EventCacheUpdatePolicy::kLastN};
 
   /**
-   * \brief Event storage.
+   * \brief Maximum number of stored events.
    */
-  SampleCache invisible_sample_cache_;
+  std::size_t cache_size_{0U};
 
+ private:
   /**
-   * \brief Mutex to protect sample cache and E2E state
+   * \brief Samples received since the last Update(). Written by the reactor thread, read by the application thread.
    */
-  mutable std::mutex sample_cache_lock_;
+  EventSampleRing<SampleType> sample_ring_;
 
   /**
    * \brief E2E state machine state
    */
-  ara::e2e::state_machine::E2EState e2e_state_{ara::e2e::state_machine::E2EState::NoData};
+  std::atomic<ara::e2e::state_machine::E2EState> e2e_state_{ara::e2e::state_machine::E2EState::NoData};
 };
 
 }  // namespace internal
@@ -0,0 +1,159 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  sample_pool.h
+ *        \brief  Pool of pre-allocated event samples for SkeletonEvent::Allocate()
+ *
+ *      \details  The samples are allocated once when the pool is created and handed back to the pool when the
+ *                SampleAllocateePtr owning them is destroyed. Returned samples are not reset, so members with dynamic
+ *                storage (e.g. vectors) keep their capacity for the next sample.
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_LIBARA_INCLUDE_ARA_COM_INTERNAL_SAMPLE_POOL_H_
+#define LIB_LIBARA_INCLUDE_ARA_COM_INTERNAL_SAMPLE_POOL_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>
+#include <memory>
+#include "ara/com/internal/mpmc_queue.h"
+
+namespace ara {
+namespace com {
+namespace internal {
+
+template <typename SampleType>
+class SamplePool;
+
+/**
+ * \brief Deleter of a SampleAllocateePtr. Hands the sample back to its pool, or deletes it if it was not taken from a
+ * pool.
+ *
+ * \tparam SampleType Type of the sample.
+ */
+template <typename SampleType>
+class SampleAllocateeDeleter {
+ public:
+  /**
+   * \brief Default constructor. The sample is deleted.
+   */
+  SampleAllocateeDeleter() noexcept = default;
+
+  /**
+   * \brief Allows the conversion from a std::unique_ptr with the default deleter.
+   */
+  SampleAllocateeDeleter(const std::default_delete<SampleType>&) noexcept {}  // NOLINT(runtime/explicit)
+
+  /**
+   * \brief Constructor for samples taken from a pool.
+   *
+   * \param pool The pool the sample is returned to.
+   */
+  explicit SampleAllocateeDeleter(std::shared_ptr<SamplePool<SampleType>> pool) noexcept : pool_{std::move(pool)} {}
+
+  /**
+   * \brief Returns the sample to the pool or deletes it.
+   *
+   * \param sample A sample allocated with new.
+   */
+  void operator()(SampleType* sample) const {
+    if (pool_) {
+      pool_->Release(sample);
+    } else {
+      delete sample;
+    }
+  }
+
+ private:
+  /**
+   * \brief The pool the sample is returned to. Keeps the pool alive as long as samples are in use.
+   */
+  std::shared_ptr<SamplePool<SampleType>> pool_;
+};
+
+/**
+ * \brief Fixed-size pool of event samples.
+ *
+ * \details Acquire() and Release() are lock-free and may be called from any thread. If all samples are in use,
+ * Acquire() allocates an additional sample, which is deleted instead of pooled when it is released to a full pool.
+ *
+ * \tparam SampleType Type of the sample. Must be default-constructible and move-assignable.
+ */
+template <typename SampleType>
+class SamplePool {
+ public:
+  /**
+   * \brief Pre-allocates the samples.
+   *
+   * \param size Number of pooled samples. Must be greater than zero.
+   */
+  explicit SamplePool(std::size_t size) : free_samples_() {
+    free_samples_.reserve(size);
+    for (std::size_t i{0U}; i < size; ++i) {
+      free_samples_.emplace(new SampleType());
+    }
+  }
+
+  SamplePool(const SamplePool&) = delete;
+  SamplePool& operator=(const SamplePool&) = delete;
+
+  /**
+   * \brief Deletes all samples in the pool.
+   */
+  ~SamplePool() {
+    SampleType* sample{nullptr};
+    while (free_samples_.pop(sample)) {
+      delete sample;
+    }
+  }
+
+  /**
+   * \brief Takes a sample from the pool.
+   *
+   * \return A sample allocated with new. It is value-initialized, also if it was recycled.
+   */
+  SampleType* Acquire() {
+    SampleType* sample{nullptr};
+    if (!free_samples_.pop(sample)) {
+      sample = new SampleType();
+    }
+    return sample;
+  }
+
+  /**
+   * \brief Returns a sample to the pool, or deletes it if the pool is full.
+   * A pooled sample is reset, so that its value cannot leak into a partly filled sample of the next user.
+   *
+   * \param sample A sample allocated with new.
+   */
+  void Release(SampleType* sample) {
+    *sample = SampleType();
+    if (!free_samples_.emplace(sample)) {
+      delete sample;
+    }
+  }
+
+ private:
+  /**
+   * \brief Samples which are not in use.
+   */
+  MpmcQueue<SampleType*> free_samples_;
+};
+
+}  // namespace internal
+}  // namespace com
+}  // namespace ara
+
+#endif  // LIB_LIBARA_INCLUDE_ARA_COM_INTERNAL_SAMPLE_POOL_H_
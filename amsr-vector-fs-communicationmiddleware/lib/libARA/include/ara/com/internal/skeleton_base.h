@@ -28,6 +28,7 @@
 #include <utility>
 #include "ara/com/future.h"
 #include "ara/com/internal/skeleton_request_handling.h"
+#include "ara/com/internal/static_queue.h"
 #include "ara/com/internal/thread_pool.h"
 #include "ara/com/runtime.h"
 #include "ara/com/types.h"
@@ -24,7 +24,11 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <memory>
+#include <mutex>
+#include "ara/com/internal/sample_pool.h"
 #include "ara/com/internal/types.h"
+#include "ara/com/runtime.h"
 #include "vac/language/cpp14_backport.h"
 
 namespace ara {
@@ -51,7 +55,7 @@ class SkeletonEvent {
    *
    * \param skeleton A reference to the skeleton object.
    */
-  explicit SkeletonEvent(Skeleton* skeleton) : skeleton_(skeleton) {}
+  explicit SkeletonEvent(Skeleton* skeleton) : skeleton_(skeleton), sample_pool_once_(), sample_pool_() {}
 
   /**
    * \brief Sending event data.
@@ -71,13 +75,28 @@ class SkeletonEvent {
   }
 
   /**
-   * \brief Allocate event data of unique ownership for sending out. The implementation
-   * of method Allocate is provided by the binding.
+   * \brief Allocate event data of unique ownership for sending out.
+   *
+   * The sample is taken from a pool of this event, which is created on the first call with the configured number of
+   * samples. Like a newly allocated sample, a recycled sample is value-initialized.
    *
    * \uptrace SWS_CM_00163
    * \return Requested memory provided by the middleware.
    */
-  ara::com::SampleAllocateePtr<SampleType> Allocate() { return vac::language::make_unique<SampleType>(); }
+  ara::com::SampleAllocateePtr<SampleType> Allocate() {
+    std::call_once(sample_pool_once_, [this]() {
+      const std::size_t pool_size{ara::com::Runtime::getInstance().GetConfiguration().GetSamplePoolSize()};
+      if (pool_size > 0U) {
+        sample_pool_ = std::make_shared<SamplePool<SampleType>>(pool_size);
+      }
+    });
+
+    if (sample_pool_) {
+      return ara::com::SampleAllocateePtr<SampleType>{sample_pool_->Acquire(),
+                                                      SampleAllocateeDeleter<SampleType>{sample_pool_}};
+    }
+    return vac::language::make_unique<SampleType>();
+  }
 
   /**
    * \brief Second variant of the Send method, which requires the call of method Allocate
@@ -85,13 +104,20 @@ class SkeletonEvent {
    *
    * \uptrace SWS_CM_00163
    * \param data A pointer of unique ownership to the data provided by the concrete
-   * binding implementation.
+   * binding implementation. The bindings serialize the sample in place, it is returned to the pool afterwards.
    */
   void Send(ara::com::SampleAllocateePtr<SampleType> data) { Send(*data); }
 
   /// A reference to the skeleton instance to call the binding-specific interfaces, when a send is called
   /// or the binding implementation of the skeleton should allocate memory of type SampleType.
   Skeleton* skeleton_;
+
+ private:
+  /// Guards the creation of the sample pool on the first Allocate().
+  std::once_flag sample_pool_once_;
+
+  /// Samples handed out by Allocate(). Shared with the samples in use, so they may outlive the event.
+  std::shared_ptr<SamplePool<SampleType>> sample_pool_;
 };
 
 }  // namespace internal
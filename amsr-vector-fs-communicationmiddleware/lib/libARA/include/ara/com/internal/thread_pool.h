@@ -25,14 +25,16 @@
  *  INCLUDES
  *********************************************************************************************************************/
 #include <atomic>
-#include <condition_variable>
 #include <memory>
 #include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include "ara/com/configuration/thread_pool_config.h"
+#include "ara/com/internal/inplace_task.h"
+#include "ara/com/internal/mpmc_queue.h"
 #include "ara/com/internal/posix_scheduler.h"
-#include "ara/com/internal/static_queue.h"
+#include "ara/com/internal/worker_parking.h"
 #include "ara/log/logging.hpp"
 #include "vac/container/static_vector.h"
 
@@ -62,6 +64,7 @@ class Task {
 /**
  * \brief The ThreadPool contains a number of threads that process incoming
  * requests.
+ * Tasks are stored in place in a bounded lock-free queue, idle worker threads park until a task is added.
  * \remark This version is checked by gcc's thread sanitizer
  * (option `-fsanitize=thread`).
  */
@@ -146,14 +149,11 @@ class ThreadPool {
   bool AddTask(Task&& task) {
     bool enqueued{true};
     if (state_ == State::kRunning) {
-      {
-        using Task_ = typename std::decay<Task>::type;  // Without any decoration
-        std::unique_ptr<Task_> task_{new Task_(std::move(task))};
-        enqueued = queue_.push(std::move(task_));
-      }
-      cv_.notify_one();
-
-      if (!enqueued) {
+      using Task_ = typename std::decay<Task>::type;  // Without any decoration
+      enqueued = queue_.emplace(Task_(std::move(task)));
+      if (enqueued) {
+        parking_.Unpark();
+      } else {
         logger_.LogError() << "Maximum number of tasks for Thread-Pool with ID "
                            << static_cast<std::uint16_t>(cfg_.GetPoolId()) << " has been reached.";
       }
@@ -174,7 +174,7 @@ class ThreadPool {
   /**
    * \brief Type-alias that specifies a queue for the tasks to process.
    */
-  using TaskQueue = ara::com::internal::StaticQueue<std::unique_ptr<Task>>;
+  using TaskQueue = ara::com::internal::MpmcQueue<InplaceTask>;
 
   /**
    * \brief Getter for the number of worker threads.
@@ -188,22 +188,16 @@ class ThreadPool {
   // to get rid of keyword friend.
  protected:
   /**
-   * \brief Condition variable used to do a blocking wait until
-   * a tasked is pending for a worker thread or the thread-pool has been shut
+   * \brief Used to do a blocking wait until a task is pending for a worker thread or the thread-pool has been shut
    * down.
    */
-  std::condition_variable cv_;
+  WorkerParking parking_;
 
   /**
    * \brief Task queue the worker threads access
    */
   TaskQueue queue_;
 
-  /**
-   * \brief Mutex for the conditional wait within the worker threads.
-   */
-  std::mutex pool_mutex_;
-
   /**
    * \brief State of this thread pool for threads to access and terminate if the
    * state_ is kStopped.
@@ -222,6 +216,14 @@ class ThreadPool {
    */
   void SpawnWorkerThreads();
 
+  /**
+   * \brief Takes the next task from the queue, waiting for one if the queue is empty.
+   *
+   * \param task Assigned the next task.
+   * \return true if a task was taken, false if the thread-pool has been shut down.
+   */
+  bool WaitForTask(InplaceTask& task);
+
   /**
    * \brief Configuration for this thread-pool.
    */
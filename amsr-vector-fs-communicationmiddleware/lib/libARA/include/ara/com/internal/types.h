@@ -27,6 +27,7 @@
 #include <functional>
 #include <memory>
 #include <vector>
+#include "ara/com/internal/sample_pool.h"
 #include "ara/com/sample_ptr.h"
 
 namespace ara {
@@ -155,11 +156,12 @@ template <typename T>
 using SampleContainer = std::vector<T>;
 
 /**
- * \brief Pointer to a data sample allocated by the runtime
+ * \brief Pointer to a data sample allocated by the runtime. Samples taken from a pool are returned to it on
+ * destruction.
  * \see SWS_CM_00308
  */
 template <typename T>
-using SampleAllocateePtr = std::unique_ptr<T>;
+using SampleAllocateePtr = std::unique_ptr<T, ara::com::internal::SampleAllocateeDeleter<T>>;
 
 /**
  * \brief Defines the subscription state of an event
@@ -0,0 +1,127 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  worker_parking.h
+ *        \brief  Parking of idle thread-pool workers
+ *
+ *      \details  Idle workers sleep on an epoch counter. Producers only make a system call if a worker is actually
+ *                parked. On Linux the workers sleep on a futex, elsewhere on a condition variable.
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_LIBARA_INCLUDE_ARA_COM_INTERNAL_WORKER_PARKING_H_
+#define LIB_LIBARA_INCLUDE_ARA_COM_INTERNAL_WORKER_PARKING_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace ara {
+namespace com {
+namespace internal {
+
+/**
+ * \brief Lets idle workers sleep until new work is available.
+ *
+ * \details Usage by a worker:
+ * \code
+ *   const auto ticket = parking.Prepare();
+ *   if (!HasWork()) { parking.Park(ticket); }
+ *   parking.Cancel();
+ * \endcode
+ * A producer calls Unpark() after making work available. Either the worker sees the work in HasWork() or the
+ * producer sees the worker announced by Prepare() and wakes it up.
+ */
+class WorkerParking {
+ public:
+  /**
+   * \brief Identifies the wake-up epoch a worker is about to sleep in.
+   */
+  using Ticket = std::uint32_t;
+
+  /**
+   * \brief Constructor of WorkerParking.
+   */
+  WorkerParking() : epoch_{0U}, parked_{0U}, lock_{}, cv_{} {}
+
+  WorkerParking(const WorkerParking&) = delete;
+  WorkerParking& operator=(const WorkerParking&) = delete;
+
+  /**
+   * \brief Announces that the calling worker is about to park. Must be followed by Cancel().
+   *
+   * \return The ticket to pass to Park().
+   */
+  Ticket Prepare();
+
+  /**
+   * \brief Sleeps until Unpark() or UnparkAll() is called after Prepare() returned the ticket. Spurious wake-ups
+   * are possible.
+   *
+   * \param ticket The ticket returned by Prepare().
+   */
+  void Park(Ticket ticket);
+
+  /**
+   * \brief Withdraws the announcement made by Prepare().
+   */
+  void Cancel();
+
+  /**
+   * \brief Wakes up one parked worker, if any.
+   */
+  void Unpark();
+
+  /**
+   * \brief Wakes up all parked workers.
+   */
+  void UnparkAll();
+
+ private:
+  /**
+   * \brief Starts a new epoch and wakes up sleeping workers.
+   *
+   * \param count Maximum number of workers to wake up.
+   */
+  void Wake(int count);
+
+  /**
+   * \brief Incremented for every wake-up. Workers sleep as long as it matches their ticket.
+   */
+  std::atomic<std::uint32_t> epoch_;
+
+  /**
+   * \brief Number of workers between Prepare() and Cancel().
+   */
+  std::atomic<std::uint32_t> parked_;
+
+  /**
+   * \brief Protects the epoch change on platforms without futex.
+   */
+  std::mutex lock_;
+
+  /**
+   * \brief Sleeping workers on platforms without futex.
+   */
+  std::condition_variable cv_;
+};
+
+}  // namespace internal
+}  // namespace com
+}  // namespace ara
+
+#endif  // LIB_LIBARA_INCLUDE_ARA_COM_INTERNAL_WORKER_PARKING_H_
@@ -26,78 +26,150 @@
  *********************************************************************************************************************/
 #include <functional>
 #include <future>
+#include <memory>
+#include <utility>
 
 #include "ara/com/future.h"
+#include "ara/com/internal/future_state.h"
 
 namespace ara {
 namespace com {
 
+namespace internal {
+
 /**
- * \brief ara::com specific Promise
+ * \brief Functionality of Promise which does not depend on the promised type.
+ *
+ * \tparam T The promised type.
  */
 template <class T>
-class Promise {
+class PromiseBase {
  public:
-  /** \brief The promised type
-   *
-   */
-  using ValueType = T;
   /**
    * \brief Default constructor
    */
-  Promise() = default;
+  PromiseBase() : state_{std::make_shared<FutureState<T>>()}, future_retrieved_{false} {}
   /**
    * \brief Default copy constructor deleted
    */
-  Promise(const Promise&) = delete;
+  PromiseBase(const PromiseBase&) = delete;
   /**
    * \brief Move constructor
    */
-  Promise(Promise&&) noexcept = default;
+  PromiseBase(PromiseBase&&) noexcept = default;
   /**
-   * \brief Destructor
+   * \brief Destructor. Stores a std::future_error with broken_promise in the shared state if no result has been set.
    */
-  ~Promise() = default;
+  ~PromiseBase() {
+    if (state_) {
+      state_->Abandon();
+    }
+  }
   /**
    * \brief Default copy assignment operator deleted
    */
-  Promise& operator=(const Promise&) = delete;
+  PromiseBase& operator=(const PromiseBase&) = delete;
   /**
    * \brief Move assignment operator
    */
-  Promise& operator=(Promise&&) noexcept = default;
+  PromiseBase& operator=(PromiseBase&& other) noexcept {
+    if (this != &other) {
+      if (state_) {
+        state_->Abandon();
+      }
+      state_ = std::move(other.state_);
+      future_retrieved_ = other.future_retrieved_;
+    }
+    return *this;
+  }
   /**
    * \brief Return a Future with the same shared state.
    * \return Future with same shared state
    */
-  Future<ValueType> get_future() { return ara::com::Future<ValueType>(delegate_promise_.get_future()); }
+  Future<T> get_future() {
+    if (future_retrieved_) {
+      throw std::future_error(std::future_errc::future_already_retrieved);
+    }
+    future_retrieved_ = true;
+    return FutureAccess::Make(GetState());
+  }
   /**
    * \brief Store an exception in the shared state.
    * \param p pointer to an exception pointer
    * \return p Exception to store
    */
-  void set_exception(std::exception_ptr p) { delegate_promise_.set_exception(p); }
+  void set_exception(std::exception_ptr p) { GetState()->SetException(p); }
+
+ protected:
+  /**
+   * \brief Access the shared state.
+   * \throws std::future_error if the promise has been moved from.
+   */
+  const std::shared_ptr<FutureState<T>>& GetState() const {
+    if (!state_) {
+      throw std::future_error(std::future_errc::no_state);
+    }
+    return state_;
+  }
+
+ private:
+  /**
+   * \brief The shared state
+   */
+  std::shared_ptr<FutureState<T>> state_;
+
+  /**
+   * \brief Indicates whether get_future() has been called.
+   */
+  bool future_retrieved_;
+};
+
+}  // namespace internal
+
+/**
+ * \brief ara::com specific Promise
+ */
+template <class T>
+class Promise : public internal::PromiseBase<T> {
+ public:
+  /** \brief The promised type
+   *
+   */
+  using ValueType = T;
   /**
    * \brief Store a value in the shared state.
    * \param value value to be set
    * \return value Value to store
    */
-  void set_value(const ValueType& value) { delegate_promise_.set_value(value); }
+  void set_value(const ValueType& value) { this->GetState()->SetValue(value); }
   /**
    * \brief Set a value in the shared state.
    * \param value value to be set
    * \return value Value to store
    */
-  void set_value(ValueType&& value) { delegate_promise_.set_value(value); }
+  void set_value(ValueType&& value) { this->GetState()->SetValue(std::move(value)); }
   /**
    * \brief Set a handler to be called, upon future destruction.
    * \param handler user-defined deleter
    * \return handler Handler to be called upon future destruction
    */
   void set_future_dtor_handler(std::function<void> handler);
+};
 
- private:
-  std::promise<ValueType> delegate_promise_;
+/**
+ * \brief ara::com specific Promise without value, used for continuations without result
+ */
+template <>
+class Promise<void> : public internal::PromiseBase<void> {
+ public:
+  /** \brief The promised type
+   *
+   */
+  using ValueType = void;
+  /**
+   * \brief Make the shared state ready.
+   */
+  void set_value() { this->GetState()->SetValue(); }
 };
 
 }  // namespace com
@@ -165,6 +165,13 @@ class Runtime {
    */
   vac::timer::TimerManager& GetTimerManager() { return timer_manager_; }
 
+  /**
+   * \brief Returns the ara::com configuration read on Initialize().
+   *
+   * \returns The reference to the configuration
+   */
+  const configuration::Configuration& GetConfiguration() const { return config_; }
+
   /**
    * \brief Check whether the Runtime is up and running or not. This is relevant for applications with multiple threads
    * that are active as long as the Runtime is initialized.
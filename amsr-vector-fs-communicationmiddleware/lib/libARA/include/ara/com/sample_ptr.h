@@ -49,6 +49,15 @@ class SamplePtr {
   explicit SamplePtr(const SampleType&& sample, ara::e2e::state_machine::E2ECheckStatus e2e_check_status)
       : sample_{std::make_shared<SampleType>(std::move(sample))}, e2e_check_status_{e2e_check_status} {}
 
+  /**
+   * \brief Constructor sharing an already allocated sample.
+   *
+   * \param sample Sample value
+   * \param e2e_check_status E2E check status
+   */
+  SamplePtr(std::shared_ptr<SampleType> sample, ara::e2e::state_machine::E2ECheckStatus e2e_check_status)
+      : sample_{std::move(sample)}, e2e_check_status_{e2e_check_status} {}
+
   /**
    * \brief E2E Status for this sample.
    *
@@ -24,6 +24,9 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include "vac/container/array_view.h"
 
@@ -74,6 +77,44 @@ class Crc {
   static CRC64 CalculateCRC64P07(const BufferView buffer_view, const CRC64 start_value,
                                  const bool is_first_call = true) noexcept;
 
+  /**
+   * \brief Calculate the CRC32 (Profile 04) of the concatenation of two data blocks from the CRCs of both blocks.
+   *
+   * \param first_crc CRC of the first data block.
+   * \param second_crc CRC of the second data block, calculated with is_first_call = true.
+   * \param second_length Length of the second data block in bytes.
+   * \return The CRC of the first block directly followed by the second block. If first_crc has been calculated with
+   * a start value, so has the result.
+   */
+  static CRC32 CombineCRC32P04(const CRC32 first_crc, const CRC32 second_crc, const std::size_t second_length) noexcept;
+
+  /**
+   * \brief Calculate the CRC64 (Profile 07) of the concatenation of two data blocks from the CRCs of both blocks.
+   *
+   * \param first_crc CRC of the first data block.
+   * \param second_crc CRC of the second data block, calculated with is_first_call = true.
+   * \param second_length Length of the second data block in bytes.
+   * \return The CRC of the first block directly followed by the second block. If first_crc has been calculated with
+   * a start value, so has the result.
+   */
+  static CRC64 CombineCRC64P07(const CRC64 first_crc, const CRC64 second_crc, const std::size_t second_length) noexcept;
+
+  /**
+   * \brief Incremental CRC calculation over data arriving in chunks.
+   */
+  template <typename CrcType>
+  class Context;
+
+  /**
+   * \brief Incremental CRC32 calculation with Profile 04 polynomial 0xF4ACFB13.
+   */
+  using ContextCRC32P04 = Context<CRC32>;
+
+  /**
+   * \brief Incremental CRC64 calculation with Profile 07 polynomial 0x42F0E1EBA9EA3693.
+   */
+  using ContextCRC64P07 = Context<CRC64>;
+
   /**
    * \brief Initial value for the CRC calculation with Profile 04 polynomial 0xF4ACFB13.
    *
@@ -103,6 +144,122 @@ class Crc {
   static constexpr std::uint64_t kXORValueCRC64{0xFFFFFFFFFFFFFFFFULL};
 };
 
+/**
+ * \brief Incremental CRC calculation. The data is fed in chunks of any size, in the order it is laid out.
+ *
+ * \details Bytes which have already been fed may be changed afterwards with Patch(), e.g. when a length field is
+ * written after the data it precedes. The CRC is corrected without feeding the data again.
+ *
+ * \tparam CrcType Crc::CRC32 for Profile 04 or Crc::CRC64 for Profile 07.
+ */
+template <typename CrcType>
+class Crc::Context {
+ public:
+  /**
+   * \brief Starts a new calculation.
+   */
+  void Reset() noexcept {
+    crc_ = 0U;
+    correction_ = 0U;
+    length_ = 0U;
+  }
+
+  /**
+   * \brief Feeds the next chunk of data.
+   *
+   * \param buffer_view The data following the data fed so far.
+   */
+  void Update(const BufferView buffer_view) noexcept {
+    crc_ = Continue(buffer_view, crc_);
+    if (correction_ != 0U) {
+      correction_ = Combine(correction_, CrcType{0U}, buffer_view.size());
+    }
+    length_ += buffer_view.size();
+  }
+
+  /**
+   * \brief Corrects the CRC for data which has changed after it was fed.
+   *
+   * \param position Position of the changed data relative to the first byte fed.
+   * \param previous The data as it was fed.
+   * \param current The data as it is now. Must have the same size as previous and end within the data fed so far.
+   */
+  void Patch(const std::size_t position, const BufferView previous, const BufferView current) noexcept {
+    // The CRC is linear: the CRC of the changed data is the CRC of the data as fed, XOR the CRC of the difference
+    // calculated from a zero register and shifted by the number of bytes following the difference.
+    constexpr CrcType kZeroRegister{static_cast<CrcType>(~CrcType{0U})};
+    std::array<std::uint8_t, 16U> difference{};
+    CrcType difference_crc{kZeroRegister};
+    for (std::size_t offset{0U}; offset < previous.size(); offset += difference.size()) {
+      const std::size_t chunk{std::min(difference.size(), previous.size() - offset)};
+      for (std::size_t i{0U}; i < chunk; ++i) {
+        difference[i] = static_cast<std::uint8_t>(previous[offset + i] ^ current[offset + i]);
+      }
+      difference_crc = Continue(BufferView(difference.data(), chunk), difference_crc);
+    }
+    correction_ ^= Combine(static_cast<CrcType>(difference_crc ^ kZeroRegister), CrcType{0U},
+                           length_ - position - previous.size());
+  }
+
+  /**
+   * \brief Get the CRC over all data fed so far.
+   *
+   * \return The CRC, as CalculateCRC32P04() / CalculateCRC64P07() with is_first_call = true would calculate it.
+   */
+  CrcType GetCRC() const noexcept { return static_cast<CrcType>(crc_ ^ correction_); }
+
+  /**
+   * \brief Get the number of bytes fed so far.
+   *
+   * \return The number of bytes.
+   */
+  std::size_t GetLength() const noexcept { return length_; }
+
+ private:
+  /**
+   * \brief Continue a CRC32 calculation.
+   */
+  static CRC32 Continue(const BufferView buffer_view, const CRC32 crc) noexcept {
+    return CalculateCRC32P04(buffer_view, crc, false);
+  }
+
+  /**
+   * \brief Continue a CRC64 calculation.
+   */
+  static CRC64 Continue(const BufferView buffer_view, const CRC64 crc) noexcept {
+    return CalculateCRC64P07(buffer_view, crc, false);
+  }
+
+  /**
+   * \brief Combine two CRC32.
+   */
+  static CRC32 Combine(const CRC32 first_crc, const CRC32 second_crc, const std::size_t second_length) noexcept {
+    return CombineCRC32P04(first_crc, second_crc, second_length);
+  }
+
+  /**
+   * \brief Combine two CRC64.
+   */
+  static CRC64 Combine(const CRC64 first_crc, const CRC64 second_crc, const std::size_t second_length) noexcept {
+    return CombineCRC64P07(first_crc, second_crc, second_length);
+  }
+
+  /**
+   * \brief CRC over the data as it was fed. The CRC of no data is zero, so continuing from it equals a first call.
+   */
+  CrcType crc_{0U};
+
+  /**
+   * \brief Accumulated corrections of Patch(), already shifted to the end of the data fed so far.
+   */
+  CrcType correction_{0U};
+
+  /**
+   * \brief Number of bytes fed so far.
+   */
+  std::size_t length_{0U};
+};
+
 }  // namespace crc
 }  // namespace ara
 
@@ -100,6 +100,32 @@ class Transformer : public E2EXfConfiguration::Profile {
     }
   }
 
+  /**
+   * \brief Protect a certain buffer based on the configured profile, reusing the CRC of the user data which has been
+   * calculated while the user data was serialized. Only the E2E header is written and read.
+   *
+   * \param buffer Holds the byte stream to verify. This includes the pre-allocated E2EHeader
+   * for the given profile and the user-data.
+   * \param non_protected_offset The offset in the buffer to not protect.
+   * \param payload_crc CRC of the user data following the E2E header.
+   * \return Based on the profile given a profile might give back additional information to its caller.
+   */
+  typename TransformerProfile::ProtectReturnType Protect(StreamType& buffer, const std::uint8_t non_protected_offset,
+                                                         const typename TransformerProfile::CRCType payload_crc) {
+    using BufferView = vac::container::array_view<std::uint8_t>;
+
+    // First check if the non-protected offset does not exceed the overall buffer size.
+    if (non_protected_offset <= buffer.size()) {
+      std::uint8_t* protect_begin = &buffer[0] + non_protected_offset;
+      const auto protected_size = buffer.size() - static_cast<decltype(buffer.size())>(non_protected_offset);
+      BufferView buffer_view(protect_begin, protected_size);
+      return this->Base::Protect(typename E2EXfConfiguration::End2EndEventProtectionProps{}, buffer_view,
+                                 payload_crc);
+    } else {
+      return Base::ProtectReturnType::kWrongInput;
+    }
+  }
+
   /**
    * \brief Executes an E2E check on a given stream, including the
    * E2E header and the protected serialized payload. This will only be called for checkers.
@@ -113,17 +139,55 @@ class Transformer : public E2EXfConfiguration::Profile {
    * \return The result of this E2E check.
    */
   ara::e2e::e2exf::Result Check(const StreamType& buffer, const std::uint8_t non_checked_offset = 0U) noexcept {
-    struct MergedConfig : public E2EXfConfiguration::End2EndEventProtectionProps,
-                          public E2EXfConfiguration::E2EProfileProps {};
+    return DoCheck(buffer, non_checked_offset, [this](const CheckedView& buffer_view) {
+      return this->Base::Check(MergedConfig{}, buffer_view);
+    });
+  }
 
-    using BufferView = vac::container::const_array_view<const std::uint8_t>;
+  /**
+   * \brief Executes an E2E check on a given stream, reusing the CRC of the user data which has been calculated while
+   * the stream was received. Only the E2E header is read.
+   *
+   * \uptrace SWS_E2E_00355
+   * \param buffer Holds the byte stream to do an E2E check for. This buffer includes the pre-allocated E2EHeader
+   * for the given profile and the user-data.
+   * \param non_checked_offset The offset in bytes before the check.
+   * \param payload_crc CRC of the user data following the E2E header.
+   * \return The result of this E2E check.
+   */
+  ara::e2e::e2exf::Result Check(const StreamType& buffer, const std::uint8_t non_checked_offset,
+                                const typename TransformerProfile::CRCType payload_crc) noexcept {
+    return DoCheck(buffer, non_checked_offset, [this, payload_crc](const CheckedView& buffer_view) {
+      return this->Base::Check(MergedConfig{}, buffer_view, payload_crc);
+    });
+  }
+
+ private:
+  /**
+   * \brief Configuration handed to the profile on a check.
+   */
+  struct MergedConfig : public E2EXfConfiguration::End2EndEventProtectionProps,
+                        public E2EXfConfiguration::E2EProfileProps {};
+
+  /**
+   * \brief View of the checked part of the stream.
+   */
+  using CheckedView = vac::container::const_array_view<const std::uint8_t>;
 
+  /**
+   * \brief Common check sequence.
+   *
+   * \tparam ProfileCheckFunction Callable running the profile check on the checked part of the stream.
+   */
+  template <typename ProfileCheckFunction>
+  ara::e2e::e2exf::Result DoCheck(const StreamType& buffer, const std::uint8_t non_checked_offset,
+                                  ProfileCheckFunction profile_check) noexcept {
     // First check if the non-checked offset does not exceed the overall buffer size.
     if (non_checked_offset <= buffer.size()) {
       const std::uint8_t* check_begin = &buffer[0] + non_checked_offset;
       const auto checked_size = buffer.size() - static_cast<decltype(buffer.size())>(non_checked_offset);
-      BufferView buffer_view(check_begin, checked_size);
-      const auto profile_specific_check_status = this->Base::Check(MergedConfig{}, buffer_view);
+      CheckedView buffer_view(check_begin, checked_size);
+      const auto profile_specific_check_status = profile_check(buffer_view);
       ara::e2e::state_machine::CheckStatus check_status = MapToAraCheckStatus(profile_specific_check_status);
       ara::e2e::state_machine::E2EState state = e2e_state_machine_.Check(check_status);
       return ara::e2e::e2exf::Result{state, check_status};
@@ -133,7 +197,6 @@ class Transformer : public E2EXfConfiguration::Profile {
     }
   }
 
- private:
   /**
    * \brief Maps the profile-specific check status from the AUTOSAR classic SWS
    * into the AUTOSAR adaptive one.
@@ -147,6 +147,29 @@ class Profile04 : public ProfileFrame {
     return computed_crc;
   }
 
+  /**
+   * \brief Compute the CRC over parts of the E2E header and the complete user data, for which the CRC has already been
+   * calculated while the data was written or received. Only the header is read from the buffer.
+   *
+   * \uptrace SWS_E2E_00367
+   * \tparam StreamType Deduced type of the stream
+   * \param buffer The buffer the CRC is computed for.
+   * \param length The length in bytes.
+   * \param offset in bytes the E2E header starts.
+   * \param payload_crc CRC of the user data following the E2E header, calculated with is_first_call = true.
+   * \return computed CRC-32 over parts of the header excluding the CRC field and the user data.
+   */
+  template <typename StreamType>
+  CRCType ComputeCRC(const StreamType& buffer, const LengthFieldType length, const OffsetType offset,
+                     const CRCType payload_crc) const noexcept {
+    // Calculate CRC over E2E header and the data before (offset), but skip the CRC field.
+    const CRCType computed_crc =
+        CRCProfile04::CalculateCRC32(&buffer[0U], offset + (kHeaderSize - kCRCSize), 0xFFFFFFFFU, true);
+
+    // Append the CRC of the user data.
+    return ara::crc::Crc::CombineCRC32P04(computed_crc, payload_crc, length - offset - kHeaderSize);
+  }
+
   /**
    * \brief Static size of the E2E header for profile 4.
    * The layout of the header for profile looks like this:
@@ -201,7 +224,30 @@ class Profile04Protector : public Profile04 {
    * \return kInputOk if the protection was successful, kWrongInput if on verification fault.
    */
   template <typename E2EConfig, typename StreamType>
-  ProtectReturnType Protect(const E2EConfig& config, StreamType& buffer) noexcept;
+  ProtectReturnType Protect(const E2EConfig& config, StreamType& buffer) noexcept {
+    return DoProtect(config, buffer, [this, &buffer](const LengthFieldType length, const OffsetType offset) {
+      return ComputeCRC(buffer, length, offset);
+    });
+  }
+
+  /**
+   * \brief Protect routine for E2E profile 4, for user data whose CRC has been calculated while it was serialized.
+   *
+   * \uptrace PRS_E2EProtocol_00362
+   * \tparam E2EConfig Deduced type of the configuration.
+   * \tparam StreamType Deduced type of the buffer.
+   * \param config Reference to the configuration.
+   * \param buffer Holds the bytestream that includes the pre-allocated E2E header.
+   * \param payload_crc CRC of the user data following the E2E header, calculated with is_first_call = true.
+   * \return kInputOk if the protection was successful, kWrongInput if on verification fault.
+   */
+  template <typename E2EConfig, typename StreamType>
+  ProtectReturnType Protect(const E2EConfig& config, StreamType& buffer, const CRCType payload_crc) noexcept {
+    return DoProtect(config, buffer, [this, &buffer, payload_crc](const LengthFieldType length,
+                                                                   const OffsetType offset) {
+      return ComputeCRC(buffer, length, offset, payload_crc);
+    });
+  }
 
  protected:
   /**
@@ -274,11 +320,20 @@ class Profile04Protector : public Profile04 {
    * \uptrace SWS_E2E_00369
    */
   void IncrementCounter() noexcept { ++counter_value_; }
+
+ private:
+  /**
+   * \brief Common protect routine for E2E profile 4.
+   *
+   * \tparam ComputeCRCFunction Callable returning the CRC for the length and the offset of the E2E header.
+   */
+  template <typename E2EConfig, typename StreamType, typename ComputeCRCFunction>
+  ProtectReturnType DoProtect(const E2EConfig& config, StreamType& buffer, ComputeCRCFunction compute_crc) noexcept;
 };
 
-template <typename E2EConfig, typename StreamType>
-Profile04Protector::ProtectReturnType Profile04Protector::Protect(const E2EConfig& config,
-                                                                  StreamType& buffer) noexcept {
+template <typename E2EConfig, typename StreamType, typename ComputeCRCFunction>
+Profile04Protector::ProtectReturnType Profile04Protector::DoProtect(const E2EConfig& config, StreamType& buffer,
+                                                                    ComputeCRCFunction compute_crc) noexcept {
   ProtectReturnType protect_ret{ProtectReturnType::kInputOk};
 
   // Compile-time check to verify the DataId type.
@@ -301,7 +356,7 @@ Profile04Protector::ProtectReturnType Profile04Protector::Protect(const E2EConfi
     WriteLength(buffer, length, offset);
     WriteCounter(buffer, offset);
     WriteDataID(buffer, config.kDataId, offset);
-    const auto crc = ComputeCRC(buffer, length, offset);
+    const auto crc = compute_crc(length, offset);
     WriteCRC(buffer, crc, offset);
     IncrementCounter();
   }
@@ -362,6 +417,36 @@ class Profile04Checker : public Profile04 {
    */
   template <typename E2EConfig, typename StreamType>
   CheckStatusType Check(const E2EConfig& config, StreamType& buffer) noexcept {
+    return DoCheck(config, buffer, [this, &buffer](const LengthFieldType length, const OffsetType offset) {
+      return ComputeCRC(buffer, length, offset);
+    });
+  }
+
+  /**
+   * \brief Check an incoming buffer on reception, for user data whose CRC has been calculated while it was received.
+   *
+   * \tparam E2EConfig
+   * \tparam StreamType
+   * \param config The configuration to use.
+   * \param buffer the buffer to check.
+   * \param payload_crc CRC of the user data following the E2E header, calculated with is_first_call = true.
+   * \return The check status according to the profile 4 specification.
+   */
+  template <typename E2EConfig, typename StreamType>
+  CheckStatusType Check(const E2EConfig& config, StreamType& buffer, const CRCType payload_crc) noexcept {
+    return DoCheck(config, buffer, [this, &buffer, payload_crc](const LengthFieldType length, const OffsetType offset) {
+      return ComputeCRC(buffer, length, offset, payload_crc);
+    });
+  }
+
+ protected:
+  /**
+   * \brief Common check routine for E2E profile 4.
+   *
+   * \tparam ComputeCRCFunction Callable returning the CRC for the length and the offset of the E2E header.
+   */
+  template <typename E2EConfig, typename StreamType, typename ComputeCRCFunction>
+  CheckStatusType DoCheck(const E2EConfig& config, StreamType& buffer, ComputeCRCFunction compute_crc) noexcept {
     CheckStatusType check_status{};
     const auto buffer_size{buffer.size()};
 
@@ -378,7 +463,7 @@ class Profile04Checker : public Profile04 {
         const CounterType received_counter = ReadCounter(buffer, offset);
         const DataIdType received_data_id = ReadDataID(buffer, offset);
         const CRCType received_crc = ReadCRC(buffer, offset);
-        const CRCType computed_crc = ComputeCRC(buffer, length, offset);
+        const CRCType computed_crc = compute_crc(length, offset);
         check_status = DoChecks(config, length, received_length, counter_value_, received_counter, config.kDataId,
                                 received_data_id, computed_crc, received_crc);
       } else {
@@ -391,7 +476,6 @@ class Profile04Checker : public Profile04 {
     return check_status;
   }
 
- protected:
   /**
    * \brief Reads the length field of the E2E header for profile 4 and returns it.
    *
@@ -155,6 +155,34 @@ class Profile07 : public ProfileFrame {
     return computed_crc;
   }
 
+  /**
+   * \brief Compute the CRC over parts of the E2E header and the complete user data, for which the CRC has already been
+   * calculated while the data was written or received. Only the header is read from the buffer.
+   *
+   * \uptrace SWS_E2E_00367
+   * \tparam StreamType Deduced type of the stream
+   * \param buffer The buffer the CRC is computed for.
+   * \param length The length in bytes.
+   * \param offset in bytes the E2E header starts.
+   * \param payload_crc CRC of the user data following the E2E header, calculated with is_first_call = true.
+   * \return computed CRC-64 over parts of the header excluding the CRC field and the user data.
+   */
+  template <typename StreamType>
+  CRCType ComputeCRC(const StreamType& buffer, const LengthFieldType length, const OffsetType offset,
+                     const CRCType payload_crc) const noexcept {
+    CRCType computed_crc{0xFFFFFFFFFFFFFFFFULL};
+
+    // Calculate CRC over data in the front of the E2E header.
+    if (offset > 0U) {
+      computed_crc = CRCProfile07::CalculateCRC64P07(&buffer[0U], offset, 0xFFFFFFFFFFFFFFFFULL, true);
+    }
+
+    // Calculate CRC over the E2E header behind the CRC field and append the CRC of the user data.
+    computed_crc = CRCProfile07::CalculateCRC64P07(&buffer[offset + kCRCSize], kHeaderSize - kCRCSize, computed_crc,
+                                                   false);
+    return ara::crc::Crc::CombineCRC64P07(computed_crc, payload_crc, length - offset - kHeaderSize);
+  }
+
   /**
    * \brief Static size of the E2E header for profile 7.
    * The layout of the header for profile looks like this:
@@ -209,7 +237,30 @@ class Profile07Protector : public Profile07 {
    * \return kInputOk if the protection was successful, kWrongInput if on verification fault.
    */
   template <typename E2EConfig, typename StreamType>
-  ProtectReturnType Protect(const E2EConfig& config, StreamType& buffer) noexcept;
+  ProtectReturnType Protect(const E2EConfig& config, StreamType& buffer) noexcept {
+    return DoProtect(config, buffer, [this, &buffer](const LengthFieldType length, const OffsetType offset) {
+      return ComputeCRC(buffer, length, offset);
+    });
+  }
+
+  /**
+   * \brief Protect routine for E2E profile 7, for user data whose CRC has been calculated while it was serialized.
+   *
+   * \uptrace SWS_E2E_00486
+   * \tparam E2EConfig Deduced type of the configuration.
+   * \tparam StreamType Deduced type of the buffer.
+   * \param config Reference to the configuration.
+   * \param buffer Holds the bytestream that includes the pre-allocated E2E header.
+   * \param payload_crc CRC of the user data following the E2E header, calculated with is_first_call = true.
+   * \return kInputOk if the protection was successful, kWrongInput if on verification fault.
+   */
+  template <typename E2EConfig, typename StreamType>
+  ProtectReturnType Protect(const E2EConfig& config, StreamType& buffer, const CRCType payload_crc) noexcept {
+    return DoProtect(config, buffer, [this, &buffer, payload_crc](const LengthFieldType length,
+                                                                   const OffsetType offset) {
+      return ComputeCRC(buffer, length, offset, payload_crc);
+    });
+  }
 
  protected:
   /**
@@ -290,11 +341,20 @@ class Profile07Protector : public Profile07 {
    * \uptrace SWS_E2E_00494
    */
   void IncrementCounter() noexcept { ++counter_value_; }
+
+ private:
+  /**
+   * \brief Common protect routine for E2E profile 7.
+   *
+   * \tparam ComputeCRCFunction Callable returning the CRC for the length and the offset of the E2E header.
+   */
+  template <typename E2EConfig, typename StreamType, typename ComputeCRCFunction>
+  ProtectReturnType DoProtect(const E2EConfig& config, StreamType& buffer, ComputeCRCFunction compute_crc) noexcept;
 };
 
-template <typename E2EConfig, typename StreamType>
-Profile07Protector::ProtectReturnType Profile07Protector::Protect(const E2EConfig& config,
-                                                                  StreamType& buffer) noexcept {
+template <typename E2EConfig, typename StreamType, typename ComputeCRCFunction>
+Profile07Protector::ProtectReturnType Profile07Protector::DoProtect(const E2EConfig& config, StreamType& buffer,
+                                                                    ComputeCRCFunction compute_crc) noexcept {
   ProtectReturnType protect_ret{ProtectReturnType::kInputOk};
 
   // Compile-time check to verify the DataId type.
@@ -317,7 +377,7 @@ Profile07Protector::ProtectReturnType Profile07Protector::Protect(const E2EConfi
     WriteLength(buffer, length, offset);
     WriteCounter(buffer, offset);
     WriteDataID(buffer, config.kDataId, offset);
-    const auto crc = ComputeCRC(buffer, length, offset);
+    const auto crc = compute_crc(length, offset);
     WriteCRC(buffer, crc, offset);
     IncrementCounter();
   }
@@ -378,6 +438,36 @@ class Profile07Checker : public Profile07 {
    */
   template <typename E2EConfig, typename StreamType>
   CheckStatusType Check(const E2EConfig& config, StreamType& buffer) noexcept {
+    return DoCheck(config, buffer, [this, &buffer](const LengthFieldType length, const OffsetType offset) {
+      return ComputeCRC(buffer, length, offset);
+    });
+  }
+
+  /**
+   * \brief Check an incoming buffer on reception, for user data whose CRC has been calculated while it was received.
+   *
+   * \tparam E2EConfig
+   * \tparam StreamType
+   * \param config The configuration to use.
+   * \param buffer the buffer to check.
+   * \param payload_crc CRC of the user data following the E2E header, calculated with is_first_call = true.
+   * \return The check status according to the profile 7 specification.
+   */
+  template <typename E2EConfig, typename StreamType>
+  CheckStatusType Check(const E2EConfig& config, StreamType& buffer, const CRCType payload_crc) noexcept {
+    return DoCheck(config, buffer, [this, &buffer, payload_crc](const LengthFieldType length, const OffsetType offset) {
+      return ComputeCRC(buffer, length, offset, payload_crc);
+    });
+  }
+
+ protected:
+  /**
+   * \brief Common check routine for E2E profile 7.
+   *
+   * \tparam ComputeCRCFunction Callable returning the CRC for the length and the offset of the E2E header.
+   */
+  template <typename E2EConfig, typename StreamType, typename ComputeCRCFunction>
+  CheckStatusType DoCheck(const E2EConfig& config, StreamType& buffer, ComputeCRCFunction compute_crc) noexcept {
     CheckStatusType check_status{};
     const auto buffer_size{buffer.size()};
 
@@ -394,7 +484,7 @@ class Profile07Checker : public Profile07 {
         const CounterType received_counter = ReadCounter(buffer, offset);
         const DataIdType received_data_id = ReadDataID(buffer, offset);
         const CRCType received_crc = ReadCRC(buffer, offset);
-        const CRCType computed_crc = ComputeCRC(buffer, length, offset);
+        const CRCType computed_crc = compute_crc(length, offset);
         check_status = DoChecks(config, length, received_length, counter_value_, received_counter, config.kDataId,
                                 received_data_id, computed_crc, received_crc);
       } else {
@@ -407,7 +497,6 @@ class Profile07Checker : public Profile07 {
     return check_status;
   }
 
- protected:
   /**
    * \brief Reads the length field of the E2E header for profile 7 and returns it.
    *
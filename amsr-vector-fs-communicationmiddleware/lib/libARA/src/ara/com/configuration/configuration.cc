@@ -33,6 +33,14 @@ const Configuration::SocketPath& Configuration::GetRoutingSocketPath() const noe
 
 RuntimeProcessingMode Configuration::GetProcessingMode() const noexcept { return processing_mode_; }
 
+std::uint32_t Configuration::GetSharedMemorySlotCount() const noexcept { return shared_memory_slot_count_; }
+
+std::uint32_t Configuration::GetSharedMemorySlotSize() const noexcept { return shared_memory_slot_size_; }
+
+std::uint32_t Configuration::GetRoutingReceiveBufferSize() const noexcept { return routing_receive_buffer_size_; }
+
+std::uint32_t Configuration::GetSamplePoolSize() const noexcept { return sample_pool_size_; }
+
 const Configuration::ThreadPoolConfigContainer& Configuration::GetThreadPools() const noexcept {
   return thread_pool_configs_;
 }
@@ -49,6 +49,28 @@ void JsonConfiguration::ReadJsonConfiguration() {
   // Parse the runtime processing mode
   ReadProcessingMode(application_json);
 
+  // Parse the optional shared memory transport
+  ReadSharedMemory(application_json);
+
+  // Parse the optional routing receive buffer size
+  if (application_json.HasMember("routing_receive_buffer_size")) {
+    if (!application_json["routing_receive_buffer_size"].IsUint()) {
+      logger.LogError()
+          << "Routing receive buffer size not in expected format! Must be \"routing_receive_buffer_size\": 65536";
+      throw std::runtime_error("Incorrect configuration structure for 'routing_receive_buffer_size'");
+    }
+    routing_receive_buffer_size_ = application_json["routing_receive_buffer_size"].GetUint();
+  }
+
+  // Parse the optional number of pre-allocated samples per skeleton event
+  if (application_json.HasMember("sample_pool_size")) {
+    if (!application_json["sample_pool_size"].IsUint()) {
+      logger.LogError() << "Sample pool size not in expected format! Must be \"sample_pool_size\": 4";
+      throw std::runtime_error("Incorrect configuration structure for 'sample_pool_size'");
+    }
+    sample_pool_size_ = application_json["sample_pool_size"].GetUint();
+  }
+
   // Parse thread pools
   if (application_json.HasMember("thread_pools")) {
     const auto& thread_pools_configuration = application_json["thread_pools"];
@@ -151,6 +173,31 @@ void JsonConfiguration::ReadProcessingMode(const ara::per::internal::json::JsonO
   }
 }
 
+void JsonConfiguration::ReadSharedMemory(const ara::per::internal::json::JsonObject& application_json) {
+  ara::log::Logger& logger = ara::log::CreateLogger("JsonConfiguration", "");
+  logger.LogDebug() << __func__ << ":" << __LINE__ << " Reading ara::com shared memory configuration";
+
+  if (application_json.HasMember("shared_memory_slot_count")) {
+    if (!application_json["shared_memory_slot_count"].IsUint()) {
+      logger.LogError() << "Shared memory slot count not in expected format! Must be \"shared_memory_slot_count\": 64";
+      throw std::runtime_error("Incorrect configuration structure for 'shared_memory_slot_count'");
+    }
+    shared_memory_slot_count_ = application_json["shared_memory_slot_count"].GetUint();
+    if ((shared_memory_slot_count_ & (shared_memory_slot_count_ - 1U)) != 0U) {
+      logger.LogError() << "Shared memory slot count must be a power of two: " << shared_memory_slot_count_;
+      throw std::runtime_error("Unexpected shared memory slot count value in 'shared_memory_slot_count'");
+    }
+  }
+
+  if (application_json.HasMember("shared_memory_slot_size")) {
+    if (!application_json["shared_memory_slot_size"].IsUint()) {
+      logger.LogError() << "Shared memory slot size not in expected format! Must be \"shared_memory_slot_size\": 4080";
+      throw std::runtime_error("Incorrect configuration structure for 'shared_memory_slot_size'");
+    }
+    shared_memory_slot_size_ = application_json["shared_memory_slot_size"].GetUint();
+  }
+}
+
 }  // namespace configuration
 }  // namespace com
 }  // namespace ara
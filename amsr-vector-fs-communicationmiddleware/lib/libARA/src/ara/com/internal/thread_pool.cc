@@ -61,7 +61,7 @@ void ThreadPool::Shutdown() {
   logger_.LogDebug() << __func__;
   state_ = State::kStopped;
   // The following notification is used to get threads out of the blocking wait, in case they are idle.
-  cv_.notify_all();
+  parking_.UnparkAll();
 
   for (auto& thread : workers_) {
     if (thread.joinable()) {
@@ -87,27 +87,38 @@ void ThreadPool::SpawnWorkerThreads() {
         }
       }
 
-      while (state_ == State::kRunning) {
-        std::unique_ptr<Task> task{nullptr};
-        std::unique_lock<std::mutex> lock(pool_mutex_);
-        // Either one task is waiting for the worker thread or the thread-pool is shut down.
-        cv_.wait(lock,
-                 [this] { return (!queue_.empty() || (state_ != State::kRunning)); });  // idle until work comes in
-        lock.unlock();
-        if (state_ != State::kRunning) {
-          break;
-        }
+      InplaceTask task;
+      while (WaitForTask(task)) {
+        task();  // Executes the work to do within this thread.
+        task.Reset();
+      }
+    }));
+  }
+}
 
-        task = std::move(queue_.front());
-        queue_.pop();
-        if (task) {
-          (*task)();  // Executes the work to do within this thread.
-        } else {
-          logger_.LogFatal() << "Couldn't process task because of nullptr address.";
+bool ThreadPool::WaitForTask(InplaceTask& task) {
+  // Number of queue polls before an idle worker parks. Bursts of requests are then picked up without a system call.
+  constexpr std::uint32_t kSpinCount{64U};
+  bool taken{false};
+  std::uint32_t spins{0U};
+  while (!taken && (state_ == State::kRunning)) {
+    taken = queue_.pop(task);
+    if (!taken) {
+      if (spins < kSpinCount) {
+        ++spins;
+        std::this_thread::yield();
+      } else {
+        // Either one task is waiting for the worker thread or the thread-pool is shut down.
+        const WorkerParking::Ticket ticket{parking_.Prepare()};
+        if (queue_.empty() && (state_ == State::kRunning)) {
+          parking_.Park(ticket);  // idle until work comes in
         }
+        parking_.Cancel();
+        spins = 0U;
       }
-    }));
+    }
   }
+  return taken;
 }
 
 }  // namespace internal
@@ -0,0 +1,91 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  worker_parking.cc
+ *        \brief  Parking of idle thread-pool workers
+ *
+ *      \details  -
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "ara/com/internal/worker_parking.h"
+#include <climits>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace ara {
+namespace com {
+namespace internal {
+
+WorkerParking::Ticket WorkerParking::Prepare() {
+  const Ticket ticket{epoch_.load(std::memory_order_acquire)};
+  parked_.fetch_add(1U, std::memory_order_seq_cst);
+  // Orders the announcement before the caller's check for work, pairs with the fence in Unpark().
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  return ticket;
+}
+
+void WorkerParking::Park(Ticket ticket) {
+#ifdef __linux__
+  // Returns immediately with EAGAIN if the epoch has already moved on.
+  static_cast<void>(syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&epoch_), FUTEX_WAIT_PRIVATE, ticket,
+                            nullptr, nullptr, 0));
+#else
+  std::unique_lock<std::mutex> lock(lock_);
+  cv_.wait(lock, [this, ticket]() { return epoch_.load(std::memory_order_relaxed) != ticket; });
+#endif
+}
+
+void WorkerParking::Cancel() { parked_.fetch_sub(1U, std::memory_order_relaxed); }
+
+void WorkerParking::Unpark() {
+  // Orders the caller's publication of work before the check for parked workers, pairs with Prepare().
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (parked_.load(std::memory_order_relaxed) != 0U) {
+    Wake(1);
+  }
+}
+
+void WorkerParking::UnparkAll() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  Wake(INT_MAX);
+}
+
+void WorkerParking::Wake(int count) {
+#ifdef __linux__
+  epoch_.fetch_add(1U, std::memory_order_release);
+  static_cast<void>(
+      syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&epoch_), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0));
+#else
+  {
+    std::lock_guard<std::mutex> lock(lock_);
+    epoch_.fetch_add(1U, std::memory_order_release);
+  }
+  if (count == 1) {
+    cv_.notify_one();
+  } else {
+    cv_.notify_all();
+  }
+#endif
+}
+
+}  // namespace internal
+}  // namespace com
+}  // namespace ara
@@ -24,6 +24,16 @@
 #include "ara/crc/crc.h"
 #include <array>
 #include <cassert>
+#include <cstddef>
+#include <cstring>
+#if defined(__x86_64__) || defined(__i386__)
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRYPTO)
+#include <arm_neon.h>
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
 
 namespace ara {
 namespace crc {
@@ -125,6 +135,533 @@ constexpr std::array<std::uint64_t, 256U> kLookUpTableCrc64{
 
 }  // namespace internal
 
+namespace {
+
+/**
+ * \brief Number of tables used by the slicing-by-8 engines.
+ */
+constexpr std::size_t kSliceCount{8U};
+
+/**
+ * \brief Minimum length in bytes for which the carry-less multiply engines fold four 16 byte lanes in parallel.
+ */
+constexpr std::size_t kFoldThreshold{64U};
+
+/**
+ * \brief Function type of a CRC32 engine. Works on the pre-inverted CRC register and returns it without final XOR.
+ */
+using Crc32Engine = std::uint32_t (*)(std::uint32_t crc, const std::uint8_t* data, std::size_t length);
+
+/**
+ * \brief Function type of a CRC64 engine. Works on the pre-inverted CRC register and returns it without final XOR.
+ */
+using Crc64Engine = std::uint64_t (*)(std::uint64_t crc, const std::uint8_t* data, std::size_t length);
+
+/**
+ * \brief Slicing-by-8 tables. Table 0 is the byte-wise look-up table, table k advances a byte by k further bytes.
+ */
+template <typename CrcType>
+using SlicingTables = std::array<std::array<CrcType, 256U>, kSliceCount>;
+
+/**
+ * \brief Derive the slicing-by-8 tables from a byte-wise look-up table of a reflected CRC.
+ */
+template <typename CrcType>
+SlicingTables<CrcType> MakeSlicingTables(const std::array<CrcType, 256U>& lookup) {
+  SlicingTables<CrcType> tables{};
+  tables[0U] = lookup;
+  for (std::size_t slice = 1U; slice < kSliceCount; ++slice) {
+    for (std::size_t index = 0U; index < 256U; ++index) {
+      const CrcType previous = tables[slice - 1U][index];
+      tables[slice][index] = (previous >> 8U) ^ lookup[static_cast<std::uint8_t>(previous)];
+    }
+  }
+  return tables;
+}
+
+/**
+ * \brief Slicing-by-8 tables for polynomial 0xF4ACFB13.
+ */
+const SlicingTables<std::uint32_t>& Crc32P04Tables() {
+  static const SlicingTables<std::uint32_t> tables{MakeSlicingTables(internal::kLookUpTableCrc32P04)};
+  return tables;
+}
+
+/**
+ * \brief Slicing-by-8 tables for polynomial 0x42F0E1EBA9EA3693.
+ */
+const SlicingTables<std::uint64_t>& Crc64P07Tables() {
+  static const SlicingTables<std::uint64_t> tables{MakeSlicingTables(internal::kLookUpTableCrc64)};
+  return tables;
+}
+
+/**
+ * \brief Load 8 bytes in little endian order.
+ */
+inline std::uint64_t LoadLittleEndian64(const std::uint8_t* data) {
+  std::uint64_t value{};
+  std::memcpy(&value, data, sizeof(value));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  value = __builtin_bswap64(value);
+#endif
+  return value;
+}
+
+/**
+ * \brief Process 8 bytes at once with the slicing tables. The CRC register has already been XORed into word.
+ */
+template <typename CrcType>
+inline CrcType SliceWord(const SlicingTables<CrcType>& tables, std::uint64_t word) {
+  return tables[7U][static_cast<std::uint8_t>(word)] ^ tables[6U][static_cast<std::uint8_t>(word >> 8U)] ^
+         tables[5U][static_cast<std::uint8_t>(word >> 16U)] ^ tables[4U][static_cast<std::uint8_t>(word >> 24U)] ^
+         tables[3U][static_cast<std::uint8_t>(word >> 32U)] ^ tables[2U][static_cast<std::uint8_t>(word >> 40U)] ^
+         tables[1U][static_cast<std::uint8_t>(word >> 48U)] ^ tables[0U][static_cast<std::uint8_t>(word >> 56U)];
+}
+
+/**
+ * \brief Reflected table driven CRC, processing 8 bytes per step and the remainder byte-wise.
+ */
+template <typename CrcType>
+CrcType CrcSlicingBy8(const SlicingTables<CrcType>& tables, CrcType crc, const std::uint8_t* data,
+                      std::size_t length) {
+  while (length >= kSliceCount) {
+    crc = SliceWord(tables, LoadLittleEndian64(data) ^ crc);
+    data += kSliceCount;
+    length -= kSliceCount;
+  }
+  for (; length > 0U; --length) {
+    crc = tables[0U][static_cast<std::uint8_t>(*data ^ crc)] ^ static_cast<CrcType>(crc >> 8U);
+    ++data;
+  }
+  return crc;
+}
+
+std::uint32_t Crc32P04SlicingBy8(std::uint32_t crc, const std::uint8_t* data, std::size_t length) {
+  return CrcSlicingBy8(Crc32P04Tables(), crc, data, length);
+}
+
+std::uint64_t Crc64P07SlicingBy8(std::uint64_t crc, const std::uint8_t* data, std::size_t length) {
+  return CrcSlicingBy8(Crc64P07Tables(), crc, data, length);
+}
+
+/**
+ * \brief Compute x^exponent mod P for a polynomial P of the given width, in normal (not reflected) bit order.
+ *
+ * \param polynomial The polynomial without its leading x^width term.
+ */
+std::uint64_t PowerOfXModP(std::size_t exponent, std::uint64_t polynomial, std::size_t width) {
+  const std::uint64_t top_bit{std::uint64_t{1U} << (width - 1U)};
+  const std::uint64_t mask{(top_bit - 1U) | top_bit};
+  std::uint64_t remainder{1U};
+  for (std::size_t i = 0U; i < exponent; ++i) {
+    const bool carry{(remainder & top_bit) != 0U};
+    remainder = (remainder << 1U) & mask;
+    if (carry) {
+      remainder ^= polynomial;
+    }
+  }
+  return remainder;
+}
+
+/**
+ * \brief Reverse the bit order of a 64 bit value.
+ */
+std::uint64_t Reflect64(std::uint64_t value) {
+  std::uint64_t reflected{0U};
+  for (std::size_t i = 0U; i < 64U; ++i) {
+    reflected = (reflected << 1U) | (value & 1U);
+    value >>= 1U;
+  }
+  return reflected;
+}
+
+/**
+ * \brief Constants for folding 16 byte lanes of a reflected CRC with carry-less multiplication.
+ *
+ * Folding a lane over d bits multiplies its first 8 bytes by x^(d+64) mod P and its last 8 bytes by x^d mod P. As the
+ * reflected product of two 64 bit values ends up shifted by one bit, the constants are x^(d+63) and x^(d-1) mod P.
+ */
+struct FoldConstants {
+  /**
+   * \brief Constants for folding over 4 lanes (512 bits): first and last 8 bytes of a lane.
+   */
+  std::uint64_t fold_512_first;
+  std::uint64_t fold_512_last;
+  /**
+   * \brief Constants for folding over 1 lane (128 bits): first and last 8 bytes of a lane.
+   */
+  std::uint64_t fold_128_first;
+  std::uint64_t fold_128_last;
+};
+
+FoldConstants MakeFoldConstants(std::uint64_t polynomial, std::size_t width) {
+  return FoldConstants{Reflect64(PowerOfXModP(512U + 63U, polynomial, width)),
+                       Reflect64(PowerOfXModP(512U - 1U, polynomial, width)),
+                       Reflect64(PowerOfXModP(128U + 63U, polynomial, width)),
+                       Reflect64(PowerOfXModP(128U - 1U, polynomial, width))};
+}
+
+/**
+ * \brief Folding constants for polynomial 0xF4ACFB13.
+ */
+const FoldConstants& Crc32P04FoldConstants() {
+  static const FoldConstants constants{MakeFoldConstants(0xF4ACFB13U, 32U)};
+  return constants;
+}
+
+/**
+ * \brief Folding constants for polynomial 0x42F0E1EBA9EA3693.
+ */
+const FoldConstants& Crc64P07FoldConstants() {
+  static const FoldConstants constants{MakeFoldConstants(0x42F0E1EBA9EA3693ULL, 64U)};
+  return constants;
+}
+
+/**
+ * \brief Multiply two polynomials modulo P in reflected bit order, i.e. the most significant bit of the width holds
+ * the coefficient of x^0.
+ *
+ * \param reflected_polynomial The polynomial without its leading x^width term, in reflected bit order.
+ */
+std::uint64_t MultiplyModP(std::uint64_t first, std::uint64_t second, std::uint64_t reflected_polynomial,
+                           std::size_t width) {
+  std::uint64_t product{0U};
+  for (std::uint64_t bit{std::uint64_t{1U} << (width - 1U)}; bit != 0U; bit >>= 1U) {
+    if ((first & bit) != 0U) {
+      product ^= second;
+    }
+    // Multiply second by x.
+    second = ((second & 1U) != 0U) ? ((second >> 1U) ^ reflected_polynomial) : (second >> 1U);
+  }
+  return product;
+}
+
+/**
+ * \brief Function type of a multiplication modulo the CRC32 polynomial in reflected bit order.
+ */
+using Crc32Multiplier = std::uint32_t (*)(std::uint32_t first, std::uint32_t second);
+
+/**
+ * \brief Function type of a multiplication modulo the CRC64 polynomial in reflected bit order.
+ */
+using Crc64Multiplier = std::uint64_t (*)(std::uint64_t first, std::uint64_t second);
+
+std::uint32_t Crc32P04MultiplyBitwise(std::uint32_t first, std::uint32_t second) {
+  return static_cast<std::uint32_t>(MultiplyModP(first, second, 0xC8DF352FU, 32U));
+}
+
+std::uint64_t Crc64P07MultiplyBitwise(std::uint64_t first, std::uint64_t second) {
+  return MultiplyModP(first, second, 0xC96C5795D7870F42ULL, 64U);
+}
+
+/**
+ * \brief Reduce the carry-less product of two reflected 32 bit values modulo P.
+ *
+ * Bit k of the product holds the coefficient of x^(62 - k). Bits 31 to 62 hold x^31 to x^0 and need no reduction.
+ * Bits 0 to 30 hold x^62 to x^32, which is the value they form shifted by one bit, times x^32. Multiplying by x^32
+ * is advancing the CRC register over 4 zero bytes.
+ */
+inline std::uint32_t ReduceProduct(const SlicingTables<std::uint32_t>& tables, std::uint64_t low, std::uint64_t) {
+  const std::uint32_t reduced{static_cast<std::uint32_t>(low >> 31U)};
+  const std::uint32_t overflow{static_cast<std::uint32_t>(low << 1U)};
+  return reduced ^ tables[3U][static_cast<std::uint8_t>(overflow)] ^
+         tables[2U][static_cast<std::uint8_t>(overflow >> 8U)] ^
+         tables[1U][static_cast<std::uint8_t>(overflow >> 16U)] ^
+         tables[0U][static_cast<std::uint8_t>(overflow >> 24U)];
+}
+
+/**
+ * \brief Reduce the carry-less product of two reflected 64 bit values modulo P.
+ *
+ * Bit k of the product holds the coefficient of x^(126 - k). Bits 63 to 126 hold x^63 to x^0 and need no reduction.
+ * Bits 0 to 62 hold x^126 to x^64, which is the value they form shifted by one bit, times x^64. Multiplying by x^64
+ * is advancing the CRC register over 8 zero bytes.
+ */
+inline std::uint64_t ReduceProduct(const SlicingTables<std::uint64_t>& tables, std::uint64_t low, std::uint64_t high) {
+  return ((high << 1U) | (low >> 63U)) ^ SliceWord(tables, low << 1U);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+#define ARA_CRC_FOLD_PCLMUL 1
+
+/**
+ * \brief Fold a lane over the distance given by constants and add the data following it.
+ */
+__attribute__((target("pclmul,sse2"))) inline __m128i FoldLane(__m128i lane, __m128i constants, __m128i data) {
+  return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(lane, constants, 0x00),
+                                     _mm_clmulepi64_si128(lane, constants, 0x11)),
+                       data);
+}
+
+/**
+ * \brief Reflected CRC using PCLMULQDQ folding for all full 16 byte blocks and the slicing tables for the rest.
+ *
+ * The folded lane is congruent to the processed data modulo P, so its CRC (from a zero register) equals the CRC of
+ * the processed data.
+ */
+template <typename CrcType>
+__attribute__((target("pclmul,sse2"))) CrcType CrcFoldPclmul(const SlicingTables<CrcType>& tables,
+                                                              const FoldConstants& constants, CrcType crc,
+                                                              const std::uint8_t* data, std::size_t length) {
+  if (length >= kFoldThreshold) {
+    const __m128i fold_512{_mm_set_epi64x(static_cast<std::int64_t>(constants.fold_512_last),
+                                          static_cast<std::int64_t>(constants.fold_512_first))};
+    const __m128i fold_128{_mm_set_epi64x(static_cast<std::int64_t>(constants.fold_128_last),
+                                          static_cast<std::int64_t>(constants.fold_128_first))};
+    const __m128i* blocks{reinterpret_cast<const __m128i*>(data)};
+
+    __m128i lane0{_mm_xor_si128(_mm_loadu_si128(blocks), _mm_set_epi64x(0, static_cast<std::int64_t>(crc)))};
+    __m128i lane1{_mm_loadu_si128(blocks + 1)};
+    __m128i lane2{_mm_loadu_si128(blocks + 2)};
+    __m128i lane3{_mm_loadu_si128(blocks + 3)};
+    blocks += 4;
+    length -= kFoldThreshold;
+
+    while (length >= kFoldThreshold) {
+      lane0 = FoldLane(lane0, fold_512, _mm_loadu_si128(blocks));
+      lane1 = FoldLane(lane1, fold_512, _mm_loadu_si128(blocks + 1));
+      lane2 = FoldLane(lane2, fold_512, _mm_loadu_si128(blocks + 2));
+      lane3 = FoldLane(lane3, fold_512, _mm_loadu_si128(blocks + 3));
+      blocks += 4;
+      length -= kFoldThreshold;
+    }
+
+    __m128i lane{FoldLane(lane0, fold_128, lane1)};
+    lane = FoldLane(lane, fold_128, lane2);
+    lane = FoldLane(lane, fold_128, lane3);
+    while (length >= sizeof(__m128i)) {
+      lane = FoldLane(lane, fold_128, _mm_loadu_si128(blocks));
+      ++blocks;
+      length -= sizeof(__m128i);
+    }
+
+    std::array<std::uint8_t, sizeof(__m128i)> folded{};
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(folded.data()), lane);
+    crc = CrcSlicingBy8(tables, CrcType{0U}, folded.data(), folded.size());
+    data = reinterpret_cast<const std::uint8_t*>(blocks);
+  }
+  return CrcSlicingBy8(tables, crc, data, length);
+}
+
+std::uint32_t Crc32P04Pclmul(std::uint32_t crc, const std::uint8_t* data, std::size_t length) {
+  return CrcFoldPclmul(Crc32P04Tables(), Crc32P04FoldConstants(), crc, data, length);
+}
+
+std::uint64_t Crc64P07Pclmul(std::uint64_t crc, const std::uint8_t* data, std::size_t length) {
+  return CrcFoldPclmul(Crc64P07Tables(), Crc64P07FoldConstants(), crc, data, length);
+}
+
+/**
+ * \brief Multiply modulo P with PCLMULQDQ and reduce the product with the slicing tables.
+ */
+template <typename CrcType>
+__attribute__((target("pclmul,sse2"))) CrcType MultiplyPclmul(const SlicingTables<CrcType>& tables, CrcType first,
+                                                               CrcType second) {
+  const __m128i product{_mm_clmulepi64_si128(_mm_set_epi64x(0, static_cast<std::int64_t>(first)),
+                                             _mm_set_epi64x(0, static_cast<std::int64_t>(second)), 0x00)};
+  std::array<std::uint64_t, 2U> halves{};
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(halves.data()), product);
+  return ReduceProduct(tables, halves[0U], halves[1U]);
+}
+
+std::uint32_t Crc32P04MultiplyPclmul(std::uint32_t first, std::uint32_t second) {
+  return MultiplyPclmul(Crc32P04Tables(), first, second);
+}
+
+std::uint64_t Crc64P07MultiplyPclmul(std::uint64_t first, std::uint64_t second) {
+  return MultiplyPclmul(Crc64P07Tables(), first, second);
+}
+
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRYPTO)
+#define ARA_CRC_FOLD_PMULL 1
+
+/**
+ * \brief Fold a lane over the distance given by the constants and add the data following it.
+ */
+inline uint64x2_t FoldLane(uint64x2_t lane, const poly64_t first, const poly64_t last, uint64x2_t data) {
+  const uint64x2_t product_first{vreinterpretq_u64_p128(vmull_p64(vgetq_lane_u64(lane, 0), first))};
+  const uint64x2_t product_last{vreinterpretq_u64_p128(vmull_p64(vgetq_lane_u64(lane, 1), last))};
+  return veorq_u64(veorq_u64(product_first, product_last), data);
+}
+
+/**
+ * \brief Reflected CRC using PMULL folding for all full 16 byte blocks and the slicing tables for the rest.
+ *
+ * The folded lane is congruent to the processed data modulo P, so its CRC (from a zero register) equals the CRC of
+ * the processed data.
+ */
+template <typename CrcType>
+CrcType CrcFoldPmull(const SlicingTables<CrcType>& tables, const FoldConstants& constants, CrcType crc,
+                     const std::uint8_t* data, std::size_t length) {
+  constexpr std::size_t kLaneSize{16U};
+  if (length >= kFoldThreshold) {
+    const std::uint64_t initial[2]{static_cast<std::uint64_t>(crc), 0U};
+    uint64x2_t lane0{veorq_u64(vreinterpretq_u64_u8(vld1q_u8(data)), vld1q_u64(initial))};
+    uint64x2_t lane1{vreinterpretq_u64_u8(vld1q_u8(data + kLaneSize))};
+    uint64x2_t lane2{vreinterpretq_u64_u8(vld1q_u8(data + (2U * kLaneSize)))};
+    uint64x2_t lane3{vreinterpretq_u64_u8(vld1q_u8(data + (3U * kLaneSize)))};
+    data += kFoldThreshold;
+    length -= kFoldThreshold;
+
+    while (length >= kFoldThreshold) {
+      lane0 = FoldLane(lane0, constants.fold_512_first, constants.fold_512_last,
+                       vreinterpretq_u64_u8(vld1q_u8(data)));
+      lane1 = FoldLane(lane1, constants.fold_512_first, constants.fold_512_last,
+                       vreinterpretq_u64_u8(vld1q_u8(data + kLaneSize)));
+      lane2 = FoldLane(lane2, constants.fold_512_first, constants.fold_512_last,
+                       vreinterpretq_u64_u8(vld1q_u8(data + (2U * kLaneSize))));
+      lane3 = FoldLane(lane3, constants.fold_512_first, constants.fold_512_last,
+                       vreinterpretq_u64_u8(vld1q_u8(data + (3U * kLaneSize))));
+      data += kFoldThreshold;
+      length -= kFoldThreshold;
+    }
+
+    uint64x2_t lane{FoldLane(lane0, constants.fold_128_first, constants.fold_128_last, lane1)};
+    lane = FoldLane(lane, constants.fold_128_first, constants.fold_128_last, lane2);
+    lane = FoldLane(lane, constants.fold_128_first, constants.fold_128_last, lane3);
+    while (length >= kLaneSize) {
+      lane = FoldLane(lane, constants.fold_128_first, constants.fold_128_last, vreinterpretq_u64_u8(vld1q_u8(data)));
+      data += kLaneSize;
+      length -= kLaneSize;
+    }
+
+    std::array<std::uint8_t, kLaneSize> folded{};
+    vst1q_u8(folded.data(), vreinterpretq_u8_u64(lane));
+    crc = CrcSlicingBy8(tables, CrcType{0U}, folded.data(), folded.size());
+  }
+  return CrcSlicingBy8(tables, crc, data, length);
+}
+
+std::uint32_t Crc32P04Pmull(std::uint32_t crc, const std::uint8_t* data, std::size_t length) {
+  return CrcFoldPmull(Crc32P04Tables(), Crc32P04FoldConstants(), crc, data, length);
+}
+
+std::uint64_t Crc64P07Pmull(std::uint64_t crc, const std::uint8_t* data, std::size_t length) {
+  return CrcFoldPmull(Crc64P07Tables(), Crc64P07FoldConstants(), crc, data, length);
+}
+
+/**
+ * \brief Multiply modulo P with PMULL and reduce the product with the slicing tables.
+ */
+template <typename CrcType>
+CrcType MultiplyPmull(const SlicingTables<CrcType>& tables, CrcType first, CrcType second) {
+  const uint64x2_t product{vreinterpretq_u64_p128(vmull_p64(first, second))};
+  return ReduceProduct(tables, vgetq_lane_u64(product, 0), vgetq_lane_u64(product, 1));
+}
+
+std::uint32_t Crc32P04MultiplyPmull(std::uint32_t first, std::uint32_t second) {
+  return MultiplyPmull(Crc32P04Tables(), first, second);
+}
+
+std::uint64_t Crc64P07MultiplyPmull(std::uint64_t first, std::uint64_t second) {
+  return MultiplyPmull(Crc64P07Tables(), first, second);
+}
+
+#endif
+
+/**
+ * \brief The engines selected for the executing CPU.
+ */
+struct CrcEngines {
+  /**
+   * \brief Engine for polynomial 0xF4ACFB13.
+   */
+  Crc32Engine crc32_p04;
+  /**
+   * \brief Engine for polynomial 0x42F0E1EBA9EA3693.
+   */
+  Crc64Engine crc64_p07;
+  /**
+   * \brief Multiplication modulo polynomial 0xF4ACFB13.
+   */
+  Crc32Multiplier multiply_p04;
+  /**
+   * \brief Multiplication modulo polynomial 0x42F0E1EBA9EA3693.
+   */
+  Crc64Multiplier multiply_p07;
+};
+
+/**
+ * \brief Select the carry-less multiply engines if the CPU supports them, the slicing-by-8 engines otherwise.
+ */
+CrcEngines SelectEngines() {
+  CrcEngines engines{&Crc32P04SlicingBy8, &Crc64P07SlicingBy8, &Crc32P04MultiplyBitwise, &Crc64P07MultiplyBitwise};
+#if defined(ARA_CRC_FOLD_PCLMUL)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("pclmul")) {
+    engines = CrcEngines{&Crc32P04Pclmul, &Crc64P07Pclmul, &Crc32P04MultiplyPclmul, &Crc64P07MultiplyPclmul};
+  }
+#elif defined(ARA_CRC_FOLD_PMULL)
+  if ((getauxval(AT_HWCAP) & HWCAP_PMULL) != 0U) {
+    engines = CrcEngines{&Crc32P04Pmull, &Crc64P07Pmull, &Crc32P04MultiplyPmull, &Crc64P07MultiplyPmull};
+  }
+#endif
+  return engines;
+}
+
+/**
+ * \brief The engines, selected on first use.
+ */
+const CrcEngines& Engines() {
+  static const CrcEngines engines{SelectEngines()};
+  return engines;
+}
+
+/**
+ * \brief x^(8 * 2^k) mod P in reflected bit order for k = 0..63. Appending n zero bytes to the data multiplies the
+ * CRC register by x^(8 * n), which is the product of the entries for the bits set in n.
+ */
+template <typename CrcType>
+using ZeroBytePowers = std::array<CrcType, 64U>;
+
+template <typename CrcType>
+ZeroBytePowers<CrcType> MakeZeroBytePowers(std::uint64_t reflected_polynomial) {
+  constexpr std::size_t kWidth{8U * sizeof(CrcType)};
+  ZeroBytePowers<CrcType> powers{};
+  powers[0U] = static_cast<CrcType>(std::uint64_t{1U} << (kWidth - 1U - 8U));
+  for (std::size_t k = 1U; k < powers.size(); ++k) {
+    powers[k] =
+        static_cast<CrcType>(MultiplyModP(powers[k - 1U], powers[k - 1U], reflected_polynomial, kWidth));
+  }
+  return powers;
+}
+
+/**
+ * \brief Zero byte powers for polynomial 0xF4ACFB13.
+ */
+const ZeroBytePowers<std::uint32_t>& Crc32P04ZeroBytePowers() {
+  static const ZeroBytePowers<std::uint32_t> powers{MakeZeroBytePowers<std::uint32_t>(0xC8DF352FU)};
+  return powers;
+}
+
+/**
+ * \brief Zero byte powers for polynomial 0x42F0E1EBA9EA3693.
+ */
+const ZeroBytePowers<std::uint64_t>& Crc64P07ZeroBytePowers() {
+  static const ZeroBytePowers<std::uint64_t> powers{MakeZeroBytePowers<std::uint64_t>(0xC96C5795D7870F42ULL)};
+  return powers;
+}
+
+/**
+ * \brief Combine the CRCs of two data blocks.
+ *
+ * As initial value and final XOR value are equal, the register state they contribute cancels out: the CRC of the
+ * concatenation is the first CRC advanced over as many zero bytes as the second block has, XOR the second CRC.
+ */
+template <typename CrcType, typename Multiplier>
+CrcType CombineCrc(const ZeroBytePowers<CrcType>& powers, Multiplier multiply, CrcType first_crc, CrcType second_crc,
+                   std::size_t second_length) {
+  for (std::size_t k = 0U; second_length != 0U; ++k) {
+    if ((second_length & 1U) != 0U) {
+      first_crc = multiply(powers[k], first_crc);
+    }
+    second_length >>= 1U;
+  }
+  return first_crc ^ second_crc;
+}
+
+}  // namespace
+
 std::uint32_t Crc::CalculateCRC32P04(const BufferView buffer_view, const std::uint32_t start_value,
                                      const bool is_first_call) noexcept {
   CRC32 crc{};
@@ -135,11 +672,7 @@ std::uint32_t Crc::CalculateCRC32P04(const BufferView buffer_view, const std::ui
     crc = start_value ^ kXORValueCRC32P04;
   }
 
-  for (const auto& byte : buffer_view) {
-    const std::uint8_t pos = static_cast<std::uint8_t>(byte ^ crc);
-    const std::uint32_t lookup = internal::kLookUpTableCrc32P04[pos];
-    crc = lookup ^ (crc >> 8U);
-  }
+  crc = Engines().crc32_p04(crc, buffer_view.data(), buffer_view.size());
 
   crc ^= kXORValueCRC32P04;
   return crc;
@@ -155,16 +688,21 @@ std::uint64_t Crc::CalculateCRC64P07(const BufferView buffer_view, const CRC64 s
     crc = start_value ^ kXORValueCRC64;
   }
 
-  for (const auto& byte : buffer_view) {
-    const std::uint8_t index = static_cast<std::uint8_t>(byte ^ crc);
-    const std::uint64_t lookup = internal::kLookUpTableCrc64[index];
-    crc >>= 8ULL;
-    crc ^= lookup;
-  }
+  crc = Engines().crc64_p07(crc, buffer_view.data(), buffer_view.size());
 
   crc ^= kXORValueCRC64;
   return crc;
 }
 
+std::uint32_t Crc::CombineCRC32P04(const CRC32 first_crc, const CRC32 second_crc,
+                                   const std::size_t second_length) noexcept {
+  return CombineCrc(Crc32P04ZeroBytePowers(), Engines().multiply_p04, first_crc, second_crc, second_length);
+}
+
+std::uint64_t Crc::CombineCRC64P07(const CRC64 first_crc, const CRC64 second_crc,
+                                   const std::size_t second_length) noexcept {
+  return CombineCrc(Crc64P07ZeroBytePowers(), Engines().multiply_p07, first_crc, second_crc, second_length);
+}
+
 }  // namespace crc
 }  // namespace ara
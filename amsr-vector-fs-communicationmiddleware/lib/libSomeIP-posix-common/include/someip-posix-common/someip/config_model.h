@@ -25,6 +25,7 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <cstdint>
 #include "someip-posix-common/someip/someip_posix_types.h"
 
 namespace someip_posix_common {
@@ -51,6 +52,16 @@ static constexpr const char* kDefaultRoutingSocketPath{"/tmp/someipd-posix-routi
  */
 static constexpr SomeIpBindingProcessingMode kDefaultProcessingMode{SomeIpBindingProcessingMode::kSingleThreaded};
 
+/**
+ * \brief Default maximum SOME/IP message size per shared memory slot. A slot including its header fills 4 KiB.
+ */
+static constexpr std::uint32_t kDefaultSharedMemorySlotSize{4080U};
+
+/**
+ * \brief Default size of the receive buffer for the routing socket.
+ */
+static constexpr std::uint32_t kDefaultRoutingReceiveBufferSize{64U * 1024U};
+
 /**
  * \brief Specific configuration for the usage of SOME/IP as one transport binding.
  */
@@ -70,6 +81,22 @@ class SomeIpPosixConfigModel {
    * \brief In dependence on the processing mode, the SomeIpPosix and its sockets must be configured appropriately.
    */
   SomeIpBindingProcessingMode processing_mode_{kDefaultProcessingMode};
+
+  /**
+   * \brief Number of slots per shared memory ring for SOME/IP messages exchanged with the SOME/IP daemon. Must be a
+   * power of two. Zero disables the shared memory transport and all SOME/IP messages use the routing socket.
+   */
+  std::uint32_t shared_memory_slot_count_{0U};
+
+  /**
+   * \brief Maximum size of a SOME/IP message stored in a shared memory slot. Larger messages use the routing socket.
+   */
+  std::uint32_t shared_memory_slot_size_{kDefaultSharedMemorySlotSize};
+
+  /**
+   * \brief Size of the receive buffer for the routing socket. Bounds the amount of data processed per wakeup.
+   */
+  std::uint32_t routing_receive_buffer_size_{kDefaultRoutingReceiveBufferSize};
 };
 
 }  // namespace config
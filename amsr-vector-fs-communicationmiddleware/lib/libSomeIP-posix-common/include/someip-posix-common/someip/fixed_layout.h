@@ -0,0 +1,254 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  fixed_layout.h
+ *        \brief  Compile-time layout of a sequence of fixed-size fields
+ *
+ *      \details  Generated code declares the fields of a data type with a fixed wire size once, e.g.
+ *                FixedLayout<std::uint32_t, std::uint32_t>. Size and offset of every field are then known at compile
+ *                time, so the whole sequence is serialized with one buffer resize and straight-line stores, and
+ *                deserialized after a single bounds check. Members of dynamic length still use PushBack()/PopFront().
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_LIBSOMEIP_POSIX_COMMON_INCLUDE_SOMEIP_POSIX_COMMON_SOMEIP_FIXED_LAYOUT_H_
+#define LIB_LIBSOMEIP_POSIX_COMMON_INCLUDE_SOMEIP_POSIX_COMMON_SOMEIP_FIXED_LAYOUT_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "someip-posix-common/someip/serialize.h"
+
+namespace someip_posix_common {
+namespace someip {
+namespace serialization {
+
+/** \brief Wire size of a field of a fixed layout
+ *
+ *  Integral and floating point types of 1, 2, 4 or 8 bytes are serialized with their size, bool with one byte and
+ *  enumerations with the size of their underlying type.
+ */
+template <typename DataType, typename Enable = void>
+struct FixedFieldSize {
+  static_assert(IsBulkSerializable<DataType>::value, "A fixed layout only supports fields of fixed wire size.");
+  static constexpr std::size_t value = sizeof(DataType);  ///< Wire size in bytes
+};
+
+/** \brief Specialization for bool, which is always one byte on the wire
+ *
+ */
+template <>
+struct FixedFieldSize<bool> {
+  static constexpr std::size_t value = 1U;  ///< Wire size in bytes
+};
+
+/** \brief Specialization for enumerations, which are serialized as their underlying type
+ *
+ */
+template <typename DataType>
+struct FixedFieldSize<DataType, typename std::enable_if<std::is_enum<DataType>::value>::type> {
+  static constexpr std::size_t value =
+      FixedFieldSize<typename std::underlying_type<DataType>::type>::value;  ///< Wire size in bytes
+};
+
+/** \brief Sum of the wire sizes of a sequence of fields
+ *
+ */
+template <typename... Fields>
+struct FixedFieldsSize : std::integral_constant<std::size_t, 0U> {};
+
+/** \brief Recursion over the sequence of fields
+ *
+ */
+template <typename Field, typename... Rest>
+struct FixedFieldsSize<Field, Rest...>
+    : std::integral_constant<std::size_t, FixedFieldSize<Field>::value + FixedFieldsSize<Rest...>::value> {};
+
+/** \brief Offset of the field with the given index in a sequence of fields
+ *
+ */
+template <std::size_t Index, typename... Fields>
+struct FixedFieldOffset;
+
+/** \brief The first field starts at offset 0
+ *
+ */
+template <typename Field, typename... Rest>
+struct FixedFieldOffset<0U, Field, Rest...> : std::integral_constant<std::size_t, 0U> {};
+
+/** \brief Recursion over the sequence of fields
+ *
+ */
+template <std::size_t Index, typename Field, typename... Rest>
+struct FixedFieldOffset<Index, Field, Rest...>
+    : std::integral_constant<std::size_t, FixedFieldSize<Field>::value + FixedFieldOffset<Index - 1U, Rest...>::value> {
+};
+
+/** \brief Store a single field in a buffer
+ *  \param pos position of the field in the buffer
+ *  \param v value to serialize
+ */
+template <typename Policy, typename DataType>
+inline typename std::enable_if<IsBulkSerializable<DataType>::value>::type StoreFixedField(Byte* pos,
+                                                                                         DataType v) noexcept {
+  if (sizeof(DataType) == 1U) {
+    std::memcpy(pos, &v, 1U);
+  } else {
+    const DataType ordered{(Policy::kByteOrder == ByteOrder::kMostSignificantByteFirst) ? ToMSB(v) : ToLSB(v)};
+    std::memcpy(pos, &ordered, sizeof(DataType));
+  }
+}
+
+/** \brief Store a bool field in a buffer
+ *  \param pos position of the field in the buffer
+ *  \param v value to serialize
+ */
+template <typename Policy>
+inline void StoreFixedField(Byte* pos, bool v) noexcept {
+  *pos = v ? 1U : 0U;
+}
+
+/** \brief Store an enumeration field in a buffer
+ *  \param pos position of the field in the buffer
+ *  \param v value to serialize
+ */
+template <typename Policy, typename DataType>
+inline typename std::enable_if<std::is_enum<DataType>::value>::type StoreFixedField(Byte* pos, DataType v) noexcept {
+  StoreFixedField<Policy>(pos, static_cast<typename std::underlying_type<DataType>::type>(v));
+}
+
+/** \brief Load a single field from a buffer
+ *  \param v value to deserialize into
+ *  \param pos position of the field in the buffer
+ */
+template <typename Policy, typename DataType>
+inline typename std::enable_if<IsBulkSerializable<DataType>::value>::type LoadFixedField(DataType& v,
+                                                                                        const Byte* pos) noexcept {
+  DataType ordered;
+  std::memcpy(&ordered, pos, sizeof(DataType));
+  if (sizeof(DataType) == 1U) {
+    v = ordered;
+  } else {
+    v = (Policy::kByteOrder == ByteOrder::kMostSignificantByteFirst) ? FromMSB(ordered) : FromLSB(ordered);
+  }
+}
+
+/** \brief Load a bool field from a buffer
+ *  \param v value to deserialize into
+ *  \param pos position of the field in the buffer
+ */
+template <typename Policy>
+inline void LoadFixedField(bool& v, const Byte* pos) noexcept {
+  v = *pos != 0U;
+}
+
+/** \brief Load an enumeration field from a buffer
+ *  \param v value to deserialize into
+ *  \param pos position of the field in the buffer
+ */
+template <typename Policy, typename DataType>
+inline typename std::enable_if<std::is_enum<DataType>::value>::type LoadFixedField(DataType& v,
+                                                                                  const Byte* pos) noexcept {
+  typename std::underlying_type<DataType>::type underlying;
+  LoadFixedField<Policy>(underlying, pos);
+  v = static_cast<DataType>(underlying);
+}
+
+/** \brief End of the recursion over the fields to store
+ *
+ */
+template <typename Policy, std::size_t Offset>
+inline void StoreFixedFields(Byte*) noexcept {}
+
+/** \brief Store a sequence of fields, each at its offset known at compile time
+ *  \param pos position of the first field in the buffer
+ *  \param field value of the first field
+ *  \param rest values of the remaining fields
+ */
+template <typename Policy, std::size_t Offset, typename Field, typename... Rest>
+inline void StoreFixedFields(Byte* pos, const Field& field, const Rest&... rest) noexcept {
+  StoreFixedField<Policy>(pos + Offset, field);
+  StoreFixedFields<Policy, Offset + FixedFieldSize<Field>::value>(pos, rest...);
+}
+
+/** \brief End of the recursion over the fields to load
+ *
+ */
+template <typename Policy, std::size_t Offset>
+inline void LoadFixedFields(const Byte*) noexcept {}
+
+/** \brief Load a sequence of fields, each from its offset known at compile time
+ *  \param pos position of the first field in the buffer
+ *  \param field value of the first field
+ *  \param rest values of the remaining fields
+ */
+template <typename Policy, std::size_t Offset, typename Field, typename... Rest>
+inline void LoadFixedFields(const Byte* pos, Field& field, Rest&... rest) noexcept {
+  LoadFixedField<Policy>(field, pos + Offset);
+  LoadFixedFields<Policy, Offset + FixedFieldSize<Field>::value>(pos, rest...);
+}
+
+/** \brief Layout of a sequence of fixed-size fields without padding
+ *
+ *  Usage:
+ *
+ *  using SubtractRequest = FixedLayout<std::uint32_t, std::uint32_t>;
+ *  serializer.PushBackFixed<SubtractRequest>(arg1, arg2);
+ *  deserializer.PopFrontFixed<SubtractRequest>(arg1, arg2);
+ *
+ *  \tparam Fields Types of the fields in wire order.
+ */
+template <typename... Fields>
+struct FixedLayout {
+  /// Wire size of all fields in bytes.
+  static constexpr std::size_t kSize = FixedFieldsSize<Fields...>::value;
+
+  /// Offset of the field with the given index in bytes.
+  template <std::size_t Index>
+  using Offset = FixedFieldOffset<Index, Fields...>;
+
+  /** \brief Read the fields into a buffer
+   *  \param pos position to write the serialized fields to, must provide space for kSize bytes
+   *  \param fields values of the fields
+   *  \return position after reading
+   */
+  template <typename Policy>
+  static Byte* read(Byte* pos, const Fields&... fields) noexcept {
+    StoreFixedFields<Policy, 0U>(pos, fields...);
+    return pos + kSize;
+  }
+
+  /** \brief Write the fields from a buffer
+   *  \param fields values to deserialize into
+   *  \param pos current position in buffer, must contain kSize bytes
+   *  \return new position in buffer
+   */
+  template <typename Policy>
+  static const Byte* write(const Byte* pos, Fields&... fields) noexcept {
+    LoadFixedFields<Policy, 0U>(pos, fields...);
+    return pos + kSize;
+  }
+};
+
+template <typename... Fields>
+constexpr std::size_t FixedLayout<Fields...>::kSize;
+
+}  // namespace serialization
+}  // namespace someip
+}  // namespace someip_posix_common
+
+#endif  // LIB_LIBSOMEIP_POSIX_COMMON_INCLUDE_SOMEIP_POSIX_COMMON_SOMEIP_FIXED_LAYOUT_H_
@@ -25,13 +25,17 @@
  *  INCLUDES
  *********************************************************************************************************************/
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "someip-posix-common/someip/fixed_layout.h"
 #include "someip-posix-common/someip/message.h"
+#include "someip-posix-common/someip/packet_buffer_pool.h"
 #include "someip-posix-common/someip/serialize.h"
 
 namespace someip_posix_common {
@@ -323,6 +327,34 @@ using BEPayloadUint32LengthFieldPolicy = PolicyHelper<BigEndian, std::uint32_t>;
 /// for a rapid prototype this shall be a vector.
 using PacketBuffer = std::vector<std::uint8_t>;
 
+/**
+ * \brief Interface to observe the bytes a RootSerializer writes, e.g. to calculate a checksum while serializing instead
+ * of reading the serialized data again afterwards.
+ */
+class SerializationObserver {
+ public:
+  virtual ~SerializationObserver() = default;
+
+  /**
+   * \brief Called with the next chunk of serialized bytes. The chunks follow each other without gaps.
+   *
+   * \param data Pointer to the first byte of the chunk.
+   * \param length Number of bytes in the chunk.
+   */
+  virtual void OnSerialized(const std::uint8_t* data, std::size_t length) = 0;
+
+  /**
+   * \brief Called when bytes already handed to OnSerialized() are overwritten, e.g. by a length field.
+   *
+   * \param position Position of the first overwritten byte, relative to the first byte handed to OnSerialized().
+   * \param previous The bytes as they were handed to OnSerialized().
+   * \param current The bytes as they are now.
+   * \param length Number of overwritten bytes.
+   */
+  virtual void OnOverwritten(std::size_t position, const std::uint8_t* previous, const std::uint8_t* current,
+                             std::size_t length) = 0;
+};
+
 /**
  * \brief The idea is here to have one root serializer, which is the owner of the serialized
  * byte stream (buffer) and may have multiple nested serializers that may also write their data into.
@@ -341,14 +373,14 @@ class RootSerializer {
    * \brief The constructor of a root serializer creates a new packet himself and all
    * nested serializers can push data into by calling PushBack.
    */
-  RootSerializer() : buffer_{new PacketBuffer} {}
+  RootSerializer() : buffer_{PacketBufferPool::GetInstance().AcquirePtr(0U)} {}
 
   /**
    * \brief The constructor of a root serializer gets an already allocated buffer from outside.
    *
    * \param buffer An allocated buffer.
    */
-  explicit RootSerializer(std::unique_ptr<PacketBuffer> buffer) : buffer_{std::move(buffer)}, size_{buffer_->size()} {}
+  explicit RootSerializer(PacketBufferPtr buffer) : buffer_{std::move(buffer)}, size_{buffer_->size()} {}
 
   /**
    * \brief Push data to the end of the stream.
@@ -382,6 +414,7 @@ class RootSerializer {
   void PushBack(bool data) {
     Serialize<NestedConfig>(data);
     size_ += 1U;  // add manually without using sizeof to maximize portability.
+    ObserveSerialized();
   }
 
   /**
@@ -394,6 +427,7 @@ class RootSerializer {
   void PushBack(std::uint8_t data) {
     Serialize<NestedConfig>(data);
     size_ += 1U;  // add manually without using sizeof to maximize portability.
+    ObserveSerialized();
   }
 
   /**
@@ -406,6 +440,7 @@ class RootSerializer {
   void PushBack(std::int8_t data) {
     Serialize<NestedConfig>(data);
     size_ += 1U;  // add manually without using sizeof to maximize portability.
+    ObserveSerialized();
   }
 
   /**
@@ -418,6 +453,7 @@ class RootSerializer {
   void PushBack(std::int16_t data) {
     Serialize<NestedConfig>(data);
     size_ += 2U;  // add manually without using sizeof to maximize portability.
+    ObserveSerialized();
   }
 
   /**
@@ -430,6 +466,7 @@ class RootSerializer {
   void PushBack(std::uint16_t data) {
     Serialize<NestedConfig>(data);
     size_ += 2U;  // add manually without using sizeof to maximize portability.
+    ObserveSerialized();
   }
 
   /**
@@ -442,6 +479,7 @@ class RootSerializer {
   void PushBack(std::int32_t data) {
     Serialize<NestedConfig>(data);
     size_ += 4U;  // add manually without using sizeof to maximize portability.
+    ObserveSerialized();
   }
 
   /**
@@ -454,6 +492,7 @@ class RootSerializer {
   void PushBack(std::uint32_t data) {
     Serialize<NestedConfig>(data);
     size_ += 4U;  // add manually without using sizeof to maximize portability.
+    ObserveSerialized();
   }
 
   /**
@@ -466,6 +505,7 @@ class RootSerializer {
   void PushBack(std::int64_t data) {
     Serialize<NestedConfig>(data);
     size_ += 8U;  // add manually without using sizeof to maximize portability.
+    ObserveSerialized();
   }
 
   /**
@@ -478,6 +518,7 @@ class RootSerializer {
   void PushBack(std::uint64_t data) {
     Serialize<NestedConfig>(data);
     size_ += 8U;  // add manually without using sizeof to maximize portability.
+    ObserveSerialized();
   }
 
   /**
@@ -490,6 +531,7 @@ class RootSerializer {
   void PushBack(float data) {
     Serialize<NestedConfig>(data);
     size_ += 4U;  // add manually without using sizeof to maximize portability.
+    ObserveSerialized();
   }
 
   /**
@@ -502,6 +544,73 @@ class RootSerializer {
   void PushBack(double data) {
     Serialize<NestedConfig>(data);
     size_ += 8U;  // add manually without using sizeof to maximize portability.
+    ObserveSerialized();
+  }
+
+  /**
+   * \brief Push a contiguous range of values to the end of the stream.
+   * The buffer is resized once for the whole range. If the byte order of the policy differs from the host, the
+   * values are converted in bulk, otherwise they are copied as they are.
+   *
+   * \tparam NestedConfig Specifies the policy to apply for the data to push back into the buffer.
+   * \tparam DataType Deduced data type. Integral or floating point type, except bool.
+   * \param data Pointer to the first value to serialize.
+   * \param count Number of values.
+   */
+  template <typename NestedConfig = Config, typename DataType>
+  void PushBackRange(const DataType* data, std::size_t count) {
+    std::size_t pos = size_;
+    size_ += count * sizeof(DataType);
+    buffer_->resize(size_);
+    if (observer_ == nullptr) {
+      someip_posix_common::someip::serialization::read_range<typename NestedConfig::Policy>(buffer_->data() + pos,
+                                                                                            data, count);
+    } else {
+      // Hand the range to the observer in chunks while they are still in the cache.
+      const std::size_t chunk_count{std::max<std::size_t>(kObserverChunkSize / sizeof(DataType), 1U)};
+      while (count > 0U) {
+        const std::size_t values{std::min(count, chunk_count)};
+        someip_posix_common::someip::serialization::read_range<typename NestedConfig::Policy>(buffer_->data() + pos,
+                                                                                              data, values);
+        pos += values * sizeof(DataType);
+        data += values;
+        count -= values;
+        if ((pos - observed_size_) >= kObserverChunkSize) {
+          FlushObserver(pos);
+        }
+      }
+    }
+  }
+
+  /**
+   * \brief Push all values of a contiguous container (e.g. std::vector or std::array) to the end of the stream.
+   *
+   * \tparam NestedConfig Specifies the policy to apply for the data to push back into the buffer.
+   * \tparam Container Deduced container type.
+   * \param data The values to serialize.
+   */
+  template <typename NestedConfig = Config, typename Container>
+  void PushBackRange(const Container& data) {
+    PushBackRange<NestedConfig>(data.data(), data.size());
+  }
+
+  /**
+   * \brief Push the fields of a fixed layout to the end of the stream.
+   * The buffer is resized once by the size of the layout and every field is stored at its offset known at compile
+   * time.
+   *
+   * \tparam Layout The FixedLayout describing the fields.
+   * \tparam NestedConfig Specifies the policy to apply for the data to push back into the buffer.
+   * \tparam Fields Deduced field types.
+   * \param fields The values of the fields in the order of the layout.
+   */
+  template <typename Layout, typename NestedConfig = Config, typename... Fields>
+  void PushBackFixed(const Fields&... fields) {
+    const std::size_t pos = size_;
+    size_ += Layout::kSize;
+    buffer_->resize(size_);
+    Layout::template read<typename NestedConfig::Policy>(buffer_->data() + pos, fields...);
+    ObserveSerialized();
   }
 
   /**
@@ -512,6 +621,7 @@ class RootSerializer {
   void Extend(const std::size_t bytes) {
     size_ += bytes;
     buffer_->resize(size_, 0U);
+    ObserveSerialized();
   }
 
   /**
@@ -650,6 +760,24 @@ class RootSerializer {
    */
   PacketBuffer& GetBuffer() { return *buffer_; }
 
+  /**
+   * \brief Attach an observer, which is handed all bytes serialized from now on, or detach it with nullptr.
+   * Bytes not yet handed to the previous observer are not handed to it anymore, see FlushObserver().
+   *
+   * \param observer The observer, or nullptr. Must stay valid until it is detached.
+   */
+  void SetObserver(SerializationObserver* observer) {
+    observer_ = observer;
+    observer_begin_ = size_;
+    observed_size_ = size_;
+  }
+
+  /**
+   * \brief Hand all bytes serialized so far to the observer, if any.
+   * Bytes are otherwise only handed over once they fill a chunk.
+   */
+  void FlushObserver() { FlushObserver(size_); }
+
   /**
    * \brief Check if this serializer is already closed.
    *
@@ -663,7 +791,8 @@ class RootSerializer {
    *
    * \return The complete serialized buffer.
    */
-  std::unique_ptr<PacketBuffer> Close() {
+  PacketBufferPtr Close() {
+    SetObserver(nullptr);
     closed_ = true;
     return std::move(buffer_);
   }
@@ -699,13 +828,50 @@ class RootSerializer {
   void Serialize(DataType data, std::size_t abs_pos) {
     static_assert(std::is_fundamental<DataType>::value,
                   "Must be a fundamental type or provide a serialization method for your specific complex data type.");
-    someip_posix_common::someip::serialization::read<typename NestedConfig::Policy>(buffer_->begin() + abs_pos, data);
+    if ((observer_ != nullptr) && (abs_pos >= observer_begin_) && (abs_pos < observed_size_)) {
+      // The observer has seen the previous bytes already.
+      const std::size_t length{std::min(sizeof(DataType), observed_size_ - abs_pos)};
+      std::array<std::uint8_t, sizeof(DataType)> previous;
+      std::copy(buffer_->begin() + abs_pos, buffer_->begin() + abs_pos + length, previous.begin());
+      someip_posix_common::someip::serialization::read<typename NestedConfig::Policy>(buffer_->begin() + abs_pos,
+                                                                                      data);
+      observer_->OnOverwritten(abs_pos - observer_begin_, previous.data(), buffer_->data() + abs_pos, length);
+    } else {
+      someip_posix_common::someip::serialization::read<typename NestedConfig::Policy>(buffer_->begin() + abs_pos,
+                                                                                      data);
+    }
     // DO NOT increment size_ attribute here, because we push to an existing
     // position in the byte stream.
   }
 
+  /**
+   * \brief Hand the bytes serialized since the last call to the observer, once they fill a chunk.
+   */
+  void ObserveSerialized() {
+    if ((observer_ != nullptr) && ((size_ - observed_size_) >= kObserverChunkSize)) {
+      FlushObserver(size_);
+    }
+  }
+
+  /**
+   * \brief Hand the bytes up to a position to the observer, if any.
+   *
+   * \param end Position after the last byte to hand over.
+   */
+  void FlushObserver(std::size_t end) {
+    if ((observer_ != nullptr) && (end > observed_size_)) {
+      observer_->OnSerialized(buffer_->data() + observed_size_, end - observed_size_);
+      observed_size_ = end;
+    }
+  }
+
+  /**
+   * \brief Number of bytes handed to the observer at once. Small enough to still be in the L1 cache.
+   */
+  static constexpr std::size_t kObserverChunkSize{4096U};
+
   /// The root always has access.
-  std::unique_ptr<PacketBuffer> buffer_;
+  PacketBufferPtr buffer_;
 
   /// Overall size of the serialized data.
   std::size_t size_{};
@@ -713,8 +879,20 @@ class RootSerializer {
   /// Flag if this serializer is closed to make sure, that a nested serializer
   /// is not closed before its root.
   bool closed_{false};
+
+  /// Observer of the serialized bytes, nullptr if none is attached.
+  SerializationObserver* observer_{nullptr};
+
+  /// Position of the first byte of the observer.
+  std::size_t observer_begin_{0U};
+
+  /// Position after the last byte handed to the observer.
+  std::size_t observed_size_{0U};
 };
 
+template <typename Config>
+constexpr std::size_t RootSerializer<Config>::kObserverChunkSize;
+
 /**
  * \brief The idea is that the nested serializer does not contain any info about the buffer "management" etc., but acts
  * more like a forwarder for the root serializer.
@@ -755,6 +933,44 @@ class NestedSerializer {
     root_->template PushBack<NestedConfig>(data);
   }
 
+  /**
+   * \brief Use the PushBackRange from the RootSerializer template class.
+   *
+   * \tparam NestedConfig Policy to apply for the serialization.
+   * \tparam DataType Deduced data type.
+   * \param data Pointer to the first value to push back into the byte stream.
+   * \param count Number of values.
+   */
+  template <typename NestedConfig = Config, typename DataType>
+  void PushBackRange(const DataType* data, std::size_t count) {
+    root_->template PushBackRange<NestedConfig>(data, count);
+  }
+
+  /**
+   * \brief Use the PushBackRange from the RootSerializer template class.
+   *
+   * \tparam NestedConfig Policy to apply for the serialization.
+   * \tparam Container Deduced container type.
+   * \param data The values to push back into the byte stream.
+   */
+  template <typename NestedConfig = Config, typename Container>
+  void PushBackRange(const Container& data) {
+    root_->template PushBackRange<NestedConfig>(data.data(), data.size());
+  }
+
+  /**
+   * \brief Use the PushBackFixed from the RootSerializer template class.
+   *
+   * \tparam Layout The FixedLayout describing the fields.
+   * \tparam NestedConfig Policy to apply for the serialization.
+   * \tparam Fields Deduced field types.
+   * \param fields The values of the fields in the order of the layout.
+   */
+  template <typename Layout, typename NestedConfig = Config, typename... Fields>
+  void PushBackFixed(const Fields&... fields) {
+    root_->template PushBackFixed<Layout, NestedConfig>(fields...);
+  }
+
   /**
    * \brief Uses the Push method from the RootSerializer template class.
    *
@@ -781,6 +997,18 @@ class NestedSerializer {
    */
   PacketBuffer& GetBuffer() { return root_->GetBuffer(); }
 
+  /**
+   * \brief Uses the SetObserver method from the RootSerializer template class.
+   *
+   * \param observer The observer of the serialized bytes, or nullptr to detach it.
+   */
+  void SetObserver(SerializationObserver* observer) { root_->SetObserver(observer); }
+
+  /**
+   * \brief Uses the FlushObserver method from the RootSerializer template class.
+   */
+  void FlushObserver() { root_->FlushObserver(); }
+
   /**
    * \brief Check if this serializer is already closed.
    * This is normally used from a nested serializer to check if the root is already closed.
@@ -846,7 +1074,7 @@ class Serializer<Config, void> : public RootSerializer<Config> {
   /**
    * \brief Constructor to init a root serializer with a buffer given from outside.
    */
-  explicit Serializer(std::unique_ptr<PacketBuffer> buffer) : Base(std::move(buffer)) {}
+  explicit Serializer(PacketBufferPtr buffer) : Base(std::move(buffer)) {}
 };
 
 /**
@@ -935,14 +1163,14 @@ class ComplexDataTypeSerializer<Config, void> : public Serializer<Config, void>
   /**
    * \brief The constructor of ComplexDataTypeSerializer will serialize the wire type, data id.
    */
-  explicit ComplexDataTypeSerializer(std::unique_ptr<PacketBuffer> buffer) : Base{std::move(buffer)} {
+  explicit ComplexDataTypeSerializer(PacketBufferPtr buffer) : Base{std::move(buffer)} {
     ReserveLengthField();
   }
 
   /**
    * \brief Close for the RootSerializer.
    */
-  std::unique_ptr<PacketBuffer> Close() {
+  PacketBufferPtr Close() {
     CloseHandler();
     return std::move(Base::Close());
   }
@@ -990,6 +1218,21 @@ class ComplexDataTypeSerializer<Config, void> : public Serializer<Config, void>
   std::size_t length_pos_;
 };
 
+/**
+ * \brief Wire layout of the SOME/IP header.
+ */
+using SomeIpHeaderLayout =
+    FixedLayout<::someip_posix_common::someip::ServiceId, ::someip_posix_common::someip::MethodId,
+                ::someip_posix_common::someip::LengthField, ::someip_posix_common::someip::ClientId,
+                ::someip_posix_common::someip::SessionId, ::someip_posix_common::someip::ProtocolVersion,
+                ::someip_posix_common::someip::InterfaceVersion, ::someip_posix_common::someip::MessageType,
+                ::someip_posix_common::someip::ReturnCode>;
+
+/**
+ * \brief Index of the length field in SomeIpHeaderLayout.
+ */
+static constexpr std::size_t kSomeIpHeaderLengthFieldIndex = 2U;
+
 /**
  * \brief Concrete serializer for the SOME/IP header.
  */
@@ -1023,21 +1266,13 @@ class SomeIpHeaderSerializer : public Serializer<Config, Root> {
    * \param header The SOME/IP header information to serialize and push into the buffer.
    */
   void WriteHeaderField(const ::someip_posix_common::someip::SomeIpMessageHeader& header) {
-    Base::template PushBack<BEPayloadNoLengthFieldPolicy>(header.service_id_);
-    Base::template PushBack<BEPayloadNoLengthFieldPolicy>(header.method_id_);
+    // Store the position of the length field. It is used for insertion of the length value after all the payload
+    // data has been serialized and pushed into the buffer.
+    length_pos_ = Base::GetLength() + SomeIpHeaderLayout::Offset<kSomeIpHeaderLengthFieldIndex>::value;
 
-    // Store the position of the length field right before the length field is pushed into the buffer.
-    // Getting the position here is used for insertion of the length value after all the payload data has been
-    // serialized and pushed into the buffer.
-    length_pos_ = Base::GetLength();
-
-    Base::template PushBack<BEPayloadNoLengthFieldPolicy>(header.length_);
-    Base::template PushBack<BEPayloadNoLengthFieldPolicy>(header.client_id_);
-    Base::template PushBack<BEPayloadNoLengthFieldPolicy>(header.session_id_);
-    Base::template PushBack<BEPayloadNoLengthFieldPolicy>(header.protocol_version_);
-    Base::template PushBack<BEPayloadNoLengthFieldPolicy>(header.interface_version_);
-    Base::template PushBack<BEPayloadNoLengthFieldPolicy>(header.message_type_);
-    Base::template PushBack<BEPayloadNoLengthFieldPolicy>(header.return_code_);
+    Base::template PushBackFixed<SomeIpHeaderLayout, BEPayloadNoLengthFieldPolicy>(
+        header.service_id_, header.method_id_, header.length_, header.client_id_, header.session_id_,
+        header.protocol_version_, header.interface_version_, header.message_type_, header.return_code_);
   }
 
   /**
@@ -1087,7 +1322,7 @@ class SomeIpHeaderSerializer<Config, void> : public Serializer<Config, void> {
    * \param buffer The buffer to move into this root serializer.
    * \param header The SOME/IP header data to serialize and push into the buffer.
    */
-  explicit SomeIpHeaderSerializer(std::unique_ptr<PacketBuffer> buffer,
+  explicit SomeIpHeaderSerializer(PacketBufferPtr buffer,
                                   const ::someip_posix_common::someip::SomeIpMessageHeader& header)
       : Base{std::move(buffer)}, header_begin_pos_{Base::GetLength()} {
     WriteHeaderField(header);
@@ -1098,7 +1333,7 @@ class SomeIpHeaderSerializer<Config, void> : public Serializer<Config, void> {
    *
    * \return The buffer and the ownership of it.
    */
-  std::unique_ptr<PacketBuffer> Close() {
+  PacketBufferPtr Close() {
     CloseHandler();
     return std::move(Base::Close());
   }
@@ -1110,21 +1345,13 @@ class SomeIpHeaderSerializer<Config, void> : public Serializer<Config, void> {
    * \param header The SOME/IP header information to serialize and push into the buffer.
    */
   void WriteHeaderField(const ::someip_posix_common::someip::SomeIpMessageHeader& header) {
-    Base::template PushBack<BEPayloadNoLengthFieldPolicy>(header.service_id_);
-    Base::template PushBack<BEPayloadNoLengthFieldPolicy>(header.method_id_);
-
-    // Store the position of the length field right before the length field is pushed into the buffer.
-    // Getting the position here is used for insertion of the length value after all the payload data has been
-    // serialized and pushed into the buffer.
-    length_pos_ = Base::GetLength();
+    // Store the position of the length field. It is used for insertion of the length value after all the payload
+    // data has been serialized and pushed into the buffer.
+    length_pos_ = Base::GetLength() + SomeIpHeaderLayout::Offset<kSomeIpHeaderLengthFieldIndex>::value;
 
-    Base::template PushBack<BEPayloadNoLengthFieldPolicy>(header.length_);
-    Base::template PushBack<BEPayloadNoLengthFieldPolicy>(header.client_id_);
-    Base::template PushBack<BEPayloadNoLengthFieldPolicy>(header.session_id_);
-    Base::template PushBack<BEPayloadNoLengthFieldPolicy>(header.protocol_version_);
-    Base::template PushBack<BEPayloadNoLengthFieldPolicy>(header.interface_version_);
-    Base::template PushBack<BEPayloadNoLengthFieldPolicy>(header.message_type_);
-    Base::template PushBack<BEPayloadNoLengthFieldPolicy>(header.return_code_);
+    Base::template PushBackFixed<SomeIpHeaderLayout, BEPayloadNoLengthFieldPolicy>(
+        header.service_id_, header.method_id_, header.length_, header.client_id_, header.session_id_,
+        header.protocol_version_, header.interface_version_, header.message_type_, header.return_code_);
   }
 
   /**
@@ -1183,7 +1410,7 @@ class TlvSerializer : public Serializer<Config, Root> {
    * \brief Close method if this is the root serializer.
    */
   template <typename T = Root>
-  typename std::enable_if<std::is_same<T, void>::value, std::unique_ptr<PacketBuffer>>::type Close() {
+  typename std::enable_if<std::is_same<T, void>::value, PacketBufferPtr>::type Close() {
     CloseHandler();
     return std::move(Base::Close());
   }
@@ -1325,7 +1552,7 @@ class RootDeserializer {
    *
    * \param buffer Contains the serialized data to deserialize.
    */
-  explicit RootDeserializer(std::unique_ptr<PacketBuffer> buffer)
+  explicit RootDeserializer(PacketBufferPtr buffer)
       : buffer_{std::move(buffer)}, pos_{buffer_->data()}, length_{buffer_->size()} {}
 
   /**
@@ -1350,6 +1577,57 @@ class RootDeserializer {
     return Deserialize<SelectedConfig>(data);
   }
 
+  /**
+   * \brief Pop a contiguous range of values from the current position.
+   * Either all values are popped or none, if the buffer does not contain enough data.
+   *
+   * \tparam SelectedConfig If it's a nested deserializer, a configuration is given.
+   * \tparam DataType Deduced data type. Integral or floating point type, except bool.
+   * \param data Pointer to the first value to write to.
+   * \param count Number of values.
+   *
+   * \return the size of all popped values in bytes, or 0 if the buffer does not contain enough data.
+   */
+  template <typename SelectedConfig = Config, typename DataType>
+  std::size_t PopFrontRange(DataType* data, std::size_t count) {
+    const std::size_t size = count * sizeof(DataType);
+    std::size_t nbytes{};
+
+    if ((bytes_read_ + size) <= length_) {
+      someip_posix_common::someip::serialization::write_range<typename SelectedConfig::Policy>(data, pos_, count);
+      pos_ += size;
+      bytes_read_ += size;
+      nbytes = size;
+    }
+
+    return nbytes;
+  }
+
+  /**
+   * \brief Pop the fields of a fixed layout from the current position.
+   * The buffer is checked once for the size of the layout. Either all fields are popped or none.
+   *
+   * \tparam Layout The FixedLayout describing the fields.
+   * \tparam SelectedConfig If it's a nested deserializer, a configuration is given.
+   * \tparam Fields Deduced field types. Must match the types of the layout.
+   * \param fields The objects to write the values of the fields to.
+   *
+   * \return the size of the layout in bytes, or 0 if the buffer does not contain enough data.
+   */
+  template <typename Layout, typename SelectedConfig = Config, typename... Fields>
+  std::size_t PopFrontFixed(Fields&... fields) {
+    std::size_t nbytes{};
+
+    if ((bytes_read_ + Layout::kSize) <= length_) {
+      Layout::template write<typename SelectedConfig::Policy>(pos_, fields...);
+      pos_ += Layout::kSize;
+      bytes_read_ += Layout::kSize;
+      nbytes = Layout::kSize;
+    }
+
+    return nbytes;
+  }
+
   /**
    * \brief Will return the remaining length of a serialized buffer.
    */
@@ -1387,7 +1665,7 @@ class RootDeserializer {
    *
    * \return the moved packet buffer.
    */
-  std::unique_ptr<PacketBuffer> ReleaseBuffer() { return std::move(buffer_); }
+  PacketBufferPtr ReleaseBuffer() { return std::move(buffer_); }
 
  private:
   template <typename SelectedConfig = Config, typename DataType>
@@ -1458,7 +1736,7 @@ class RootDeserializer {
   }
 
   /// The root is owner of the buffer.
-  std::unique_ptr<PacketBuffer> buffer_;
+  PacketBufferPtr buffer_;
 
   /// Current position for calling the write method to deserialize data from.
   std::uint8_t* pos_;
@@ -1501,6 +1779,34 @@ class NestedDeserializer {
     return root_->template PopFront<NestedConfig>(data);
   }
 
+  /**
+   * \brief This method uses the PopFrontRange method from the root.
+   *
+   * \tparam NestedConfig Will override the policy of the root on a PopFrontRange.
+   * \tparam DataType Deduced data type
+   * \param data Pointer to the first value to write to.
+   * \param count Number of values.
+   * \return The size in bytes which is read from the buffer of the root deserializer.
+   */
+  template <typename NestedConfig = Config, typename DataType>
+  std::size_t PopFrontRange(DataType* data, std::size_t count) {
+    return root_->template PopFrontRange<NestedConfig>(data, count);
+  }
+
+  /**
+   * \brief This method uses the PopFrontFixed method from the root.
+   *
+   * \tparam Layout The FixedLayout describing the fields.
+   * \tparam NestedConfig Will override the policy of the root on a PopFrontFixed.
+   * \tparam Fields Deduced field types.
+   * \param fields The objects to write the values of the fields to.
+   * \return The size in bytes which is read from the buffer of the root deserializer.
+   */
+  template <typename Layout, typename NestedConfig = Config, typename... Fields>
+  std::size_t PopFrontFixed(Fields&... fields) {
+    return root_->template PopFrontFixed<Layout, NestedConfig>(fields...);
+  }
+
   /**
    * \brief This method uses the GetPosition method from the root.
    */
@@ -1567,7 +1873,7 @@ class Deserializer<Config, void> : public RootDeserializer<Config> {
   /**
    * \brief Constructor to initialize a root serializer.
    */
-  explicit Deserializer(std::unique_ptr<PacketBuffer> buffer) : Base{std::move(buffer)} {}
+  explicit Deserializer(PacketBufferPtr buffer) : Base{std::move(buffer)} {}
 };
 
 /**
@@ -1602,7 +1908,7 @@ class TlvDeserializer : public Deserializer<Config, Root> {
    * \brief This constructor will set up a root serializer.
    */
   template <typename T = Root, typename std::enable_if<std::is_same<T, void>::value, int>::type = 0>
-  explicit TlvDeserializer(std::unique_ptr<PacketBuffer> buffer) : Base(std::move(buffer)) {}
+  explicit TlvDeserializer(PacketBufferPtr buffer) : Base(std::move(buffer)) {}
 
   /**
    * \brief This constructor will set up a nested serializer.
@@ -1659,6 +1965,36 @@ class TlvDeserializer : public Deserializer<Config, Root> {
     return nbytes;
   }
 
+  /**
+   * \brief The method PopFrontRange is overridden in this specialized deserializer
+   * to check for overflows like PopFront.
+   */
+  template <typename NestedConfig = Config, typename DataType>
+  std::size_t PopFrontRange(DataType* data, std::size_t count) {
+    std::size_t nbytes{};
+    if ((bytes_read_ + (count * sizeof(DataType))) <= current_len_) {
+      nbytes = Base::template PopFrontRange<NestedConfig>(data, count);
+      bytes_read_ += nbytes;
+    }
+
+    return nbytes;
+  }
+
+  /**
+   * \brief The method PopFrontFixed is overridden in this specialized deserializer
+   * to check for overflows like PopFront.
+   */
+  template <typename Layout, typename NestedConfig = Config, typename... Fields>
+  std::size_t PopFrontFixed(Fields&... fields) {
+    std::size_t nbytes{};
+    if ((bytes_read_ + Layout::kSize) <= current_len_) {
+      nbytes = Base::template PopFrontFixed<Layout, NestedConfig>(fields...);
+      bytes_read_ += nbytes;
+    }
+
+    return nbytes;
+  }
+
   /**
    * \brief Method specialization for extracting a bool from the byte stream.
    * \note sizeof(bool) depends on the implementation (normally one byte),
@@ -1837,7 +2173,7 @@ class SomeIpHeaderDeserializer : public Deserializer<Config, Root> {
    */
   template <typename T = Root, typename C = Config,
             typename std::enable_if<std::is_same<T, void>::value, int>::type = 0>
-  explicit SomeIpHeaderDeserializer(std::unique_ptr<PacketBuffer> buffer) : Base(std::move(buffer)) {
+  explicit SomeIpHeaderDeserializer(PacketBufferPtr buffer) : Base(std::move(buffer)) {
     ConsumeHeader();
   }
 
@@ -1865,15 +2201,10 @@ class SomeIpHeaderDeserializer : public Deserializer<Config, Root> {
    * data model.
    */
   void ConsumeHeader() {
-    Base::template PopFront<BEPayloadNoLengthFieldPolicy>(deserialized_header_.service_id_);
-    Base::template PopFront<BEPayloadNoLengthFieldPolicy>(deserialized_header_.method_id_);
-    Base::template PopFront<BEPayloadNoLengthFieldPolicy>(deserialized_header_.length_);
-    Base::template PopFront<BEPayloadNoLengthFieldPolicy>(deserialized_header_.client_id_);
-    Base::template PopFront<BEPayloadNoLengthFieldPolicy>(deserialized_header_.session_id_);
-    Base::template PopFront<BEPayloadNoLengthFieldPolicy>(deserialized_header_.protocol_version_);
-    Base::template PopFront<BEPayloadNoLengthFieldPolicy>(deserialized_header_.interface_version_);
-    Base::template PopFront<BEPayloadNoLengthFieldPolicy>(deserialized_header_.message_type_);
-    Base::template PopFront<BEPayloadNoLengthFieldPolicy>(deserialized_header_.return_code_);
+    Base::template PopFrontFixed<SomeIpHeaderLayout, BEPayloadNoLengthFieldPolicy>(
+        deserialized_header_.service_id_, deserialized_header_.method_id_, deserialized_header_.length_,
+        deserialized_header_.client_id_, deserialized_header_.session_id_, deserialized_header_.protocol_version_,
+        deserialized_header_.interface_version_, deserialized_header_.message_type_, deserialized_header_.return_code_);
   }
 
   /// Contains the deserialized extracted data.
@@ -1895,7 +2226,7 @@ class ComplexDataTypeDeserializer : public Deserializer<Config, Root> {
    */
   template <typename T = Root, typename C = Config,
             typename std::enable_if<std::is_same<T, void>::value, int>::type = 0>
-  explicit ComplexDataTypeDeserializer(std::unique_ptr<PacketBuffer> buffer) : Base(std::move(buffer)) {
+  explicit ComplexDataTypeDeserializer(PacketBufferPtr buffer) : Base(std::move(buffer)) {
     if (Config::LengthFieldActive) {
       length_ = ConsumeLengthField();
     }
@@ -1947,6 +2278,50 @@ class ComplexDataTypeDeserializer : public Deserializer<Config, Root> {
     return nbytes;
   }
 
+  /**
+   * \brief The method PopFrontRange is overridden in this specialized deserializer
+   * to check for overflows like PopFront.
+   */
+  template <typename NestedConfig = Config, typename DataType>
+  std::size_t PopFrontRange(DataType* data, std::size_t count) {
+    std::size_t nbytes{};
+
+    // Only do range-checking, when a length field is active
+    if (Config::LengthFieldActive) {
+      if ((bytes_read_ + (count * sizeof(DataType))) <= length_) {
+        nbytes = Base::template PopFrontRange<NestedConfig>(data, count);
+        bytes_read_ += nbytes;
+      }
+    } else {
+      nbytes = Base::template PopFrontRange<NestedConfig>(data, count);
+      bytes_read_ += nbytes;
+    }
+
+    return nbytes;
+  }
+
+  /**
+   * \brief The method PopFrontFixed is overridden in this specialized deserializer
+   * to check for overflows like PopFront.
+   */
+  template <typename Layout, typename NestedConfig = Config, typename... Fields>
+  std::size_t PopFrontFixed(Fields&... fields) {
+    std::size_t nbytes{};
+
+    // Only do range-checking, when a length field is active
+    if (Config::LengthFieldActive) {
+      if ((bytes_read_ + Layout::kSize) <= length_) {
+        nbytes = Base::template PopFrontFixed<Layout, NestedConfig>(fields...);
+        bytes_read_ += nbytes;
+      }
+    } else {
+      nbytes = Base::template PopFrontFixed<Layout, NestedConfig>(fields...);
+      bytes_read_ += nbytes;
+    }
+
+    return nbytes;
+  }
+
   /**
    * \brief Method specialization for extracting a bool from the byte stream.
    * \note sizeof(bool) depends on the implementation (normally one byte),
@@ -2026,6 +2401,13 @@ class ComplexDataTypeDeserializer : public Deserializer<Config, Root> {
    */
   bool HasDataRemaining() const noexcept { return bytes_read_ < length_; }
 
+  /**
+   * \brief Number of bytes of the complex data type which have not been popped yet.
+   * Only meaningful if a length field is active. The value is derived from the received length field and may exceed
+   * the received data, compare it with GetRemainingLength() before allocating memory for it.
+   */
+  std::size_t GetDataRemaining() const noexcept { return length_ - bytes_read_; }
+
  private:
   /**
    * \brief Consumes the length field of configured size.
@@ -0,0 +1,379 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  packet_buffer_pool.h
+ *        \brief  Pool of packet buffers for SOME/IP messages
+ *
+ *      \details  Packet buffers are recycled together with their capacity, so that steady-state messaging does not
+ *                allocate. Buffers are kept in size classes. Each thread has a small local cache in front of the
+ *                shared pool, so that the common case does not take a lock.
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_LIBSOMEIP_POSIX_COMMON_INCLUDE_SOMEIP_POSIX_COMMON_SOMEIP_PACKET_BUFFER_POOL_H_
+#define LIB_LIBSOMEIP_POSIX_COMMON_INCLUDE_SOMEIP_POSIX_COMMON_SOMEIP_PACKET_BUFFER_POOL_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace someip_posix_common {
+namespace someip {
+
+/**
+ * \brief Represents a SOME/IP message.
+ */
+using PacketBuffer = std::vector<std::uint8_t>;
+
+/**
+ * \brief Deleter which hands a packet buffer back to the PacketBufferPool instead of freeing it.
+ */
+struct PacketBufferDeleter {
+  /**
+   * \brief Default constructor.
+   */
+  PacketBufferDeleter() noexcept = default;
+  /**
+   * \brief Allows the conversion from a std::unique_ptr with the default deleter.
+   */
+  PacketBufferDeleter(const std::default_delete<PacketBuffer>&) noexcept {}  // NOLINT(runtime/explicit)
+  /**
+   * \brief Hands a packet buffer back to the pool.
+   *
+   * \param buffer A packet buffer allocated with new.
+   */
+  void operator()(PacketBuffer* buffer) const;
+};
+
+/**
+ * \brief Owning pointer to a packet buffer which is recycled on destruction.
+ */
+using PacketBufferPtr = std::unique_ptr<PacketBuffer, PacketBufferDeleter>;
+
+/**
+ * \brief Size-classed pool of packet buffers.
+ *
+ * \details A buffer is taken from the smallest size class that fits the requested size, and returned into the
+ * largest size class that its capacity covers. Buffers larger than the largest size class are not pooled. All
+ * functions are thread-safe.
+ */
+class PacketBufferPool {
+ public:
+  /**
+   * \brief Pool counters.
+   */
+  struct Statistics {
+    std::uint64_t hits_;      ///< Requests served with a recycled buffer
+    std::uint64_t misses_;    ///< Requests which had to allocate
+    std::uint64_t discards_;  ///< Returned buffers which were freed because the pool was full or they did not fit
+  };
+
+  /**
+   * \brief Number of size classes.
+   */
+  static constexpr std::size_t kSizeClassCount = 5U;
+
+  /**
+   * \brief Capacity of the smallest size class. Each following size class is four times larger.
+   */
+  static constexpr std::size_t kSmallestSizeClass = 256U;
+
+  /**
+   * \brief Maximum number of buffers per size class in the shared pool.
+   */
+  static constexpr std::size_t kMaxPooledBuffersPerClass = 256U;
+
+  /**
+   * \brief Maximum number of buffers per size class in the cache of a thread.
+   */
+  static constexpr std::size_t kThreadCacheSize = 16U;
+
+  /**
+   * \brief Returns the process-wide pool.
+   *
+   * \return The pool.
+   */
+  static PacketBufferPool& GetInstance();
+
+  /**
+   * \brief Takes a buffer from the pool.
+   *
+   * \param size The size of the returned buffer. Its contents are zero-initialized.
+   * \return A buffer of the requested size.
+   */
+  PacketBuffer Acquire(std::size_t size);
+
+  /**
+   * \brief Takes a heap-allocated buffer from the pool.
+   *
+   * \param size The size of the returned buffer. Its contents are zero-initialized.
+   * \return A buffer of the requested size, which is returned to the pool on destruction.
+   */
+  PacketBufferPtr AcquirePtr(std::size_t size);
+
+  /**
+   * \brief Returns the storage of a buffer to the pool.
+   *
+   * \param buffer A buffer. It is empty afterwards.
+   */
+  void Release(PacketBuffer&& buffer);
+
+  /**
+   * \brief Returns a heap-allocated buffer and its storage to the pool.
+   *
+   * \param buffer A buffer allocated with new.
+   */
+  void Release(PacketBuffer* buffer);
+
+  /**
+   * \brief Moves a buffer to the heap without allocating a new buffer object.
+   *
+   * \param buffer A buffer. It is empty afterwards.
+   * \return A heap-allocated buffer holding the storage of the passed buffer, which is returned to the pool on
+   *         destruction.
+   */
+  PacketBufferPtr Wrap(PacketBuffer&& buffer);
+
+  /**
+   * \brief Returns the pool counters.
+   *
+   * \return The counters accumulated since process start.
+   */
+  Statistics GetStatistics() const;
+
+  /**
+   * \brief Returns the capacity of a size class.
+   *
+   * \param size_class A size class index.
+   * \return The capacity in bytes.
+   */
+  static constexpr std::size_t GetSizeClassCapacity(std::size_t size_class) {
+    return kSmallestSizeClass << (2U * size_class);
+  }
+
+ private:
+  /**
+   * \brief Stacks of pooled buffers, one per size class.
+   */
+  struct BufferStacks {
+    std::array<std::vector<PacketBuffer>, kSizeClassCount> buffers_;  ///< Pooled buffers per size class
+    std::vector<PacketBuffer*> shells_;                                ///< Heap buffer objects without storage
+  };
+
+  /**
+   * \brief Per-thread cache in front of the shared pool. Flushed to the shared pool when the thread exits.
+   */
+  struct ThreadCache : public BufferStacks {
+    /**
+     * \brief Constructor of ThreadCache.
+     */
+    ThreadCache();
+    /**
+     * \brief Destructor of ThreadCache. Hands all cached buffers to the shared pool.
+     */
+    ~ThreadCache();
+  };
+
+  /**
+   * \brief Constructor of PacketBufferPool.
+   */
+  PacketBufferPool();
+
+  /**
+   * \brief Returns the cache of the calling thread.
+   *
+   * \return The thread cache or nullptr if it has already been destroyed because the thread is exiting.
+   */
+  static ThreadCache* GetThreadCache();
+
+  /**
+   * \brief Takes an empty heap-allocated buffer object from the pool or allocates a new one.
+   *
+   * \return An empty buffer allocated with new.
+   */
+  PacketBuffer* AcquireShell();
+
+  /**
+   * \brief Returns the smallest size class that can hold a buffer of the given size.
+   *
+   * \param size A buffer size.
+   * \return A size class index or kSizeClassCount if the size is larger than all size classes.
+   */
+  static std::size_t GetAcquireClass(std::size_t size);
+
+  /**
+   * \brief Returns the largest size class that is covered by the given capacity.
+   *
+   * \param capacity A buffer capacity.
+   * \return A size class index or kSizeClassCount if the buffer is not pooled.
+   */
+  static std::size_t GetReleaseClass(std::size_t capacity);
+
+  /**
+   * \brief Moves cached buffers and buffer objects of a thread to the shared pool, or frees them if it is full.
+   *
+   * \param cache A thread cache.
+   * \param keep Number of buffers per size class and of buffer objects which stay in the thread cache.
+   */
+  void Flush(BufferStacks& cache, std::size_t keep);
+
+  /**
+   * \brief Protects shared_.
+   */
+  std::mutex lock_;
+
+  /**
+   * \brief Buffers shared by all threads.
+   */
+  BufferStacks shared_;
+
+  /**
+   * \brief Number of requests served with a recycled buffer.
+   */
+  std::atomic<std::uint64_t> hits_;
+
+  /**
+   * \brief Number of requests which had to allocate.
+   */
+  std::atomic<std::uint64_t> misses_;
+
+  /**
+   * \brief Number of returned buffers which were freed.
+   */
+  std::atomic<std::uint64_t> discards_;
+};
+
+/**
+ * \brief Allocator for fixed-size objects such as std::allocate_shared control blocks, backed by a free list.
+ *
+ * \details Freed blocks are kept for reuse and never returned to the heap. One free list exists per block size.
+ *
+ * \tparam T The allocated type.
+ */
+template <typename T>
+class PooledObjectAllocator {
+ public:
+  /**
+   * \brief The allocated type.
+   */
+  using value_type = T;
+
+  /**
+   * \brief Default constructor.
+   */
+  PooledObjectAllocator() noexcept = default;
+
+  /**
+   * \brief Rebinding constructor.
+   */
+  template <typename U>
+  PooledObjectAllocator(const PooledObjectAllocator<U>&) noexcept {}  // NOLINT(runtime/explicit)
+
+  /**
+   * \brief Allocates storage for n objects. Only single objects are pooled.
+   *
+   * \param n Number of objects.
+   * \return Pointer to uninitialized storage.
+   */
+  T* allocate(std::size_t n) {
+    if (n == 1U) {
+      FreeList& free_list = GetFreeList();
+      std::lock_guard<std::mutex> lock(free_list.lock_);
+      if (free_list.head_ != nullptr) {
+        Block* block = free_list.head_;
+        free_list.head_ = block->next_;
+        return reinterpret_cast<T*>(block);
+      }
+    }
+    // A block freed to the free list holds a pointer, which may be larger than a T.
+    return static_cast<T*>(::operator new(std::max(n * sizeof(T), sizeof(Block))));
+  }
+
+  /**
+   * \brief Releases storage obtained from allocate().
+   *
+   * \param ptr Pointer returned by allocate().
+   * \param n Number of objects passed to allocate().
+   */
+  void deallocate(T* ptr, std::size_t n) noexcept {
+    if (n == 1U) {
+      FreeList& free_list = GetFreeList();
+      Block* block = reinterpret_cast<Block*>(ptr);
+      std::lock_guard<std::mutex> lock(free_list.lock_);
+      block->next_ = free_list.head_;
+      free_list.head_ = block;
+    } else {
+      ::operator delete(ptr);
+    }
+  }
+
+ private:
+  /**
+   * \brief A free block. Overlays the storage of a T.
+   */
+  union Block {
+    Block* next_;                                                         ///< Next free block
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_;  ///< Storage of a T
+  };
+
+  static_assert(alignof(Block) <= alignof(std::max_align_t), "::operator new does not align blocks sufficiently");
+
+  /**
+   * \brief Free list of blocks.
+   */
+  struct FreeList {
+    std::mutex lock_;         ///< Protects head_
+    Block* head_{nullptr};    ///< First free block
+  };
+
+  /**
+   * \brief Returns the free list of this block type. Intentionally never destroyed, blocks may be freed during exit.
+   *
+   * \return The free list.
+   */
+  static FreeList& GetFreeList() {
+    static FreeList* free_list = new FreeList();
+    return *free_list;
+  }
+};
+
+/**
+ * \brief All PooledObjectAllocator instances are interchangeable.
+ */
+template <typename T, typename U>
+bool operator==(const PooledObjectAllocator<T>&, const PooledObjectAllocator<U>&) noexcept {
+  return true;
+}
+
+/**
+ * \brief All PooledObjectAllocator instances are interchangeable.
+ */
+template <typename T, typename U>
+bool operator!=(const PooledObjectAllocator<T>&, const PooledObjectAllocator<U>&) noexcept {
+  return false;
+}
+
+}  // namespace someip
+}  // namespace someip_posix_common
+
+#endif  // LIB_LIBSOMEIP_POSIX_COMMON_INCLUDE_SOMEIP_POSIX_COMMON_SOMEIP_PACKET_BUFFER_POOL_H_
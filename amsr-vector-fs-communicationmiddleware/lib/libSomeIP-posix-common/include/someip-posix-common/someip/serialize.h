@@ -25,7 +25,11 @@
  *  INCLUDES
  *********************************************************************************************************************/
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <type_traits>
 
 namespace someip_posix_common {
 namespace someip {
@@ -484,6 +488,84 @@ write(DataType& v, IterType pos) {
   return pos + sizeof(DataType);
 }
 
+/******************************************************************************
+ * Bulk support
+ *
+ */
+
+/** \brief Copy elements and reverse the byte order of each element
+ *
+ *  Uses SIMD byte shuffles (AVX2 or SSSE3 if the CPU supports it, NEON on ARM) and converts the remainder one by one.
+ *
+ *  \param dst destination, must not overlap with src
+ *  \param src source
+ *  \param count number of elements
+ *  \param element_size size of one element in bytes (2, 4 or 8)
+ */
+void SwapByteOrderRange(Byte* dst, const Byte* src, std::size_t count, std::size_t element_size) noexcept;
+
+/** \brief Determines whether a type can be (de)serialized as a contiguous range of bytes
+ *
+ *  bool is excluded, because its size is implementation-specific.
+ */
+template <typename DataType>
+struct IsBulkSerializable
+    : std::integral_constant<bool, ((std::is_integral<DataType>::value || std::is_floating_point<DataType>::value) &&
+                                    !std::is_same<DataType, bool>::value &&
+                                    ((sizeof(DataType) == 1U) || (sizeof(DataType) == 2U) ||
+                                     (sizeof(DataType) == 4U) || (sizeof(DataType) == 8U)))> {};
+
+/** \brief Returns true if the byte order of the policy is the byte order of the host
+ *
+ */
+template <typename Policy>
+inline bool IsHostByteOrder() noexcept {
+  static_assert(Policy::kByteOrder != ByteOrder::kOpaque, "Bulk serialization requires a fixed byte order.");
+  return (Policy::kByteOrder == ByteOrder::kMostSignificantByteFirst) == IsHostMSB();
+}
+
+/** \brief Read a contiguous range of values into a buffer
+ *  \param pos position to write the serialized values to, must provide space for count values
+ *  \param data first value to serialize
+ *  \param count number of values
+ *  \return position after reading
+ */
+template <typename Policy = DefaultPolicy, typename DataType>
+Byte* read_range(Byte* pos, const DataType* data, std::size_t count) {
+  static_assert(IsBulkSerializable<DataType>::value, "Bulk serialization requires an integral or floating point type.");
+  const std::size_t nbytes = count * sizeof(DataType);
+  if (count != 0U) {
+    const Byte* first = reinterpret_cast<const Byte*>(data);
+    if ((sizeof(DataType) == 1U) || IsHostByteOrder<Policy>()) {
+      std::memcpy(pos, first, nbytes);
+    } else {
+      SwapByteOrderRange(pos, first, count, sizeof(DataType));
+    }
+  }
+  return pos + nbytes;
+}
+
+/** \brief Write a contiguous range of values from a buffer
+ *  \param data first value to deserialize into
+ *  \param pos current position in buffer, must contain count values
+ *  \param count number of values
+ *  \return new position in buffer
+ */
+template <typename Policy = DefaultPolicy, typename DataType>
+const Byte* write_range(DataType* data, const Byte* pos, std::size_t count) {
+  static_assert(IsBulkSerializable<DataType>::value, "Bulk serialization requires an integral or floating point type.");
+  const std::size_t nbytes = count * sizeof(DataType);
+  if (count != 0U) {
+    Byte* first = reinterpret_cast<Byte*>(data);
+    if ((sizeof(DataType) == 1U) || IsHostByteOrder<Policy>()) {
+      std::memcpy(first, pos, nbytes);
+    } else {
+      SwapByteOrderRange(first, pos, count, sizeof(DataType));
+    }
+  }
+  return pos + nbytes;
+}
+
 }  // namespace serialization
 
 }  // namespace someip
@@ -24,7 +24,10 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <vector>
+
 #include "ara/log/logging.hpp"
+#include "osabstraction/io/network/socket/datagram_socket.h"
 #include "someip-posix-common/someip/someip_message.h"
 
 namespace someip_posix_common {
@@ -42,13 +45,17 @@ class SomeIpDatagramMessageReader {
    */
   explicit SomeIpDatagramMessageReader(std::size_t max_datagram_length);
   /**
-   * \brief Tries to read a single message from a file descriptor.
+   * \brief Maximum number of datagrams read at once.
+   */
+  static constexpr std::size_t kMaxBatchedDatagrams = 16U;
+  /**
+   * \brief Reads all datagrams available on a socket, up to kMaxBatchedDatagrams, with a single system call.
    *
-   * The message reader is able to read and buffer only one message at a time.
+   * Does nothing as long as messages of previously read datagrams have not been fetched.
    *
-   * \param socket A socket from which a single message will be read.
+   * \param socket A socket from which datagrams will be read.
    */
-  void Read(osabstraction::io::network::socket::Socket* socket);
+  void Read(osabstraction::io::network::socket::DatagramSocket* socket);
   /**
    * \brief Indicates whether a complete message has been successfully read.
    *
@@ -68,15 +75,13 @@ class SomeIpDatagramMessageReader {
 
  private:
   /**
-   * \brief A helper function for reading a datagram.
-   *
-   * \param socket A socket.
+   * \brief A helper function for reading the next message contained in the received datagrams.
    */
-  void ReadDatagram(osabstraction::io::network::socket::Socket* socket);
+  void ReadMessage();
   /**
-   * \brief A helper function for reading the next message contained in the received datagram.
+   * \brief Drops the rest of the current datagram after a malformed message.
    */
-  void ReadMessage();
+  void DropDatagram();
   /**
    * \brief Our logger.
    */
@@ -86,7 +91,7 @@ class SomeIpDatagramMessageReader {
    */
   const std::size_t max_datagram_length_;
   /**
-   * \brief Number of bytes read so far.
+   * \brief Number of bytes of the current datagram read so far.
    */
   std::size_t bytes_read_;
   /**
@@ -98,9 +103,21 @@ class SomeIpDatagramMessageReader {
    */
   SomeIpMessage::DataBuffer message_;
   /**
-   * \brief Stores a single datagram.
+   * \brief Receive buffers, one per datagram. Allocated once and reused for each read.
+   */
+  std::vector<SomeIpMessage::DataBuffer> buffers_;
+  /**
+   * \brief Received datagrams, one per receive buffer.
+   */
+  std::vector<osabstraction::io::network::socket::DatagramSocket::InboundDatagram> datagrams_;
+  /**
+   * \brief Number of datagrams received by the last read.
+   */
+  std::size_t datagram_count_;
+  /**
+   * \brief Index of the datagram from which messages are currently read.
    */
-  SomeIpMessage::DataBuffer datagram_;
+  std::size_t current_datagram_;
   /**
    * \brief A remote socket address from which the message came.
    */
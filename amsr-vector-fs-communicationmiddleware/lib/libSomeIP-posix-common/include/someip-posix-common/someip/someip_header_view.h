@@ -0,0 +1,133 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  someip_header_view.h
+ *        \brief  SOME/IP message header parsed once on reception.
+ *
+ *      \details  The view decodes the 16 header bytes of a received message into host byte order and runs the
+ *                infrastructural checks matching its message type once. Routing code only reads the view and its
+ *                verification result, it never deserializes or verifies the header again.
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_LIBSOMEIP_POSIX_COMMON_INCLUDE_SOMEIP_POSIX_COMMON_SOMEIP_SOMEIP_HEADER_VIEW_H_
+#define LIB_LIBSOMEIP_POSIX_COMMON_INCLUDE_SOMEIP_POSIX_COMMON_SOMEIP_SOMEIP_HEADER_VIEW_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstdint>
+#include "someip-posix-common/someip/marshalling.h"
+#include "someip-posix-common/someip/message.h"
+#include "someip-posix-common/someip/message_verification.h"
+
+namespace someip_posix_common {
+namespace someip {
+
+/**
+ * \brief Decoded SOME/IP header of a received message together with its verification result.
+ */
+class SomeIpHeaderView {
+ public:
+  /**
+   * \brief Decodes the SOME/IP header and runs the infrastructural checks for its message type.
+   *
+   * \param data Pointer to the serialized SOME/IP header, must contain at least kHeaderSize bytes.
+   */
+  explicit SomeIpHeaderView(const std::uint8_t* data) noexcept : header_(), verification_result_(), known_type_() {
+    serialization::SomeIpHeaderLayout::write<serialization::BEPayloadNoLengthFieldPolicy::Policy>(
+        data, header_.service_id_, header_.method_id_, header_.length_, header_.client_id_, header_.session_id_,
+        header_.protocol_version_, header_.interface_version_, header_.message_type_, header_.return_code_);
+    Verify();
+  }
+
+  /**
+   * \brief Returns the decoded SOME/IP header.
+   *
+   * \return SOME/IP message header in host byte order.
+   */
+  const SomeIpMessageHeader& GetHeader() const noexcept { return header_; }
+
+  /**
+   * \brief Returns the result of the infrastructural checks for the message type of the header.
+   *
+   * \return E_OK if all checks passed, the return code of the first failed check otherwise.
+   */
+  SomeIpReturnCode GetVerificationResult() const noexcept {
+    return static_cast<SomeIpReturnCode>(verification_result_);
+  }
+
+  /**
+   * \brief Tells whether the header passed the infrastructural checks.
+   *
+   * \return true if the message may be forwarded, false otherwise.
+   */
+  bool IsVerified() const noexcept { return verification_result_ == SomeIpReturnCode::kOk; }
+
+  /**
+   * \brief Tells whether the message type of the header is one of the types defined by SOME/IP.
+   *
+   * \return true if the message type is known, false otherwise.
+   */
+  bool HasKnownMessageType() const noexcept { return known_type_; }
+
+ private:
+  /**
+   * \brief Runs the infrastructural checks selected by the message type.
+   */
+  void Verify() noexcept {
+    SomeIpReturnCode result{SomeIpReturnCode::kWrongMessageType};
+    known_type_ = true;
+    switch (header_.message_type_) {
+      case SomeIpMessageType::kRequest:
+        result = RequestMessageVerification::DoInfrastructuralChecks(header_);
+        break;
+      case SomeIpMessageType::kRequestNoReturn:
+        result = RequestNoReturnMessageVerification::DoInfrastructuralChecks(header_);
+        break;
+      case SomeIpMessageType::kNotification:
+        result = EventMessageVerification::DoInfrastructuralChecks(header_);
+        break;
+      case SomeIpMessageType::kResponse:
+        result = ResponseMessageVerification::DoInfrastructuralChecks(header_);
+        break;
+      case SomeIpMessageType::kError:
+        result = ErrorMessageVerification::DoInfrastructuralChecks(header_);
+        break;
+      default:
+        known_type_ = false;
+        break;
+    }
+    verification_result_ = static_cast<ReturnCode>(result);
+  }
+
+  /**
+   * \brief SOME/IP header in host byte order.
+   */
+  SomeIpMessageHeader header_;
+  /**
+   * \brief Result of the infrastructural checks.
+   */
+  ReturnCode verification_result_;
+  /**
+   * \brief Whether the message type is known.
+   */
+  bool known_type_;
+};
+
+static_assert(sizeof(SomeIpHeaderView) <= 2U * kHeaderSize, "SomeIpHeaderView shall stay compact.");
+
+}  // namespace someip
+}  // namespace someip_posix_common
+
+#endif  // LIB_LIBSOMEIP_POSIX_COMMON_INCLUDE_SOMEIP_POSIX_COMMON_SOMEIP_SOMEIP_HEADER_VIEW_H_
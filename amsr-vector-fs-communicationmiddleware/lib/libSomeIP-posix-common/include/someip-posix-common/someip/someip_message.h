@@ -26,11 +26,14 @@
  *********************************************************************************************************************/
 #include <sys/uio.h>
 #include <array>
+#include <memory>
 #include <utility>
 #include <vector>
 #include "osabstraction/io/network/socket/socket.h"
 #include "someip-posix-common/someip/marshalling.h"
 #include "someip-posix-common/someip/message.h"
+#include "someip-posix-common/someip/packet_buffer_pool.h"
+#include "someip-posix-common/someip/someip_header_view.h"
 #include "someip-posix-common/someip/someip_posix_types.h"
 #include "vac/container/array_view.h"
 
@@ -67,12 +70,36 @@ class SomeIpMessage {
    * \param from_address A socket address of the sender of the SOME/IP message.
    */
   SomeIpMessage(DataBuffer&& data, const SocketAddress& from_address);
+  /**
+   * \brief Move constructor of SomeIpMessage.
+   */
+  SomeIpMessage(SomeIpMessage&& other) = default;
+  /**
+   * \brief Destructor of SomeIpMessage. Returns the data buffer to the PacketBufferPool.
+   */
+  ~SomeIpMessage();
+  /**
+   * \brief Creates a shared SOME/IP message whose object and reference counts are stored in a single pooled block.
+   *
+   * \param args Arguments of one of the constructors.
+   * \return The created SOME/IP message.
+   */
+  template <typename... Args>
+  static std::shared_ptr<SomeIpMessage> CreateShared(Args&&... args) {
+    return std::allocate_shared<SomeIpMessage>(PooledObjectAllocator<SomeIpMessage>(), std::forward<Args>(args)...);
+  }
   /**
    * \brief Returns the SOME/IP message header of the contained SOME/IP message.
    *
    * \return SOME/IP message header.
    */
-  const SomeIpMessageHeader& GetHeader() const { return deserializer_.GetDeserializedHeader(); }
+  const SomeIpMessageHeader& GetHeader() const { return header_view_.GetHeader(); }
+  /**
+   * \brief Returns the SOME/IP header view parsed and verified on construction.
+   *
+   * \return SOME/IP header view.
+   */
+  const SomeIpHeaderView& GetHeaderView() const { return header_view_; }
   /**
    * \brief Returns a pointer to the body of the contained SOME/IP message.
    *
@@ -114,9 +141,9 @@ class SomeIpMessage {
    */
   const std::pair<SocketAddress, bool> from_address_;
   /**
-   * \brief A SOME/IP header deserializer.
+   * \brief The SOME/IP header, parsed once from data_.
    */
-  serialization::SomeIpHeaderDeserializer<serialization::BEPayloadNoLengthFieldPolicy> deserializer_;
+  const SomeIpHeaderView header_view_;
   /**
    * \brief An array of struct iovec covering the whole SOME/IP message.
    */
@@ -26,11 +26,14 @@
  *********************************************************************************************************************/
 
 #include <chrono>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "someip-posix-common/someip/packet_buffer_pool.h"
+
 namespace someip_posix_common {
 namespace someip {
 
@@ -178,11 +181,28 @@ using KeepAliveEnable = bool;
  */
 using TcpKeepAliveOption = std::pair<KeepAliveEnable, KeepAliveParameters>;
 
+/**
+ * \brief Limits of the outbound queue of a TCP connection in bytes. A value of 0 selects the default.
+ */
+struct TcpSendQueueParameters {
+  /**
+   * \brief Queued bytes above which notifications are dropped according to their drop policy.
+   */
+  std::size_t high_watermark_;
+
+  /**
+   * \brief Queued bytes at or below which a congested queue is considered drained again.
+   */
+  std::size_t low_watermark_;
+};
+
 /**
  * \brief Options of a socket combined in a structure.
  * Possible options are
  * - QoS
  * - KeepAlive
+ * - TCP send queue limits
+ * - UDP segmentation offload
  */
 struct SocketOptions {
   /**
@@ -193,6 +213,14 @@ struct SocketOptions {
    * \brief KeepAlive option for TCP sockets.
    */
   TcpKeepAliveOption keep_alive_;
+  /**
+   * \brief Outbound queue limits for TCP sockets.
+   */
+  TcpSendQueueParameters send_queue_;
+  /**
+   * \brief Use UDP generic segmentation offload where the kernel supports it.
+   */
+  bool segmentation_offload_;
 };
 
 /**
@@ -242,14 +270,10 @@ struct EventSubscriptionState {
 };
 
 /**
- * \brief Represents a SOME/IP message.
- */
-using PacketBuffer = std::vector<std::uint8_t>;
-
-/**
- * \brief Represents a unique pointer to a SOME/IP message.
+ * \brief Represents a unique pointer to a SOME/IP message. The buffer is returned to the PacketBufferPool on
+ * destruction.
  */
-using SomeIpPacket = std::unique_ptr<PacketBuffer>;
+using SomeIpPacket = PacketBufferPtr;
 
 /**
  * \brief Transmission trigger buffer size in bytes.
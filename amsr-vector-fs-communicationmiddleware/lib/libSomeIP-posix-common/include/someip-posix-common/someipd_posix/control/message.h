@@ -100,7 +100,25 @@ enum MessageType {
    * A request sent by an application to the SOME/IP daemon informing it about the Requested
    *  SOME/IP service instance by this application.
    */
-  kReleaseService
+  kReleaseService,
+  /**
+   * A request sent by an application to the SOME/IP daemon to move the SOME/IP messages of its routing channel
+   * to a pair of shared memory rings. The file descriptors of both rings are passed along with the request.
+   */
+  kAttachSharedMemoryRequest,
+  /**
+   * A message sent by the SOME/IP daemon to an application as a response to an AttachSharedMemory request.
+   */
+  kAttachSharedMemoryResponse,
+  /**
+   * A request sent by an application to the SOME/IP daemon carrying a sequence of control operations which are
+   * applied in one pass.
+   */
+  kBatchRequest,
+  /**
+   * A message sent by the SOME/IP daemon to an application as a response to a Batch request.
+   */
+  kBatchResponse
 };
 
 /**
@@ -217,6 +235,58 @@ struct MessageUnsubscribeEvent {
   std::uint16_t event_id_;     ///< A SOME/IP event identifier
 };
 
+/**
+ * \brief Index of the file descriptors passed along with an AttachSharedMemory request.
+ */
+enum SharedMemoryHandleIndex {
+  kToDaemonMemoryHandle = 0,     ///< Shared memory file of the ring from the application to the daemon
+  kToDaemonDoorbellHandle,       ///< Doorbell of the ring from the application to the daemon
+  kToApplicationMemoryHandle,    ///< Shared memory file of the ring from the daemon to the application
+  kToApplicationDoorbellHandle,  ///< Doorbell of the ring from the daemon to the application
+  kSharedMemoryHandleCount       ///< Number of passed file descriptors
+};
+
+/**
+ * \brief AttachSharedMemory request message.
+ */
+struct MessageAttachSharedMemoryRequest {
+  std::uint32_t slot_count_;  ///< Number of slots per ring
+  std::uint32_t slot_size_;   ///< Maximum SOME/IP message size per slot
+};
+
+/**
+ * \brief AttachSharedMemory response message.
+ */
+struct MessageAttachSharedMemoryResponse {
+  std::uint32_t accepted_;  ///< Non-zero if the daemon uses the shared memory rings from now on
+};
+
+/**
+ * \brief Entry of a Batch request message.
+ *
+ * Carries one of the operations kOfferService, kStopOfferService, kRequestService, kReleaseService,
+ * kStartFindService, kStopFindService, kSubscribeEvent and kUnsubscribeEvent. Fields not used by the operation are 0.
+ */
+struct MessageBatchEntry {
+  std::uint16_t type_;         ///< Message type of the operation
+  std::uint16_t service_id_;   ///< A SOME/IP service identifier
+  std::uint16_t instance_id_;  ///< A SOME/IP service instance identifier
+  std::uint16_t event_id_;     ///< A SOME/IP event identifier
+};
+
+/**
+ * \brief Maximum number of entries in a single Batch request message.
+ */
+static constexpr std::uint32_t kMaxBatchEntries = 4096U;
+
+/**
+ * \brief Batch response message.
+ */
+struct MessageBatchResponse {
+  std::uint32_t applied_;   ///< Number of operations applied by the daemon
+  std::uint32_t rejected_;  ///< Number of operations skipped because they were invalid or redundant
+};
+
 }  // namespace control
 }  // namespace someipd_posix
 }  // namespace someip_posix_common
@@ -62,7 +62,14 @@ enum MessageType {
   /**
    * A message sent by the SOME/IP daemon to an application informing it about event subscription state update.
    */
-  kServiceDiscoveryEventSubscriptionState
+  kServiceDiscoveryEventSubscriptionState,
+  /**
+   * A message containing a SOME/IP message which is sent over the routing socket although a shared memory ring is
+   * attached, because the message did not fit into the ring. The receiver first processes all messages left in the
+   * ring and then acknowledges the message in the ring. Until then the sender sends all further SOME/IP messages this
+   * way as well, so that no message overtakes another one.
+   */
+  kSomeIPRingFallback
 };
 
 /**
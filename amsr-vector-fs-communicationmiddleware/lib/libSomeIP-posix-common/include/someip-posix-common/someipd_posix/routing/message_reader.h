@@ -24,6 +24,8 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -37,6 +39,10 @@ namespace routing {
 
 /**
  * \brief Message reader.
+ *
+ * \details The reader receives into a receive buffer with one system call per Read() and parses as many complete
+ * messages as the received data contains. The size of the receive buffer bounds the amount of data processed per
+ * Read() call. Message bodies larger than the receive buffer are received directly into the message.
  */
 class MessageReader {
  public:
@@ -47,20 +53,27 @@ class MessageReader {
     MessageHeader header_;            ///< A message header
     std::vector<std::uint8_t> body_;  ///< A message body
   };
+  /**
+   * \brief Default size of the receive buffer.
+   */
+  static constexpr std::size_t kDefaultReceiveBufferSize = 64U * 1024U;
   /**
    * \brief Constructor of MessageReader.
+   *
+   * \param receive_buffer_size Size of the receive buffer. Values smaller than a message header are rounded up.
    */
-  MessageReader();
+  explicit MessageReader(std::size_t receive_buffer_size = kDefaultReceiveBufferSize);
   /**
    * \brief Destructor of MessageReader.
    */
   ~MessageReader() = default;
   /**
-   * \brief Tries to read a single message from a file descriptor.
+   * \brief Receives the data available on a socket with a single system call.
    *
-   * The message reader is able to read and buffer only one message at a time.
+   * Does nothing if a complete message is still available. Must only be called when the socket is readable, or for a
+   * non-blocking socket.
    *
-   * \param socket A socket from which a single message will be read.
+   * \param socket A socket from which data will be read.
    */
   void Read(osabstraction::io::network::socket::Socket* socket);
   /**
@@ -73,8 +86,9 @@ class MessageReader {
   /**
    * \brief Transfers the ownership of the read message to the caller.
    *
-   * This function should be called to fetch the next message if it is available.
-   * The message reader can read the next message after returning.
+   * This function should be called to fetch the next message if it is available. Afterwards, the next message is
+   * parsed from the data already received, so IsMessageAvailable() tells whether another message can be fetched
+   * without calling Read().
    *
    * \return the next complete message.
    */
@@ -82,21 +96,29 @@ class MessageReader {
 
  private:
   /**
-   * \brief A helper function for reading a message's header.
-   *
-   * \param socket A socket.
+   * \brief Parses the received data into message_ until the message is complete or the data is used up.
    */
-  void ReadHeader(osabstraction::io::network::socket::Socket* socket);
+  void Parse();
   /**
-   * \brief A helper function for reading a message's body.
-   *
-   * \param socket A socket.
+   * \brief Receive buffer.
+   */
+  std::vector<std::uint8_t> buffer_;
+  /**
+   * \brief Offset of the first received byte in buffer_ which has not been parsed yet.
+   */
+  std::size_t buffer_begin_;
+  /**
+   * \brief Offset behind the last received byte in buffer_.
+   */
+  std::size_t buffer_end_;
+  /**
+   * \brief Indicates whether the header of message_ is complete.
    */
-  void ReadBody(osabstraction::io::network::socket::Socket* socket);
+  bool is_header_complete_;
   /**
-   * \brief Number of bytes read so far.
+   * \brief Number of body bytes of message_ read so far.
    */
-  std::size_t bytes_read_;
+  std::size_t body_bytes_read_;
   /**
    * \brief Indicates whether a complete message has been read successfully.
    */
@@ -0,0 +1,284 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  shared_memory_ring.h
+ *        \brief  Shared memory ring buffer for routing messages
+ *
+ *      \details  A shared memory ring is a single-producer/single-consumer queue of fixed-size slots placed in an
+ *                anonymous shared memory file. Each slot holds one routing message header followed by the message
+ *                body. The consumer is woken up through an eventfd doorbell, which is only rung by the producer when
+ *                the consumer may have run out of messages. Both file descriptors are passed to the peer process over
+ *                the control socket.
+ *                A message that does not fit into the ring is sent over the routing socket instead. The producer
+ *                keeps using the socket until the consumer has acknowledged that message, which it does after having
+ *                drained the ring, so that messages are delivered in the order they were sent.
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_LIBSOMEIP_POSIX_COMMON_INCLUDE_SOMEIP_POSIX_COMMON_SOMEIPD_POSIX_ROUTING_SHARED_MEMORY_RING_H_
+#define LIB_LIBSOMEIP_POSIX_COMMON_INCLUDE_SOMEIP_POSIX_COMMON_SOMEIPD_POSIX_ROUTING_SHARED_MEMORY_RING_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <sys/uio.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "someip-posix-common/someipd_posix/routing/message.h"
+#include "vac/container/array_view.h"
+
+namespace someip_posix_common {
+namespace someipd_posix {
+namespace routing {
+
+/**
+ * \brief Single-producer/single-consumer ring of routing messages in shared memory.
+ */
+class SharedMemoryRing {
+ public:
+  /**
+   * \brief I/O vector container.
+   */
+  using IovecContainer = vac::container::array_view<struct iovec>;
+
+  /**
+   * \brief Creates a new ring in an anonymous shared memory file.
+   *
+   * \param slot_count Number of slots. Must be a power of two.
+   * \param slot_size Maximum size of a message body stored in a slot.
+   * \return The created ring.
+   */
+  static std::unique_ptr<SharedMemoryRing> Create(std::uint32_t slot_count, std::uint32_t slot_size);
+
+  /**
+   * \brief Maps a ring created by another process.
+   *
+   * The ring takes ownership of the passed file descriptors, also if the mapping fails.
+   *
+   * \param memory_handle File descriptor of the shared memory file.
+   * \param doorbell_handle File descriptor of the doorbell eventfd.
+   * \return The mapped ring or nullptr if the shared memory file does not contain a valid ring.
+   */
+  static std::unique_ptr<SharedMemoryRing> Attach(int memory_handle, int doorbell_handle);
+
+  /**
+   * \brief Destructor of SharedMemoryRing. Unmaps the shared memory and closes both file descriptors.
+   */
+  ~SharedMemoryRing();
+
+  /**
+   * \brief SharedMemoryRing is not copy-constructable.
+   */
+  SharedMemoryRing(const SharedMemoryRing& other) = delete;
+
+  /**
+   * \brief SharedMemoryRing is not copy-assignable.
+   */
+  SharedMemoryRing& operator=(const SharedMemoryRing& other) = delete;
+
+  /**
+   * \brief Copies a message into the next free slot and publishes it to the consumer.
+   *
+   * Must only be called by the producer side.
+   *
+   * \param header The routing message header. Its length must match the total length of body_iovc.
+   * \param body_iovc An I/O vector container for the message body.
+   * \return false if the ring is full, the message does not fit into a slot or a message sent over the routing socket
+   *         instead has not been acknowledged yet, true otherwise. The message must then be sent over the routing
+   *         socket as kSomeIPRingFallback, followed by a call to NotifyFallbackSent().
+   */
+  bool TryWrite(const MessageHeader& header, IovecContainer body_iovc);
+
+  /**
+   * \brief Records that a message was sent over the routing socket instead of the ring.
+   *
+   * Must only be called by the producer side. TryWrite() fails until the consumer has acknowledged all these messages.
+   */
+  void NotifyFallbackSent();
+
+  /**
+   * \brief Acknowledges a message received over the routing socket instead of the ring.
+   *
+   * Must only be called by the consumer side, after all messages in the ring have been processed.
+   */
+  void AcknowledgeFallback();
+
+  /**
+   * \brief Returns the oldest unread message without removing it.
+   *
+   * Must only be called by the consumer side. The returned body stays valid until Pop() is called.
+   *
+   * \param header Receives the routing message header.
+   * \return Pointer to the message body in shared memory or nullptr if the ring is empty.
+   */
+  const std::uint8_t* Peek(MessageHeader* header) const;
+
+  /**
+   * \brief Releases the slot of the oldest unread message to the producer.
+   *
+   * Must only be called by the consumer side after a successful Peek().
+   */
+  void Pop();
+
+  /**
+   * \brief Resets the doorbell after a wake-up. Must only be called by the consumer side.
+   */
+  void ClearDoorbell();
+
+  /**
+   * \brief Wakes up the consumer.
+   *
+   * Called by the producer after publishing into an empty ring, or by a consumer that stops reading with messages
+   * left in the ring so that it is woken up again.
+   */
+  void RingDoorbell();
+
+  /**
+   * \brief Returns the file descriptor of the shared memory file.
+   *
+   * \return A file descriptor.
+   */
+  int GetMemoryHandle() const { return memory_handle_; }
+
+  /**
+   * \brief Returns the file descriptor of the doorbell eventfd. It becomes readable when messages are available.
+   *
+   * \return A file descriptor.
+   */
+  int GetDoorbellHandle() const { return doorbell_handle_; }
+
+  /**
+   * \brief Returns the maximum size of a message body which can be stored in a slot.
+   *
+   * \return The slot size in bytes.
+   */
+  std::uint32_t GetSlotSize() const { return slot_size_; }
+
+  /**
+   * \brief Returns the number of slots.
+   *
+   * \return The number of slots.
+   */
+  std::uint32_t GetSlotCount() const { return slot_count_; }
+
+ private:
+  /**
+   * \brief Control block at the start of the shared memory file.
+   *
+   * Producer and consumer indices live on separate cache lines so that both sides do not invalidate each other's
+   * cache line on every message.
+   */
+  struct ControlBlock {
+    std::uint32_t magic_;                          ///< Identifies an initialized ring
+    std::uint32_t slot_count_;                     ///< Number of slots
+    std::uint32_t slot_size_;                      ///< Maximum message body size per slot
+    alignas(64) std::atomic<std::uint32_t> head_;  ///< Free-running index of the next slot to write
+    alignas(64) std::atomic<std::uint32_t> tail_;  ///< Free-running index of the next slot to read
+    alignas(64) std::atomic<std::uint32_t> fallback_acknowledged_;  ///< Number of acknowledged socket messages
+  };
+
+  /**
+   * \brief Marks an initialized control block.
+   */
+  static constexpr std::uint32_t kMagic = 0x534D5231U;
+
+  /**
+   * \brief Constructor of SharedMemoryRing.
+   *
+   * \param memory_handle File descriptor of the shared memory file.
+   * \param doorbell_handle File descriptor of the doorbell eventfd.
+   * \param mapping Start of the mapped shared memory.
+   * \param mapping_size Size of the mapped shared memory.
+   */
+  SharedMemoryRing(int memory_handle, int doorbell_handle, void* mapping, std::size_t mapping_size);
+
+  /**
+   * \brief Returns the distance in bytes between the start of two consecutive slots.
+   *
+   * \param slot_size Maximum message body size per slot.
+   * \return The slot stride in bytes.
+   */
+  static std::size_t GetSlotStride(std::uint32_t slot_size);
+
+  /**
+   * \brief Returns the size of the shared memory file of a ring.
+   *
+   * \param slot_count Number of slots.
+   * \param slot_size Maximum message body size per slot.
+   * \return The size in bytes.
+   */
+  static std::size_t GetMappingSize(std::uint32_t slot_count, std::uint32_t slot_size);
+
+  /**
+   * \brief Returns the start of a slot.
+   *
+   * \param index A free-running ring index.
+   * \return Pointer to the slot.
+   */
+  std::uint8_t* GetSlot(std::uint32_t index) const;
+
+  /**
+   * \brief Checks if a message sent over the routing socket instead of the ring has not been acknowledged yet.
+   *
+   * \return true if such a message is pending, false otherwise.
+   */
+  bool IsFallbackPending() const;
+
+  /**
+   * \brief File descriptor of the shared memory file.
+   */
+  int memory_handle_;
+
+  /**
+   * \brief File descriptor of the doorbell eventfd.
+   */
+  int doorbell_handle_;
+
+  /**
+   * \brief Start of the mapped shared memory.
+   */
+  void* mapping_;
+
+  /**
+   * \brief Size of the mapped shared memory.
+   */
+  std::size_t mapping_size_;
+
+  /**
+   * \brief The control block in shared memory.
+   */
+  ControlBlock* control_;
+
+  /**
+   * \brief Local copy of the number of slots. The peer cannot change it after the ring was mapped.
+   */
+  std::uint32_t slot_count_;
+
+  /**
+   * \brief Local copy of the slot size. The peer cannot change it after the ring was mapped.
+   */
+  std::uint32_t slot_size_;
+
+  /**
+   * \brief Number of messages the producer sent over the routing socket instead of the ring.
+   */
+  std::uint32_t fallback_sent_;
+};
+
+}  // namespace routing
+}  // namespace someipd_posix
+}  // namespace someip_posix_common
+
+#endif  // LIB_LIBSOMEIP_POSIX_COMMON_INCLUDE_SOMEIP_POSIX_COMMON_SOMEIPD_POSIX_ROUTING_SHARED_MEMORY_RING_H_
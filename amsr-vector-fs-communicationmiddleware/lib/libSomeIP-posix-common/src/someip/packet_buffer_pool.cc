@@ -0,0 +1,258 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  packet_buffer_pool.cc
+ *        \brief  Pool of packet buffers for SOME/IP messages
+ *
+ *      \details  -
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "someip-posix-common/someip/packet_buffer_pool.h"
+#include <utility>
+
+namespace someip_posix_common {
+namespace someip {
+
+constexpr std::size_t PacketBufferPool::kSizeClassCount;
+constexpr std::size_t PacketBufferPool::kSmallestSizeClass;
+constexpr std::size_t PacketBufferPool::kMaxPooledBuffersPerClass;
+constexpr std::size_t PacketBufferPool::kThreadCacheSize;
+
+/**
+ * \brief Set when the thread cache of the calling thread has been destroyed. Buffers released afterwards, e.g. by
+ * other thread_local or static objects, bypass the thread cache.
+ */
+static thread_local bool is_thread_cache_destroyed = false;
+
+/**
+ * \brief Moves elements from the back of one stack to another one.
+ *
+ * \param from The source stack.
+ * \param keep Number of elements which stay in the source stack.
+ * \param to The destination stack.
+ * \param limit Maximum size of the destination stack.
+ */
+template <typename T>
+static void MoveElements(std::vector<T>& from, std::size_t keep, std::vector<T>& to, std::size_t limit) {
+  while ((from.size() > keep) && (to.size() < limit)) {
+    to.push_back(std::move(from.back()));
+    from.pop_back();
+  }
+}
+
+void PacketBufferDeleter::operator()(PacketBuffer* buffer) const { PacketBufferPool::GetInstance().Release(buffer); }
+
+PacketBufferPool::ThreadCache::ThreadCache() {
+  for (std::vector<PacketBuffer>& buffers : buffers_) {
+    buffers.reserve(kThreadCacheSize + 1U);
+  }
+  shells_.reserve(kThreadCacheSize + 1U);
+}
+
+PacketBufferPool::ThreadCache::~ThreadCache() {
+  is_thread_cache_destroyed = true;
+  GetInstance().Flush(*this, 0U);
+}
+
+PacketBufferPool& PacketBufferPool::GetInstance() {
+  // Intentionally never destroyed: buffers may be released by static objects during process termination.
+  static PacketBufferPool* instance = new PacketBufferPool();
+  return *instance;
+}
+
+PacketBufferPool::PacketBufferPool() : lock_(), shared_(), hits_(0U), misses_(0U), discards_(0U) {
+  for (std::vector<PacketBuffer>& buffers : shared_.buffers_) {
+    buffers.reserve(kMaxPooledBuffersPerClass);
+  }
+  shared_.shells_.reserve(kMaxPooledBuffersPerClass);
+}
+
+PacketBuffer PacketBufferPool::Acquire(std::size_t size) {
+  const std::size_t size_class = GetAcquireClass(size);
+  PacketBuffer buffer;
+  if (size_class < kSizeClassCount) {
+    ThreadCache* cache = GetThreadCache();
+    if (cache != nullptr) {
+      std::vector<PacketBuffer>& cached = cache->buffers_[size_class];
+      if (cached.empty()) {
+        // Take several buffers at once, so that the lock is only taken once for a burst of messages.
+        std::lock_guard<std::mutex> lock(lock_);
+        MoveElements(shared_.buffers_[size_class], 0U, cached, kThreadCacheSize / 2U);
+      }
+      if (!cached.empty()) {
+        buffer = std::move(cached.back());
+        cached.pop_back();
+      }
+    } else {
+      std::lock_guard<std::mutex> lock(lock_);
+      std::vector<PacketBuffer>& shared = shared_.buffers_[size_class];
+      if (!shared.empty()) {
+        buffer = std::move(shared.back());
+        shared.pop_back();
+      }
+    }
+  }
+
+  if (buffer.capacity() != 0U) {
+    hits_.fetch_add(1U, std::memory_order_relaxed);
+  } else {
+    misses_.fetch_add(1U, std::memory_order_relaxed);
+    buffer.reserve((size_class < kSizeClassCount) ? GetSizeClassCapacity(size_class) : size);
+  }
+  buffer.resize(size);
+  return buffer;
+}
+
+PacketBufferPtr PacketBufferPool::AcquirePtr(std::size_t size) { return Wrap(Acquire(size)); }
+
+void PacketBufferPool::Release(PacketBuffer&& buffer) {
+  if (buffer.capacity() == 0U) {
+    return;
+  }
+  const std::size_t size_class = GetReleaseClass(buffer.capacity());
+  if (size_class == kSizeClassCount) {
+    discards_.fetch_add(1U, std::memory_order_relaxed);
+    PacketBuffer discarded{std::move(buffer)};
+    return;
+  }
+
+  buffer.clear();
+  ThreadCache* cache = GetThreadCache();
+  if (cache != nullptr) {
+    std::vector<PacketBuffer>& cached = cache->buffers_[size_class];
+    cached.push_back(std::move(buffer));
+    if (cached.size() > kThreadCacheSize) {
+      Flush(*cache, kThreadCacheSize / 2U);
+    }
+  } else {
+    std::unique_lock<std::mutex> lock(lock_);
+    std::vector<PacketBuffer>& shared = shared_.buffers_[size_class];
+    if (shared.size() < kMaxPooledBuffersPerClass) {
+      shared.push_back(std::move(buffer));
+    } else {
+      lock.unlock();
+      discards_.fetch_add(1U, std::memory_order_relaxed);
+      PacketBuffer discarded{std::move(buffer)};
+    }
+  }
+}
+
+void PacketBufferPool::Release(PacketBuffer* buffer) {
+  if (buffer == nullptr) {
+    return;
+  }
+  Release(std::move(*buffer));
+  ThreadCache* cache = GetThreadCache();
+  if (cache != nullptr) {
+    cache->shells_.push_back(buffer);
+    if (cache->shells_.size() > kThreadCacheSize) {
+      Flush(*cache, kThreadCacheSize / 2U);
+    }
+  } else {
+    std::unique_lock<std::mutex> lock(lock_);
+    if (shared_.shells_.size() < kMaxPooledBuffersPerClass) {
+      shared_.shells_.push_back(buffer);
+    } else {
+      lock.unlock();
+      delete buffer;
+    }
+  }
+}
+
+PacketBufferPtr PacketBufferPool::Wrap(PacketBuffer&& buffer) {
+  PacketBufferPtr ptr{AcquireShell()};
+  *ptr = std::move(buffer);
+  return ptr;
+}
+
+PacketBufferPool::Statistics PacketBufferPool::GetStatistics() const {
+  return Statistics{hits_.load(std::memory_order_relaxed), misses_.load(std::memory_order_relaxed),
+                    discards_.load(std::memory_order_relaxed)};
+}
+
+PacketBufferPool::ThreadCache* PacketBufferPool::GetThreadCache() {
+  if (is_thread_cache_destroyed) {
+    return nullptr;
+  }
+  static thread_local ThreadCache cache;
+  return &cache;
+}
+
+PacketBuffer* PacketBufferPool::AcquireShell() {
+  PacketBuffer* shell = nullptr;
+  ThreadCache* cache = GetThreadCache();
+  if (cache != nullptr) {
+    if (cache->shells_.empty()) {
+      std::lock_guard<std::mutex> lock(lock_);
+      MoveElements(shared_.shells_, 0U, cache->shells_, kThreadCacheSize / 2U);
+    }
+    if (!cache->shells_.empty()) {
+      shell = cache->shells_.back();
+      cache->shells_.pop_back();
+    }
+  } else {
+    std::lock_guard<std::mutex> lock(lock_);
+    if (!shared_.shells_.empty()) {
+      shell = shared_.shells_.back();
+      shared_.shells_.pop_back();
+    }
+  }
+  return (shell != nullptr) ? shell : new PacketBuffer();
+}
+
+std::size_t PacketBufferPool::GetAcquireClass(std::size_t size) {
+  std::size_t size_class = 0U;
+  while ((size_class < kSizeClassCount) && (size > GetSizeClassCapacity(size_class))) {
+    ++size_class;
+  }
+  return size_class;
+}
+
+std::size_t PacketBufferPool::GetReleaseClass(std::size_t capacity) {
+  if ((capacity < GetSizeClassCapacity(0U)) || (capacity > GetSizeClassCapacity(kSizeClassCount - 1U))) {
+    return kSizeClassCount;
+  }
+  std::size_t size_class = kSizeClassCount - 1U;
+  while (capacity < GetSizeClassCapacity(size_class)) {
+    --size_class;
+  }
+  return size_class;
+}
+
+void PacketBufferPool::Flush(BufferStacks& cache, std::size_t keep) {
+  {
+    std::lock_guard<std::mutex> lock(lock_);
+    for (std::size_t size_class = 0U; size_class < kSizeClassCount; ++size_class) {
+      MoveElements(cache.buffers_[size_class], keep, shared_.buffers_[size_class], kMaxPooledBuffersPerClass);
+    }
+    MoveElements(cache.shells_, keep, shared_.shells_, kMaxPooledBuffersPerClass);
+  }
+  // Free whatever did not fit into the shared pool without holding the lock.
+  for (std::vector<PacketBuffer>& buffers : cache.buffers_) {
+    while (buffers.size() > keep) {
+      discards_.fetch_add(1U, std::memory_order_relaxed);
+      buffers.pop_back();
+    }
+  }
+  while (cache.shells_.size() > keep) {
+    delete cache.shells_.back();
+    cache.shells_.pop_back();
+  }
+}
+
+}  // namespace someip
+}  // namespace someip_posix_common
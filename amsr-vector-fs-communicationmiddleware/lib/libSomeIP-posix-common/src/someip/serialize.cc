@@ -19,6 +19,14 @@
  *********************************************************************************************************************/
 #include "someip-posix-common/someip/serialize.h"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SOMEIP_POSIX_COMMON_BULK_SWAP_X86
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SOMEIP_POSIX_COMMON_BULK_SWAP_NEON
+#include <arm_neon.h>
+#endif
+
 namespace someip_posix_common {
 namespace someip {
 
@@ -41,6 +49,160 @@ IsMSBTest __isMSBTest;
 
 #endif
 
+namespace {
+
+/** \brief Reverse the byte order of count elements of type T one by one
+ *  \return number of bytes converted
+ */
+template <typename T>
+std::size_t SwapElements(Byte* dst, const Byte* src, std::size_t count) noexcept {
+  for (std::size_t i = 0U; i < count; ++i) {
+    T value;
+    std::memcpy(&value, src + (i * sizeof(T)), sizeof(T));
+    value = SwapByteOrder(value);
+    std::memcpy(dst + (i * sizeof(T)), &value, sizeof(T));
+  }
+  return count * sizeof(T);
+}
+
+#if defined(SOMEIP_POSIX_COMMON_BULK_SWAP_X86)
+
+/** \brief Byte shuffle masks reversing 2, 4 and 8 byte elements, repeated for both 128 bit lanes of AVX2
+ *
+ */
+alignas(32) const std::uint8_t kShuffleMask16[32] = {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                                     1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14};
+alignas(32) const std::uint8_t kShuffleMask32[32] = {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                                     3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12};
+alignas(32) const std::uint8_t kShuffleMask64[32] = {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                                     7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8};
+
+/** \brief Signature of a kernel shuffling whole vector blocks
+ *  \return number of bytes converted
+ */
+using ShuffleKernel = std::size_t (*)(Byte* dst, const Byte* src, std::size_t nbytes, const std::uint8_t* mask);
+
+/** \brief Shuffle 32 byte blocks with AVX2
+ *
+ */
+__attribute__((target("avx2"))) std::size_t ShuffleAvx2(Byte* dst, const Byte* src, std::size_t nbytes,
+                                                         const std::uint8_t* mask) noexcept {
+  const __m256i shuffle = _mm256_load_si256(reinterpret_cast<const __m256i*>(mask));
+  std::size_t offset = 0U;
+  for (; (offset + 32U) <= nbytes; offset += 32U) {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + offset));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + offset), _mm256_shuffle_epi8(block, shuffle));
+  }
+  return offset;
+}
+
+/** \brief Shuffle 16 byte blocks with SSSE3
+ *
+ */
+__attribute__((target("ssse3"))) std::size_t ShuffleSsse3(Byte* dst, const Byte* src, std::size_t nbytes,
+                                                           const std::uint8_t* mask) noexcept {
+  const __m128i shuffle = _mm_load_si128(reinterpret_cast<const __m128i*>(mask));
+  std::size_t offset = 0U;
+  for (; (offset + 16U) <= nbytes; offset += 16U) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + offset));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + offset), _mm_shuffle_epi8(block, shuffle));
+  }
+  return offset;
+}
+
+/** \brief Select the widest kernel supported by the CPU
+ *
+ */
+ShuffleKernel SelectShuffleKernel() noexcept {
+  ShuffleKernel kernel{nullptr};
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    kernel = &ShuffleAvx2;
+  } else if (__builtin_cpu_supports("ssse3")) {
+    kernel = &ShuffleSsse3;
+  }
+  return kernel;
+}
+
+/** \brief Reverse the byte order of all whole vector blocks
+ *  \return number of bytes converted
+ */
+std::size_t SwapBlocks(Byte* dst, const Byte* src, std::size_t nbytes, std::size_t element_size) noexcept {
+  static const ShuffleKernel kernel{SelectShuffleKernel()};
+  std::size_t converted{0U};
+  if (kernel != nullptr) {
+    const std::uint8_t* mask{nullptr};
+    switch (element_size) {
+      case 2U:
+        mask = kShuffleMask16;
+        break;
+      case 4U:
+        mask = kShuffleMask32;
+        break;
+      default:
+        mask = kShuffleMask64;
+        break;
+    }
+    converted = kernel(dst, src, nbytes, mask);
+  }
+  return converted;
+}
+
+#elif defined(SOMEIP_POSIX_COMMON_BULK_SWAP_NEON)
+
+/** \brief Reverse the byte order of all whole 16 byte blocks with NEON
+ *  \return number of bytes converted
+ */
+std::size_t SwapBlocks(Byte* dst, const Byte* src, std::size_t nbytes, std::size_t element_size) noexcept {
+  std::size_t offset = 0U;
+  for (; (offset + 16U) <= nbytes; offset += 16U) {
+    const uint8x16_t block = vld1q_u8(src + offset);
+    uint8x16_t swapped;
+    switch (element_size) {
+      case 2U:
+        swapped = vrev16q_u8(block);
+        break;
+      case 4U:
+        swapped = vrev32q_u8(block);
+        break;
+      default:
+        swapped = vrev64q_u8(block);
+        break;
+    }
+    vst1q_u8(dst + offset, swapped);
+  }
+  return offset;
+}
+
+#else
+
+/** \brief No SIMD support, all elements are converted one by one
+ *  \return 0
+ */
+std::size_t SwapBlocks(Byte*, const Byte*, std::size_t, std::size_t) noexcept { return 0U; }
+
+#endif
+
+}  // namespace
+
+void SwapByteOrderRange(Byte* dst, const Byte* src, std::size_t count, std::size_t element_size) noexcept {
+  if ((element_size == 2U) || (element_size == 4U) || (element_size == 8U)) {
+    // Vector blocks always hold whole elements, so the remainder starts at an element boundary.
+    const std::size_t converted = SwapBlocks(dst, src, count * element_size, element_size);
+    const std::size_t remaining = count - (converted / element_size);
+    if (element_size == 2U) {
+      SwapElements<std::uint16_t>(dst + converted, src + converted, remaining);
+    } else if (element_size == 4U) {
+      SwapElements<std::uint32_t>(dst + converted, src + converted, remaining);
+    } else {
+      SwapElements<std::uint64_t>(dst + converted, src + converted, remaining);
+    }
+  } else {
+    // Single bytes have no byte order.
+    std::memcpy(dst, src, count * element_size);
+  }
+}
+
 }  // namespace serialization
 
 }  // namespace someip
@@ -21,6 +21,7 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <algorithm>
 #include <cassert>
 
 #include "someip-posix-common/someip/serialize.h"
@@ -29,18 +30,36 @@
 namespace someip_posix_common {
 namespace someip {
 
+constexpr std::size_t SomeIpDatagramMessageReader::kMaxBatchedDatagrams;
+
 SomeIpDatagramMessageReader::SomeIpDatagramMessageReader(std::size_t max_datagram_length)
     : logger_(ara::log::CreateLogger("SomeIpDatagramMessageReader", "")),
       max_datagram_length_(max_datagram_length),
       bytes_read_(0U),
       is_message_available_(false),
-      bad_datagram_counter_(0) {}
+      buffers_(kMaxBatchedDatagrams),
+      datagrams_(kMaxBatchedDatagrams),
+      datagram_count_(0U),
+      current_datagram_(0U),
+      bad_datagram_counter_(0) {
+  for (SomeIpMessage::DataBuffer& buffer : buffers_) {
+    buffer = PacketBufferPool::GetInstance().Acquire(max_datagram_length_);
+  }
+}
 
-void SomeIpDatagramMessageReader::Read(osabstraction::io::network::socket::Socket* socket) {
-  if (is_message_available_) {
+void SomeIpDatagramMessageReader::Read(osabstraction::io::network::socket::DatagramSocket* socket) {
+  if (is_message_available_ || (current_datagram_ < datagram_count_)) {
     return;
   }
-  ReadDatagram(socket);
+  for (std::size_t i = 0U; i < kMaxBatchedDatagrams; ++i) {
+    datagrams_[i].buffer_.iov_base = buffers_[i].data();
+    datagrams_[i].buffer_.iov_len = buffers_[i].size();
+  }
+  using InboundDatagramContainer = osabstraction::io::network::socket::DatagramSocket::InboundDatagramContainer;
+  datagram_count_ = socket->ReceiveBatch(InboundDatagramContainer(datagrams_.data(), datagrams_.size()));
+  logger_.LogVerbose() << __func__ << ":" << __LINE__ << ": datagrams " << datagram_count_;
+  current_datagram_ = 0U;
+  bytes_read_ = 0U;
 }
 
 bool SomeIpDatagramMessageReader::IsMessageAvailable() {
@@ -59,56 +78,56 @@ SomeIpMessage SomeIpDatagramMessageReader::GetNextMessage() {
   return ret;
 }
 
-void SomeIpDatagramMessageReader::ReadDatagram(osabstraction::io::network::socket::Socket* socket) {
-  datagram_.resize(max_datagram_length_);
-  const std::size_t n = static_cast<typename std::make_unsigned<ssize_t>::type>(
-      socket->Receive(datagram_.data(), datagram_.size(), &from_address_));
-  logger_.LogVerbose() << __func__ << ":" << __LINE__ << ": datagram length " << n;
-  datagram_.resize(n);
-  bytes_read_ = 0U;
-}
-
 void SomeIpDatagramMessageReader::ReadMessage() {
   assert(!is_message_available_);
-  assert(bytes_read_ <= datagram_.size());
-  // Calculate number of bytes left to consume
-  const auto bytes_left{datagram_.size() - bytes_read_};
-  logger_.LogVerbose() << __func__ << ":" << __LINE__ << ": bytes read so far " << bytes_read_
-                       << ", bytes left to read " << bytes_left;
-  if ((datagram_.size() == 0U) || (bytes_read_ == datagram_.size())) {
-    return;
-  }
-  // A SOME/IP message must be at least of length of SOME/IP message header
-  if (bytes_left < kHeaderSize) {
-    logger_.LogError() << __func__ << ":" << __LINE__ << ": invalid SOME/IP message of length " << bytes_left;
-    bytes_read_ = 0U;
-    datagram_.resize(0U);
-    ++bad_datagram_counter_;
-    logger_.LogError() << __func__ << ":" << __LINE__ << ": bad datagrams so far " << bad_datagram_counter_;
-    return;
-  }
-  LengthField length_field{0U};
-  // Calculate offset to length field from the beginning of SOME/IP message header
-  const auto offset{bytes_read_ + kLengthFieldOffset};
-  // Deserialize length field inside SOME/IP header
-  serialization::write<serialization::SomeIpMessagePolicy>(length_field, datagram_.begin() + offset);
-  // Calculate total length of the SOME/IP message with header
-  const auto total_length = CalculateSomeIpMessageLengthFromLengthField(length_field);
-  if (bytes_left < total_length) {
-    logger_.LogError() << __func__ << ":" << __LINE__ << ": invalid SOME/IP message total length, got " << bytes_left
-                       << " expected at least " << total_length;
-    bytes_read_ = 0U;
-    datagram_.resize(0U);
-    ++bad_datagram_counter_;
-    logger_.LogError() << __func__ << ":" << __LINE__ << ": bad datagrams so far " << bad_datagram_counter_;
-    return;
+  while (!is_message_available_ && (current_datagram_ < datagram_count_)) {
+    const auto& datagram = datagrams_[current_datagram_];
+    auto& buffer = buffers_[current_datagram_];
+    assert(bytes_read_ <= datagram.length_);
+    // Calculate number of bytes left to consume
+    const auto bytes_left{datagram.length_ - bytes_read_};
+    logger_.LogVerbose() << __func__ << ":" << __LINE__ << ": bytes read so far " << bytes_read_
+                         << ", bytes left to read " << bytes_left;
+    if (bytes_left == 0U) {
+      ++current_datagram_;
+      bytes_read_ = 0U;
+      continue;
+    }
+    // A SOME/IP message must be at least of length of SOME/IP message header
+    if (bytes_left < kHeaderSize) {
+      logger_.LogError() << __func__ << ":" << __LINE__ << ": invalid SOME/IP message of length " << bytes_left;
+      DropDatagram();
+      continue;
+    }
+    LengthField length_field{0U};
+    // Calculate offset to length field from the beginning of SOME/IP message header
+    const auto offset{bytes_read_ + kLengthFieldOffset};
+    // Deserialize length field inside SOME/IP header
+    serialization::write<serialization::SomeIpMessagePolicy>(length_field, buffer.begin() + offset);
+    // Calculate total length of the SOME/IP message with header
+    const auto total_length = CalculateSomeIpMessageLengthFromLengthField(length_field);
+    if (bytes_left < total_length) {
+      logger_.LogError() << __func__ << ":" << __LINE__ << ": invalid SOME/IP message total length, got " << bytes_left
+                         << " expected at least " << total_length;
+      DropDatagram();
+      continue;
+    }
+    // From now on we assume having a valid SOME/IP message
+    auto start = buffer.begin() + static_cast<int>(bytes_read_);
+    auto end = start + static_cast<int>(total_length);
+    message_ = PacketBufferPool::GetInstance().Acquire(total_length);
+    std::copy(start, end, message_.begin());
+    from_address_ = datagram.remote_address_;
+    bytes_read_ += total_length;
+    is_message_available_ = true;
   }
-  // From now on we assume having a valid SOME/IP message
-  auto start = datagram_.begin() + static_cast<int>(bytes_read_);
-  auto end = start + static_cast<int>(total_length);
-  message_ = SomeIpMessage::DataBuffer(start, end);
-  bytes_read_ += total_length;
-  is_message_available_ = true;
+}
+
+void SomeIpDatagramMessageReader::DropDatagram() {
+  ++current_datagram_;
+  bytes_read_ = 0U;
+  ++bad_datagram_counter_;
+  logger_.LogError() << __func__ << ":" << __LINE__ << ": bad datagrams so far " << bad_datagram_counter_;
 }
 
 }  // namespace someip
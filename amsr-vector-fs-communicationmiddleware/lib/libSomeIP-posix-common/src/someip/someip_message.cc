@@ -23,7 +23,6 @@
  *********************************************************************************************************************/
 #include "someip-posix-common/someip/someip_message.h"
 #include <cassert>
-#include "vac/language/cpp14_backport.h"
 
 namespace someip_posix_common {
 namespace someip {
@@ -31,7 +30,7 @@ namespace someip {
 SomeIpMessage::SomeIpMessage(DataBuffer&& data)
     : data_{std::move(data)},
       from_address_{{}, false},
-      deserializer_{vac::language::make_unique<DataBuffer>(data_.begin(), data_.begin() + kHeaderSize)},
+      header_view_{data_.data()},
       io_vector_array_{{data_.data(), data_.size()}} {
   assert((GetHeader().length_ + kHeaderLength) == data_.size());
 }
@@ -39,10 +38,12 @@ SomeIpMessage::SomeIpMessage(DataBuffer&& data)
 SomeIpMessage::SomeIpMessage(DataBuffer&& data, const SocketAddress& from_address)
     : data_{std::move(data)},
       from_address_{from_address, true},
-      deserializer_{vac::language::make_unique<DataBuffer>(data_.begin(), data_.begin() + kHeaderSize)},
+      header_view_{data_.data()},
       io_vector_array_{{data_.data(), data_.size()}} {
   assert((GetHeader().length_ + kHeaderLength) == data_.size());
 }
 
+SomeIpMessage::~SomeIpMessage() { PacketBufferPool::GetInstance().Release(std::move(data_)); }
+
 }  // namespace someip
 }  // namespace someip_posix_common
@@ -21,6 +21,7 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <algorithm>
 #include <cassert>
 
 #include "someip-posix-common/someip/serialize.h"
@@ -36,14 +37,23 @@ void SomeIpStreamMessageReader::Read(osabstraction::io::network::socket::Socket*
     return;
   }
   if (bytes_read_ == 0 && message_.size() == 0) {
-    message_.resize(kHeaderLength);
+    message_ = PacketBufferPool::GetInstance().Acquire(kHeaderLength);
   }
   if (bytes_read_ < kHeaderLength) {
     ReadHeader(socket);
   }
   if (bytes_read_ == kHeaderLength) {
     serialization::write<serialization::SomeIpMessagePolicy>(length_, message_.begin() + kLengthFieldOffset);
-    message_.resize(kHeaderLength + length_);
+    const std::size_t total_length{kHeaderLength + length_};
+    if (total_length > message_.capacity()) {
+      // Continue in a pooled buffer of the matching size class instead of letting the vector reallocate.
+      SomeIpMessage::DataBuffer message{PacketBufferPool::GetInstance().Acquire(total_length)};
+      std::copy(message_.begin(), message_.end(), message.begin());
+      PacketBufferPool::GetInstance().Release(std::move(message_));
+      message_ = std::move(message);
+    } else {
+      message_.resize(total_length);
+    }
   }
   if (bytes_read_ >= kHeaderLength) {
     ReadBody(socket);
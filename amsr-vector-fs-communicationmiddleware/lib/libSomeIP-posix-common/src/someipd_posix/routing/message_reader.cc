@@ -23,55 +23,96 @@
  *********************************************************************************************************************/
 #include "someip-posix-common/someipd_posix/routing/message_reader.h"
 
+#include <sys/uio.h>
 #include <unistd.h>
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstring>
+#include <utility>
+#include "someip-posix-common/someip/packet_buffer_pool.h"
 
 namespace someip_posix_common {
 namespace someipd_posix {
 namespace routing {
 
-MessageReader::MessageReader() : bytes_read_{0U}, is_message_available_{false} {}
+constexpr std::size_t MessageReader::kDefaultReceiveBufferSize;
+
+MessageReader::MessageReader(std::size_t receive_buffer_size)
+    : buffer_(std::max(receive_buffer_size, sizeof(MessageHeader))),
+      buffer_begin_{0U},
+      buffer_end_{0U},
+      is_header_complete_{false},
+      body_bytes_read_{0U},
+      is_message_available_{false} {}
 
 void MessageReader::Read(osabstraction::io::network::socket::Socket* socket) {
   if (is_message_available_) {
     return;
   }
-  if (bytes_read_ < sizeof(MessageHeader)) {
-    ReadHeader(socket);
-  }
-  if (bytes_read_ == sizeof(MessageHeader)) {
-    message_.body_.resize(message_.header_.length_);
+  // Parse() has consumed everything it could, so only the start of a header is left in the buffer.
+  assert((buffer_end_ - buffer_begin_) < sizeof(MessageHeader));
+  if (buffer_begin_ > 0U) {
+    std::memmove(buffer_.data(), buffer_.data() + buffer_begin_, buffer_end_ - buffer_begin_);
+    buffer_end_ -= buffer_begin_;
+    buffer_begin_ = 0U;
   }
-  if (bytes_read_ >= sizeof(MessageHeader)) {
-    if (message_.header_.length_ > 0U) {
-      ReadBody(socket);
-    }
-    if (bytes_read_ == (sizeof(MessageHeader) + message_.header_.length_)) {
-      is_message_available_ = true;
-      bytes_read_ = 0U;
-    }
+
+  std::array<struct iovec, 2> iov;
+  std::size_t iov_count{0U};
+  std::size_t direct_length{0U};
+  if (is_header_complete_ && ((message_.header_.length_ - body_bytes_read_) > buffer_.size())) {
+    // Receive the rest of a large body directly into the message and the start of the next messages behind it.
+    direct_length = message_.header_.length_ - body_bytes_read_;
+    iov[iov_count++] = {&message_.body_[body_bytes_read_], direct_length};
   }
+  iov[iov_count++] = {buffer_.data() + buffer_end_, buffer_.size() - buffer_end_};
+
+  const std::size_t n =
+      socket->Receive(osabstraction::io::network::socket::Socket::IovecContainer(iov.data(), iov_count));
+  const std::size_t direct_read = std::min(n, direct_length);
+  body_bytes_read_ += direct_read;
+  buffer_end_ += n - direct_read;
+  Parse();
 }
 
 bool MessageReader::IsMessageAvailable() const { return is_message_available_; }
 
 MessageReader::Message MessageReader::GetNextMessage() {
   is_message_available_ = false;
-  return std::move(message_);
-}
-
-void MessageReader::ReadHeader(osabstraction::io::network::socket::Socket* socket) {
-  assert(bytes_read_ < sizeof(MessageHeader));
-  const std::size_t n = socket->Receive(reinterpret_cast<std::uint8_t*>(&message_.header_) + bytes_read_,
-                                        sizeof(MessageHeader) - bytes_read_);
-  bytes_read_ += n;
+  Message message{std::move(message_)};
+  Parse();
+  return message;
 }
 
-void MessageReader::ReadBody(osabstraction::io::network::socket::Socket* socket) {
-  assert(bytes_read_ >= sizeof(MessageHeader) && bytes_read_ < (sizeof(MessageHeader) + message_.body_.size()));
-  std::size_t offset = bytes_read_ - sizeof(MessageHeader);
-  std::size_t n = socket->Receive(&message_.body_.at(offset), message_.body_.size() - offset);
-  bytes_read_ += n;
+void MessageReader::Parse() {
+  if (is_message_available_) {
+    return;
+  }
+  if (!is_header_complete_) {
+    if ((buffer_end_ - buffer_begin_) < sizeof(MessageHeader)) {
+      return;
+    }
+    std::memcpy(&message_.header_, buffer_.data() + buffer_begin_, sizeof(MessageHeader));
+    buffer_begin_ += sizeof(MessageHeader);
+    message_.body_ = someip::PacketBufferPool::GetInstance().Acquire(message_.header_.length_);
+    body_bytes_read_ = 0U;
+    is_header_complete_ = true;
+  }
+  const std::size_t n = std::min(buffer_end_ - buffer_begin_, message_.header_.length_ - body_bytes_read_);
+  if (n > 0U) {
+    std::memcpy(&message_.body_[body_bytes_read_], buffer_.data() + buffer_begin_, n);
+    buffer_begin_ += n;
+    body_bytes_read_ += n;
+  }
+  if (buffer_begin_ == buffer_end_) {
+    buffer_begin_ = 0U;
+    buffer_end_ = 0U;
+  }
+  if (body_bytes_read_ == message_.header_.length_) {
+    is_header_complete_ = false;
+    is_message_available_ = true;
+  }
 }
 
 }  // namespace routing
@@ -0,0 +1,219 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  shared_memory_ring.cc
+ *        \brief  Shared memory ring buffer for routing messages
+ *
+ *      \details  -
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "someip-posix-common/someipd_posix/routing/shared_memory_ring.h"
+
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <system_error>
+
+namespace someip_posix_common {
+namespace someipd_posix {
+namespace routing {
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "shared memory rings require address-free atomics");
+
+constexpr std::uint32_t SharedMemoryRing::kMagic;
+
+/**
+ * \brief Alignment of the control block and of all slots.
+ */
+static constexpr std::size_t kCacheLineSize = 64U;
+
+std::unique_ptr<SharedMemoryRing> SharedMemoryRing::Create(std::uint32_t slot_count, std::uint32_t slot_size) {
+  if ((slot_count == 0U) || ((slot_count & (slot_count - 1U)) != 0U)) {
+    throw std::invalid_argument("SharedMemoryRing: slot count must be a power of two");
+  }
+  const std::size_t mapping_size = GetMappingSize(slot_count, slot_size);
+  int memory_handle = ::memfd_create("someip-posix-ring", MFD_CLOEXEC);
+  if (memory_handle < 0) {
+    throw std::system_error(errno, std::generic_category());
+  }
+  if (::ftruncate(memory_handle, static_cast<off_t>(mapping_size)) < 0) {
+    const int error = errno;
+    ::close(memory_handle);
+    throw std::system_error(error, std::generic_category());
+  }
+  void* mapping = ::mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, memory_handle, 0);
+  if (mapping == MAP_FAILED) {
+    const int error = errno;
+    ::close(memory_handle);
+    throw std::system_error(error, std::generic_category());
+  }
+  int doorbell_handle = ::eventfd(0U, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (doorbell_handle < 0) {
+    const int error = errno;
+    ::munmap(mapping, mapping_size);
+    ::close(memory_handle);
+    throw std::system_error(error, std::generic_category());
+  }
+  ControlBlock* control = new (mapping) ControlBlock();
+  control->slot_count_ = slot_count;
+  control->slot_size_ = slot_size;
+  control->head_.store(0U, std::memory_order_relaxed);
+  control->tail_.store(0U, std::memory_order_relaxed);
+  control->fallback_acknowledged_.store(0U, std::memory_order_relaxed);
+  control->magic_ = kMagic;
+  return std::unique_ptr<SharedMemoryRing>(new SharedMemoryRing(memory_handle, doorbell_handle, mapping, mapping_size));
+}
+
+std::unique_ptr<SharedMemoryRing> SharedMemoryRing::Attach(int memory_handle, int doorbell_handle) {
+  struct stat memory_stat;
+  void* mapping = MAP_FAILED;
+  std::size_t mapping_size = 0U;
+  if ((::fstat(memory_handle, &memory_stat) == 0) && (memory_stat.st_size >= static_cast<off_t>(sizeof(ControlBlock)))) {
+    mapping_size = static_cast<std::size_t>(memory_stat.st_size);
+    mapping = ::mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, memory_handle, 0);
+  }
+  if (mapping != MAP_FAILED) {
+    const ControlBlock* control = static_cast<const ControlBlock*>(mapping);
+    const std::uint32_t slot_count = control->slot_count_;
+    const std::uint32_t slot_size = control->slot_size_;
+    // Never trust the peer: the geometry must match the size of the file, otherwise a slot could lie outside of it.
+    if ((control->magic_ == kMagic) && (slot_count != 0U) && ((slot_count & (slot_count - 1U)) == 0U) &&
+        (GetMappingSize(slot_count, slot_size) == mapping_size)) {
+      return std::unique_ptr<SharedMemoryRing>(
+          new SharedMemoryRing(memory_handle, doorbell_handle, mapping, mapping_size));
+    }
+    ::munmap(mapping, mapping_size);
+  }
+  ::close(memory_handle);
+  ::close(doorbell_handle);
+  return nullptr;
+}
+
+SharedMemoryRing::SharedMemoryRing(int memory_handle, int doorbell_handle, void* mapping, std::size_t mapping_size)
+    : memory_handle_(memory_handle),
+      doorbell_handle_(doorbell_handle),
+      mapping_(mapping),
+      mapping_size_(mapping_size),
+      control_(static_cast<ControlBlock*>(mapping)),
+      slot_count_(control_->slot_count_),
+      slot_size_(control_->slot_size_),
+      fallback_sent_(0U) {}
+
+SharedMemoryRing::~SharedMemoryRing() {
+  ::munmap(mapping_, mapping_size_);
+  ::close(memory_handle_);
+  ::close(doorbell_handle_);
+}
+
+bool SharedMemoryRing::TryWrite(const MessageHeader& header, IovecContainer body_iovc) {
+  std::size_t body_length = 0U;
+  for (const struct iovec& iov : body_iovc) {
+    body_length += iov.iov_len;
+  }
+  assert(body_length == header.length_);
+  // A message still on its way over the routing socket must not be overtaken by this one.
+  if ((body_length > slot_size_) || IsFallbackPending()) {
+    return false;
+  }
+  const std::uint32_t head = control_->head_.load(std::memory_order_relaxed);
+  const std::uint32_t tail = control_->tail_.load(std::memory_order_acquire);
+  if ((head - tail) >= slot_count_) {
+    return false;
+  }
+  std::uint8_t* slot = GetSlot(head);
+  std::memcpy(slot, &header, sizeof(header));
+  std::size_t offset = sizeof(header);
+  for (const struct iovec& iov : body_iovc) {
+    std::memcpy(slot + offset, iov.iov_base, iov.iov_len);
+    offset += iov.iov_len;
+  }
+  control_->head_.store(head + 1U, std::memory_order_seq_cst);
+  // Only ring the doorbell if the consumer has already read everything before this message. Otherwise it is still
+  // draining the ring and will find this message without being woken up.
+  if (control_->tail_.load(std::memory_order_seq_cst) == head) {
+    RingDoorbell();
+  }
+  return true;
+}
+
+const std::uint8_t* SharedMemoryRing::Peek(MessageHeader* header) const {
+  const std::uint32_t tail = control_->tail_.load(std::memory_order_relaxed);
+  const std::uint32_t head = control_->head_.load(std::memory_order_seq_cst);
+  if (head == tail) {
+    return nullptr;
+  }
+  const std::uint8_t* slot = GetSlot(tail);
+  std::memcpy(header, slot, sizeof(MessageHeader));
+  if (header->length_ > slot_size_) {
+    // A corrupted length must never make the consumer read beyond the slot.
+    header->length_ = slot_size_;
+  }
+  return slot + sizeof(MessageHeader);
+}
+
+void SharedMemoryRing::Pop() {
+  const std::uint32_t tail = control_->tail_.load(std::memory_order_relaxed);
+  control_->tail_.store(tail + 1U, std::memory_order_seq_cst);
+}
+
+void SharedMemoryRing::NotifyFallbackSent() { ++fallback_sent_; }
+
+void SharedMemoryRing::AcknowledgeFallback() {
+  const std::uint32_t acknowledged = control_->fallback_acknowledged_.load(std::memory_order_relaxed);
+  control_->fallback_acknowledged_.store(acknowledged + 1U, std::memory_order_release);
+}
+
+bool SharedMemoryRing::IsFallbackPending() const {
+  return control_->fallback_acknowledged_.load(std::memory_order_acquire) != fallback_sent_;
+}
+
+void SharedMemoryRing::ClearDoorbell() {
+  std::uint64_t value;
+  ssize_t ret = ::read(doorbell_handle_, &value, sizeof(value));
+  static_cast<void>(ret);
+}
+
+void SharedMemoryRing::RingDoorbell() {
+  const std::uint64_t increment = 1U;
+  ssize_t ret = ::write(doorbell_handle_, &increment, sizeof(increment));
+  static_cast<void>(ret);
+}
+
+std::size_t SharedMemoryRing::GetSlotStride(std::uint32_t slot_size) {
+  const std::size_t size = sizeof(MessageHeader) + slot_size;
+  return ((size + kCacheLineSize - 1U) / kCacheLineSize) * kCacheLineSize;
+}
+
+std::size_t SharedMemoryRing::GetMappingSize(std::uint32_t slot_count, std::uint32_t slot_size) {
+  static_assert((sizeof(ControlBlock) % kCacheLineSize) == 0U, "slots must start on a cache line");
+  return sizeof(ControlBlock) + (static_cast<std::size_t>(slot_count) * GetSlotStride(slot_size));
+}
+
+std::uint8_t* SharedMemoryRing::GetSlot(std::uint32_t index) const {
+  return static_cast<std::uint8_t*>(mapping_) + sizeof(ControlBlock) +
+         (static_cast<std::size_t>(index & (slot_count_ - 1U)) * GetSlotStride(slot_size_));
+}
+
+}  // namespace routing
+}  // namespace someipd_posix
+}  // namespace someip_posix_common
@@ -0,0 +1,200 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  someip-posix/control_batch.h
+ *        \brief  Queue of control operations sent to the SomeIP daemon at once
+ *
+ *      \details  Each control operation of SomeIpPosix costs one datagram and one wake-up of the SomeIP daemon. An
+ *                application offering or subscribing many services and events at start-up queues the operations in a
+ *                ControlBatch instead and hands it to SomeIpPosix::FlushControlBatch(), which sends the whole queue in
+ *                one datagram and waits for a single aggregated response.
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_LIBSOMEIP_POSIX_INCLUDE_SOMEIP_POSIX_CONTROL_BATCH_H_
+#define LIB_LIBSOMEIP_POSIX_INCLUDE_SOMEIP_POSIX_CONTROL_BATCH_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstdint>
+#include <vector>
+#include "someip-posix-common/someip/someip_posix_types.h"
+#include "someip-posix-common/someipd_posix/control/message.h"
+
+namespace someip_posix {
+
+/**
+ * \brief Result of a flushed ControlBatch.
+ */
+struct ControlBatchResult {
+  /**
+   * \brief Number of operations applied by the SomeIP daemon.
+   */
+  std::uint32_t applied_;
+  /**
+   * \brief Number of operations skipped by the SomeIP daemon, e.g. offering an already offered service instance.
+   */
+  std::uint32_t rejected_;
+};
+
+/**
+ * \brief ControlBatch.
+ *
+ * Operations are applied by the SomeIP daemon in the order they were queued. A ControlBatch is not thread-safe, it is
+ * meant to be filled and flushed by a single thread.
+ */
+class ControlBatch {
+ public:
+  /**
+   * \brief Type of a queued operation.
+   */
+  using Entry = someip_posix_common::someipd_posix::control::MessageBatchEntry;
+
+  /**
+   * \brief Queues SomeIpPosix::OfferService().
+   *
+   * \param service_id SOME/IP service id of the offered service.
+   * \param instance_id SOME/IP instance id of the offered service.
+   */
+  void OfferService(someip_posix_common::someip::ServiceId service_id,
+                    someip_posix_common::someip::InstanceId instance_id) {
+    Queue(someip_posix_common::someipd_posix::control::MessageType::kOfferService, service_id, instance_id);
+  }
+
+  /**
+   * \brief Queues SomeIpPosix::StopOfferService().
+   *
+   * \param service_id SOME/IP service id of the offered service.
+   * \param instance_id SOME/IP instance id of the offered service.
+   */
+  void StopOfferService(someip_posix_common::someip::ServiceId service_id,
+                        someip_posix_common::someip::InstanceId instance_id) {
+    Queue(someip_posix_common::someipd_posix::control::MessageType::kStopOfferService, service_id, instance_id);
+  }
+
+  /**
+   * \brief Queues SomeIpPosix::RequestService().
+   *
+   * \param service_id SOME/IP service id of the Requested service.
+   * \param instance_id SOME/IP instance id of the Requested service.
+   */
+  void RequestService(someip_posix_common::someip::ServiceId service_id,
+                      someip_posix_common::someip::InstanceId instance_id) {
+    Queue(someip_posix_common::someipd_posix::control::MessageType::kRequestService, service_id, instance_id);
+  }
+
+  /**
+   * \brief Queues SomeIpPosix::ReleaseService().
+   *
+   * \param service_id SOME/IP service id of the Released service.
+   * \param instance_id SOME/IP instance id of the Released service.
+   */
+  void ReleaseService(someip_posix_common::someip::ServiceId service_id,
+                      someip_posix_common::someip::InstanceId instance_id) {
+    Queue(someip_posix_common::someipd_posix::control::MessageType::kReleaseService, service_id, instance_id);
+  }
+
+  /**
+   * \brief Queues SomeIpPosix::StartFindService().
+   *
+   * \param service_id SOME/IP service id of the service.
+   * \param instance_id SOME/IP instance id of the service.
+   */
+  void StartFindService(someip_posix_common::someip::ServiceId service_id,
+                        someip_posix_common::someip::InstanceId instance_id) {
+    Queue(someip_posix_common::someipd_posix::control::MessageType::kStartFindService, service_id, instance_id);
+  }
+
+  /**
+   * \brief Queues SomeIpPosix::StopFindService().
+   *
+   * \param service_id SOME/IP service id of the service.
+   * \param instance_id SOME/IP instance id of the service.
+   */
+  void StopFindService(someip_posix_common::someip::ServiceId service_id,
+                       someip_posix_common::someip::InstanceId instance_id) {
+    Queue(someip_posix_common::someipd_posix::control::MessageType::kStopFindService, service_id, instance_id);
+  }
+
+  /**
+   * \brief Queues SomeIpPosix::SubscribeEvent().
+   *
+   * \param service_id SOME/IP service id of the service.
+   * \param instance_id SOME/IP instance id of the service.
+   * \param event_id SOME/IP event id of the service.
+   */
+  void SubscribeEvent(someip_posix_common::someip::ServiceId service_id,
+                      someip_posix_common::someip::InstanceId instance_id,
+                      someip_posix_common::someip::EventId event_id) {
+    Queue(someip_posix_common::someipd_posix::control::MessageType::kSubscribeEvent, service_id, instance_id,
+          event_id);
+  }
+
+  /**
+   * \brief Queues SomeIpPosix::UnsubscribeEvent().
+   *
+   * \param service_id SOME/IP service id of the service.
+   * \param instance_id SOME/IP instance id of the service.
+   * \param event_id SOME/IP event id of the service.
+   */
+  void UnsubscribeEvent(someip_posix_common::someip::ServiceId service_id,
+                        someip_posix_common::someip::InstanceId instance_id,
+                        someip_posix_common::someip::EventId event_id) {
+    Queue(someip_posix_common::someipd_posix::control::MessageType::kUnsubscribeEvent, service_id, instance_id,
+          event_id);
+  }
+
+  /**
+   * \brief Returns the queued operations.
+   *
+   * \return Operations in the order they were queued.
+   */
+  const std::vector<Entry>& GetEntries() const { return entries_; }
+
+  /**
+   * \brief Checks if no operation is queued.
+   *
+   * \return true if the batch is empty, false otherwise.
+   */
+  bool IsEmpty() const { return entries_.empty(); }
+
+  /**
+   * \brief Removes all queued operations. The allocated storage is kept for the next batch.
+   */
+  void Clear() { entries_.clear(); }
+
+ private:
+  /**
+   * \brief Appends an operation.
+   *
+   * \param type Control message type of the operation.
+   * \param service_id SOME/IP service id.
+   * \param instance_id SOME/IP instance id.
+   * \param event_id SOME/IP event id, 0 for operations without event.
+   */
+  void Queue(someip_posix_common::someipd_posix::control::MessageType type,
+             someip_posix_common::someip::ServiceId service_id, someip_posix_common::someip::InstanceId instance_id,
+             someip_posix_common::someip::EventId event_id = 0U) {
+    entries_.push_back(Entry{static_cast<std::uint16_t>(type), service_id, instance_id, event_id});
+  }
+
+  /**
+   * \brief Queued operations.
+   */
+  std::vector<Entry> entries_;
+};
+
+}  // namespace someip_posix
+
+#endif  // LIB_LIBSOMEIP_POSIX_INCLUDE_SOMEIP_POSIX_CONTROL_BATCH_H_
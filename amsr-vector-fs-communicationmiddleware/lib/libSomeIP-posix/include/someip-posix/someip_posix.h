@@ -38,6 +38,8 @@
 #include "someip-posix-common/someip/config_model.h"
 #include "someip-posix-common/someip/someip_posix_types.h"
 #include "someip-posix-common/someipd_posix/routing/message_reader.h"
+#include "someip-posix-common/someipd_posix/routing/shared_memory_ring.h"
+#include "someip-posix/control_batch.h"
 #include "someip-posix/someip_posix_application_interface.h"
 #include "vac/language/cpp14_backport.h"
 
@@ -215,6 +217,17 @@ class SomeIpPosix : public osabstraction::io::EventHandler {
   void StopFindService(someip_posix_common::someip::ServiceId service_id,
                        someip_posix_common::someip::InstanceId instance_id);
 
+  /**
+   * \brief Sends all operations queued in a batch to the SomeIP daemon.
+   *
+   * The operations are sent in one control message, or in one control message per kMaxBatchEntries operations for
+   * larger batches, and the SomeIP daemon applies them in the queued order. The batch is cleared afterwards.
+   *
+   * \param batch Operations to send.
+   * \return Number of operations applied and skipped by the SomeIP daemon.
+   */
+  ControlBatchResult FlushControlBatch(ControlBatch& batch);
+
   /**
    * \brief Sets a receive handler for incoming SOME/IP messages and asynchronous notifications of offered services.
    *
@@ -280,11 +293,31 @@ class SomeIpPosix : public osabstraction::io::EventHandler {
    */
   void ReadRoutingChannelId();
 
+  /**
+   * \brief Creates a pair of shared memory rings and hands them over to the SomeIP daemon.
+   *
+   * If the SomeIP daemon accepts the rings, SOME/IP messages are exchanged over shared memory from now on.
+   * Otherwise the routing socket keeps being used for all messages.
+   */
+  void AttachSharedMemory();
+
+  /**
+   * \brief Handles the oldest SOME/IP message received from the SomeIP daemon over shared memory.
+   *
+   * \return true if a message was handled, false if no shared memory is attached or the ring is empty.
+   */
+  bool ProcessSharedMemoryMessage();
+
   /**
    * \brief Maximum number of entries in a FindService response control message.
    */
   static constexpr int kMaxFindServiceResponseEntries{100};
 
+  /**
+   * \brief Maximum number of messages read from the shared memory ring per wake-up.
+   */
+  static constexpr std::size_t kMaxSharedMemoryMessagesPerRead{64U};
+
   /**
    * \brief A reactor used for asynchronous event notification on file descriptors.
    */
@@ -335,6 +368,16 @@ class SomeIpPosix : public osabstraction::io::EventHandler {
    */
   someip_posix_common::someipd_posix::routing::MessageReader routing_message_reader_;
 
+  /**
+   * \brief Shared memory ring for SOME/IP messages sent to the SomeIP daemon. Empty if not attached.
+   */
+  std::unique_ptr<someip_posix_common::someipd_posix::routing::SharedMemoryRing> shared_memory_to_daemon_;
+
+  /**
+   * \brief Shared memory ring for SOME/IP messages received from the SomeIP daemon. Empty if not attached.
+   */
+  std::unique_ptr<someip_posix_common::someipd_posix::routing::SharedMemoryRing> shared_memory_from_daemon_;
+
   /**
    * \brief true if SOME/IP Posix is running, false otherwise.
    * TODO(PAASR-2151) replace with state machine
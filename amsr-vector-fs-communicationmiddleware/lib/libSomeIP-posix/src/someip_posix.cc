@@ -24,6 +24,7 @@
 #include "someip-posix/someip_posix.h"
 
 #include <unistd.h>
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
 #include "ara/log/logging.hpp"
@@ -37,6 +38,8 @@ namespace someip_posix {
 
 std::atomic<std::uint32_t> SomeIpPosix::socket_id_{0};
 
+constexpr std::size_t SomeIpPosix::kMaxSharedMemoryMessagesPerRead;
+
 SomeIpPosix::SomeIpPosix(const someip_posix_common::config::SomeIpPosixConfigModel& config,
                          osabstraction::io::ReactorInterface* reactor)
     : reactor_(reactor),
@@ -48,6 +51,7 @@ SomeIpPosix::SomeIpPosix(const someip_posix_common::config::SomeIpPosixConfigMod
           osabstraction::io::network::address::UnixDomainSocketAddress(config.control_socket_path_))),
       routing_channel_id_{},
       someip_posix_application_{nullptr},
+      routing_message_reader_{config.routing_receive_buffer_size_},
       someip_config_{config} {
   // Socket connector for the routing connection to the SomeIP daemon.
 
@@ -68,6 +72,9 @@ void SomeIpPosix::RoutingSocketConnectorHandler(
     osabstraction::io::network::socket::UnixDomainStreamSocket&& stream_socket) {
   this->routing_socket_ = std::move(stream_socket);
   this->ReadRoutingChannelId();
+  if (someip_config_.shared_memory_slot_count_ > 0U) {
+    this->AttachSharedMemory();
+  }
 
   if (someip_config_.processing_mode_ == someip_posix_common::config::SomeIpBindingProcessingMode::kPolling) {
     // Set it to the routing socket to non-blocking to achieve full polling mode.
@@ -75,12 +82,19 @@ void SomeIpPosix::RoutingSocketConnectorHandler(
   } else {
     // Registering an event handler is only necessary for threaded mode.
     this->reactor_->RegisterEventHandler(routing_socket_.GetHandle(), this, osabstraction::io::kReadEvent, nullptr);
+    if (shared_memory_from_daemon_) {
+      this->reactor_->RegisterEventHandler(shared_memory_from_daemon_->GetDoorbellHandle(), this,
+                                           osabstraction::io::kReadEvent, nullptr);
+    }
   }
 }
 
 SomeIpPosix::~SomeIpPosix() {
   if (someip_config_.processing_mode_ != someip_posix_common::config::SomeIpBindingProcessingMode::kPolling) {
     reactor_->UnregisterEventHandler(routing_socket_.GetHandle(), osabstraction::io::kReadEvent);
+    if (shared_memory_from_daemon_) {
+      reactor_->UnregisterEventHandler(shared_memory_from_daemon_->GetDoorbellHandle(), osabstraction::io::kReadEvent);
+    }
   }
 }
 
@@ -220,6 +234,15 @@ void SomeIpPosix::Send(someip_posix_common::someip::InstanceId instance_id,
   std::lock_guard<std::mutex> lock(routing_socket_lock_);
   routing::MessageHeader header{routing::kVersion, routing::MessageType::kSomeIP,
                                 static_cast<std::uint32_t>(packet->size()), instance_id};
+  if (shared_memory_to_daemon_) {
+    std::array<struct iovec, 1> body_iov{{{packet->data(), packet->size()}}};
+    if (shared_memory_to_daemon_->TryWrite(header, routing::SharedMemoryRing::IovecContainer(body_iov))) {
+      return;
+    }
+    // The daemon processes the messages left in the ring before this one.
+    header.type_ = routing::MessageType::kSomeIPRingFallback;
+    shared_memory_to_daemon_->NotifyFallbackSent();
+  }
   std::array<struct iovec, 2> iov{{{&header, sizeof(header)}, {packet->data(), packet->size()}}};
   std::size_t n = routing_socket_.Send(osabstraction::io::network::socket::Socket::IovecContainer(iov));
   if (n != sizeof(header) + packet->size()) {
@@ -288,6 +311,42 @@ void SomeIpPosix::StopFindService(someip_posix_common::someip::ServiceId service
   }
 }
 
+ControlBatchResult SomeIpPosix::FlushControlBatch(ControlBatch& batch) {
+  namespace control = someip_posix_common::someipd_posix::control;
+  ControlBatchResult result{0U, 0U};
+  const std::vector<ControlBatch::Entry>& entries = batch.GetEntries();
+  std::lock_guard<std::mutex> lock(control_socket_lock_);
+  for (std::size_t first = 0U; first < entries.size(); first += control::kMaxBatchEntries) {
+    const std::size_t count = std::min<std::size_t>(entries.size() - first, control::kMaxBatchEntries);
+    const std::size_t body_size = count * sizeof(ControlBatch::Entry);
+    control::MessageHeader header{control::kVersion, control::MessageType::kBatchRequest,
+                                  static_cast<std::uint32_t>(body_size), routing_channel_id_};
+    // struct iovec only takes mutable buffers, the entries are not modified by sending them.
+    ControlBatch::Entry* body = const_cast<ControlBatch::Entry*>(&entries[first]);
+    std::array<struct iovec, 2> iov{{{&header, sizeof(header)}, {body, body_size}}};
+    std::size_t n = control_socket_.Send(osabstraction::io::network::socket::Socket::IovecContainer(iov));
+    if (n != (sizeof(header) + body_size)) {
+      // TODO(PAASR-608)
+      throw std::runtime_error("Socket::Send");
+    }
+    control::MessageBatchResponse response;
+    std::array<struct iovec, 2> response_iov{{{&header, sizeof(header)}, {&response, sizeof(response)}}};
+    n = control_socket_.Receive(osabstraction::io::network::socket::Socket::IovecContainer(response_iov));
+    if (n != (sizeof(header) + sizeof(response))) {
+      // TODO(PAASR-608)
+      throw std::runtime_error("Socket::Receive");
+    }
+    if (header.type_ != control::MessageType::kBatchResponse) {
+      // TODO(PAASR-608)
+      throw std::runtime_error("invalid packet");
+    }
+    result.applied_ += response.applied_;
+    result.rejected_ += response.rejected_;
+  }
+  batch.Clear();
+  return result;
+}
+
 void SomeIpPosix::SetSomeipPosixApplication(SomeipPosixApplicationInterface* someip_posix_application) {
   someip_posix_application_ = someip_posix_application;
 }
@@ -296,12 +355,30 @@ void SomeIpPosix::UnsetSomeipPosixApplication() { someip_posix_application_ = nu
 
 bool SomeIpPosix::IsRunning() const { return someip_posix_running_; }
 
-bool SomeIpPosix::ProcessNextPacket() { return HandleRead(routing_socket_.GetHandle()); }
+bool SomeIpPosix::ProcessNextPacket() {
+  if (ProcessSharedMemoryMessage()) {
+    return true;
+  }
+  return HandleRead(routing_socket_.GetHandle());
+}
 
 bool SomeIpPosix::HandleRead(int handle) {
+  if (shared_memory_from_daemon_ && (handle == shared_memory_from_daemon_->GetDoorbellHandle())) {
+    shared_memory_from_daemon_->ClearDoorbell();
+    std::size_t count{0U};
+    while (ProcessSharedMemoryMessage()) {
+      if (++count == kMaxSharedMemoryMessagesPerRead) {
+        // Come back later for the rest, so that the routing socket gets its turn.
+        shared_memory_from_daemon_->RingDoorbell();
+        break;
+      }
+    }
+    return EventHandler::HandleRead(handle);
+  }
   try {
+    // One receive call per wakeup. All messages completed by it are processed before returning to the reactor.
     routing_message_reader_.Read(&routing_socket_);
-    if (routing_message_reader_.IsMessageAvailable()) {
+    while (routing_message_reader_.IsMessageAvailable()) {
       ProcessRoutingMessage(routing_message_reader_.GetNextMessage());
     }
     return EventHandler::HandleRead(handle);
@@ -331,13 +408,45 @@ bool SomeIpPosix::HandleRead(int handle) {
   }
 }
 
+bool SomeIpPosix::ProcessSharedMemoryMessage() {
+  namespace routing = someip_posix_common::someipd_posix::routing;
+  if (!shared_memory_from_daemon_) {
+    return false;
+  }
+  routing::MessageReader::Message message;
+  const std::uint8_t* body = shared_memory_from_daemon_->Peek(&message.header_);
+  if (body == nullptr) {
+    return false;
+  }
+  message.body_.assign(body, body + message.header_.length_);
+  shared_memory_from_daemon_->Pop();
+  ProcessRoutingMessage(std::move(message));
+  return true;
+}
+
 void SomeIpPosix::ProcessRoutingMessage(someip_posix_common::someipd_posix::routing::MessageReader::Message&& message) {
   namespace routing = someip_posix_common::someipd_posix::routing;
 
   switch (message.header_.type_) {
+    case routing::MessageType::kSomeIPRingFallback: {
+      // The message did not fit into the ring: everything the daemon wrote into the ring before comes first.
+      if (shared_memory_from_daemon_) {
+        while (ProcessSharedMemoryMessage()) {
+        }
+        shared_memory_from_daemon_->AcknowledgeFallback();
+      }
+      if (someip_posix_application_ != nullptr) {
+        someip_posix_common::someip::SomeIpPacket packet{
+            someip_posix_common::someip::PacketBufferPool::GetInstance().Wrap(std::move(message.body_))};
+        someip_posix_application_->HandleReceive(message.header_.instance_id_, std::move(packet));
+      }
+
+      break;
+    }
     case routing::MessageType::kSomeIP: {
       if (someip_posix_application_ != nullptr) {
-        someip_posix_common::someip::SomeIpPacket packet(new std::vector<std::uint8_t>(std::move(message.body_)));
+        someip_posix_common::someip::SomeIpPacket packet{
+            someip_posix_common::someip::PacketBufferPool::GetInstance().Wrap(std::move(message.body_))};
         someip_posix_application_->HandleReceive(message.header_.instance_id_, std::move(packet));
       }
 
@@ -419,4 +528,49 @@ void SomeIpPosix::ReadRoutingChannelId() {
   routing_channel_id_ = body.channel_id_;
 }
 
+void SomeIpPosix::AttachSharedMemory() {
+  namespace control = someip_posix_common::someipd_posix::control;
+  namespace routing = someip_posix_common::someipd_posix::routing;
+  std::unique_ptr<routing::SharedMemoryRing> to_daemon = routing::SharedMemoryRing::Create(
+      someip_config_.shared_memory_slot_count_, someip_config_.shared_memory_slot_size_);
+  std::unique_ptr<routing::SharedMemoryRing> from_daemon = routing::SharedMemoryRing::Create(
+      someip_config_.shared_memory_slot_count_, someip_config_.shared_memory_slot_size_);
+
+  std::lock_guard<std::mutex> lock(control_socket_lock_);
+  control::MessageAttachSharedMemoryRequest request{someip_config_.shared_memory_slot_count_,
+                                                    someip_config_.shared_memory_slot_size_};
+  control::MessageHeader header{control::kVersion, control::MessageType::kAttachSharedMemoryRequest, sizeof(request),
+                                routing_channel_id_};
+  std::array<struct iovec, 2> iov{{{&header, sizeof(header)}, {&request, sizeof(request)}}};
+  std::vector<int> handles(control::kSharedMemoryHandleCount);
+  handles[control::kToDaemonMemoryHandle] = to_daemon->GetMemoryHandle();
+  handles[control::kToDaemonDoorbellHandle] = to_daemon->GetDoorbellHandle();
+  handles[control::kToApplicationMemoryHandle] = from_daemon->GetMemoryHandle();
+  handles[control::kToApplicationDoorbellHandle] = from_daemon->GetDoorbellHandle();
+  std::size_t n =
+      control_socket_.SendWithHandles(osabstraction::io::network::socket::Socket::IovecContainer(iov), handles);
+  if (n != (sizeof(header) + sizeof(request))) {
+    // TODO(PAASR-608)
+    throw std::runtime_error("Socket::Send");
+  }
+  control::MessageAttachSharedMemoryResponse response;
+  std::array<struct iovec, 2> response_iov{{{&header, sizeof(header)}, {&response, sizeof(response)}}};
+  n = control_socket_.Receive(osabstraction::io::network::socket::Socket::IovecContainer(response_iov));
+  if (n != (sizeof(header) + sizeof(response))) {
+    // TODO(PAASR-608)
+    throw std::runtime_error("Socket::Receive");
+  }
+  if (header.type_ != control::MessageType::kAttachSharedMemoryResponse) {
+    // TODO(PAASR-608)
+    throw std::runtime_error("invalid packet");
+  }
+  if (response.accepted_ != 0U) {
+    shared_memory_to_daemon_ = std::move(to_daemon);
+    shared_memory_from_daemon_ = std::move(from_daemon);
+    logger_.LogInfo() << "SOME/IP messages are exchanged over shared memory";
+  } else {
+    logger_.LogWarn() << "someipd-posix rejected the shared memory rings, using the routing socket";
+  }
+}
+
 }  // namespace someip_posix
@@ -23,6 +23,7 @@
  *********************************************************************************************************************/
 #include "someipd-posix/application/application.h"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cerrno>
@@ -39,9 +40,15 @@
 namespace someipd_posix {
 namespace application {
 
+constexpr std::size_t Application::kMaxSharedMemoryMessagesPerRead;
+
 Application::Application(packet_router::PacketRouterInterface* packet_router,
-                         osabstraction::io::network::socket::UnixDomainStreamSocket&& socket)
-    : packet_router_(packet_router), subLogger(ara::log::CreateLogger("Application", "")), socket_(std::move(socket)) {
+                         osabstraction::io::network::socket::UnixDomainStreamSocket&& socket,
+                         std::size_t receive_buffer_size)
+    : packet_router_(packet_router),
+      subLogger(ara::log::CreateLogger("Application", "")),
+      socket_(std::move(socket)),
+      message_reader_(receive_buffer_size) {
   WriteRoutingChannelId();
 }
 
@@ -52,6 +59,14 @@ void Application::Forward(someip_posix_common::someip::InstanceId instance_id, p
       someip_posix_common::someipd_posix::routing::kVersion,
       someip_posix_common::someipd_posix::routing::MessageType::kSomeIP,
       static_cast<std::uint32_t>(packet->GetTotalSize()), instance_id};
+  if (shared_memory_to_application_) {
+    if (shared_memory_to_application_->TryWrite(header, packet->GetIovecContainer())) {
+      return;
+    }
+    // The application processes the messages left in the ring before this one.
+    header.type_ = someip_posix_common::someipd_posix::routing::MessageType::kSomeIPRingFallback;
+    shared_memory_to_application_->NotifyFallbackSent();
+  }
   std::array<struct iovec, 1> iov{{{&header, sizeof(header)}}};
   SendRoutingMessage(IovecContainer(iov), packet->GetIovecContainer());
 }
@@ -128,10 +143,28 @@ void Application::NotifyEventSubscriptionStateChange(
   }
 }
 
-bool Application::HandleRead(int /*handle*/) {
+void Application::AttachSharedMemory(std::unique_ptr<SharedMemoryRing> from_application,
+                                     std::unique_ptr<SharedMemoryRing> to_application) {
+  shared_memory_from_application_ = std::move(from_application);
+  shared_memory_to_application_ = std::move(to_application);
+  subLogger.LogInfo() << "application with channel id " << GetChannelId() << " uses shared memory rings with "
+                      << shared_memory_from_application_->GetSlotCount() << " slots of "
+                      << shared_memory_from_application_->GetSlotSize() << " bytes";
+}
+
+int Application::GetSharedMemoryDoorbellHandle() const {
+  return shared_memory_from_application_ ? shared_memory_from_application_->GetDoorbellHandle() : -1;
+}
+
+bool Application::HandleRead(int handle) {
+  if (handle == GetSharedMemoryDoorbellHandle()) {
+    ProcessSharedMemoryMessages(kMaxSharedMemoryMessagesPerRead);
+    return true;
+  }
   try {
+    // One receive call per wakeup. All messages completed by it are processed before returning to the reactor.
     message_reader_.Read(&socket_);
-    if (message_reader_.IsMessageAvailable()) {
+    while (message_reader_.IsMessageAvailable()) {
       ProcessRoutingMessage(message_reader_.GetNextMessage());
     }
     return true;
@@ -160,8 +193,17 @@ void Application::SetServiceDiscoveryPtr(const someipd_posix::service_discovery:
 void Application::ProcessRoutingMessage(MessageReader::Message&& message) {
   switch (message.header_.type_) {
     case someip_posix_common::someipd_posix::routing::MessageType::kSomeIP: {
-      packet_router::Packet packet(new SomeIpMessage(std::move(message.body_)));
-      packet_router_->Forward(message.header_.instance_id_, shared_from_this(), packet);
+      packet_router::Packet packet{SomeIpMessage::CreateShared(std::move(message.body_))};
+      packet_router_->Forward(message.header_.instance_id_, shared_from_this(), std::move(packet));
+    } break;
+    case someip_posix_common::someipd_posix::routing::MessageType::kSomeIPRingFallback: {
+      // The message did not fit into the ring: everything the application wrote into the ring before comes first.
+      if (shared_memory_from_application_) {
+        ProcessSharedMemoryMessages(std::numeric_limits<std::size_t>::max());
+        shared_memory_from_application_->AcknowledgeFallback();
+      }
+      packet_router::Packet packet{SomeIpMessage::CreateShared(std::move(message.body_))};
+      packet_router_->Forward(message.header_.instance_id_, shared_from_this(), std::move(packet));
     } break;
     default:
       // TODO(PAASR-605)
@@ -170,6 +212,36 @@ void Application::ProcessRoutingMessage(MessageReader::Message&& message) {
   }
 }
 
+void Application::ProcessSharedMemoryMessages(std::size_t max_count) {
+  namespace routing = someip_posix_common::someipd_posix::routing;
+  SharedMemoryRing& ring = *shared_memory_from_application_;
+  ring.ClearDoorbell();
+  routing::MessageHeader header;
+  std::size_t count{0U};
+  for (const std::uint8_t* body = ring.Peek(&header); body != nullptr; body = ring.Peek(&header)) {
+    if (count == max_count) {
+      // Come back later for the rest, other applications must not starve.
+      ring.RingDoorbell();
+      break;
+    }
+    ++count;
+    if (header.type_ == routing::MessageType::kSomeIP) {
+      // The packet takes its own copy of the slot so that the slot can be handed back to the application right away,
+      // independently of how long the routed packet is kept alive by its packet sinks.
+      SomeIpMessage::DataBuffer data{
+          someip_posix_common::someip::PacketBufferPool::GetInstance().Acquire(header.length_)};
+      std::copy(body, body + header.length_, data.begin());
+      packet_router::Packet packet{SomeIpMessage::CreateShared(std::move(data))};
+      ring.Pop();
+      packet_router_->Forward(header.instance_id_, shared_from_this(), std::move(packet));
+    } else {
+      ring.Pop();
+      // TODO(PAASR-605)
+      subLogger.LogError() << "unexpected message type " << header.type_ << " in shared memory ring";
+    }
+  }
+}
+
 void Application::ForwardServiceDiscoveryUpdate(std::vector<MessageServiceDiscoveryOfferedServiceEntry>& response) {
   namespace routing = someip_posix_common::someipd_posix::routing;  // namespace is used for the response message
   std::size_t response_size = response.size() * sizeof(routing::MessageServiceDiscoveryOfferedServiceEntry);
@@ -37,6 +37,7 @@
 #include "osabstraction/io/network/socket/socket.h"
 #include "osabstraction/io/network/socket/unix_domain_stream_socket.h"
 #include "someip-posix-common/someipd_posix/routing/message_reader.h"
+#include "someip-posix-common/someipd_posix/routing/shared_memory_ring.h"
 #include "someipd-posix/application/event_subscription_state_application_observer.h"
 #include "someipd-posix/application/findservice_application_observer.h"
 #include "someipd-posix/packet_router/packet_router_interface.h"
@@ -119,14 +120,21 @@ class Application : public std::enable_shared_from_this<Application>,
    */
   using MessageServiceDiscoveryEventSubscriptionStateEntry =
       someip_posix_common::someipd_posix::routing::MessageServiceDiscoveryEventSubscriptionStateEntry;
+  /**
+   * \brief A shared memory ring type.
+   */
+  using SharedMemoryRing = someip_posix_common::someipd_posix::routing::SharedMemoryRing;
   /**
    * \brief Constructor of Application.
    *
    * \param packet_router A packet router.
    * \param socket A socket connected to an application.
+   * \param receive_buffer_size Size of the receive buffer for routing messages.
    */
   Application(packet_router::PacketRouterInterface* packet_router,
-              osabstraction::io::network::socket::UnixDomainStreamSocket&& socket);
+              osabstraction::io::network::socket::UnixDomainStreamSocket&& socket,
+              std::size_t receive_buffer_size =
+                  someip_posix_common::someipd_posix::routing::MessageReader::kDefaultReceiveBufferSize);
   /**
    * \brief Destructor of Application.
    */
@@ -184,6 +192,23 @@ class Application : public std::enable_shared_from_this<Application>,
    * \return A routing channel identifier.
    */
   someip_posix_common::someip::ChannelId GetChannelId() const { return socket_.GetHandle(); }
+  /**
+   * \brief Moves the SOME/IP messages of the routing channel to a pair of shared memory rings.
+   *
+   * SOME/IP messages which do not fit into a slot or find the ring full are still sent over the routing socket.
+   * All other routing messages always use the routing socket.
+   *
+   * \param from_application Ring for SOME/IP messages sent by the application.
+   * \param to_application Ring for SOME/IP messages sent to the application.
+   */
+  void AttachSharedMemory(std::unique_ptr<SharedMemoryRing> from_application,
+                          std::unique_ptr<SharedMemoryRing> to_application);
+  /**
+   * \brief Returns the doorbell of the shared memory ring for SOME/IP messages sent by the application.
+   *
+   * \return A file descriptor or -1 if no shared memory is attached.
+   */
+  int GetSharedMemoryDoorbellHandle() const;
   /**
    * \brief Registers a shutdown handler.
    *
@@ -322,6 +347,11 @@ class Application : public std::enable_shared_from_this<Application>,
    * \brief A message reader type.
    */
   using MessageReader = someip_posix_common::someipd_posix::routing::MessageReader;
+  /**
+   * \brief Maximum number of messages read from the shared memory ring per wake-up. Bounds the time spent on a
+   * single application before other event handlers of the reactor get their turn.
+   */
+  static constexpr std::size_t kMaxSharedMemoryMessagesPerRead = 64U;
   /**
    * \brief Notify the client about a service discovery update, after a StartFindService()
    * has been called by the client.
@@ -353,6 +383,12 @@ class Application : public std::enable_shared_from_this<Application>,
    * \param message A complete routing message received from the connected application.
    */
   void ProcessRoutingMessage(MessageReader::Message&& message);
+  /**
+   * \brief Handles SOME/IP messages received from the application over the shared memory ring.
+   *
+   * \param max_count Maximum number of messages handled before returning.
+   */
+  void ProcessSharedMemoryMessages(std::size_t max_count);
   /**
    * \brief Sends I/O vector containers on the routing connection.
    *
@@ -382,6 +418,14 @@ class Application : public std::enable_shared_from_this<Application>,
    * \brief Reader for routing messages.
    */
   MessageReader message_reader_;
+  /**
+   * \brief Shared memory ring for SOME/IP messages sent by the application. Empty if not attached.
+   */
+  std::unique_ptr<SharedMemoryRing> shared_memory_from_application_;
+  /**
+   * \brief Shared memory ring for SOME/IP messages sent to the application. Empty if not attached.
+   */
+  std::unique_ptr<SharedMemoryRing> shared_memory_to_application_;
   /**
    * \brief A shutdown handler.
    */
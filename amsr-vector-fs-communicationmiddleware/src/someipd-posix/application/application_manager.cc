@@ -22,6 +22,7 @@
  *  INCLUDES
  *********************************************************************************************************************/
 #include "someipd-posix/application/application_manager.h"
+#include <unistd.h>
 #include <utility>
 #include <vector>
 #include "ara/log/logging.hpp"
@@ -59,6 +60,9 @@ ApplicationManager::~ApplicationManager() {
   for (auto& application : applications_) {
     reactor_->UnregisterEventHandler(application.second->GetChannelId(), osabstraction::io::kReadEvent);
   }
+  for (auto& doorbell : shared_memory_doorbells_) {
+    reactor_->UnregisterEventHandler(doorbell.first, osabstraction::io::kReadEvent);
+  }
   service_discovery_->UnRegisterServiceDiscoveryOfferServiceObserver(&find_service_update_manager_);
   service_discovery_->UnRegisterServiceDiscoveryEventSubscriptionStateObserver(
       &event_state_subscription_update_manager_);
@@ -91,12 +95,18 @@ void ApplicationManager::OnApplicationShutdown(Application* application) {
     // very important, otherwise the application is called on service offers, but the application is shut down.
     find_service_update_manager_.DeleteOfferServiceObserver(app);
     event_state_subscription_update_manager_.DeleteEventSubscriptionObserver(app);
+    const int doorbell_handle = app->GetSharedMemoryDoorbellHandle();
+    if (doorbell_handle >= 0) {
+      reactor_->UnregisterEventHandler(doorbell_handle, osabstraction::io::kReadEvent);
+      shared_memory_doorbells_.erase(doorbell_handle);
+    }
     applications_.erase(i);
   }
 }
 
 void ApplicationManager::AcceptApplication(osabstraction::io::network::socket::UnixDomainStreamSocket&& socket) {
-  ApplicationPtr application = std::make_shared<Application>(packet_router_, std::move(socket));
+  ApplicationPtr application = std::make_shared<Application>(packet_router_, std::move(socket),
+                                                            config_.GetRoutingReceiveBufferSize());
   application->SetShutdownHandler([this](Application* app) { this->OnApplicationShutdown(app); });
   application->SetServiceDiscoveryPtr(service_discovery_);
   applications_.insert({application->GetChannelId(), application});
@@ -108,9 +118,10 @@ void ApplicationManager::AcceptApplication(osabstraction::io::network::socket::U
 bool ApplicationManager::HandleRead(someip_posix_common::someip::ChannelId handle) {
   namespace control = someip_posix_common::someipd_posix::control;
   osabstraction::io::network::address::SocketAddress remote_address;
-  std::size_t n = static_cast<typename std::make_unsigned<ssize_t>::type>(
-      control_socket_.Receive(control_packet_buffer_.data(), kMaxControlPacketSize, &remote_address));
-  if (n > 0) {
+  std::array<struct iovec, 1> iov{{{control_packet_buffer_.data(), kMaxControlPacketSize}}};
+  std::size_t n = control_socket_.ReceiveWithHandles(osabstraction::io::network::socket::Socket::IovecContainer(iov),
+                                                     &remote_address, &received_handles_);
+  if (n >= sizeof(control::MessageHeader)) {
     auto header = reinterpret_cast<const control::MessageHeader*>(control_packet_buffer_.data());
     std::size_t body_length = n - sizeof(control::MessageHeader);
     if (header->length_ == body_length) {
@@ -120,12 +131,19 @@ bool ApplicationManager::HandleRead(someip_posix_common::someip::ChannelId handl
                            << " got body length " << body_length << " expected body length " << header->length_;
     }
   }
+  CloseReceivedHandles();
   return EventHandler::HandleRead(handle);
 }
 
 ApplicationManager::ApplicationPtr ApplicationManager::GetApplication(
     someip_posix_common::someip::ChannelId handle) const {
   auto it = applications_.find(handle);
+  if (it == applications_.end()) {
+    auto doorbell = shared_memory_doorbells_.find(handle);
+    if (doorbell != shared_memory_doorbells_.end()) {
+      it = applications_.find(doorbell->second);
+    }
+  }
   if (it == applications_.end()) {
     return ApplicationPtr();
   } else {
@@ -174,6 +192,12 @@ void ApplicationManager::ProcessControlPacket(
       case control::MessageType::kReleaseService:
         ReleaseService(application, header, remote_address);
         break;
+      case control::MessageType::kAttachSharedMemoryRequest:
+        AttachSharedMemoryHandler(application, header, remote_address);
+        break;
+      case control::MessageType::kBatchRequest:
+        BatchHandler(application, header, remote_address);
+        break;
       default:
         subLogger.LogError() << "unknown control packet type " << header->type_;
         break;
@@ -228,59 +252,66 @@ void ApplicationManager::OfferServiceHandler(
   namespace control = someip_posix_common::someipd_posix::control;
   if (header->length_ == sizeof(control::MessageOfferService)) {
     auto request = reinterpret_cast<const control::MessageOfferService*>(header + 1);  // Jump over header
-    const auto sid = request->service_id_;
-    const auto inst = request->instance_id_;
-
-    // Search within the service discovery if the same or any other application has already offered same service
-    // instance id
-    const auto& offered_services = service_discovery_->GetOfferedServices();
-    auto it = std::find_if(offered_services.begin(), offered_services.end(),
-                           [&sid, &inst](const service_discovery::ServiceDiscovery::OfferedService& other) {
-                             return sid == other.service_id_ && inst == other.instance_id_;
-                           });
-
-    if (it == offered_services.end()) {
-      service_discovery_->OfferService(request->service_id_, request->instance_id_, application);
-      application->AddOfferedServiceInstance(request->service_id_, request->instance_id_);
-    } else {
-      // already exists
-      subLogger.LogError() << "service (" << std::hex << sid << ", " << inst << std::dec
-                           << ") is already offered, skipped.";
-    }
+    static_cast<void>(ApplyOfferService(application, request->service_id_, request->instance_id_));
   } else {
     subLogger.LogError() << "invalid OfferService control message";
   }
 }
 
+bool ApplicationManager::ApplyOfferService(ApplicationPtr application, someip_posix_common::someip::ServiceId sid,
+                                           someip_posix_common::someip::InstanceId inst) {
+  // Search within the service discovery if the same or any other application has already offered same service
+  // instance id
+  const auto& offered_services = service_discovery_->GetOfferedServices();
+  auto it = std::find_if(offered_services.begin(), offered_services.end(),
+                         [&sid, &inst](const service_discovery::ServiceDiscovery::OfferedService& other) {
+                           return sid == other.service_id_ && inst == other.instance_id_;
+                         });
+
+  if (it == offered_services.end()) {
+    service_discovery_->OfferService(sid, inst, application);
+    application->AddOfferedServiceInstance(sid, inst);
+    return true;
+  } else {
+    // already exists
+    subLogger.LogError() << "service (" << std::hex << sid << ", " << inst << std::dec
+                         << ") is already offered, skipped.";
+    return false;
+  }
+}
+
 void ApplicationManager::StopOfferServiceHandler(
     ApplicationPtr application, const someip_posix_common::someipd_posix::control::MessageHeader* header,
     const osabstraction::io::network::address::SocketAddress& /*remote_address*/) {
   namespace control = someip_posix_common::someipd_posix::control;
   if (header->length_ == sizeof(control::MessageStopOfferService)) {
     auto request = reinterpret_cast<const control::MessageStopOfferService*>(header + 1);  // Jump over header
-    const auto sid = request->service_id_;
-    const auto inst = request->instance_id_;
-
-    // Search only within this application if it already offered the service before
-    const auto& offered_services = application->GetOfferedServiceInstances();
-    auto it = std::find_if(offered_services.begin(), offered_services.end(),
-                           [&sid, &inst](const Application::OfferedServiceInstanceEntry& other) {
-                             return sid == other.service_id_ && inst == other.instance_id_;
-                           });
-
-    if (it != offered_services.end()) {
-      service_discovery_->StopOfferService(sid, inst);
-      application->DeleteOfferedServiceInstance(sid, inst);
-    } else {
-      // does not exist
-      subLogger.LogError() << "service (" << std::hex << sid << ", " << inst << std::dec
-                           << ") is not offered, skipped.";
-    }
+    static_cast<void>(ApplyStopOfferService(application, request->service_id_, request->instance_id_));
   } else {
     subLogger.LogError() << "invalid StopOfferService control message";
   }
 }
 
+bool ApplicationManager::ApplyStopOfferService(ApplicationPtr application, someip_posix_common::someip::ServiceId sid,
+                                               someip_posix_common::someip::InstanceId inst) {
+  // Search only within this application if it already offered the service before
+  const auto& offered_services = application->GetOfferedServiceInstances();
+  auto it = std::find_if(offered_services.begin(), offered_services.end(),
+                         [&sid, &inst](const Application::OfferedServiceInstanceEntry& other) {
+                           return sid == other.service_id_ && inst == other.instance_id_;
+                         });
+
+  if (it != offered_services.end()) {
+    service_discovery_->StopOfferService(sid, inst);
+    application->DeleteOfferedServiceInstance(sid, inst);
+    return true;
+  } else {
+    // does not exist
+    subLogger.LogError() << "service (" << std::hex << sid << ", " << inst << std::dec << ") is not offered, skipped.";
+    return false;
+  }
+}
+
 void ApplicationManager::FindServiceHandler(ApplicationPtr application,
                                             const someip_posix_common::someipd_posix::control::MessageHeader* header,
                                             const osabstraction::io::network::address::SocketAddress& remote_address) {
@@ -326,11 +357,7 @@ void ApplicationManager::StartFindServiceHandler(
   if (length == sizeof(control::MessageStartFindService)) {
     const control::MessageFindServiceRequest* request =
         reinterpret_cast<const control::MessageFindServiceRequest*>(header + 1);  // Jump over header
-    const someip_posix_common::someip::ServiceId service_id = request->service_id_;
-    const someip_posix_common::someip::InstanceId instance_id = request->instance_id_;
-    // Register this application in an observer-like pattern container, to inform about offered and stopped offered
-    // services.
-    find_service_update_manager_.AddFindServiceJob(application, service_id, instance_id);
+    ApplyStartFindService(application, request->service_id_, request->instance_id_);
   } else {
     // If the length of the message does not match the specification
     subLogger.LogError() << "invalid StartFindServiceRequest control message";
@@ -347,53 +374,79 @@ void ApplicationManager::StopFindServiceHandler(
   if (length == sizeof(control::MessageStopFindService)) {
     // get the message field, without the SOME/IP header
     const auto request = reinterpret_cast<const control::MessageStartFindService*>(header + 1);
-    // De-Register this application in an observer-like pattern container, to inform about offered services,
-    // that match the requested (explicit or any) instance from the proxy
-    const someip_posix_common::someip::ServiceId service_id = request->service_id_;
-    const someip_posix_common::someip::InstanceId instance_id = request->instance_id_;
-    find_service_update_manager_.DeleteFindServiceJob(application, service_id, instance_id);
+    ApplyStopFindService(application, request->service_id_, request->instance_id_);
   } else {
     // If the length of the message does not match the specification
     subLogger.LogError() << "invalid StopFindServiceRequest control message";
   }
 }
 
+void ApplicationManager::ApplyStartFindService(ApplicationPtr application,
+                                               someip_posix_common::someip::ServiceId service_id,
+                                               someip_posix_common::someip::InstanceId instance_id) {
+  // Register this application in an observer-like pattern container, to inform about offered and stopped offered
+  // services.
+  find_service_update_manager_.AddFindServiceJob(application, service_id, instance_id);
+}
+
+void ApplicationManager::ApplyStopFindService(ApplicationPtr application,
+                                              someip_posix_common::someip::ServiceId service_id,
+                                              someip_posix_common::someip::InstanceId instance_id) {
+  // De-Register this application in an observer-like pattern container, to inform about offered services,
+  // that match the requested (explicit or any) instance from the proxy
+  find_service_update_manager_.DeleteFindServiceJob(application, service_id, instance_id);
+}
+
 void ApplicationManager::SubscribeEventHandler(
     ApplicationPtr application, const someip_posix_common::someipd_posix::control::MessageHeader* header,
     const osabstraction::io::network::address::SocketAddress& /*remote_address*/) {
   namespace control = someip_posix_common::someipd_posix::control;
   if (header->length_ == sizeof(control::MessageSubscribeEvent)) {
     auto request = reinterpret_cast<const control::MessageSubscribeEvent*>(header + 1);
-    if (application->GetSubscribedEvents().empty()) {
-      // First event subscription -> Start monitoring
-      event_state_subscription_update_manager_.AddEventSubscriptionObserver(application);
-    }
-    // Application::AddSubscribedEvent is called before ServiceDiscovery::SubscribeEvent so that the application starts
-    // tracking the event subscription state changes.
-    application->AddSubscribedEvent(request->service_id_, request->instance_id_, request->event_id_);
-    service_discovery_->SubscribeEvent(request->service_id_, request->instance_id_, request->event_id_, application);
+    ApplySubscribeEvent(application, request->service_id_, request->instance_id_, request->event_id_);
   } else {
     subLogger.LogError() << "invalid SubscribeEvent control message";
   }
 }
 
+void ApplicationManager::ApplySubscribeEvent(ApplicationPtr application,
+                                             someip_posix_common::someip::ServiceId service_id,
+                                             someip_posix_common::someip::InstanceId instance_id,
+                                             someip_posix_common::someip::EventId event_id) {
+  if (application->GetSubscribedEvents().empty()) {
+    // First event subscription -> Start monitoring
+    event_state_subscription_update_manager_.AddEventSubscriptionObserver(application);
+  }
+  // Application::AddSubscribedEvent is called before ServiceDiscovery::SubscribeEvent so that the application starts
+  // tracking the event subscription state changes.
+  application->AddSubscribedEvent(service_id, instance_id, event_id);
+  service_discovery_->SubscribeEvent(service_id, instance_id, event_id, application);
+}
+
 void ApplicationManager::UnsubscribeEventHandler(
     ApplicationPtr application, const someip_posix_common::someipd_posix::control::MessageHeader* header,
     const osabstraction::io::network::address::SocketAddress& /*remote_address*/) {
   namespace control = someip_posix_common::someipd_posix::control;
   if (header->length_ == sizeof(control::MessageUnsubscribeEvent)) {
     auto request = reinterpret_cast<const control::MessageUnsubscribeEvent*>(header + 1);
-    service_discovery_->UnsubscribeEvent(request->service_id_, request->instance_id_, request->event_id_, application);
-    application->DeleteSubscribedEvent(request->service_id_, request->instance_id_, request->event_id_);
-    if (application->GetSubscribedEvents().empty()) {
-      // Last event subscription -> Stop monitoring
-      event_state_subscription_update_manager_.DeleteEventSubscriptionObserver(application);
-    }
+    ApplyUnsubscribeEvent(application, request->service_id_, request->instance_id_, request->event_id_);
   } else {
     subLogger.LogError() << "invalid UnsubscribeEvent control message";
   }
 }
 
+void ApplicationManager::ApplyUnsubscribeEvent(ApplicationPtr application,
+                                               someip_posix_common::someip::ServiceId service_id,
+                                               someip_posix_common::someip::InstanceId instance_id,
+                                               someip_posix_common::someip::EventId event_id) {
+  service_discovery_->UnsubscribeEvent(service_id, instance_id, event_id, application);
+  application->DeleteSubscribedEvent(service_id, instance_id, event_id);
+  if (application->GetSubscribedEvents().empty()) {
+    // Last event subscription -> Stop monitoring
+    event_state_subscription_update_manager_.DeleteEventSubscriptionObserver(application);
+  }
+}
+
 void ApplicationManager::RequestService(ApplicationPtr application,
                                         const someip_posix_common::someipd_posix::control::MessageHeader* header,
                                         const osabstraction::io::network::address::SocketAddress& /*remote_address*/) {
@@ -401,28 +454,31 @@ void ApplicationManager::RequestService(ApplicationPtr application,
   namespace control = someip_posix_common::someipd_posix::control;
   if (header->length_ == sizeof(control::MessageRequestService)) {
     auto request = reinterpret_cast<const control::MessageRequestService*>(header + 1);
-    const auto sid = request->service_id_;
-    const auto inst = request->instance_id_;
-
-    // Search within the service discovery if this service is already offered
-    const auto& offered_services = service_discovery_->GetOfferedServices();
-    auto it = std::find_if(offered_services.begin(), offered_services.end(),
-                           [&sid, &inst](const service_discovery::ServiceDiscovery::OfferedService& other) {
-                             return sid == other.service_id_ && inst == other.instance_id_;
-                           });
-
-    if (it != offered_services.end()) {
-      service_discovery_->RequestService(request->service_id_, request->instance_id_);
-      application->AddRequestedServiceInstance(request->service_id_, request->instance_id_);
-    } else {
-      subLogger.LogError() << "service (" << std::hex << sid << ", " << inst << std::dec
-                           << ") is not offered, skipped.";
-    }
+    static_cast<void>(ApplyRequestService(application, request->service_id_, request->instance_id_));
   } else {
     subLogger.LogError() << "invalid RequestService control message";
   }
 }
 
+bool ApplicationManager::ApplyRequestService(ApplicationPtr application, someip_posix_common::someip::ServiceId sid,
+                                             someip_posix_common::someip::InstanceId inst) {
+  // Search within the service discovery if this service is already offered
+  const auto& offered_services = service_discovery_->GetOfferedServices();
+  auto it = std::find_if(offered_services.begin(), offered_services.end(),
+                         [&sid, &inst](const service_discovery::ServiceDiscovery::OfferedService& other) {
+                           return sid == other.service_id_ && inst == other.instance_id_;
+                         });
+
+  if (it != offered_services.end()) {
+    service_discovery_->RequestService(sid, inst);
+    application->AddRequestedServiceInstance(sid, inst);
+    return true;
+  } else {
+    subLogger.LogError() << "service (" << std::hex << sid << ", " << inst << std::dec << ") is not offered, skipped.";
+    return false;
+  }
+}
+
 void ApplicationManager::ReleaseService(ApplicationPtr application,
                                         const someip_posix_common::someipd_posix::control::MessageHeader* header,
                                         const osabstraction::io::network::address::SocketAddress& /*remote_address*/) {
@@ -430,27 +486,142 @@ void ApplicationManager::ReleaseService(ApplicationPtr application,
   namespace control = someip_posix_common::someipd_posix::control;
   if (header->length_ == sizeof(control::MessageReleaseService)) {
     auto request = reinterpret_cast<const control::MessageReleaseService*>(header + 1);
-    const auto sid = request->service_id_;
-    const auto inst = request->instance_id_;
-
-    // Search only within this application if it already requested the service before
-    const auto& offered_services = application->GetRequestedServiceInstances();
-    auto it = std::find_if(offered_services.begin(), offered_services.end(),
-                           [&sid, &inst](const Application::RequestedServiceInstanceEntry& other) {
-                             return sid == std::get<0>(other) && inst == std::get<1>(other);
-                           });
-
-    if (it != offered_services.end()) {
-      service_discovery_->ReleaseService(request->service_id_, request->instance_id_);
-      application->DeleteRequestedServiceInstance(request->service_id_, request->instance_id_);
+    static_cast<void>(ApplyReleaseService(application, request->service_id_, request->instance_id_));
+  } else {
+    subLogger.LogError() << "invalid ReleaseService control message";
+  }
+}
+
+bool ApplicationManager::ApplyReleaseService(ApplicationPtr application, someip_posix_common::someip::ServiceId sid,
+                                             someip_posix_common::someip::InstanceId inst) {
+  // Search only within this application if it already requested the service before
+  const auto& offered_services = application->GetRequestedServiceInstances();
+  auto it = std::find_if(offered_services.begin(), offered_services.end(),
+                         [&sid, &inst](const Application::RequestedServiceInstanceEntry& other) {
+                           return sid == std::get<0>(other) && inst == std::get<1>(other);
+                         });
+
+  if (it != offered_services.end()) {
+    service_discovery_->ReleaseService(sid, inst);
+    application->DeleteRequestedServiceInstance(sid, inst);
+    return true;
+  } else {
+    // does not exist
+    subLogger.LogError() << "service (" << std::hex << sid << ", " << inst << std::dec
+                         << ") is not requested, skipped.";
+    return false;
+  }
+}
+
+void ApplicationManager::AttachSharedMemoryHandler(
+    ApplicationPtr application, const someip_posix_common::someipd_posix::control::MessageHeader* header,
+    const osabstraction::io::network::address::SocketAddress& remote_address) {
+  namespace control = someip_posix_common::someipd_posix::control;
+  using SharedMemoryRing = someip_posix_common::someipd_posix::routing::SharedMemoryRing;
+  control::MessageAttachSharedMemoryResponse response{0U};
+  if ((header->length_ == sizeof(control::MessageAttachSharedMemoryRequest)) &&
+      (received_handles_.size() == control::kSharedMemoryHandleCount) &&
+      (application->GetSharedMemoryDoorbellHandle() < 0)) {
+    // The rings take ownership of the received file descriptors.
+    std::unique_ptr<SharedMemoryRing> from_application = SharedMemoryRing::Attach(
+        received_handles_[control::kToDaemonMemoryHandle], received_handles_[control::kToDaemonDoorbellHandle]);
+    std::unique_ptr<SharedMemoryRing> to_application =
+        SharedMemoryRing::Attach(received_handles_[control::kToApplicationMemoryHandle],
+                                 received_handles_[control::kToApplicationDoorbellHandle]);
+    received_handles_.clear();
+    if (from_application && to_application) {
+      const int doorbell_handle = from_application->GetDoorbellHandle();
+      application->AttachSharedMemory(std::move(from_application), std::move(to_application));
+      shared_memory_doorbells_.insert({doorbell_handle, application->GetChannelId()});
+      reactor_->RegisterEventHandler(doorbell_handle, &application_event_handler_, osabstraction::io::kReadEvent,
+                                     nullptr);
+      response.accepted_ = 1U;
     } else {
-      // does not exist
-      subLogger.LogError() << "service (" << std::hex << sid << ", " << inst << std::dec
-                           << ") is not requested, skipped.";
+      subLogger.LogError() << "invalid shared memory rings from application with channel id "
+                           << application->GetChannelId();
     }
   } else {
-    subLogger.LogError() << "invalid ReleaseService control message";
+    subLogger.LogError() << "invalid AttachSharedMemoryRequest control message";
+  }
+  control::MessageHeader to_header{control::kVersion, control::MessageType::kAttachSharedMemoryResponse,
+                                   sizeof(response), static_cast<std::uint32_t>(application->GetChannelId())};
+  std::array<struct iovec, 2> iov{{
+      {&to_header, sizeof(to_header)}, {&response, sizeof(response)},
+  }};
+  std::size_t n = control_socket_.Send(osabstraction::io::network::socket::Socket::IovecContainer(iov), remote_address);
+  if (n != (sizeof(to_header) + sizeof(response))) {
+    // TODO(PAASR-605)
+    throw std::runtime_error("Socket::Send");
+  }
+}
+
+void ApplicationManager::BatchHandler(ApplicationPtr application,
+                                      const someip_posix_common::someipd_posix::control::MessageHeader* header,
+                                      const osabstraction::io::network::address::SocketAddress& remote_address) {
+  namespace control = someip_posix_common::someipd_posix::control;
+  control::MessageBatchResponse response{0U, 0U};
+  const std::size_t count = header->length_ / sizeof(control::MessageBatchEntry);
+  if ((header->length_ % sizeof(control::MessageBatchEntry) == 0U) && (count <= control::kMaxBatchEntries)) {
+    auto entries = reinterpret_cast<const control::MessageBatchEntry*>(header + 1);  // Jump over header
+    for (std::size_t i = 0U; i < count; ++i) {
+      const control::MessageBatchEntry& entry = entries[i];
+      bool applied{true};
+      switch (entry.type_) {
+        case control::MessageType::kOfferService:
+          applied = ApplyOfferService(application, entry.service_id_, entry.instance_id_);
+          break;
+        case control::MessageType::kStopOfferService:
+          applied = ApplyStopOfferService(application, entry.service_id_, entry.instance_id_);
+          break;
+        case control::MessageType::kRequestService:
+          applied = ApplyRequestService(application, entry.service_id_, entry.instance_id_);
+          break;
+        case control::MessageType::kReleaseService:
+          applied = ApplyReleaseService(application, entry.service_id_, entry.instance_id_);
+          break;
+        case control::MessageType::kStartFindService:
+          ApplyStartFindService(application, entry.service_id_, entry.instance_id_);
+          break;
+        case control::MessageType::kStopFindService:
+          ApplyStopFindService(application, entry.service_id_, entry.instance_id_);
+          break;
+        case control::MessageType::kSubscribeEvent:
+          ApplySubscribeEvent(application, entry.service_id_, entry.instance_id_, entry.event_id_);
+          break;
+        case control::MessageType::kUnsubscribeEvent:
+          ApplyUnsubscribeEvent(application, entry.service_id_, entry.instance_id_, entry.event_id_);
+          break;
+        default:
+          subLogger.LogError() << "control packet type " << entry.type_ << " is not allowed in a batch";
+          applied = false;
+          break;
+      }
+      if (applied) {
+        ++response.applied_;
+      } else {
+        ++response.rejected_;
+      }
+    }
+  } else {
+    subLogger.LogError() << "invalid BatchRequest control message";
+  }
+  control::MessageHeader to_header{control::kVersion, control::MessageType::kBatchResponse, sizeof(response),
+                                   static_cast<std::uint32_t>(application->GetChannelId())};
+  std::array<struct iovec, 2> iov{{
+      {&to_header, sizeof(to_header)}, {&response, sizeof(response)},
+  }};
+  std::size_t n = control_socket_.Send(osabstraction::io::network::socket::Socket::IovecContainer(iov), remote_address);
+  if (n != (sizeof(to_header) + sizeof(response))) {
+    // TODO(PAASR-605)
+    throw std::runtime_error("Socket::Send");
+  }
+}
+
+void ApplicationManager::CloseReceivedHandles() {
+  for (int handle : received_handles_) {
+    static_cast<void>(::close(handle));
   }
+  received_handles_.clear();
 }
 
 someip_posix_common::someip::ClientId ApplicationManager::GetFreeClientId() {
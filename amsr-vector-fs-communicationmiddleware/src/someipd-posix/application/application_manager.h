@@ -28,6 +28,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <vector>
 #include "ara/log/logging.hpp"
 #include "osabstraction/io/network/socket/socket.h"
 #include "osabstraction/io/network/socket/socket_acceptor.h"
@@ -246,6 +247,114 @@ class ApplicationManager : public osabstraction::io::EventHandler {
   void ReleaseService(ApplicationPtr application,
                       const someip_posix_common::someipd_posix::control::MessageHeader* header,
                       const osabstraction::io::network::address::SocketAddress& remote_address);
+  /**
+   * \brief AttachSharedMemory control message handler.
+   *
+   * Consumes the file descriptors passed along with the request.
+   *
+   * \param application The application which sent the request.
+   * \param header A pointer to a received control message.
+   * \param remote_address The address of the remote peer. Required for sending a response.
+   */
+  void AttachSharedMemoryHandler(ApplicationPtr application,
+                                 const someip_posix_common::someipd_posix::control::MessageHeader* header,
+                                 const osabstraction::io::network::address::SocketAddress& remote_address);
+  /**
+   * \brief Batch control message handler.
+   *
+   * Applies all operations of the batch in one pass and answers with a single BatchResponse.
+   *
+   * \param application The application which sent the request.
+   * \param header A pointer to a received control message.
+   * \param remote_address The address of the remote peer. Required for sending a response.
+   */
+  void BatchHandler(ApplicationPtr application,
+                    const someip_posix_common::someipd_posix::control::MessageHeader* header,
+                    const osabstraction::io::network::address::SocketAddress& remote_address);
+  /**
+   * \brief Offers a service instance on behalf of an application.
+   *
+   * \param application The application offering the service instance.
+   * \param sid SOME/IP service id.
+   * \param inst SOME/IP instance id.
+   * \return false if the service instance is already offered, true otherwise.
+   */
+  bool ApplyOfferService(ApplicationPtr application, someip_posix_common::someip::ServiceId sid,
+                         someip_posix_common::someip::InstanceId inst);
+  /**
+   * \brief Stops offering a service instance on behalf of an application.
+   *
+   * \param application The application which offered the service instance.
+   * \param sid SOME/IP service id.
+   * \param inst SOME/IP instance id.
+   * \return false if the application does not offer the service instance, true otherwise.
+   */
+  bool ApplyStopOfferService(ApplicationPtr application, someip_posix_common::someip::ServiceId sid,
+                             someip_posix_common::someip::InstanceId inst);
+  /**
+   * \brief Requests a service instance on behalf of an application.
+   *
+   * \param application The application requesting the service instance.
+   * \param sid SOME/IP service id.
+   * \param inst SOME/IP instance id.
+   * \return false if the service instance is not offered, true otherwise.
+   */
+  bool ApplyRequestService(ApplicationPtr application, someip_posix_common::someip::ServiceId sid,
+                           someip_posix_common::someip::InstanceId inst);
+  /**
+   * \brief Releases a service instance on behalf of an application.
+   *
+   * \param application The application which requested the service instance.
+   * \param sid SOME/IP service id.
+   * \param inst SOME/IP instance id.
+   * \return false if the application did not request the service instance, true otherwise.
+   */
+  bool ApplyReleaseService(ApplicationPtr application, someip_posix_common::someip::ServiceId sid,
+                           someip_posix_common::someip::InstanceId inst);
+  /**
+   * \brief Starts asynchronous service notifications for an application.
+   *
+   * \param application The application to notify.
+   * \param service_id SOME/IP service id.
+   * \param instance_id SOME/IP instance id or kInstanceIdAny.
+   */
+  void ApplyStartFindService(ApplicationPtr application, someip_posix_common::someip::ServiceId service_id,
+                             someip_posix_common::someip::InstanceId instance_id);
+  /**
+   * \brief Stops asynchronous service notifications for an application.
+   *
+   * \param application The application to stop notifying.
+   * \param service_id SOME/IP service id.
+   * \param instance_id SOME/IP instance id or kInstanceIdAny.
+   */
+  void ApplyStopFindService(ApplicationPtr application, someip_posix_common::someip::ServiceId service_id,
+                            someip_posix_common::someip::InstanceId instance_id);
+  /**
+   * \brief Subscribes an event on behalf of an application.
+   *
+   * \param application The application to forward the event to.
+   * \param service_id SOME/IP service id.
+   * \param instance_id SOME/IP instance id.
+   * \param event_id SOME/IP event id.
+   */
+  void ApplySubscribeEvent(ApplicationPtr application, someip_posix_common::someip::ServiceId service_id,
+                           someip_posix_common::someip::InstanceId instance_id,
+                           someip_posix_common::someip::EventId event_id);
+  /**
+   * \brief Cancels an event subscription of an application.
+   *
+   * \param application The application which subscribed the event.
+   * \param service_id SOME/IP service id.
+   * \param instance_id SOME/IP instance id.
+   * \param event_id SOME/IP event id.
+   */
+  void ApplyUnsubscribeEvent(ApplicationPtr application, someip_posix_common::someip::ServiceId service_id,
+                             someip_posix_common::someip::InstanceId instance_id,
+                             someip_posix_common::someip::EventId event_id);
+  /**
+   * \brief Closes all received file descriptors which have not been consumed by a control message handler.
+   */
+  void CloseReceivedHandles();
   /**
    * \brief Allocate an unused client id.
    *
@@ -291,10 +400,18 @@ class ApplicationManager : public osabstraction::io::EventHandler {
    * \brief Buffer for incoming control messages.
    */
   std::array<std::uint8_t, kMaxControlPacketSize> control_packet_buffer_;
+  /**
+   * \brief File descriptors passed along with the control message currently processed.
+   */
+  std::vector<int> received_handles_;
   /**
    * \brief Container for each application connection.
    */
   ApplicationMap applications_;
+  /**
+   * \brief Routing channel identifiers by shared memory doorbell file descriptor.
+   */
+  std::map<int, someip_posix_common::someip::ChannelId> shared_memory_doorbells_;
   /**
    * \brief Client id bit mask.
    */
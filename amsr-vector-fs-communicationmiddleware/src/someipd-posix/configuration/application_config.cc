@@ -416,6 +416,17 @@ ConfigurationTypesAndDefs::NetworkEndpointContainer ApplicationConfig::ReadNetwo
               someip_posix_common::someip::KeepAliveParameters{idle_time, alive_interval, retry_count};
         }
 
+        if (pc.HasMember("send_queue") && pc["send_queue"].IsObject()) {
+          const auto& send_queue = pc["send_queue"];
+          assert(send_queue.HasMember("high_watermark") && send_queue["high_watermark"].IsUint());
+          assert(send_queue.HasMember("low_watermark") && send_queue["low_watermark"].IsUint());
+          const std::size_t high_watermark{send_queue["high_watermark"].GetUint()};
+          const std::size_t low_watermark{send_queue["low_watermark"].GetUint()};
+          assert(low_watermark <= high_watermark);
+          port.options_.send_queue_ =
+              someip_posix_common::someip::TcpSendQueueParameters{high_watermark, low_watermark};
+        }
+
       } else {
         port.proto_ = Protocol::kUDP;
       }
@@ -427,6 +438,12 @@ ConfigurationTypesAndDefs::NetworkEndpointContainer ApplicationConfig::ReadNetwo
         port.options_.qos_.first = false;
       }
 
+      if (pc.HasMember("segmentation_offload")) {
+        assert(port.proto_ == Protocol::kUDP);
+        assert(pc["segmentation_offload"].IsBool());
+        port.options_.segmentation_offload_ = pc["segmentation_offload"].GetBool();
+      }
+
       if (pc.HasMember("tx_trigger")) {
         assert(port.proto_ == Protocol::kUDP);
         assert(pc["tx_trigger"].IsObject());
@@ -26,10 +26,13 @@
  *********************************************************************************************************************/
 #include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <cstddef>
 #include <iterator>
 #include <utility>
 #include <vector>
 #include "ara/log/logging.hpp"
+#include "someip-posix-common/someip/config_model.h"
 #include "someipd-posix/configuration/configuration_types.h"
 
 namespace someipd_posix {
@@ -60,6 +63,18 @@ class Configuration : public ConfigurationTypesAndDefs {
    * \return Path to routing socket.
    */
   const someip_posix_common::someip::SocketPath& GetRoutingSocketPath() const { return routing_socket_path_; }
+  /**
+   * \brief Returns the time after which an unanswered method request is no longer tracked.
+   *
+   * \return Response timeout. Zero means that requests are tracked until a response arrives.
+   */
+  std::chrono::milliseconds GetResponseTimeout() const { return response_timeout_; }
+  /**
+   * \brief Returns the size of the receive buffer of each application connection.
+   *
+   * \return Receive buffer size in bytes.
+   */
+  std::size_t GetRoutingReceiveBufferSize() const { return routing_receive_buffer_size_; }
   /**
    * \brief Returns a container of all services.
    *
@@ -422,6 +437,14 @@ class Configuration : public ConfigurationTypesAndDefs {
    * \brief A path to a routing socket.
    */
   someip_posix_common::someip::SocketPath routing_socket_path_;
+  /**
+   * \brief Time after which an unanswered method request is no longer tracked.
+   */
+  std::chrono::milliseconds response_timeout_{0};
+  /**
+   * \brief Size of the receive buffer of each application connection. Bounds the amount of data processed per wakeup.
+   */
+  std::size_t routing_receive_buffer_size_{someip_posix_common::config::kDefaultRoutingReceiveBufferSize};
   /**
    * \brief Required service instances.
    */
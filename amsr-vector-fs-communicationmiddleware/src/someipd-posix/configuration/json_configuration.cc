@@ -109,6 +109,16 @@ void JsonConfiguration::ReadDaemon(const ara::per::internal::json::JsonObject& c
     routing_socket_path_ = "/tmp/someipd-posix-routing.socket";
   }
 
+  if (config.HasMember("response_timeout_ms")) {
+    assert(config["response_timeout_ms"].IsUint());
+    response_timeout_ = std::chrono::milliseconds{config["response_timeout_ms"].GetUint()};
+  }
+
+  if (config.HasMember("routing_receive_buffer_size")) {
+    assert(config["routing_receive_buffer_size"].IsUint());
+    routing_receive_buffer_size_ = config["routing_receive_buffer_size"].GetUint();
+  }
+
   *this << ReadStaticServiceDiscovery(config);
 }
 
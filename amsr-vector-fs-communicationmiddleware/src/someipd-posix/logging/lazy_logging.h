@@ -0,0 +1,75 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  lazy_logging.h
+ *        \brief  Logging macros which evaluate their arguments only if the log level is enabled.
+ *
+ *      \details  logger.LogDebug() << a << b; formats a and b even if debug output is disabled. On paths executed
+ *                per SOME/IP message use SOMEIPD_LOG_DEBUG(logger) << a << b; instead: the log level is checked
+ *                first and the stream expression is skipped entirely if it is disabled.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SRC_SOMEIPD_POSIX_LOGGING_LAZY_LOGGING_H_
+#define SRC_SOMEIPD_POSIX_LOGGING_LAZY_LOGGING_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "ara/log/logging.hpp"
+
+/**
+ * \brief Starts a log statement of the given level if it is enabled for the logger.
+ *
+ * The empty if branch followed by else keeps the macro safe to use inside an unbraced if/else.
+ *
+ * \param logger Logger to write to.
+ * \param level Enumerator of ara::log::LogLevel.
+ * \param method Logger method returning the log stream of that level.
+ */
+#define SOMEIPD_LOG_IF_ENABLED(logger, level, method)      \
+  if (!(logger).IsLogEnabled(ara::log::LogLevel::level)) { \
+  } else                                                   \
+    (logger).method()
+
+/**
+ * \brief Log statement of level fatal.
+ */
+#define SOMEIPD_LOG_FATAL(logger) SOMEIPD_LOG_IF_ENABLED(logger, kFatal, LogFatal)
+
+/**
+ * \brief Log statement of level error.
+ */
+#define SOMEIPD_LOG_ERROR(logger) SOMEIPD_LOG_IF_ENABLED(logger, kError, LogError)
+
+/**
+ * \brief Log statement of level warning.
+ */
+#define SOMEIPD_LOG_WARN(logger) SOMEIPD_LOG_IF_ENABLED(logger, kWarn, LogWarn)
+
+/**
+ * \brief Log statement of level info.
+ */
+#define SOMEIPD_LOG_INFO(logger) SOMEIPD_LOG_IF_ENABLED(logger, kInfo, LogInfo)
+
+/**
+ * \brief Log statement of level debug.
+ */
+#define SOMEIPD_LOG_DEBUG(logger) SOMEIPD_LOG_IF_ENABLED(logger, kDebug, LogDebug)
+
+/**
+ * \brief Log statement of level verbose.
+ */
+#define SOMEIPD_LOG_VERBOSE(logger) SOMEIPD_LOG_IF_ENABLED(logger, kVerbose, LogVerbose)
+
+#endif  // SRC_SOMEIPD_POSIX_LOGGING_LAZY_LOGGING_H_
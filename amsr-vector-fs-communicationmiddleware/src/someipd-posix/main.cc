@@ -25,8 +25,10 @@
 #include <unistd.h>
 #include <atomic>
 #include <csignal>
+#include <memory>
 #include <thread>
 #include "ara/log/logging.hpp"
+#include "osabstraction/io/epoll_reactor.h"
 #include "osabstraction/io/reactor.h"
 #include "someipd-posix/application/application_manager.h"
 #include "someipd-posix/configuration/json_configuration.h"
@@ -54,6 +56,10 @@ struct CommandLineArguments {
    * \brief Verbosity level.
    */
   std::size_t verbose_;
+  /**
+   * \brief Use the epoll based reactor instead of the select based one.
+   */
+  bool use_epoll_reactor_;
 };
 
 /**
@@ -64,9 +70,10 @@ struct CommandLineArguments {
 static void Usage(const char* progname) {
   ara::log::Logger& logger = ara::log::CreateLogger("Usage SOME/IP daemon", "");
   logger.LogInfo() << "usage: " << progname
-                   << " [-h] [-v] -c <config file path>\n"
+                   << " [-h] [-v] [-e] -c <config file path>\n"
                       "-h                       Print this message and exit.\n"
                       "-v                       Verbosity level.\n"
+                      "-e                       Use the epoll based reactor.\n"
                       "-c <config file path>    Specify the location of the configuration file.\n";
 }
 
@@ -83,8 +90,9 @@ static CommandLineArguments ParseArguments(int argc, char* argv[]) {
   ara::log::Logger& logger = ara::log::CreateLogger("Arguments parser SOME/IP daemon", "");
   args.cfg_path_ = "";
   args.verbose_ = 0;
+  args.use_epoll_reactor_ = false;
   printf("ParseArguments into\n");
-  while ((c = getopt(argc, argv, "hc:v")) != -1) {
+  while ((c = getopt(argc, argv, "hc:ve")) != -1) {
     printf("while into\n");
     switch (c) {
       case 'h':
@@ -103,6 +111,9 @@ static CommandLineArguments ParseArguments(int argc, char* argv[]) {
           args.verbose_++;
         }
         break;
+      case 'e':
+        args.use_epoll_reactor_ = true;
+        break;
       case '?':
         //printf("---?\n");
       default:
@@ -214,8 +225,13 @@ int main(int argc, char* argv[]) {
   SetupSignalHandling();
   printf("someip--------- zhuang2\n");
 
-  osabstraction::io::Reactor reactor;
-  vac::timer::TimerManager timer_manager(&reactor);
+  std::unique_ptr<osabstraction::io::ReactorInterface> reactor;
+  if (args.use_epoll_reactor_) {
+    reactor = vac::language::make_unique<osabstraction::io::EpollReactor>();
+  } else {
+    reactor = vac::language::make_unique<osabstraction::io::Reactor>();
+  }
+  vac::timer::TimerManager timer_manager(reactor.get());
   printf("someip---------- zhuang3\n");
 
   try {
@@ -227,14 +243,14 @@ int main(int argc, char* argv[]) {
     printf("someip---------- zhuang4\n");
     // Initialize packet router
     printf("someip---------- zhuang5\n");
-    someipd_posix::packet_router::PacketRouter packet_router(&config);
+    someipd_posix::packet_router::PacketRouter packet_router(&config, &timer_manager);
     // Initialize service discovery
     printf("someip---------- zhuang6\n");
-    someipd_posix::service_discovery::ServiceDiscovery service_discovery(&config, &reactor, &timer_manager,
+    someipd_posix::service_discovery::ServiceDiscovery service_discovery(&config, reactor.get(), &timer_manager,
                                                                          &packet_router);
     printf("someip---------- zhuang7\n");
     // Initialize application manager
-    someipd_posix::application::ApplicationManager application_manager(config, &reactor, &packet_router,
+    someipd_posix::application::ApplicationManager application_manager(config, reactor.get(), &packet_router,
                                                                        &service_discovery);
     printf("someip---------- zhuang8\n");
 #if defined(ENABLE_EXEC_MANAGER_SUPPORT)
@@ -252,9 +268,9 @@ int main(int argc, char* argv[]) {
         printf("someip------ zhuang11");
         const std::pair<bool, struct timeval> expiry = timer_manager.GetNextExpiry();
         if (expiry.first) {
-          reactor.HandleEvents(&expiry.second);
+          reactor->HandleEvents(&expiry.second);
         } else {
-          reactor.HandleEvents(nullptr);
+          reactor->HandleEvents(nullptr);
         }
         timer_manager.HandleTimerExpiry();
       }
@@ -270,7 +286,7 @@ int main(int argc, char* argv[]) {
 
     printf("Stopping the reactor thread\n");
     reactor_done = true;
-    reactor.Unblock();
+    reactor->Unblock();
     reactor_thread.join();
   } catch (std::system_error& e) {
     //logger.LogError() << e.what();
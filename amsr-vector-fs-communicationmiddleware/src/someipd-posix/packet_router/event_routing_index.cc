@@ -0,0 +1,92 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  event_routing_index.cc
+ *        \brief  Precompiled routing index for SOME/IP events
+ *
+ *      \details  -
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "someipd-posix/packet_router/event_routing_index.h"
+
+#include <cassert>
+
+namespace someipd_posix {
+namespace packet_router {
+
+constexpr std::uint32_t EventRoutingIndex::kEmptySlot;
+
+constexpr std::size_t EventRoutingIndex::kInitialCapacity;
+
+EventRoutingIndex::EventRoutingIndex() : slots_(kInitialCapacity, Slot{0U, kEmptySlot}) {
+  routes_.reserve(kInitialCapacity / 2U);
+}
+
+const EventRoutingIndex::Route* EventRoutingIndex::Find(someip_posix_common::someip::ServiceId service_id,
+                                                        someip_posix_common::someip::InstanceId instance_id,
+                                                        someip_posix_common::someip::EventId event_id) const {
+  const Slot& slot = slots_[Probe(MakeKey(service_id, instance_id, event_id))];
+  return (slot.route_index_ != kEmptySlot) ? &routes_[slot.route_index_] : nullptr;
+}
+
+EventRoutingIndex::Route& EventRoutingIndex::FindOrInsert(someip_posix_common::someip::ServiceId service_id,
+                                                          someip_posix_common::someip::InstanceId instance_id,
+                                                          someip_posix_common::someip::EventId event_id) {
+  const std::uint64_t key{MakeKey(service_id, instance_id, event_id)};
+  std::size_t index{Probe(key)};
+  if (slots_[index].route_index_ == kEmptySlot) {
+    // Keep the load factor at or below 50% so that probe sequences stay short.
+    if (((routes_.size() + 1U) * 2U) > slots_.size()) {
+      Grow();
+      index = Probe(key);
+    }
+    assert(routes_.size() < kEmptySlot);
+    slots_[index] = Slot{key, static_cast<std::uint32_t>(routes_.size())};
+    routes_.push_back(Route{service_id, instance_id, event_id, false, std::make_shared<const PacketSinkContainer>()});
+  }
+  return routes_[slots_[index].route_index_];
+}
+
+std::uint64_t EventRoutingIndex::MakeKey(someip_posix_common::someip::ServiceId service_id,
+                                         someip_posix_common::someip::InstanceId instance_id,
+                                         someip_posix_common::someip::EventId event_id) {
+  return (static_cast<std::uint64_t>(service_id) << 32U) | (static_cast<std::uint64_t>(instance_id) << 16U) |
+         static_cast<std::uint64_t>(event_id);
+}
+
+std::size_t EventRoutingIndex::Probe(std::uint64_t key) const {
+  const std::size_t mask{slots_.size() - 1U};
+  // Fibonacci hashing spreads the densely allocated SOME/IP identifiers over the whole table.
+  std::size_t index{static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32U) & mask};
+  while ((slots_[index].route_index_ != kEmptySlot) && (slots_[index].key_ != key)) {
+    index = (index + 1U) & mask;
+  }
+  return index;
+}
+
+void EventRoutingIndex::Grow() {
+  std::vector<Slot> old_slots(slots_.size() * 2U, Slot{0U, kEmptySlot});
+  slots_.swap(old_slots);
+  for (const Slot& slot : old_slots) {
+    if (slot.route_index_ != kEmptySlot) {
+      slots_[Probe(slot.key_)] = slot;
+    }
+  }
+}
+
+}  // namespace packet_router
+}  // namespace someipd_posix
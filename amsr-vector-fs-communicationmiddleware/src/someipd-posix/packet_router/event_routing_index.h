@@ -0,0 +1,168 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  event_routing_index.h
+ *        \brief  Precompiled routing index for SOME/IP events
+ *
+ *      \details  The event routing index maps a (service, instance, event) triple directly to the deduplicated list of
+ *                packet sinks which shall receive the event. It merges the event and eventgroup routing tables of the
+ *                packet router so that forwarding an event requires a single hash lookup and no heap allocation.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SRC_SOMEIPD_POSIX_PACKET_ROUTER_EVENT_ROUTING_INDEX_H_
+#define SRC_SOMEIPD_POSIX_PACKET_ROUTER_EVENT_ROUTING_INDEX_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "someip-posix-common/someip/someip_posix_types.h"
+#include "someipd-posix/packet_router/packet_router_interface.h"
+
+namespace someipd_posix {
+namespace packet_router {
+
+/**
+ * \brief Open-addressed hash table which resolves a SOME/IP event to its fan-out list.
+ *
+ * \details Routes are never removed from the index once created. A route whose last sink is removed stays in the table
+ * with an empty fan-out list, because it still carries the field flag required for caching field notifications.
+ * The number of routes is therefore bounded by the number of configured events per offered service instance.
+ */
+class EventRoutingIndex {
+ public:
+  /**
+   * \brief Packet sink container.
+   */
+  using PacketSinkContainer = std::vector<std::shared_ptr<PacketSink>>;
+
+  /**
+   * \brief Immutable fan-out list. A route update replaces the list instead of modifying it, so a caller holding the
+   * pointer can iterate it while sinks subscribe or unsubscribe.
+   */
+  using PacketSinkSnapshot = std::shared_ptr<const PacketSinkContainer>;
+
+  /**
+   * \brief Routing information of a single event.
+   */
+  struct Route {
+    someip_posix_common::someip::ServiceId service_id_;    ///< A SOME/IP service identifier
+    someip_posix_common::someip::InstanceId instance_id_;  ///< A SOME/IP service instance identifier
+    someip_posix_common::someip::EventId event_id_;        ///< A SOME/IP event identifier
+    bool is_field_;                                        ///< Event is the notifier of a field
+    PacketSinkSnapshot sinks_;                             ///< Deduplicated list of destination packet sinks
+  };
+
+  /**
+   * \brief Route container.
+   */
+  using RouteContainer = std::vector<Route>;
+
+  /**
+   * \brief Constructor of EventRoutingIndex.
+   */
+  EventRoutingIndex();
+  /**
+   * \brief EventRoutingIndex is not copy-constructable.
+   */
+  EventRoutingIndex(const EventRoutingIndex& other) = delete;
+  /**
+   * \brief EventRoutingIndex is not copy-assignable.
+   */
+  EventRoutingIndex& operator=(const EventRoutingIndex& other) = delete;
+  /**
+   * \brief Looks up the route of an event.
+   *
+   * \param service_id SOME/IP service id.
+   * \param instance_id SOME/IP instance id.
+   * \param event_id SOME/IP event id.
+   * \return The route if one exists, otherwise nullptr.
+   */
+  const Route* Find(someip_posix_common::someip::ServiceId service_id,
+                    someip_posix_common::someip::InstanceId instance_id,
+                    someip_posix_common::someip::EventId event_id) const;
+  /**
+   * \brief Looks up the route of an event and creates an empty one if it does not exist yet.
+   *
+   * \param service_id SOME/IP service id.
+   * \param instance_id SOME/IP instance id.
+   * \param event_id SOME/IP event id.
+   * \return The route of the given event. The reference is invalidated by the next call to FindOrInsert().
+   */
+  Route& FindOrInsert(someip_posix_common::someip::ServiceId service_id,
+                      someip_posix_common::someip::InstanceId instance_id,
+                      someip_posix_common::someip::EventId event_id);
+  /**
+   * \brief Returns all routes of the index.
+   *
+   * \return A container of routes.
+   */
+  const RouteContainer& GetRoutes() const { return routes_; }
+
+ private:
+  /**
+   * \brief A single slot of the open-addressed table.
+   */
+  struct Slot {
+    std::uint64_t key_;          ///< Packed (service, instance, event) key
+    std::uint32_t route_index_;  ///< Index into the route container or kEmptySlot
+  };
+  /**
+   * \brief Marks an unused slot.
+   */
+  static constexpr std::uint32_t kEmptySlot = 0xFFFFFFFFU;
+  /**
+   * \brief Initial number of slots. Must be a power of two.
+   */
+  static constexpr std::size_t kInitialCapacity = 64U;
+  /**
+   * \brief Packs the identifiers of an event into a single key.
+   *
+   * \param service_id SOME/IP service id.
+   * \param instance_id SOME/IP instance id.
+   * \param event_id SOME/IP event id.
+   * \return The packed key.
+   */
+  static std::uint64_t MakeKey(someip_posix_common::someip::ServiceId service_id,
+                               someip_posix_common::someip::InstanceId instance_id,
+                               someip_posix_common::someip::EventId event_id);
+  /**
+   * \brief Returns the index of the slot which holds the given key or the first free slot of its probe sequence.
+   *
+   * \param key A packed key.
+   * \return A slot index.
+   */
+  std::size_t Probe(std::uint64_t key) const;
+  /**
+   * \brief Doubles the number of slots and reinserts all routes.
+   */
+  void Grow();
+  /**
+   * \brief Open-addressed slot table. The size is always a power of two.
+   */
+  std::vector<Slot> slots_;
+  /**
+   * \brief Contiguous storage of all routes.
+   */
+  RouteContainer routes_;
+};
+
+}  // namespace packet_router
+}  // namespace someipd_posix
+
+#endif  // SRC_SOMEIPD_POSIX_PACKET_ROUTER_EVENT_ROUTING_INDEX_H_
@@ -31,13 +31,15 @@
 #include "ara/log/logging.hpp"
 
 #include "someip-posix-common/someip/message_builder.h"
-#include "someip-posix-common/someip/message_verification.h"
+#include "someipd-posix/logging/lazy_logging.h"
 
 namespace someipd_posix {
 namespace packet_router {
 
-PacketRouter::PacketRouter(const configuration::Configuration* config)
-    : config_(config), logger_(ara::log::CreateLogger("PacketRouter", "")) {}
+PacketRouter::PacketRouter(const configuration::Configuration* config, vac::timer::TimerManager* timer_manager)
+    : config_(config),
+      logger_(ara::log::CreateLogger("PacketRouter", "")),
+      response_routing_table_(timer_manager, config->GetResponseTimeout()) {}
 
 void PacketRouter::AddRequestRoute(someip_posix_common::someip::ServiceId service_id,
                                    someip_posix_common::someip::InstanceId instance_id,
@@ -66,6 +68,7 @@ void PacketRouter::AddEventRoute(someip_posix_common::someip::ServiceId service_
   } else {
     it_cont->second.push_back(to);
   }
+  UpdateEventRoutingIndex(service_id, instance_id, event_id);
 }
 
 void PacketRouter::DeleteEventRoute(someip_posix_common::someip::ServiceId service_id,
@@ -84,6 +87,7 @@ void PacketRouter::DeleteEventRoute(someip_posix_common::someip::ServiceId servi
       if (it_cont->second.empty()) {
         event_routing_table_.erase(it_cont);
       }
+      UpdateEventRoutingIndex(service_id, instance_id, event_id);
     }
   }
 }
@@ -100,6 +104,7 @@ void PacketRouter::AddEventgroupRoute(someip_posix_common::someip::ServiceId ser
   } else {
     it_cont->second.push_back(to);
   }
+  UpdateEventgroupRoutingIndex(service_id, instance_id, eventgroup_id);
 }
 
 void PacketRouter::DeleteEventgroupRoute(someip_posix_common::someip::ServiceId service_id,
@@ -118,102 +123,89 @@ void PacketRouter::DeleteEventgroupRoute(someip_posix_common::someip::ServiceId
       if (it_cont->second.empty()) {
         eventgroup_routing_table_.erase(it_cont);
       }
+      UpdateEventgroupRoutingIndex(service_id, instance_id, eventgroup_id);
     }
   }
 }
 
 void PacketRouter::Forward(someip_posix_common::someip::InstanceId instance_id, std::shared_ptr<PacketSink> from,
                            Packet packet) {
-  const someip_posix_common::someip::SomeIpMessageHeader& header = packet->GetHeader();
+  // The header was parsed and verified once when the message was received.
+  const someip_posix_common::someip::SomeIpHeaderView& header_view = packet->GetHeaderView();
+  const someip_posix_common::someip::SomeIpMessageHeader& header = header_view.GetHeader();
 
   switch (header.message_type_) {
     case someip_posix_common::someip::SomeIpMessageType::kNotification: {
-      const someip_posix_common::someip::SomeIpReturnCode verify_return_code{
-          someip_posix_common::someip::EventMessageVerification::DoInfrastructuralChecks(header)};
-
-      if (verify_return_code == someip_posix_common::someip::SomeIpReturnCode::kOk) {
-        ForwardEvent(instance_id, packet);
+      if (header_view.IsVerified()) {
+        ForwardEvent(instance_id, header, packet);
       } else {
-        logger_.LogError() << "Event message verification failed with return code " << verify_return_code << " - ("
-                           << std::hex << header.service_id_ << ", " << instance_id << "): "
-                           << "event ID: " << header.method_id_ << ", session ID: " << header.session_id_ << std::dec
-                           << ". No forwarding.";
+        SOMEIPD_LOG_ERROR(logger_) << "Event message verification failed with return code "
+                                   << header_view.GetVerificationResult() << " - (" << std::hex << header.service_id_
+                                   << ", " << instance_id << "): "
+                                   << "event ID: " << header.method_id_ << ", session ID: " << header.session_id_
+                                   << std::dec << ". No forwarding.";
       }
 
       break;
     }
     case someip_posix_common::someip::SomeIpMessageType::kResponse: {
-      const someip_posix_common::someip::SomeIpReturnCode verify_return_code{
-          someip_posix_common::someip::ResponseMessageVerification::DoInfrastructuralChecks(header)};
-
-      if (verify_return_code == someip_posix_common::someip::SomeIpReturnCode::kOk) {
-        ForwardResponse(instance_id, packet);
+      if (header_view.IsVerified()) {
+        ForwardResponse(instance_id, header, packet);
       } else {
-        logger_.LogError() << "Method response message verification failed with return code " << verify_return_code
-                           << " - (" << std::hex << header.service_id_ << ", " << instance_id << "): "
-                           << "method ID: " << header.method_id_ << ", session ID: " << header.session_id_ << std::dec
-                           << ". No forwarding.";
+        SOMEIPD_LOG_ERROR(logger_) << "Method response message verification failed with return code "
+                                   << header_view.GetVerificationResult() << " - (" << std::hex << header.service_id_
+                                   << ", " << instance_id << "): "
+                                   << "method ID: " << header.method_id_ << ", session ID: " << header.session_id_
+                                   << std::dec << ". No forwarding.";
       }
 
       break;
     }
     case someip_posix_common::someip::SomeIpMessageType::kRequest: {
-      const someip_posix_common::someip::SomeIpReturnCode verify_return_code{
-          someip_posix_common::someip::RequestMessageVerification::DoInfrastructuralChecks(header)};
-
-      if (verify_return_code == someip_posix_common::someip::SomeIpReturnCode::kOk) {
-        ForwardRequest(instance_id, from, packet);
+      if (header_view.IsVerified()) {
+        ForwardRequest(instance_id, from, header, packet);
       } else {
-        someip_posix_common::someip::SomeIpPacket error_res{
-            someip_posix_common::someip::SomeIpPacket{new someip_posix_common::someip::PacketBuffer{}}};
-        error_res =
-            someip_posix_common::someip::CreateSomeIpErrorHeader(verify_return_code, header, std::move(error_res));
-        // Use the packet for the error message - swap it with the original request.
-        packet.reset(new someip_posix_common::someip::SomeIpMessage(std::move(*error_res)));
-        from->Forward(instance_id, packet);
-        logger_.LogError() << "Method request message verification failed with return code " << verify_return_code
-                           << " - (" << std::hex << header.service_id_ << ", " << instance_id << "): "
-                           << "method ID: " << header.method_id_ << ", session ID: " << header.session_id_ << std::dec
-                           << ". Sending error response.";
+        SendErrorResponse(instance_id, *from, header, header_view.GetVerificationResult());
+        SOMEIPD_LOG_ERROR(logger_) << "Method request message verification failed with return code "
+                                   << header_view.GetVerificationResult() << " - (" << std::hex << header.service_id_
+                                   << ", " << instance_id << "): "
+                                   << "method ID: " << header.method_id_ << ", session ID: " << header.session_id_
+                                   << std::dec << ". Sending error response.";
       }
 
       break;
     }
     case someip_posix_common::someip::SomeIpMessageType::kRequestNoReturn: {
-      const someip_posix_common::someip::SomeIpReturnCode verify_return_code{
-          someip_posix_common::someip::RequestNoReturnMessageVerification::DoInfrastructuralChecks(header)};
-
-      if (verify_return_code == someip_posix_common::someip::SomeIpReturnCode::kOk) {
-        ForwardRequestNoReturn(instance_id, from, packet);
+      if (header_view.IsVerified()) {
+        ForwardRequestNoReturn(instance_id, header, packet);
       } else {
         // No error response message shall be sent for fire & forget methods. Print an error logging message only.
-        logger_.LogError() << "Fire & forget message verification failed with return code " << verify_return_code
-                           << " - (" << std::hex << header.service_id_ << ", " << instance_id << "): "
-                           << "method ID: " << header.method_id_ << ", session ID: " << header.session_id_ << std::dec
-                           << ". No forwarding.";
+        SOMEIPD_LOG_ERROR(logger_) << "Fire & forget message verification failed with return code "
+                                   << header_view.GetVerificationResult() << " - (" << std::hex << header.service_id_
+                                   << ", " << instance_id << "): "
+                                   << "method ID: " << header.method_id_ << ", session ID: " << header.session_id_
+                                   << std::dec << ". No forwarding.";
       }
 
       break;
     }
     case someip_posix_common::someip::SomeIpMessageType::kError: {
-      const someip_posix_common::someip::SomeIpReturnCode verify_return_code{
-          someip_posix_common::someip::ErrorMessageVerification::DoInfrastructuralChecks(header)};
-
-      if (verify_return_code == someip_posix_common::someip::SomeIpReturnCode::kOk) {
-        ForwardResponse(instance_id, packet);
+      if (header_view.IsVerified()) {
+        ForwardResponse(instance_id, header, packet);
       } else {
-        logger_.LogError() << "Generic error response message verification failed with return code "
-                           << verify_return_code << ". Will not route this error response to a binding instance."
-                           << " - (" << std::hex << header.service_id_ << ", " << instance_id << "): "
-                           << "method/event ID: " << header.method_id_ << ", session ID: " << header.session_id_
-                           << std::dec << ". No forwarding.";
+        SOMEIPD_LOG_ERROR(logger_) << "Generic error response message verification failed with return code "
+                                   << header_view.GetVerificationResult()
+                                   << ". Will not route this error response to a binding instance."
+                                   << " - (" << std::hex << header.service_id_ << ", " << instance_id << "): "
+                                   << "method/event ID: " << header.method_id_ << ", session ID: "
+                                   << header.session_id_ << std::dec << ". No forwarding.";
       }
 
       break;
     }
     default: {
-      logger_.LogError() << "unknown SOME/IP message type " << std::hex
-                         << static_cast<std::size_t>(header.message_type_) << std::dec;
+      SOMEIPD_LOG_ERROR(logger_) << "unknown SOME/IP message type " << std::hex
+                                 << static_cast<std::size_t>(header.message_type_) << std::dec;
       break;
     }
   }
@@ -279,10 +271,8 @@ void PacketRouter::CleanUpRequestRoutingTableEntries(const PacketSink* sink) {
 
 void PacketRouter::CleanUpResponseRoutingTableEntries(const PacketSink* sink) {
   logger_.LogDebug() << __func__ << ":" << __LINE__;
-  response_routing_table_.erase(
-      std::remove_if(response_routing_table_.begin(), response_routing_table_.end(),
-                     [sink](const ResponseRoute& other) { return other.from_.get() == sink; }),
-      response_routing_table_.end());
+  const std::size_t removed{response_routing_table_.RemoveSink(sink)};
+  logger_.LogDebug() << "removed " << removed << " outstanding requests";
 }
 
 void PacketRouter::CleanUpEventRoutingTableEntries(const PacketSink* sink) {
@@ -301,6 +291,7 @@ void PacketRouter::CleanUpEventRoutingTableEntries(const PacketSink* sink) {
       ++it_ev;
     }
   }
+  UpdateEventRoutingIndex(sink);
 }
 
 void PacketRouter::CleanUpEventgroupRoutingTableEntries(const PacketSink* sink) {
@@ -319,6 +310,7 @@ void PacketRouter::CleanUpEventgroupRoutingTableEntries(const PacketSink* sink)
       ++it_eg;
     }
   }
+  UpdateEventRoutingIndex(sink);
 }
 
 void PacketRouter::CleanUpFieldCacheTableEntries(const someip_posix_common::someip::ServiceId service_id,
@@ -327,17 +319,17 @@ void PacketRouter::CleanUpFieldCacheTableEntries(const someip_posix_common::some
   field_cache_table_.erase({service_id, instance_id});
 }
 
-void PacketRouter::ForwardRequest(someip_posix_common::someip::InstanceId instance_id, std::shared_ptr<PacketSink> from,
-                                  Packet packet) {
-  auto header = packet->GetHeader();
-
+void PacketRouter::ForwardRequest(someip_posix_common::someip::InstanceId instance_id,
+                                  const std::shared_ptr<PacketSink>& from,
+                                  const someip_posix_common::someip::SomeIpMessageHeader& header,
+                                  const Packet& packet) {
   const auto service_id = header.service_id_;
   const auto method_id = header.method_id_;
   const auto client_id = header.client_id_;
   const auto session_id = header.session_id_;
   auto it = request_routing_table_.find({service_id, instance_id});
   if (it != request_routing_table_.end()) {
-    response_routing_table_.push_back({service_id, instance_id, client_id, session_id, from});
+    response_routing_table_.Insert(service_id, instance_id, client_id, session_id, from);
     it->second->Forward(instance_id, packet);
   } else {
     // Assume that the service and method is known, but the application is not
@@ -357,84 +349,71 @@ void PacketRouter::ForwardRequest(someip_posix_common::someip::InstanceId instan
       return_code = someip_posix_common::someip::SomeIpReturnCode::kUnknownService;
     }
 
-    someip_posix_common::someip::SomeIpPacket error_res{
-        someip_posix_common::someip::SomeIpPacket{new someip_posix_common::someip::PacketBuffer{}}};
-    error_res = someip_posix_common::someip::CreateSomeIpErrorHeader(return_code, header, std::move(error_res));
-    // Use the packet for the error message - swap it with the original request.
-    packet.reset(new someip_posix_common::someip::SomeIpMessage(std::move(*error_res)));
-    from->Forward(instance_id, packet);
+    SendErrorResponse(instance_id, *from, header, return_code);
 
-    logger_.LogError() << "no route was found for request (" << std::hex << service_id << ", " << instance_id << ", "
-                       << method_id << ", " << client_id << ", " << session_id << ", "
-                       << static_cast<std::uint16_t>(return_code) << ")" << std::dec;
+    SOMEIPD_LOG_ERROR(logger_) << "no route was found for request (" << std::hex << service_id << ", " << instance_id
+                               << ", " << method_id << ", " << client_id << ", " << session_id << ", "
+                               << static_cast<std::uint16_t>(return_code) << ")" << std::dec;
   }
 }
 
 void PacketRouter::ForwardRequestNoReturn(someip_posix_common::someip::InstanceId instance_id,
-                                          std::shared_ptr<PacketSink> from, Packet packet) {
-  (void)from;
-  auto header = packet->GetHeader();
+                                          const someip_posix_common::someip::SomeIpMessageHeader& header,
+                                          const Packet& packet) {
   const auto service_id = header.service_id_;
-  const auto method_id = header.method_id_;
-  const auto client_id = header.client_id_;
-  const auto session_id = header.session_id_;
   auto it = request_routing_table_.find({service_id, instance_id});
   if (it != request_routing_table_.end()) {
     it->second->Forward(instance_id, packet);
   } else {
-    logger_.LogError() << "no route was found for request (" << std::hex << service_id << ", " << instance_id << ", "
-                       << method_id << ", " << client_id << ", " << session_id << ")" << std::dec;
+    SOMEIPD_LOG_ERROR(logger_) << "no route was found for request (" << std::hex << service_id << ", " << instance_id
+                               << ", " << header.method_id_ << ", " << header.client_id_ << ", "
+                               << header.session_id_ << ")" << std::dec;
   }
 }
 
-void PacketRouter::ForwardResponse(someip_posix_common::someip::InstanceId instance_id, Packet packet) {
-  auto header = packet->GetHeader();
+void PacketRouter::ForwardResponse(someip_posix_common::someip::InstanceId instance_id,
+                                   const someip_posix_common::someip::SomeIpMessageHeader& header,
+                                   const Packet& packet) {
   const auto service_id = header.service_id_;
-  const auto method_id = header.method_id_;
   const auto client_id = header.client_id_;
   const auto session_id = header.session_id_;
-  auto it = std::find_if(response_routing_table_.begin(), response_routing_table_.end(),
-                         [service_id, instance_id, client_id, session_id](const ResponseRoute& rr) {
-                           return ((rr.service_id_ == service_id) && (rr.instance_id_ == instance_id) &&
-                                   (rr.client_id_ == client_id) && (rr.session_id_ == session_id));
-                         });
-  if (it != response_routing_table_.end()) {
-    it->from_->Forward(instance_id, packet);
-    response_routing_table_.erase(it);
+  const std::shared_ptr<PacketSink> from{
+      response_routing_table_.Remove(service_id, instance_id, client_id, session_id)};
+  if (from) {
+    from->Forward(instance_id, packet);
   } else {
-    logger_.LogDebug() << "response (" << std::hex << service_id << ", " << instance_id << ", " << method_id << ", "
-                       << client_id << ", " << session_id << ") could not be routed" << std::dec;
+    SOMEIPD_LOG_DEBUG(logger_) << "response (" << std::hex << service_id << ", " << instance_id << ", "
+                               << header.method_id_ << ", " << client_id << ", " << session_id
+                               << ") could not be routed" << std::dec;
   }
 }
 
-void PacketRouter::ForwardEvent(someip_posix_common::someip::InstanceId instance_id, Packet packet) {
-  auto header = packet->GetHeader();
+void PacketRouter::ForwardEvent(someip_posix_common::someip::InstanceId instance_id,
+                                const someip_posix_common::someip::SomeIpMessageHeader& header, const Packet& packet) {
   const auto service_id = header.service_id_;
   const auto method_id = header.method_id_;
-  logger_.LogDebug() << "event (" << std::hex << service_id << ", " << instance_id << ", " << method_id << ")"
-                     << std::dec;
-  /* Forward to single event subscribers */
-  logger_.LogDebug() << "routing to event subscribers";
-  auto it_cont_e = event_routing_table_.find({service_id, instance_id, method_id});
-  if (it_cont_e != event_routing_table_.end()) {
-    std::for_each(it_cont_e->second.begin(), it_cont_e->second.end(),
-                  [instance_id, packet](std::shared_ptr<PacketSink> to) { to->Forward(instance_id, packet); });
+  SOMEIPD_LOG_DEBUG(logger_) << "event (" << std::hex << service_id << ", " << instance_id << ", " << method_id
+                             << ")" << std::dec;
+  const EventRoutingIndex::Route* route{event_routing_index_.Find(service_id, instance_id, method_id)};
+  if (route == nullptr) {
+    // First notification of an event without any subscriber so far. Resolve its field flag once.
+    assert(config_->GetEvent(service_id, method_id) && "No such event found");
+    route = &UpdateEventRoutingIndex(service_id, instance_id, method_id);
   }
-  /* Forward to eventgroup subscribers */
-  logger_.LogDebug() << "routing to eventgroup subscribers";
-  for (auto eventgroup_id : config_->EventToEventgroups(service_id, method_id)) {
-    logger_.LogDebug() << std::hex << "event " << method_id << " maps to eventgroup " << eventgroup_id << std::dec;
-    auto it_cont_eg = eventgroup_routing_table_.find({service_id, instance_id, eventgroup_id});
-    if (it_cont_eg != eventgroup_routing_table_.end()) {
-      std::for_each(it_cont_eg->second.begin(), it_cont_eg->second.end(),
-                    [instance_id, packet](std::shared_ptr<PacketSink> to) { to->Forward(instance_id, packet); });
-    }
+  const bool is_field{route->is_field_};
+  // Forward() may subscribe or unsubscribe, which replaces the fan-out list and may move the route itself. Only the
+  // snapshot taken here is used afterwards, it also keeps its sinks alive.
+  const EventRoutingIndex::PacketSinkSnapshot sinks{route->sinks_};
+  route = nullptr;
+
+  /* Forward to event and eventgroup subscribers */
+  SOMEIPD_LOG_DEBUG(logger_) << "routing to " << sinks->size() << " subscribers";
+  for (const std::shared_ptr<PacketSink>& to : *sinks) {
+    to->Forward(instance_id, packet);
   }
 
   // Field Notification ? Cache it
-  const auto event = config_->GetEvent(service_id, method_id);
-  assert(event && "No such event found");
-  if (event && event->is_field_) {
+  if (is_field) {
     // Create Cache if not found
     auto result =
         field_cache_table_.insert({{service_id, instance_id}, PacketCache<someip_posix_common::someip::EventId>{}});
@@ -445,6 +424,71 @@ void PacketRouter::ForwardEvent(someip_posix_common::someip::InstanceId instance
   }
 }
 
+void PacketRouter::SendErrorResponse(someip_posix_common::someip::InstanceId instance_id, PacketSink& to,
+                                     const someip_posix_common::someip::SomeIpMessageHeader& header,
+                                     someip_posix_common::someip::SomeIpReturnCode return_code) {
+  someip_posix_common::someip::SomeIpPacket error_res{
+      someip_posix_common::someip::PacketBufferPool::GetInstance().AcquirePtr(0U)};
+  error_res = someip_posix_common::someip::CreateSomeIpErrorHeader(return_code, header, std::move(error_res));
+  to.Forward(instance_id, someip_posix_common::someip::SomeIpMessage::CreateShared(std::move(*error_res)));
+}
+
+const EventRoutingIndex::Route& PacketRouter::UpdateEventRoutingIndex(
+    someip_posix_common::someip::ServiceId service_id, someip_posix_common::someip::InstanceId instance_id,
+    someip_posix_common::someip::EventId event_id) {
+  EventRoutingIndex::Route& route = event_routing_index_.FindOrInsert(service_id, instance_id, event_id);
+  const auto event = config_->GetEvent(service_id, event_id);
+  route.is_field_ = (event != nullptr) && event->is_field_;
+  EventRoutingIndex::PacketSinkContainer route_sinks{};
+
+  auto merge_sinks = [&route_sinks](const PacketSinkContainer& sinks) {
+    for (const auto& sink : sinks) {
+      if (std::find(route_sinks.cbegin(), route_sinks.cend(), sink) == route_sinks.cend()) {
+        route_sinks.push_back(sink);
+      }
+    }
+  };
+
+  auto it_cont_e = event_routing_table_.find({service_id, instance_id, event_id});
+  if (it_cont_e != event_routing_table_.end()) {
+    merge_sinks(it_cont_e->second);
+  }
+  for (auto eventgroup_id : config_->EventToEventgroups(service_id, event_id)) {
+    auto it_cont_eg = eventgroup_routing_table_.find({service_id, instance_id, eventgroup_id});
+    if (it_cont_eg != eventgroup_routing_table_.end()) {
+      merge_sinks(it_cont_eg->second);
+    }
+  }
+  // Replace instead of modifying the list, an event may currently be forwarded to the old one.
+  route.sinks_ = std::make_shared<const EventRoutingIndex::PacketSinkContainer>(std::move(route_sinks));
+  return route;
+}
+
+void PacketRouter::UpdateEventgroupRoutingIndex(someip_posix_common::someip::ServiceId service_id,
+                                                someip_posix_common::someip::InstanceId instance_id,
+                                                someip_posix_common::someip::EventgroupId eventgroup_id) {
+  const auto eventgroup = config_->GetEventgroup(service_id, eventgroup_id);
+  if (eventgroup) {
+    for (auto event_id : eventgroup->events_) {
+      UpdateEventRoutingIndex(service_id, instance_id, event_id);
+    }
+  }
+}
+
+void PacketRouter::UpdateEventRoutingIndex(const PacketSink* sink) {
+  std::vector<EventKey> affected_events{};
+  for (const auto& route : event_routing_index_.GetRoutes()) {
+    const auto it_sink = std::find_if(route.sinks_->cbegin(), route.sinks_->cend(),
+                                      [sink](const std::shared_ptr<PacketSink>& other) { return other.get() == sink; });
+    if (it_sink != route.sinks_->cend()) {
+      affected_events.push_back({route.service_id_, route.instance_id_, route.event_id_});
+    }
+  }
+  for (const auto& key : affected_events) {
+    UpdateEventRoutingIndex(key.service_id, key.instance_id, key.event_id);
+  }
+}
+
 const PacketRouter::FieldCacheTable& PacketRouter::GetFieldCacheTable() { return field_cache_table_; }
 
 }  // namespace packet_router
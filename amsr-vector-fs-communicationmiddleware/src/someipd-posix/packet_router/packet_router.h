@@ -35,9 +35,12 @@
 #include "osabstraction/io/reactor_interface.h"
 #include "someip-posix-common/someip/message.h"
 #include "someipd-posix/configuration/configuration.h"
+#include "someipd-posix/packet_router/event_routing_index.h"
 #include "someipd-posix/packet_router/packet_cache.h"
 #include "someipd-posix/packet_router/packet_router_interface.h"
+#include "someipd-posix/packet_router/response_routing_table.h"
 #include "vac/language/cpp14_backport.h"
+#include "vac/timer/timer_manager.h"
 
 namespace someipd_posix {
 namespace packet_router {
@@ -61,17 +64,6 @@ struct RequestSinkKey {
   }
 };
 
-/**
- * \brief Represents an information for routing a SOME/IP method response message back to the client.
- */
-struct ResponseRoute {
-  someip_posix_common::someip::ServiceId service_id_;    ///< A SOME/IP service identifier
-  someip_posix_common::someip::InstanceId instance_id_;  ///< A SOME/IP service instance identifier
-  someip_posix_common::someip::ClientId client_id_;      ///< A SOME/IP client identifier
-  someip_posix_common::someip::SessionId session_id_;    ///< A SOME/IP session identifier
-  std::shared_ptr<PacketSink> from_;                     ///< Packet sink that the request came from
-};
-
 /**
  * \brief Key for looking up the destination of a SOME/IP event.
  */
@@ -142,8 +134,9 @@ class PacketRouter : public PacketRouterInterface {
    * \brief Constructor of PacketRouter.
    *
    * \param config A configuration.
+   * \param timer_manager A timer manager used for the response timeout.
    */
-  explicit PacketRouter(const configuration::Configuration* config);
+  PacketRouter(const configuration::Configuration* config, vac::timer::TimerManager* timer_manager);
   /**
    * \brief Destructor of PacketRouter.
    */
@@ -288,33 +281,49 @@ class PacketRouter : public PacketRouterInterface {
    *
    * \param instance_id SOME/IP instance id.
    * \param from A packet sink from which the passed SOME/IP request message comes.
+   * \param header The verified SOME/IP header of the message.
    * \param packet A SOME/IP request message.
    */
-  void ForwardRequest(someip_posix_common::someip::InstanceId instance_id, std::shared_ptr<PacketSink> from,
-                      Packet packet);
+  void ForwardRequest(someip_posix_common::someip::InstanceId instance_id, const std::shared_ptr<PacketSink>& from,
+                      const someip_posix_common::someip::SomeIpMessageHeader& header, const Packet& packet);
   /**
    * \brief Forwards a SOME/IP fire & forget request message.
    *
    * \param instance_id SOME/IP instance id.
-   * \param from A packet sink from which the passed SOME/IP request message comes.
+   * \param header The verified SOME/IP header of the message.
    * \param packet A SOME/IP request message.
    */
-  void ForwardRequestNoReturn(someip_posix_common::someip::InstanceId instance_id, std::shared_ptr<PacketSink> from,
-                              Packet packet);
+  void ForwardRequestNoReturn(someip_posix_common::someip::InstanceId instance_id,
+                              const someip_posix_common::someip::SomeIpMessageHeader& header, const Packet& packet);
   /**
    * \brief Forwards a SOME/IP response message.
    *
    * \param instance_id SOME/IP instance id.
+   * \param header The verified SOME/IP header of the message.
    * \param packet A SOME/IP response message.
    */
-  void ForwardResponse(someip_posix_common::someip::InstanceId instance_id, Packet packet);
+  void ForwardResponse(someip_posix_common::someip::InstanceId instance_id,
+                       const someip_posix_common::someip::SomeIpMessageHeader& header, const Packet& packet);
   /**
    * \brief Forwards a SOME/IP event message.
    *
    * \param instance_id SOME/IP instance id.
+   * \param header The verified SOME/IP header of the message.
    * \param packet A SOME/IP event message.
    */
-  void ForwardEvent(someip_posix_common::someip::InstanceId instance_id, Packet packet);
+  void ForwardEvent(someip_posix_common::someip::InstanceId instance_id,
+                    const someip_posix_common::someip::SomeIpMessageHeader& header, const Packet& packet);
+  /**
+   * \brief Sends a SOME/IP error response for a request.
+   *
+   * \param instance_id SOME/IP instance id.
+   * \param to The packet sink the request came from.
+   * \param header The SOME/IP header of the request.
+   * \param return_code The return code of the error response.
+   */
+  void SendErrorResponse(someip_posix_common::someip::InstanceId instance_id, PacketSink& to,
+                         const someip_posix_common::someip::SomeIpMessageHeader& header,
+                         someip_posix_common::someip::SomeIpReturnCode return_code);
   /**
    * \brief Gets the field cache table.
    *
@@ -339,10 +348,6 @@ class PacketRouter : public PacketRouterInterface {
    * \brief Request routing table.
    */
   using RequestRoutingTable = std::map<RequestSinkKey, std::shared_ptr<PacketSink>>;
-  /**
-   * \brief Response routing table.
-   */
-  using ResponseRoutingTable = std::vector<ResponseRoute>;
   /**
    * \brief Event routing table.
    */
@@ -351,6 +356,33 @@ class PacketRouter : public PacketRouterInterface {
    * \brief Eventgroup routing table.
    */
   using EventgroupRoutingTable = std::map<EventgroupKey, PacketSinkContainer>;
+  /**
+   * \brief Recomputes the precompiled route of a single event from the event and eventgroup routing tables.
+   *
+   * \param service_id SOME/IP service id.
+   * \param instance_id SOME/IP instance id.
+   * \param event_id SOME/IP event id.
+   * \return The updated route.
+   */
+  const EventRoutingIndex::Route& UpdateEventRoutingIndex(someip_posix_common::someip::ServiceId service_id,
+                                                          someip_posix_common::someip::InstanceId instance_id,
+                                                          someip_posix_common::someip::EventId event_id);
+  /**
+   * \brief Recomputes the precompiled routes of all events which are mapped to the given eventgroup.
+   *
+   * \param service_id SOME/IP service id.
+   * \param instance_id SOME/IP instance id.
+   * \param eventgroup_id SOME/IP eventgroup id.
+   */
+  void UpdateEventgroupRoutingIndex(someip_posix_common::someip::ServiceId service_id,
+                                    someip_posix_common::someip::InstanceId instance_id,
+                                    someip_posix_common::someip::EventgroupId eventgroup_id);
+  /**
+   * \brief Recomputes all precompiled routes which reference the passed packet sink.
+   *
+   * \param sink A packet sink.
+   */
+  void UpdateEventRoutingIndex(const PacketSink* sink);
   /**
    * \brief A configuration.
    */
@@ -365,6 +397,7 @@ class PacketRouter : public PacketRouterInterface {
   RequestRoutingTable request_routing_table_;
   /**
    * \brief Response routing table.
+   * Correlates outstanding method requests with the packet sinks they came from.
    */
   ResponseRoutingTable response_routing_table_;
   /**
@@ -375,6 +408,12 @@ class PacketRouter : public PacketRouterInterface {
    * \brief Eventgroup routing table.
    */
   EventgroupRoutingTable eventgroup_routing_table_;
+  /**
+   * \brief Precompiled event routing index.
+   * Merges the event and eventgroup routing tables into one fan-out list per event. Kept up to date by every
+   * modification of the event and eventgroup routing tables.
+   */
+  EventRoutingIndex event_routing_index_;
   /**
    * \brief Field value cache table.
    * Stores the values of the event-mapped-fields, to be sent to new field subscribers.
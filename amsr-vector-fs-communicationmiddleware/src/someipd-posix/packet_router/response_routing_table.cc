@@ -0,0 +1,195 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  response_routing_table.cc
+ *        \brief  Correlation table for outstanding SOME/IP method requests
+ *
+ *      \details  -
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "someipd-posix/packet_router/response_routing_table.h"
+
+#include <cassert>
+#include <ios>
+#include <tuple>
+#include <utility>
+
+namespace someipd_posix {
+namespace packet_router {
+
+constexpr std::size_t ResponseRoutingTable::kInitialBucketCount;
+
+ResponseRoutingTable::ResponseRoutingTable(vac::timer::TimerManager* timer_manager, Clock::duration response_timeout)
+    : vac::timer::Timer(timer_manager),
+      response_timeout_(response_timeout),
+      timer_scheduled_(false),
+      size_(0U),
+      slots_(),
+      free_list_(),
+      buckets_(kInitialBucketCount, nullptr),
+      sink_lists_(),
+      age_list_(),
+      logger_(ara::log::CreateLogger("PacketRouter", "")) {}
+
+void ResponseRoutingTable::Insert(someip_posix_common::someip::ServiceId service_id,
+                                  someip_posix_common::someip::InstanceId instance_id,
+                                  someip_posix_common::someip::ClientId client_id,
+                                  someip_posix_common::someip::SessionId session_id, std::shared_ptr<PacketSink> from) {
+  // A client reusing a session identifier supersedes its previous request.
+  static_cast<void>(Remove(service_id, instance_id, client_id, session_id));
+
+  if (free_list_.empty()) {
+    slots_.emplace_back();
+    PendingRequest& slot = slots_.back();
+    slot.age_link_.owner_ = &slot;
+    free_list_.push_back(slot);
+  }
+  if (size_ >= buckets_.size()) {
+    Grow();
+  }
+
+  PendingRequest& request = *free_list_.pop_front()->GetSelf();
+  request.key_ = MakeKey(service_id, instance_id, client_id, session_id);
+  request.created_ = Clock::now();
+  PendingRequest*& bucket = Bucket(request.key_);
+  request.bucket_next_ = bucket;
+  bucket = &request;
+
+  auto it_list = sink_lists_.find(from.get());
+  if (it_list == sink_lists_.end()) {
+    it_list = sink_lists_.emplace(std::piecewise_construct, std::forward_as_tuple(from.get()), std::forward_as_tuple())
+                  .first;
+  }
+  it_list->second.push_back(request);
+  request.from_ = std::move(from);
+  age_list_.push_back(request.age_link_);
+  ++size_;
+
+  if (!timer_scheduled_) {
+    ScheduleTimeout();
+  }
+}
+
+std::shared_ptr<PacketSink> ResponseRoutingTable::Remove(someip_posix_common::someip::ServiceId service_id,
+                                                         someip_posix_common::someip::InstanceId instance_id,
+                                                         someip_posix_common::someip::ClientId client_id,
+                                                         someip_posix_common::someip::SessionId session_id) {
+  std::shared_ptr<PacketSink> from{nullptr};
+  const std::uint64_t key{MakeKey(service_id, instance_id, client_id, session_id)};
+  for (PendingRequest* request = Bucket(key); request != nullptr; request = request->bucket_next_) {
+    if (request->key_ == key) {
+      from = request->from_;
+      Release(*request);
+      break;
+    }
+  }
+  return from;
+}
+
+std::size_t ResponseRoutingTable::RemoveSink(const PacketSink* sink) {
+  std::size_t removed{0U};
+  auto it_list = sink_lists_.find(sink);
+  if (it_list != sink_lists_.end()) {
+    PendingRequestList& requests = it_list->second;
+    while (!requests.empty()) {
+      Release(*requests.front().GetSelf());
+      ++removed;
+    }
+    sink_lists_.erase(it_list);
+  }
+  return removed;
+}
+
+std::size_t ResponseRoutingTable::RemoveExpired(Clock::time_point deadline) {
+  std::size_t removed{0U};
+  while (!age_list_.empty()) {
+    PendingRequest& oldest = *age_list_.front().GetSelf()->owner_;
+    if (oldest.created_ >= deadline) {
+      break;
+    }
+    logger_.LogDebug() << "dropping unanswered request with key " << std::hex << oldest.key_ << std::dec;
+    Release(oldest);
+    ++removed;
+  }
+  return removed;
+}
+
+bool ResponseRoutingTable::HandleTimer() {
+  timer_scheduled_ = false;
+  const std::size_t removed{RemoveExpired(Clock::now() - response_timeout_)};
+  if (removed > 0U) {
+    logger_.LogWarn() << "response timeout: dropped " << removed << " outstanding request(s)";
+  }
+  ScheduleTimeout();
+  return false;
+}
+
+void ResponseRoutingTable::ScheduleTimeout() {
+  if ((response_timeout_ > Clock::duration::zero()) && !age_list_.empty()) {
+    const PendingRequest& oldest = *age_list_.front().GetSelf()->owner_;
+    SetOneShot(oldest.created_ + response_timeout_);
+    Start();
+    timer_scheduled_ = true;
+  }
+}
+
+std::uint64_t ResponseRoutingTable::MakeKey(someip_posix_common::someip::ServiceId service_id,
+                                            someip_posix_common::someip::InstanceId instance_id,
+                                            someip_posix_common::someip::ClientId client_id,
+                                            someip_posix_common::someip::SessionId session_id) {
+  return (static_cast<std::uint64_t>(service_id) << 48U) | (static_cast<std::uint64_t>(instance_id) << 32U) |
+         (static_cast<std::uint64_t>(client_id) << 16U) | static_cast<std::uint64_t>(session_id);
+}
+
+ResponseRoutingTable::PendingRequest*& ResponseRoutingTable::Bucket(std::uint64_t key) {
+  // Fibonacci hashing spreads the consecutive session identifiers over the whole table.
+  const std::size_t index{static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32U) & (buckets_.size() - 1U)};
+  return buckets_[index];
+}
+
+void ResponseRoutingTable::Release(PendingRequest& request) {
+  PendingRequest** link = &Bucket(request.key_);
+  while (*link != &request) {
+    assert(*link != nullptr);
+    link = &(*link)->bucket_next_;
+  }
+  *link = request.bucket_next_;
+  request.bucket_next_ = nullptr;
+
+  request.age_link_.EraseFromList();
+  request.EraseFromList();
+  request.from_.reset();
+  free_list_.push_back(request);
+  --size_;
+}
+
+void ResponseRoutingTable::Grow() {
+  std::vector<PendingRequest*> old_buckets(buckets_.size() * 2U, nullptr);
+  buckets_.swap(old_buckets);
+  for (PendingRequest* head : old_buckets) {
+    while (head != nullptr) {
+      PendingRequest* next = head->bucket_next_;
+      PendingRequest*& bucket = Bucket(head->key_);
+      head->bucket_next_ = bucket;
+      bucket = head;
+      head = next;
+    }
+  }
+}
+
+}  // namespace packet_router
+}  // namespace someipd_posix
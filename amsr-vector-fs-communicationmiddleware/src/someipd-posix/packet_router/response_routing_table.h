@@ -0,0 +1,242 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  response_routing_table.h
+ *        \brief  Correlation table for outstanding SOME/IP method requests
+ *
+ *      \details  The response routing table remembers the packet sink a SOME/IP method request came from, so that the
+ *                corresponding response can be routed back to the caller. Lookup, insertion and removal are O(1).
+ *                All entries of a packet sink are chained in an intrusive list, so that a disconnected sink is
+ *                cleaned up in O(k) for k outstanding requests. Entries for lost responses are removed after a
+ *                configurable timeout.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SRC_SOMEIPD_POSIX_PACKET_ROUTER_RESPONSE_ROUTING_TABLE_H_
+#define SRC_SOMEIPD_POSIX_PACKET_ROUTER_RESPONSE_ROUTING_TABLE_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "ara/log/logging.hpp"
+#include "someip-posix-common/someip/someip_posix_types.h"
+#include "someipd-posix/packet_router/packet_router_interface.h"
+#include "vac/container/intrusive_list.h"
+#include "vac/timer/timer.h"
+
+namespace someipd_posix {
+namespace packet_router {
+
+/**
+ * \brief Hashed table of outstanding SOME/IP method requests.
+ *
+ * \details The table is a timer itself: if a response timeout is configured, the timer fires when the oldest entry
+ * expires and removes all expired entries.
+ */
+class ResponseRoutingTable : public vac::timer::Timer {
+ public:
+  /**
+   * \brief Clock used for request timestamps.
+   */
+  using Clock = vac::timer::Timer::Clock;
+
+  /**
+   * \brief Constructor of ResponseRoutingTable.
+   *
+   * \param timer_manager A timer manager.
+   * \param response_timeout Time after which an unanswered request is dropped. Zero disables the timeout.
+   */
+  ResponseRoutingTable(vac::timer::TimerManager* timer_manager, Clock::duration response_timeout);
+  /**
+   * \brief Destructor of ResponseRoutingTable.
+   */
+  virtual ~ResponseRoutingTable() = default;
+  /**
+   * \brief ResponseRoutingTable is not copy-constructable.
+   */
+  ResponseRoutingTable(const ResponseRoutingTable& other) = delete;
+  /**
+   * \brief ResponseRoutingTable is not copy-assignable.
+   */
+  ResponseRoutingTable& operator=(const ResponseRoutingTable& other) = delete;
+  /**
+   * \brief Remembers the packet sink an outstanding request came from.
+   *
+   * An existing entry with the same key is replaced.
+   *
+   * \param service_id SOME/IP service id.
+   * \param instance_id SOME/IP instance id.
+   * \param client_id SOME/IP client id.
+   * \param session_id SOME/IP session id.
+   * \param from Packet sink the request came from.
+   */
+  void Insert(someip_posix_common::someip::ServiceId service_id, someip_posix_common::someip::InstanceId instance_id,
+              someip_posix_common::someip::ClientId client_id, someip_posix_common::someip::SessionId session_id,
+              std::shared_ptr<PacketSink> from);
+  /**
+   * \brief Removes an outstanding request.
+   *
+   * \param service_id SOME/IP service id.
+   * \param instance_id SOME/IP instance id.
+   * \param client_id SOME/IP client id.
+   * \param session_id SOME/IP session id.
+   * \return The packet sink the request came from or nullptr if there is no such request.
+   */
+  std::shared_ptr<PacketSink> Remove(someip_posix_common::someip::ServiceId service_id,
+                                     someip_posix_common::someip::InstanceId instance_id,
+                                     someip_posix_common::someip::ClientId client_id,
+                                     someip_posix_common::someip::SessionId session_id);
+  /**
+   * \brief Removes all outstanding requests of a packet sink.
+   *
+   * \param sink A packet sink.
+   * \return The number of removed requests.
+   */
+  std::size_t RemoveSink(const PacketSink* sink);
+  /**
+   * \brief Removes all outstanding requests which were inserted before the given point in time.
+   *
+   * \param deadline Requests inserted before this point in time are removed.
+   * \return The number of removed requests.
+   */
+  std::size_t RemoveExpired(Clock::time_point deadline);
+  /**
+   * \brief Returns the number of outstanding requests.
+   *
+   * \return The number of outstanding requests.
+   */
+  std::size_t Size() const { return size_; }
+
+ private:
+  struct PendingRequest;
+
+  /**
+   * \brief Node of the list which orders all outstanding requests by their insertion time.
+   */
+  struct AgeLink : public vac::container::IntrusiveListNode<AgeLink> {
+    PendingRequest* owner_{nullptr};  ///< Request this link belongs to
+  };
+
+  /**
+   * \brief A slot of the table.
+   *
+   * The list node of the base class links the slot either into the list of its packet sink (while in use) or into the
+   * free list (while unused).
+   */
+  struct PendingRequest : public vac::container::IntrusiveListNode<PendingRequest> {
+    std::uint64_t key_{0U};                 ///< Packed (service, instance, client, session) key
+    std::shared_ptr<PacketSink> from_;      ///< Packet sink that the request came from
+    Clock::time_point created_;             ///< Time at which the request was routed
+    PendingRequest* bucket_next_{nullptr};  ///< Next slot of the same hash bucket
+    AgeLink age_link_;                      ///< Link into the age-ordered list
+  };
+
+  /**
+   * \brief List of slots.
+   */
+  using PendingRequestList = vac::container::IntrusiveList<PendingRequest>;
+
+  /**
+   * \brief Initial number of hash buckets. Must be a power of two.
+   */
+  static constexpr std::size_t kInitialBucketCount = 64U;
+
+  /**
+   * \brief Called upon timer expiration and removes all expired requests.
+   *
+   * \return false, the timer is rescheduled explicitly for the next oldest request.
+   */
+  bool HandleTimer() override;
+  /**
+   * \brief Schedules the timer for the expiry of the oldest outstanding request.
+   */
+  void ScheduleTimeout();
+  /**
+   * \brief Packs the identifiers of a request into a single key.
+   *
+   * \param service_id SOME/IP service id.
+   * \param instance_id SOME/IP instance id.
+   * \param client_id SOME/IP client id.
+   * \param session_id SOME/IP session id.
+   * \return The packed key.
+   */
+  static std::uint64_t MakeKey(someip_posix_common::someip::ServiceId service_id,
+                               someip_posix_common::someip::InstanceId instance_id,
+                               someip_posix_common::someip::ClientId client_id,
+                               someip_posix_common::someip::SessionId session_id);
+  /**
+   * \brief Returns the hash bucket of a key.
+   *
+   * \param key A packed key.
+   * \return Reference to the head of the bucket chain.
+   */
+  PendingRequest*& Bucket(std::uint64_t key);
+  /**
+   * \brief Unlinks a slot from all lists and returns it to the free list.
+   *
+   * \param request A slot in use.
+   */
+  void Release(PendingRequest& request);
+  /**
+   * \brief Doubles the number of hash buckets.
+   */
+  void Grow();
+  /**
+   * \brief Response timeout. Zero disables the timeout.
+   */
+  const Clock::duration response_timeout_;
+  /**
+   * \brief Whether the timer is currently scheduled.
+   */
+  bool timer_scheduled_;
+  /**
+   * \brief Number of slots in use.
+   */
+  std::size_t size_;
+  /**
+   * \brief Storage of all slots. A deque keeps the slot addresses stable while growing.
+   */
+  std::deque<PendingRequest> slots_;
+  /**
+   * \brief Unused slots.
+   */
+  PendingRequestList free_list_;
+  /**
+   * \brief Hash buckets. The size is always a power of two.
+   */
+  std::vector<PendingRequest*> buckets_;
+  /**
+   * \brief Outstanding requests per packet sink.
+   */
+  std::map<const PacketSink*, PendingRequestList> sink_lists_;
+  /**
+   * \brief All outstanding requests ordered by insertion time.
+   */
+  vac::container::IntrusiveList<AgeLink> age_list_;
+  /**
+   * \brief Our logger.
+   */
+  ara::log::Logger& logger_;
+};
+
+}  // namespace packet_router
+}  // namespace someipd_posix
+
+#endif  // SRC_SOMEIPD_POSIX_PACKET_ROUTER_RESPONSE_ROUTING_TABLE_H_
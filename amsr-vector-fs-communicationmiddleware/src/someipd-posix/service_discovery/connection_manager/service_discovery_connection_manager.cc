@@ -98,11 +98,19 @@ ServiceDiscoveryUdpReceiverPtr ServiceDiscoveryConnectionManager::GetUdpMulticas
 
 void ServiceDiscoveryConnectionManager::CreateEndpoints() {
   using config = configuration::Configuration;
+  ServiceDiscoveryTcpEndpoint::FieldContainer fields;
+  for (const auto& s : config_->GetServices()) {
+    for (const auto& e : s.events_) {
+      if (e.is_field_) {
+        fields.insert(ServiceDiscoveryTcpEndpoint::MakeFieldKey(s.id_, e.id_));
+      }
+    }
+  }
   for (const auto& ne : config_->GetNetworkEndpoints()) {
     for (const auto& p : ne.ports_) {
       if (p.proto_ == config::Protocol::kTCP) {
-        tcp_endpoints_.emplace_back(
-            std::make_shared<ServiceDiscoveryTcpEndpoint>(reactor_, packet_router_, ne.address_, p.port_, p.options_));
+        tcp_endpoints_.emplace_back(std::make_shared<ServiceDiscoveryTcpEndpoint>(reactor_, packet_router_, ne.address_,
+                                                                                  p.port_, p.options_, fields));
       } else {
         someip_posix_common::someip::TransmissionTriggerBufferSize tx_trigger_buffer_size{0U};
         if (p.tx_trigger_.is_valid_) {
@@ -26,6 +26,7 @@
 #include <limits>
 
 #include "osabstraction/io/network/address/ip_socket_address.h"
+#include "someipd-posix/logging/lazy_logging.h"
 #include "someipd-posix/service_discovery/connection_manager/service_discovery_tcp_connection.h"
 #include "someipd-posix/service_discovery/connection_manager/service_discovery_tcp_endpoint.h"
 #include "vac/language/cpp14_backport.h"
@@ -46,7 +47,10 @@ ServiceDiscoveryTcpConnection::ServiceDiscoveryTcpConnection(ServiceDiscoveryTcp
       users_(0),
       logger_(ara::log::CreateLogger("ServiceDiscoveryTcpConnection", "")),
       inside_notify_(false),
-      socket_options_(options) {
+      socket_options_(options),
+      send_queue_(options.send_queue_),
+      is_write_pending_(false),
+      inside_connect_(false) {
   Connect();
 }
 
@@ -61,7 +65,10 @@ ServiceDiscoveryTcpConnection::ServiceDiscoveryTcpConnection(ServiceDiscoveryTcp
       users_(0),
       logger_(ara::log::CreateLogger("ServiceDiscoveryTcpConnection", "")),
       inside_notify_(false),
-      socket_options_(options) {
+      socket_options_(options),
+      send_queue_(options.send_queue_),
+      is_write_pending_(false),
+      inside_connect_(false) {
   ApplySocketOptions();
   endpoint_->RegisterReadEventHandler(this, socket_.GetHandle());
 }
@@ -107,16 +114,43 @@ void ServiceDiscoveryTcpConnection::Disconnect() {
 
 void ServiceDiscoveryTcpConnection::Forward(someip_posix_common::someip::InstanceId instance_id,
                                             packet_router::Packet packet) {
-  logger_.LogDebug() << __func__ << ":" << __LINE__ << ": instance id " << std::hex << instance_id << std::dec;
+  SOMEIPD_LOG_DEBUG(logger_) << __func__ << ":" << __LINE__ << ": instance id " << std::hex << instance_id << std::dec;
+  namespace someip = someip_posix_common::someip;
   if (is_connected_) {
-    try {
-      socket_.Send(packet->GetIovecContainer());
-    } catch (...) {
-      Disconnected();
+    using DropPolicy = ServiceDiscoveryTcpSendQueue::DropPolicy;
+    const someip::SomeIpMessageHeader& header = packet->GetHeader();
+    DropPolicy policy = DropPolicy::kNever;
+    if (header.message_type_ == someip::SomeIpMessageType::kNotification) {
+      policy = endpoint_->IsField(header.service_id_, header.method_id_) ? DropPolicy::kKeepLatest
+                                                                          : DropPolicy::kDropOldest;
+    }
+    const std::uint64_t key = (static_cast<std::uint64_t>(instance_id) << 32U) |
+                              (static_cast<std::uint64_t>(header.service_id_) << 16U) | header.method_id_;
+    const bool was_congested = send_queue_.IsCongested();
+    send_queue_.Push(std::move(packet), policy, key);
+    // While a write notification is pending or the connector is still dispatching, the queue is flushed later.
+    if (!is_write_pending_ && !inside_connect_) {
+      try {
+        if (!send_queue_.Flush(&socket_)) {
+          is_write_pending_ = true;
+          endpoint_->RegisterWriteEventHandler(this, socket_.GetHandle());
+        }
+      } catch (...) {
+        Disconnected();
+        return;
+      }
+    }
+    if (send_queue_.IsCongested() && !was_congested) {
+      logger_.LogWarn() << __func__ << ":" << __LINE__ << ": send queue to " << address_ << "," << port_
+                        << " above high watermark, dropping notifications";
     }
   }
 }
 
+ServiceDiscoveryTcpSendQueue::Statistics ServiceDiscoveryTcpConnection::GetSendQueueStatistics() const {
+  return send_queue_.GetStatistics();
+}
+
 std::size_t ServiceDiscoveryTcpConnection::Acquire() { return ++users_; }
 
 std::size_t ServiceDiscoveryTcpConnection::Release() {
@@ -170,6 +204,7 @@ bool ServiceDiscoveryTcpConnection::HandleRead(int handle) {
        * The caller will do it automatically when we return false.
        */
       is_connected_ = false;
+      DiscardPendingPackets();
       Notify();
       return false;
     }
@@ -179,8 +214,35 @@ bool ServiceDiscoveryTcpConnection::HandleRead(int handle) {
 }
 
 bool ServiceDiscoveryTcpConnection::HandleWrite(int handle) {
-  if (!is_connected_ && is_active_ && connector_ && handle == connector_->GetHandle()) {
-    return connector_->HandleWrite(handle);
+  if (is_connected_ && is_write_pending_ && handle == socket_.GetHandle()) {
+    try {
+      const bool was_congested = send_queue_.IsCongested();
+      is_write_pending_ = !send_queue_.Flush(&socket_);
+      if (was_congested && !send_queue_.IsCongested()) {
+        logger_.LogInfo() << __func__ << ":" << __LINE__ << ": send queue to " << address_ << "," << port_
+                          << " drained below low watermark";
+      }
+      return is_write_pending_;
+    } catch (...) {
+      /*
+       * Mustn't unregister event handler here.
+       * The caller will do it automatically when we return false.
+       */
+      is_write_pending_ = false;
+      Disconnected();
+      return false;
+    }
+  } else if (!is_connected_ && is_active_ && connector_ && handle == connector_->GetHandle()) {
+    inside_connect_ = true;
+    bool keep = connector_->HandleWrite(handle);
+    inside_connect_ = false;
+    if (!keep && is_connected_ && !send_queue_.IsEmpty() && handle == socket_.GetHandle()) {
+      // Packets were forwarded while the connection was being established. The registration of the connector is
+      // kept for writing them.
+      is_write_pending_ = true;
+      keep = true;
+    }
+    return keep;
   } else {
     return false;
   }
@@ -203,11 +265,20 @@ void ServiceDiscoveryTcpConnection::Connected() {
 void ServiceDiscoveryTcpConnection::Disconnected() {
   logger_.LogDebug() << __func__ << ":" << __LINE__;
   is_connected_ = false;
+  DiscardPendingPackets();
   endpoint_->UnregisterReadEventHandler(this, socket_.GetHandle());
   socket_.Close();
   Notify();
 }
 
+void ServiceDiscoveryTcpConnection::DiscardPendingPackets() {
+  if (is_write_pending_) {
+    is_write_pending_ = false;
+    endpoint_->UnregisterWriteEventHandler(this, socket_.GetHandle());
+  }
+  send_queue_.Clear();
+}
+
 void ServiceDiscoveryTcpConnection::Notify() {
   inside_notify_ = true;
   removed_senders_.resize(0);
@@ -228,7 +299,7 @@ void ServiceDiscoveryTcpConnection::Notify() {
 
 void ServiceDiscoveryTcpConnection::ProcessMessage(SomeIpMessage&& message) {
   namespace someip = someip_posix_common::someip;
-  auto header = message.GetHeader();
+  const someip::SomeIpMessageHeader& header = message.GetHeader();
   const auto service_id = header.service_id_;
   auto instance_id = someip::kInstanceIdAny;
   if (header.message_type_ == someip::SomeIpMessageType::kRequest ||
@@ -247,8 +318,8 @@ void ServiceDiscoveryTcpConnection::ProcessMessage(SomeIpMessage&& message) {
   } else {
     assert(0);
   }
-  logger_.LogDebug() << __func__ << ":" << __LINE__ << ": (" << std::hex << service_id << "," << instance_id << std::dec
-                     << ")";
+  SOMEIPD_LOG_DEBUG(logger_) << __func__ << ":" << __LINE__ << ": (" << std::hex << service_id << "," << instance_id
+                             << std::dec << ")";
   if (instance_id != someip::kInstanceIdAny) {
     endpoint_->ProcessReceivedMessage(this, instance_id, std::move(message));
   }
@@ -34,6 +34,7 @@
 #include "osabstraction/io/network/socket/tcp_socket.h"
 #include "someip-posix-common/someip/someip_stream_message_reader.h"
 #include "someipd-posix/packet_router/packet_router_interface.h"
+#include "someipd-posix/service_discovery/connection_manager/service_discovery_tcp_send_queue.h"
 
 namespace someipd_posix {
 namespace service_discovery {
@@ -129,10 +130,19 @@ class ServiceDiscoveryTcpConnection {
   /**
    * \brief Sends a SOME/IP message to remote peer.
    *
+   * \details The message is queued if the socket cannot accept it right away and written once the socket becomes
+   * writable again.
+   *
    * \param instance_id A SOME/IP instance identifier.
    * \param packet A SOME/IP message.
    */
   void Forward(someip_posix_common::someip::InstanceId instance_id, packet_router::Packet packet);
+  /**
+   * \brief Returns the metrics of the outbound packet queue.
+   *
+   * \return The current queue metrics.
+   */
+  ServiceDiscoveryTcpSendQueue::Statistics GetSendQueueStatistics() const;
   /**
    * \brief Increments the number of users of this TCP connection.
    *
@@ -241,6 +251,10 @@ class ServiceDiscoveryTcpConnection {
    * \brief Called when a TCP connection dies or is closed.
    */
   void Disconnected();
+  /**
+   * \brief Removes all queued outbound packets and stops write event notification for them.
+   */
+  void DiscardPendingPackets();
   /**
    * \brief Notifies registered TCP senders about a change in the TCP connection state.
    */
@@ -336,6 +350,18 @@ class ServiceDiscoveryTcpConnection {
    * \brief A container of registered required SOME/IP service instances.
    */
   RequiredServiceInstanceContainer required_service_instances_;
+  /**
+   * \brief Outbound packets which could not be written to the socket yet.
+   */
+  ServiceDiscoveryTcpSendQueue send_queue_;
+  /**
+   * \brief Indicates whether the socket is registered for write event notification because packets are queued.
+   */
+  bool is_write_pending_;
+  /**
+   * \brief Indicates whether the TCP connector is completing a connection attempt.
+   */
+  bool inside_connect_;
 };
 
 }  // namespace connection_manager
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <cassert>
 
+#include "someipd-posix/logging/lazy_logging.h"
 #include "someipd-posix/service_discovery/connection_manager/service_discovery_tcp_endpoint.h"
 #include "vac/language/cpp14_backport.h"
 
@@ -35,7 +36,8 @@ ServiceDiscoveryTcpEndpoint::ServiceDiscoveryTcpEndpoint(osabstraction::io::Reac
                                                          packet_router::PacketRouterInterface* packet_router,
                                                          const someip_posix_common::someip::IpAddress& address,
                                                          someip_posix_common::someip::Port port,
-                                                         const someip_posix_common::someip::SocketOptions& options)
+                                                         const someip_posix_common::someip::SocketOptions& options,
+                                                         const FieldContainer& fields)
     : reactor_(reactor),
       packet_router_(packet_router),
       address_(address),
@@ -43,7 +45,8 @@ ServiceDiscoveryTcpEndpoint::ServiceDiscoveryTcpEndpoint(osabstraction::io::Reac
       logger_(ara::log::CreateLogger("ServiceDiscoveryTcpEndpoint", "")),
       server_(nullptr),
       server_users_(0),
-      socket_options_(options) {}
+      socket_options_(options),
+      fields_(fields) {}
 
 const someip_posix_common::someip::IpAddress& ServiceDiscoveryTcpEndpoint::GetAddress() const { return address_; }
 
@@ -94,10 +97,10 @@ void ServiceDiscoveryTcpEndpoint::AcceptConnection(ServiceDiscoveryTcpConnection
 void ServiceDiscoveryTcpEndpoint::ProcessReceivedMessage(ServiceDiscoveryTcpConnection* connection,
                                                          someip_posix_common::someip::InstanceId instance_id,
                                                          SomeIpMessage&& message) {
-  logger_.LogDebug() << __func__ << ":" << __LINE__ << ": instance id " << std::hex << instance_id << std::dec;
+  SOMEIPD_LOG_DEBUG(logger_) << __func__ << ":" << __LINE__ << ": instance id " << std::hex << instance_id << std::dec;
   auto response_sender = std::make_shared<ServiceDiscoveryTcpResponseSender>(shared_from_this(), connection);
-  packet_router::Packet packet{new SomeIpMessage(std::move(message))};
-  packet_router_->Forward(instance_id, response_sender, packet);
+  packet_router::Packet packet{SomeIpMessage::CreateShared(std::move(message))};
+  packet_router_->Forward(instance_id, std::move(response_sender), std::move(packet));
 }
 
 void ServiceDiscoveryTcpEndpoint::RegisterReadEventHandler(ServiceDiscoveryTcpConnection* connection, int handle) {
@@ -182,6 +185,11 @@ std::pair<bool, someip_posix_common::someip::InstanceId> ServiceDiscoveryTcpEndp
   }
 }
 
+bool ServiceDiscoveryTcpEndpoint::IsField(someip_posix_common::someip::ServiceId service_id,
+                                          someip_posix_common::someip::EventId event_id) const {
+  return fields_.find(MakeFieldKey(service_id, event_id)) != fields_.end();
+}
+
 bool ServiceDiscoveryTcpEndpoint::HandleRead(int handle) {
   logger_.LogDebug() << __func__ << ":" << __LINE__ << ": handle " << handle;
   auto it = read_event_handlers_.find(handle);
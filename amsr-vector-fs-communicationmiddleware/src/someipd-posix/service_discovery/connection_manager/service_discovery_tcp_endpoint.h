@@ -27,6 +27,7 @@
 #include <atomic>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -60,6 +61,10 @@ class ServiceDiscoveryTcpEndpoint : public std::enable_shared_from_this<ServiceD
    * \brief A SOME/IP message type.
    */
   using SomeIpMessage = someip_posix_common::someip::SomeIpMessage;
+  /**
+   * \brief A set of fields, each identified by MakeFieldKey().
+   */
+  using FieldContainer = std::unordered_set<std::uint32_t>;
   /**
    * \brief Constructor of ServiceDiscoveryTcpEndpoint.
    *
@@ -67,13 +72,14 @@ class ServiceDiscoveryTcpEndpoint : public std::enable_shared_from_this<ServiceD
    * \param packet_router A packet router.
    * \param address A local IP address.
    * \param port A local port number.
-   * \param options Additional options for TCP sockets (QoS, KeepAlive).
+   * \param options Additional options for TCP sockets (QoS, KeepAlive, send queue).
+   * \param fields The configured fields. Only the latest value of a field is kept in a congested send queue.
    */
   ServiceDiscoveryTcpEndpoint(osabstraction::io::ReactorInterface* reactor,
                               packet_router::PacketRouterInterface* packet_router,
                               const someip_posix_common::someip::IpAddress& address,
                               someip_posix_common::someip::Port port,
-                              const someip_posix_common::someip::SocketOptions& options);
+                              const someip_posix_common::someip::SocketOptions& options, const FieldContainer& fields);
 
   /**
    * \brief Delete copy constructor
@@ -218,6 +224,25 @@ class ServiceDiscoveryTcpEndpoint : public std::enable_shared_from_this<ServiceD
    */
   std::pair<bool, someip_posix_common::someip::InstanceId> GetProvidedServiceInstanceId(
       someip_posix_common::someip::ServiceId service_id);
+  /**
+   * \brief Indicates whether an event is a field.
+   *
+   * \param service_id A SOME/IP service identifier.
+   * \param event_id A SOME/IP event identifier.
+   * \return true if the event is a field and false otherwise.
+   */
+  bool IsField(someip_posix_common::someip::ServiceId service_id, someip_posix_common::someip::EventId event_id) const;
+  /**
+   * \brief Returns the key of a field in a FieldContainer.
+   *
+   * \param service_id A SOME/IP service identifier.
+   * \param event_id A SOME/IP event identifier.
+   * \return The field key.
+   */
+  static std::uint32_t MakeFieldKey(someip_posix_common::someip::ServiceId service_id,
+                                    someip_posix_common::someip::EventId event_id) {
+    return (static_cast<std::uint32_t>(service_id) << 16U) | event_id;
+  }
 
  private:
   /**
@@ -348,6 +373,10 @@ class ServiceDiscoveryTcpEndpoint : public std::enable_shared_from_this<ServiceD
    * \brief Quality of service setting for this TCP endpoint.
    */
   const someip_posix_common::someip::SocketOptions socket_options_;
+  /**
+   * \brief The configured fields.
+   */
+  const FieldContainer fields_;
 };
 
 }  // namespace connection_manager
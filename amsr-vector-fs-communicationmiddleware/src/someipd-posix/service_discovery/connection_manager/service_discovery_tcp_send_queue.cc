@@ -0,0 +1,160 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  service_discovery_tcp_send_queue.cc
+ *        \brief  Outbound packet queue of a TCP connection
+ *
+ *      \details  -
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <sys/uio.h>
+#include <algorithm>
+#include <array>
+#include <utility>
+
+#include "someipd-posix/service_discovery/connection_manager/service_discovery_tcp_send_queue.h"
+
+namespace someipd_posix {
+namespace service_discovery {
+namespace connection_manager {
+
+constexpr std::size_t ServiceDiscoveryTcpSendQueue::kDefaultHighWatermark;
+constexpr std::size_t ServiceDiscoveryTcpSendQueue::kDefaultLowWatermark;
+constexpr std::size_t ServiceDiscoveryTcpSendQueue::kMaxIovecs;
+
+ServiceDiscoveryTcpSendQueue::ServiceDiscoveryTcpSendQueue(
+    const someip_posix_common::someip::TcpSendQueueParameters& parameters)
+    : high_watermark_(parameters.high_watermark_ != 0U ? parameters.high_watermark_ : kDefaultHighWatermark),
+      low_watermark_(std::min(parameters.low_watermark_ != 0U ? parameters.low_watermark_ : kDefaultLowWatermark,
+                              high_watermark_)),
+      entries_(),
+      front_offset_(0U),
+      queued_bytes_(0U),
+      is_congested_(false),
+      max_queued_bytes_(0U),
+      dropped_packets_(0U),
+      replaced_packets_(0U),
+      congestions_(0U) {}
+
+void ServiceDiscoveryTcpSendQueue::Push(packet_router::Packet packet, DropPolicy policy, std::uint64_t key) {
+  const std::size_t length = packet->GetTotalSize();
+  if ((policy == DropPolicy::kKeepLatest) && !entries_.empty()) {
+    // The first packet must not be replaced once it has been partially sent.
+    auto first = (front_offset_ == 0U) ? entries_.begin() : std::next(entries_.begin());
+    auto it = std::find_if(first, entries_.end(), [key](const Entry& entry) {
+      return (entry.policy_ == DropPolicy::kKeepLatest) && (entry.key_ == key);
+    });
+    if (it != entries_.end()) {
+      queued_bytes_ = (queued_bytes_ - it->packet_->GetTotalSize()) + length;
+      it->packet_ = std::move(packet);
+      ++replaced_packets_;
+      max_queued_bytes_ = std::max(max_queued_bytes_, queued_bytes_);
+      DropOldest();
+      return;
+    }
+  }
+
+  entries_.push_back(Entry{std::move(packet), policy, key});
+  queued_bytes_ += length;
+  max_queued_bytes_ = std::max(max_queued_bytes_, queued_bytes_);
+  DropOldest();
+}
+
+bool ServiceDiscoveryTcpSendQueue::Flush(osabstraction::io::network::socket::Socket* socket) {
+  using IovecContainer = osabstraction::io::network::socket::Socket::IovecContainer;
+  std::array<struct iovec, kMaxIovecs> iovecs;
+  bool is_blocked = false;
+  while (!entries_.empty() && !is_blocked) {
+    std::size_t count = 0U;
+    std::size_t length = 0U;
+    std::size_t skip = front_offset_;
+    for (auto it = entries_.begin(); (it != entries_.end()) && (count < kMaxIovecs); ++it) {
+      for (const struct iovec& iov : it->packet_->GetIovecContainer()) {
+        if (skip >= iov.iov_len) {
+          skip -= iov.iov_len;
+        } else if (count < kMaxIovecs) {
+          iovecs[count].iov_base = static_cast<std::uint8_t*>(iov.iov_base) + skip;
+          iovecs[count].iov_len = iov.iov_len - skip;
+          length += iovecs[count].iov_len;
+          ++count;
+          skip = 0U;
+        }
+      }
+    }
+    const std::size_t sent = socket->TrySend(IovecContainer(iovecs.data(), count));
+    Consume(sent);
+    // A short write means that the socket send buffer is full.
+    is_blocked = (sent < length);
+  }
+  if (is_congested_ && (queued_bytes_ <= low_watermark_)) {
+    is_congested_ = false;
+  }
+  return entries_.empty();
+}
+
+void ServiceDiscoveryTcpSendQueue::Clear() {
+  entries_.clear();
+  front_offset_ = 0U;
+  queued_bytes_ = 0U;
+  is_congested_ = false;
+}
+
+ServiceDiscoveryTcpSendQueue::Statistics ServiceDiscoveryTcpSendQueue::GetStatistics() const {
+  return Statistics{entries_.size(), queued_bytes_,     max_queued_bytes_,
+                    dropped_packets_, replaced_packets_, congestions_};
+}
+
+void ServiceDiscoveryTcpSendQueue::Consume(std::size_t length) {
+  while ((length > 0U) && !entries_.empty()) {
+    const std::size_t remaining = entries_.front().packet_->GetTotalSize() - front_offset_;
+    if (length >= remaining) {
+      length -= remaining;
+      queued_bytes_ -= remaining;
+      front_offset_ = 0U;
+      entries_.pop_front();
+    } else {
+      front_offset_ += length;
+      queued_bytes_ -= length;
+      length = 0U;
+    }
+  }
+}
+
+void ServiceDiscoveryTcpSendQueue::DropOldest() {
+  if (queued_bytes_ <= high_watermark_) {
+    return;
+  }
+  if (!is_congested_) {
+    is_congested_ = true;
+    ++congestions_;
+  }
+  // The first packet must not be dropped once it has been partially sent, the peer would lose the stream framing.
+  auto it = (front_offset_ == 0U) ? entries_.begin() : std::next(entries_.begin());
+  while ((it != entries_.end()) && (queued_bytes_ > high_watermark_)) {
+    if (it->policy_ != DropPolicy::kNever) {
+      queued_bytes_ -= it->packet_->GetTotalSize();
+      ++dropped_packets_;
+      it = entries_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+}  // namespace connection_manager
+}  // namespace service_discovery
+}  // namespace someipd_posix
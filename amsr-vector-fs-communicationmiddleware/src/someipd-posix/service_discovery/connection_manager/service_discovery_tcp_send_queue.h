@@ -0,0 +1,221 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  service_discovery_tcp_send_queue.h
+ *        \brief  Outbound packet queue of a TCP connection
+ *
+ *      \details  Packets which cannot be written to a TCP socket right away are kept in a queue and written with
+ *                vectored non-blocking sends once the socket becomes writable. When the queue grows above its high
+ *                watermark, notifications are dropped according to their drop policy, so that a slow peer cannot make
+ *                the queue grow without bound.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SRC_SOMEIPD_POSIX_SERVICE_DISCOVERY_CONNECTION_MANAGER_SERVICE_DISCOVERY_TCP_SEND_QUEUE_H_
+#define SRC_SOMEIPD_POSIX_SERVICE_DISCOVERY_CONNECTION_MANAGER_SERVICE_DISCOVERY_TCP_SEND_QUEUE_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+#include "osabstraction/io/network/socket/socket.h"
+#include "someip-posix-common/someip/someip_posix_types.h"
+#include "someipd-posix/packet_router/packet_router_interface.h"
+
+namespace someipd_posix {
+namespace service_discovery {
+namespace connection_manager {
+
+/**
+ * \brief Outbound packet queue of a TCP connection.
+ */
+class ServiceDiscoveryTcpSendQueue {
+ public:
+  /**
+   * \brief Specifies what happens to a queued packet when the queue is congested.
+   */
+  enum class DropPolicy : std::uint8_t {
+    /**
+     * \brief The packet is never dropped. Used for requests and responses.
+     */
+    kNever,
+    /**
+     * \brief The oldest queued packets with this policy are dropped first while the queue is above its high watermark.
+     */
+    kDropOldest,
+    /**
+     * \brief Like kDropOldest. In addition, a queued packet that has not been sent yet is replaced by a newer packet
+     * with the same key. Used for fields, for which only the latest value is of interest.
+     */
+    kKeepLatest
+  };
+
+  /**
+   * \brief Queue depth metrics.
+   */
+  struct Statistics {
+    std::size_t queued_packets_;      ///< Packets currently queued
+    std::size_t queued_bytes_;        ///< Bytes currently queued and not yet sent
+    std::size_t max_queued_bytes_;    ///< Highest number of queued bytes so far
+    std::uint64_t dropped_packets_;   ///< Packets dropped because the queue was above its high watermark
+    std::uint64_t replaced_packets_;  ///< Packets replaced by a newer packet with the same key before being sent
+    std::uint64_t congestions_;       ///< Number of times the queue grew above its high watermark
+  };
+
+  /**
+   * \brief Default high watermark in bytes.
+   */
+  static constexpr std::size_t kDefaultHighWatermark = 256U * 1024U;
+
+  /**
+   * \brief Default low watermark in bytes.
+   */
+  static constexpr std::size_t kDefaultLowWatermark = 64U * 1024U;
+
+  /**
+   * \brief Maximum number of buffers written by a single send call.
+   */
+  static constexpr std::size_t kMaxIovecs = 64U;
+
+  /**
+   * \brief Constructor of ServiceDiscoveryTcpSendQueue.
+   *
+   * \param parameters Watermarks of the queue. A watermark of 0 selects the default.
+   */
+  explicit ServiceDiscoveryTcpSendQueue(const someip_posix_common::someip::TcpSendQueueParameters& parameters);
+
+  /**
+   * \brief Appends a packet to the queue.
+   *
+   * \param packet A SOME/IP message.
+   * \param policy The drop policy of the packet.
+   * \param key Identifies packets which replace each other if policy is kKeepLatest.
+   */
+  void Push(packet_router::Packet packet, DropPolicy policy, std::uint64_t key);
+
+  /**
+   * \brief Writes as many queued packets to a socket as it accepts without blocking.
+   *
+   * \param socket A connected stream socket.
+   * \return true if the queue is empty afterwards and false if the socket cannot accept more data.
+   * \throws std::system_error if the socket reports an error.
+   */
+  bool Flush(osabstraction::io::network::socket::Socket* socket);
+
+  /**
+   * \brief Removes all queued packets.
+   */
+  void Clear();
+
+  /**
+   * \brief Indicates whether packets are queued.
+   *
+   * \return true if no packet is queued and false otherwise.
+   */
+  bool IsEmpty() const { return entries_.empty(); }
+
+  /**
+   * \brief Indicates whether the queue has grown above its high watermark and not yet drained to its low watermark.
+   *
+   * \return true if the queue is congested and false otherwise.
+   */
+  bool IsCongested() const { return is_congested_; }
+
+  /**
+   * \brief Returns the queue depth metrics.
+   *
+   * \return The current metrics.
+   */
+  Statistics GetStatistics() const;
+
+ private:
+  /**
+   * \brief A queued packet.
+   */
+  struct Entry {
+    packet_router::Packet packet_;  ///< The SOME/IP message
+    DropPolicy policy_;             ///< Drop policy of the message
+    std::uint64_t key_;             ///< Replacement key of the message
+  };
+
+  /**
+   * \brief Removes sent bytes from the front of the queue.
+   *
+   * \param length Number of bytes sent.
+   */
+  void Consume(std::size_t length);
+
+  /**
+   * \brief Drops the oldest droppable packets until the queue is at or below its high watermark.
+   */
+  void DropOldest();
+
+  /**
+   * \brief Queued bytes above which notifications are dropped.
+   */
+  const std::size_t high_watermark_;
+
+  /**
+   * \brief Queued bytes at or below which the congestion ends.
+   */
+  const std::size_t low_watermark_;
+
+  /**
+   * \brief Queued packets in sending order.
+   */
+  std::deque<Entry> entries_;
+
+  /**
+   * \brief Number of bytes of the first queued packet which have already been sent.
+   */
+  std::size_t front_offset_;
+
+  /**
+   * \brief Number of queued bytes not yet sent.
+   */
+  std::size_t queued_bytes_;
+
+  /**
+   * \brief Indicates whether the queue is congested.
+   */
+  bool is_congested_;
+
+  /**
+   * \brief Highest number of queued bytes so far.
+   */
+  std::size_t max_queued_bytes_;
+
+  /**
+   * \brief Number of dropped packets.
+   */
+  std::uint64_t dropped_packets_;
+
+  /**
+   * \brief Number of replaced packets.
+   */
+  std::uint64_t replaced_packets_;
+
+  /**
+   * \brief Number of congestions.
+   */
+  std::uint64_t congestions_;
+};
+
+}  // namespace connection_manager
+}  // namespace service_discovery
+}  // namespace someipd_posix
+
+#endif  // SRC_SOMEIPD_POSIX_SERVICE_DISCOVERY_CONNECTION_MANAGER_SERVICE_DISCOVERY_TCP_SEND_QUEUE_H_
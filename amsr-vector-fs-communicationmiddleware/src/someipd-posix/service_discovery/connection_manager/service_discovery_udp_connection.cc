@@ -68,28 +68,14 @@ void ServiceDiscoveryUdpConnection::OnSendDatagram() {
   // TODO(PAASR-3062)
   // Get the next UDP datagram which represents all SOME/IP messages which shall be transmitted in a single UDP packet
   auto next_datagram = transmission_trigger_message_queue_.DequeueNextDatagram();
-  // Repeat until all datagrams are sent
+  // Repeat until all datagrams are queued. The endpoint sends the datagrams of all its connections at once.
   while (next_datagram.second) {
-    // Get the IO vector container which described the whole datagram
-    auto io_vec_container{GetDatagramIovecContainer(next_datagram.first)};
-    // Transmitt the next UDP datagram
-    endpoint_->Send(osabstraction::io::network::socket::Socket::IovecContainer{io_vec_container}, socket_address_);
+    endpoint_->QueueDatagram(std::move(next_datagram.first), socket_address_);
     // Fetch the next UDP datagram
     next_datagram = transmission_trigger_message_queue_.DequeueNextDatagram();
   }
 }
 
-ServiceDiscoveryUdpConnection::IovecContainer ServiceDiscoveryUdpConnection::GetDatagramIovecContainer(
-    const MessageContainer& messages) {
-  IovecContainer io_vec_container{};
-  for (const auto& message : messages) {
-    for (const auto& iov : message->GetIovecContainer()) {
-      io_vec_container.push_back(iov);
-    }
-  }
-  return io_vec_container;
-}
-
 }  // namespace connection_manager
 }  // namespace service_discovery
 }  // namespace someipd_posix
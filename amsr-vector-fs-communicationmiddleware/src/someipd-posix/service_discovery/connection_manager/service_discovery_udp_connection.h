@@ -108,23 +108,6 @@ class ServiceDiscoveryUdpConnection : public transmission_trigger::TransmissionT
   void OnSendDatagram() override;
 
  private:
-  /**
-   * \brief An I/O vector container.
-   */
-  using IovecContainer = std::vector<struct iovec>;
-  /**
-   * \brief A container of SOME/IP messages.
-   */
-  using MessageContainer = transmission_trigger::TransmissionTriggerMessageQueue::MessageContainer;
-
-  /**
-   * \brief Builds a I/O vector container from a container of SOME/IP messages.
-   *
-   * \param messages A container of SOME/IP messages.
-   * \return An I/O vector container.
-   */
-  IovecContainer GetDatagramIovecContainer(const MessageContainer& messages);
-
   /**
    * \brief An UDP endpoint this connection belongs to.
    */
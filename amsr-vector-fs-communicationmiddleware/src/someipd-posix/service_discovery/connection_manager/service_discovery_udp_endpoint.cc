@@ -25,7 +25,9 @@
 #include <algorithm>
 #include <cassert>
 #include <limits>
+#include <system_error>
 #include "osabstraction/io/network/address/ip_socket_address.h"
+#include "someipd-posix/logging/lazy_logging.h"
 #include "vac/language/cpp14_backport.h"
 
 namespace someipd_posix {
@@ -52,7 +54,8 @@ ServiceDiscoveryUdpEndpoint::ServiceDiscoveryUdpEndpoint(
       socket_options_(options),
       timer_manager_{timer_manager},
       transmission_trigger_policy_manager_(transmission_trigger_policy_manager),
-      transmission_trigger_buffer_size_{transmission_trigger_buffer_size} {}
+      transmission_trigger_buffer_size_{transmission_trigger_buffer_size},
+      is_send_scheduled_(false) {}
 
 ServiceDiscoveryUdpEndpoint::ServiceDiscoveryUdpEndpoint(
     osabstraction::io::ReactorInterface* reactor, packet_router::PacketRouterInterface* packet_router,
@@ -72,9 +75,11 @@ ServiceDiscoveryUdpEndpoint::ServiceDiscoveryUdpEndpoint(
       logger_(ara::log::CreateLogger("ServiceDiscoveryUdpEndpoint", "")),
       users_(0),
       message_reader_(mtu),
+      socket_options_{},
       timer_manager_{timer_manager},
       transmission_trigger_policy_manager_(transmission_trigger_policy_manager),
-      transmission_trigger_buffer_size_{transmission_trigger_buffer_size} {
+      transmission_trigger_buffer_size_{transmission_trigger_buffer_size},
+      is_send_scheduled_(false) {
   logger_.LogDebug() << __func__ << ":" << __LINE__ << ": local address " << local_address << " group address "
                      << group_address << "," << port;
 }
@@ -174,6 +179,56 @@ std::size_t ServiceDiscoveryUdpEndpoint::Send(
   }
 }
 
+void ServiceDiscoveryUdpEndpoint::QueueDatagram(
+    transmission_trigger::TransmissionTriggerMessageQueue::MessageContainer&& messages,
+    const osabstraction::io::network::address::SocketAddress& socket_address) {
+  if (!socket_) {
+    return;
+  }
+  const std::size_t first_iovec = pending_iovecs_.size();
+  for (const auto& message : messages) {
+    for (const auto& iov : message->GetIovecContainer()) {
+      pending_iovecs_.push_back(iov);
+    }
+  }
+  pending_datagrams_.push_back(
+      PendingDatagram{std::move(messages), first_iovec, pending_iovecs_.size() - first_iovec, &socket_address});
+  if (pending_datagrams_.size() >= osabstraction::io::network::socket::DatagramSocket::kMaxBatchSize) {
+    SendQueuedDatagrams();
+  } else if (!is_send_scheduled_) {
+    // The socket is writable right away, so the datagrams are sent as soon as the reactor dispatches the next events.
+    reactor_->RegisterEventHandler(socket_->GetHandle(), this, osabstraction::io::kWriteEvent, nullptr);
+    is_send_scheduled_ = true;
+  }
+}
+
+void ServiceDiscoveryUdpEndpoint::SendQueuedDatagrams() {
+  using OutboundDatagram = osabstraction::io::network::socket::DatagramSocket::OutboundDatagram;
+  using OutboundDatagramContainer = osabstraction::io::network::socket::DatagramSocket::OutboundDatagramContainer;
+  outbound_datagrams_.clear();
+  for (const PendingDatagram& datagram : pending_datagrams_) {
+    outbound_datagrams_.push_back(OutboundDatagram{
+        osabstraction::io::network::socket::Socket::IovecContainer{&pending_iovecs_[datagram.first_iovec_],
+                                                                   datagram.iovec_count_},
+        datagram.socket_address_});
+  }
+  logger_.LogDebug() << __func__ << ":" << __LINE__ << ": datagrams " << outbound_datagrams_.size();
+  std::size_t sent = 0U;
+  while (sent < outbound_datagrams_.size()) {
+    try {
+      sent += socket_->SendBatch(
+          OutboundDatagramContainer{&outbound_datagrams_[sent], outbound_datagrams_.size() - sent});
+    } catch (const std::system_error& e) {
+      // A datagram which cannot be sent must not hold back the datagrams to other remote peers.
+      logger_.LogError() << __func__ << ":" << __LINE__ << ": sending to "
+                         << outbound_datagrams_[sent].remote_address_->toString() << " failed: " << e.what();
+      ++sent;
+    }
+  }
+  pending_datagrams_.clear();
+  pending_iovecs_.clear();
+}
+
 void ServiceDiscoveryUdpEndpoint::OpenSocket() {
   assert(!socket_);
   logger_.LogDebug() << __func__ << ":" << __LINE__ << ": address " << socket_address_.toString() << " multicast "
@@ -186,6 +241,11 @@ void ServiceDiscoveryUdpEndpoint::OpenSocket() {
     socket_->SetPriority(qos_priority);
   }
 
+  if (socket_options_.segmentation_offload_) {
+    const bool is_enabled = socket_->SetSegmentationOffload(true);
+    logger_.LogDebug() << __func__ << ":" << __LINE__ << ": segmentation offload " << is_enabled;
+  }
+
   socket_->SetMulticastSendInterface(local_address_);
   if (is_multicast_) {
     socket_->JoinMulticastGroup(local_address_, group_address_);
@@ -195,6 +255,11 @@ void ServiceDiscoveryUdpEndpoint::OpenSocket() {
 
 void ServiceDiscoveryUdpEndpoint::CloseSocket() {
   assert(socket_);
+  if (is_send_scheduled_) {
+    SendQueuedDatagrams();
+    reactor_->UnregisterEventHandler(socket_->GetHandle(), osabstraction::io::kWriteEvent);
+    is_send_scheduled_ = false;
+  }
   reactor_->UnregisterEventHandler(socket_->GetHandle(), osabstraction::io::kReadEvent);
   if (is_multicast_) {
     socket_->LeaveMulticastGroup(local_address_, group_address_);
@@ -209,8 +274,8 @@ void ServiceDiscoveryUdpEndpoint::ProcessReceivedMessage(someip_posix_common::so
   auto address = ap.first;
   auto port = std::strtoul(ap.second.c_str(), nullptr, 0);
   assert(port <= std::numeric_limits<someip_posix_common::someip::Port>::max());
-  logger_.LogDebug() << __func__ << ":" << __LINE__ << ": instance id " << std::hex << instance_id << std::dec
-                     << " from " << from_address.toString();
+  SOMEIPD_LOG_DEBUG(logger_) << __func__ << ":" << __LINE__ << ": instance id " << std::hex << instance_id << std::dec
+                             << " from " << from_address.toString();
   auto it = GetConnection(address, static_cast<someip_posix_common::someip::Port>(port));
   if (it == connections_.end()) {
     connections_.emplace_back(vac::language::make_unique<ServiceDiscoveryUdpConnection>(
@@ -219,15 +284,15 @@ void ServiceDiscoveryUdpEndpoint::ProcessReceivedMessage(someip_posix_common::so
     it = std::prev(connections_.end());
   }
   auto response_sender = std::make_shared<ServiceDiscoveryUdpResponseSender>(shared_from_this(), it->get());
-  packet_router::Packet packet(new SomeIpMessage(std::move(message)));
+  packet_router::Packet packet{SomeIpMessage::CreateShared(std::move(message))};
   packet_router_->Forward(instance_id, response_sender, std::move(packet));
 }
 
 void ServiceDiscoveryUdpEndpoint::ProcessMessage(SomeIpMessage&& message) {
   namespace someip = someip_posix_common::someip;
   const auto& from_address = message.GetFromAddress().first;
-  logger_.LogDebug() << __func__ << ":" << __LINE__ << ": " << from_address.toString();
-  auto header = message.GetHeader();
+  SOMEIPD_LOG_DEBUG(logger_) << __func__ << ":" << __LINE__ << ": " << from_address.toString();
+  const someip::SomeIpMessageHeader& header = message.GetHeader();
   const auto service_id = header.service_id_;
   auto instance_id = someip::kInstanceIdAny;
   if (header.message_type_ == someip::SomeIpMessageType::kRequest ||
@@ -246,8 +311,8 @@ void ServiceDiscoveryUdpEndpoint::ProcessMessage(SomeIpMessage&& message) {
   } else {
     assert(0);
   }
-  logger_.LogDebug() << __func__ << ":" << __LINE__ << ": (" << std::hex << service_id << "," << instance_id << std::dec
-                     << ")";
+  SOMEIPD_LOG_DEBUG(logger_) << __func__ << ":" << __LINE__ << ": (" << std::hex << service_id << "," << instance_id
+                             << std::dec << ")";
   if (instance_id != someip::kInstanceIdAny) {
     ProcessReceivedMessage(instance_id, std::move(message));
   }
@@ -265,6 +330,10 @@ bool ServiceDiscoveryUdpEndpoint::HandleRead(int handle) {
 
 bool ServiceDiscoveryUdpEndpoint::HandleWrite(int handle) {
   (void)handle;
+  if (is_send_scheduled_) {
+    SendQueuedDatagrams();
+    is_send_scheduled_ = false;
+  }
   return false;
 }
 
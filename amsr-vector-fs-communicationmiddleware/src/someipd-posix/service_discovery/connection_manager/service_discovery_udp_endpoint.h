@@ -197,6 +197,17 @@ class ServiceDiscoveryUdpEndpoint : public std::enable_shared_from_this<ServiceD
    */
   std::size_t Send(const osabstraction::io::network::socket::Socket::IovecContainer& iovec,
                    const osabstraction::io::network::address::SocketAddress& socket_address);
+  /**
+   * \brief Queues a datagram for transmission.
+   *
+   * \details All datagrams queued by any UDP connection of this endpoint until the reactor dispatches the next events
+   * are sent with a single system call.
+   *
+   * \param messages The SOME/IP messages forming the datagram.
+   * \param socket_address The remote address to which the datagram is sent. Must stay valid until it is sent.
+   */
+  void QueueDatagram(transmission_trigger::TransmissionTriggerMessageQueue::MessageContainer&& messages,
+                     const osabstraction::io::network::address::SocketAddress& socket_address);
 
  private:
   /**
@@ -245,10 +256,23 @@ class ServiceDiscoveryUdpEndpoint : public std::enable_shared_from_this<ServiceD
    * \brief A SOME/IP message type.
    */
   using SomeIpMessage = someip_posix_common::someip::SomeIpMessage;
+  /**
+   * \brief A datagram waiting for transmission.
+   */
+  struct PendingDatagram {
+    transmission_trigger::TransmissionTriggerMessageQueue::MessageContainer messages_;  ///< Messages of the datagram
+    std::size_t first_iovec_;  ///< Index of the first buffer of the datagram in pending_iovecs_
+    std::size_t iovec_count_;  ///< Number of buffers of the datagram
+    const osabstraction::io::network::address::SocketAddress* socket_address_;  ///< Remote address
+  };
   /**
    * \brief Opens UDP socket.
    */
   void OpenSocket();
+  /**
+   * \brief Sends all queued datagrams.
+   */
+  void SendQueuedDatagrams();
   /**
    * \brief Closes UDP socket.
    */
@@ -379,6 +403,22 @@ class ServiceDiscoveryUdpEndpoint : public std::enable_shared_from_this<ServiceD
    * \brief Maximum number of bytes which can be queued before transmission.
    */
   const TransmissionTriggerBufferSize transmission_trigger_buffer_size_;
+  /**
+   * \brief Datagrams waiting for transmission.
+   */
+  std::vector<PendingDatagram> pending_datagrams_;
+  /**
+   * \brief Buffers of all datagrams waiting for transmission.
+   */
+  std::vector<struct iovec> pending_iovecs_;
+  /**
+   * \brief Descriptions of the datagrams passed to the socket, kept to avoid allocations.
+   */
+  std::vector<osabstraction::io::network::socket::DatagramSocket::OutboundDatagram> outbound_datagrams_;
+  /**
+   * \brief Indicates whether the socket is registered for write event notification to send queued datagrams.
+   */
+  bool is_send_scheduled_;
 };
 
 }  // namespace connection_manager
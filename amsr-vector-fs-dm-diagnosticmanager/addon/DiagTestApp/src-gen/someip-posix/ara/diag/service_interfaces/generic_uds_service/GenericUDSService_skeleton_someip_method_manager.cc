@@ -66,18 +66,6 @@ class DeserializeGenericUDSServiceServiceRequestData {
  public:
   explicit DeserializeGenericUDSServiceServiceRequestData(RootDeserializer* root) : deserializer_{root} {}
 
-  /* ImplementationDataTypeValue deserialization for element 'byte' (/ara/diag/types/DataArrayType/byte) */
-  template <typename ParentDeserializer>
-  std::pair<uint8, bool> DeserializeRequestData_byte(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    uint8 RequestData_byte{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer>
-        deserializer__RequestData_byte{parent};
-    deserialization_ok = deserializer__RequestData_byte.PopFront(RequestData_byte) > 0U;
-    return std::make_pair(RequestData_byte, deserialization_ok);
-  }
-
   /* ImplementationDataTypeVector deserialization for element 'RequestData' (/ara/diag/types/DataArrayType) */
   template <typename ParentDeserializer>
   std::pair<DataArrayType, bool> DeserializeRequestData(ParentDeserializer* parent) {
@@ -86,14 +74,15 @@ class DeserializeGenericUDSServiceServiceRequestData {
     marshaller::ComplexDataTypeDeserializer<marshaller::BEPayloadUint32LengthFieldPolicy, ParentDeserializer>
         deserializer__RequestData{parent};
     DataArrayType RequestData{};
-    while (deserializer__RequestData.HasDataRemaining()) {
-      const auto ret = DeserializeRequestData_byte(&deserializer__RequestData);
-      deserialization_ok &= ret.second;
-      if (!deserialization_ok) {
-        break;
-      }
-
-      RequestData.push_back(ret.first);
+    // Elements are primitives: copy them in one go instead of one PopFront per element.
+    const std::size_t RequestData_bytes{deserializer__RequestData.GetDataRemaining()};
+    // The length field is set by the peer: reject it before allocating if the message does not contain that much data.
+    deserialization_ok = (RequestData_bytes <= deserializer__RequestData.GetRemainingLength()) &&
+                         ((RequestData_bytes % sizeof(DataArrayType::value_type)) == 0U);
+    if (deserialization_ok) {
+      RequestData.resize(RequestData_bytes / sizeof(DataArrayType::value_type));
+      deserialization_ok = deserializer__RequestData.template PopFrontRange<marshaller::BEPayloadNoLengthFieldPolicy>(
+                               RequestData.data(), RequestData.size()) == RequestData_bytes;
     }
     return std::make_pair(RequestData, deserialization_ok);
   }
@@ -368,15 +357,8 @@ void GenericUDSServiceSkeletonSomeIpMethodManagerService::SendMethodResponse(
   {
     marshaller::ComplexDataTypeSerializer<marshaller::BEPayloadUint32LengthFieldPolicy, decltype(serializer)>
         serializer_ResponseData{&serializer};
-    for (const auto& out_val_ResponseData_element : out_val.ResponseData) {
-      /* ImplementationDataTypeValue serialization for element 'byte' (/ara/diag/types/DataArrayType/byte) */
-      {
-        marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer_ResponseData)>
-            serializer_ResponseData_byte{&serializer_ResponseData};
-        serializer_ResponseData_byte.PushBack(out_val_ResponseData_element);
-        serializer_ResponseData_byte.Close();
-      }
-    }
+    /* Bulk ImplementationDataTypeValue serialization for elements 'byte' (/ara/diag/types/DataArrayType/byte) */
+    serializer_ResponseData.PushBackRange<marshaller::BEPayloadNoLengthFieldPolicy>(out_val.ResponseData);
     serializer_ResponseData.Close();
   }
 
@@ -24,7 +24,7 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
-#include <map>
+#include <atomic>
 #include <memory>
 #include <tuple>
 #include "ara-someip-posix/aracom_someip_binding_interface.h"
@@ -175,9 +175,15 @@ class DataIdentifier_SWCL_A_DID_4711ProxySomeIpBinding : public DataIdentifier_S
 
   /* ---- Fields --------------------------------------------------------------------------------------------------- */
  private:
-  /** Subscribed events with the related event manager */
-  using EventSubscriptionsMap =
-      std::map<someip_posix_common::someip::EventId, ara::com::someip_posix::ServiceProxySomeIpEventInterface*>;
+  /** Event manager of a subscribed event, nullptr if the event is not subscribed */
+  using EventSubscription = std::atomic<ara::com::someip_posix::ServiceProxySomeIpEventInterface*>;
+
+  /**
+   * \brief Look up the subscription of an event. The look-up is a switch over the event IDs of the service interface.
+   * \param event_id The SOME/IP event ID
+   * \return The subscription, or nullptr if the service interface has no event with this ID.
+   */
+  EventSubscription* FindEventSubscription(someip_posix_common::someip::EventId event_id);
 
   /** SOME/IP instance ID used by this binding. */
   someip_posix_common::someip::InstanceId instance_id_;
@@ -191,12 +197,6 @@ class DataIdentifier_SWCL_A_DID_4711ProxySomeIpBinding : public DataIdentifier_S
   /** Logger for tracing and debugging */
   ara::log::Logger& logger_;
 
-  /** Event subscriptions */
-  EventSubscriptionsMap event_subscriptions_;
-
-  /** Mutex for protection of event_subscriptions_ */
-  std::mutex event_subscriptions_lock_;
-
   /* ---- Methods manager ------------------------------------------------------------------------------------------ */
 
   /** Method request/response manager for proxy method 'Read' */
@@ -61,16 +61,13 @@ void DataIdentifier_SWCL_A_DID_F190ProxySomeIpBinding::SendMethodRequest(
 void DataIdentifier_SWCL_A_DID_F190ProxySomeIpBinding::SubscribeEvent(
     someip_posix_common::someip::EventId event_id,
     ara::com::someip_posix::ServiceProxySomeIpEventInterface* event_manager) {
-  std::pair<EventSubscriptionsMap::iterator, bool> insert_pair{event_subscriptions_.end(), false};
-  {
-    // Protect concurrent modification of event_subscriptions_
-    std::lock_guard<std::mutex> guard(event_subscriptions_lock_);
+  EventSubscription* subscription{FindEventSubscription(event_id)};
+  ara::com::someip_posix::ServiceProxySomeIpEventInterface* expected{nullptr};
 
-    // Subscribe to event
-    insert_pair = event_subscriptions_.emplace(event_id, event_manager);
-  }
-
-  if (insert_pair.second) {
+  if (subscription == nullptr) {
+    logger_.LogError() << "Event with ID " << event_id << " is not part of the service interface. Subscription is "
+                       << "dropped.";
+  } else if (subscription->compare_exchange_strong(expected, event_manager, std::memory_order_acq_rel)) {
     someip_binding_.SubscribeEvent(DataIdentifier_SWCL_A_DID_F190ProxySomeIpBinding::kServiceId, instance_id_,
                                    event_id);
   } else {
@@ -79,30 +76,17 @@ void DataIdentifier_SWCL_A_DID_F190ProxySomeIpBinding::SubscribeEvent(
 }
 
 void DataIdentifier_SWCL_A_DID_F190ProxySomeIpBinding::UnsubscribeEvent(someip_posix_common::someip::EventId event_id) {
-  ara::com::someip_posix::ServiceProxySomeIpEventInterface* event_manager = nullptr;
-  {
-    // Protect concurrent modification of event_subscriptions_
-    std::lock_guard<std::mutex> guard(event_subscriptions_lock_);
-
-    // Search event by ID
-    auto it = event_subscriptions_.find(event_id);
-
-    if (it != event_subscriptions_.end()) {
-      // Store related event handler for later notification of subscription state update
-      event_manager = it->second;
-
-      // Delete route and unsubscribe from event
-      event_subscriptions_.erase(it);
-      someip_binding_.UnsubscribeEvent(DataIdentifier_SWCL_A_DID_F190ProxySomeIpBinding::kServiceId, instance_id_,
-                                       event_id);
-    }
-  }
-
-  /* Notify the related event manager about subscription state update.
-   * Done outside of event_subscriptions_lock_ due to possible dead-locks in case the event
-   * subscription state update handler directly calls SubscribeEvent API. A possible unexpected
-   * event notification in case of a Subscribe call between lock_guard and handler call is accepted. */
+  EventSubscription* subscription{FindEventSubscription(event_id)};
+  // Delete route and unsubscribe from event. Keep the related event handler for the notification of the subscription
+  // state update.
+  ara::com::someip_posix::ServiceProxySomeIpEventInterface* event_manager{
+      (subscription != nullptr) ? subscription->exchange(nullptr, std::memory_order_acq_rel) : nullptr};
+
+  /* Notify the related event manager about subscription state update. A possible unexpected event notification in
+   * case of a concurrent event notification by the reactor is accepted. */
   if (event_manager) {
+    someip_binding_.UnsubscribeEvent(DataIdentifier_SWCL_A_DID_F190ProxySomeIpBinding::kServiceId, instance_id_,
+                                     event_id);
     event_manager->HandleEventSubscriptionStateUpdate(ara::com::SubscriptionState::kNotSubscribed);
   } else {
     logger_.LogWarn() << "No subscription active for event with SOME/IP event ID " << event_id
@@ -143,24 +127,12 @@ void DataIdentifier_SWCL_A_DID_F190ProxySomeIpBinding::HandleEventNotification(
   // The method / event ID and the session ID.
   const someip_posix_common::someip::MethodId event_id = header.method_id_;
 
-  ara::com::someip_posix::ServiceProxySomeIpEventInterface* event_manager = nullptr;
-  {
-    // Protect concurrent modification of event_subscriptions_ container.
-    // Required in case of concurrent reception of new event notifications by reactor and Subscribe/Unsubscribe by
-    // Application
-    std::lock_guard<std::mutex> guard(event_subscriptions_lock_);
-
-    // Search event subscription and call event notification handler
-    auto it = event_subscriptions_.find(event_id);
-    if (it != event_subscriptions_.end()) {
-      event_manager = it->second;
-    }
-  }
+  // Search event subscription and call event notification handler. Subscribe/Unsubscribe by the application only
+  // exchange the event manager of the subscription, so no lock is needed.
+  EventSubscription* subscription{FindEventSubscription(event_id)};
+  ara::com::someip_posix::ServiceProxySomeIpEventInterface* event_manager{
+      (subscription != nullptr) ? subscription->load(std::memory_order_acquire) : nullptr};
 
-  /* Call event notification handler. Explicitly done outside of event_subscriptions_lock_ to avoid
-   * potential dead-locks in case application handler calls other event subscribe/unsubscribe APIs.
-   * A possible unexpected event notification in case of Unsubscribe call between lock_guard and handler
-   * call is accepted. */
   if (event_manager) {
     event_manager->HandleEventNotification(std::move(deserializer));
   } else {
@@ -171,22 +143,11 @@ void DataIdentifier_SWCL_A_DID_F190ProxySomeIpBinding::HandleEventNotification(
 
 void DataIdentifier_SWCL_A_DID_F190ProxySomeIpBinding::HandleEventSubscriptionStateUpdate(
     const someip_posix_common::someip::MethodId event_id, ara::com::SubscriptionState state) {
-  ara::com::someip_posix::ServiceProxySomeIpEventInterface* event_manager = nullptr;
-  {
-    // Protect concurrent modification of event_subscriptions_ container.
-    // Required in case of concurrent subscription state update by reactor and Subscribe/Unsubscribe by Application
-    std::lock_guard<std::mutex> guard(event_subscriptions_lock_);
-
-    // Search event subscription and call subscription state update handler
-    auto it = event_subscriptions_.find(event_id);
-    if (it != event_subscriptions_.end()) {
-      event_manager = it->second;
-    }
-  }
+  // Search event subscription and call subscription state update handler
+  EventSubscription* subscription{FindEventSubscription(event_id)};
+  ara::com::someip_posix::ServiceProxySomeIpEventInterface* event_manager{
+      (subscription != nullptr) ? subscription->load(std::memory_order_acquire) : nullptr};
 
-  /* Call event subscription state change handler. Explicitely done outside of event_subscriptions_lock_ to avoid
-   * potential dead-locks in case application handler calls other event subscribe/unsubscribe APIs. A possible
-   * unexpected state change update in case of Unsubscribe call between lock_guard and handler call is accepted. */
   if (event_manager) {
     event_manager->HandleEventSubscriptionStateUpdate(state);
   } else {
@@ -199,6 +160,13 @@ void DataIdentifier_SWCL_A_DID_F190ProxySomeIpBinding::HandleEventSubscriptionSt
   }
 }
 
+DataIdentifier_SWCL_A_DID_F190ProxySomeIpBinding::EventSubscription*
+DataIdentifier_SWCL_A_DID_F190ProxySomeIpBinding::FindEventSubscription(someip_posix_common::someip::EventId event_id) {
+  // The service interface has no events.
+  static_cast<void>(event_id);
+  return nullptr;
+}
+
 }  // namespace data_identifier_F190
 }  // namespace service_interfaces
 }  // namespace diag
@@ -140,19 +140,6 @@ class DeserializeDataIdentifier_SWCL_A_DID_F190ReaddataRecord_vin {
  public:
   explicit DeserializeDataIdentifier_SWCL_A_DID_F190ReaddataRecord_vin(RootDeserializer* root) : deserializer_{root} {}
 
-  /* ImplementationDataTypeValue deserialization for element 'Element'
-   * (/ara/diag/types/fixed_size_array_with_17_uint8_items/Element) */
-  template <typename ParentDeserializer>
-  std::pair<uint8, bool> DeserializedataRecord_vin_Element(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    uint8 dataRecord_vin_Element{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer>
-        deserializer__dataRecord_vin_Element{parent};
-    deserialization_ok = deserializer__dataRecord_vin_Element.PopFront(dataRecord_vin_Element) > 0U;
-    return std::make_pair(dataRecord_vin_Element, deserialization_ok);
-  }
-
   /* ImplementationDataTypeArray deserialization for element 'dataRecord_vin'
    * (/ara/diag/types/fixed_size_array_with_17_uint8_items) */
   template <typename ParentDeserializer>
@@ -162,14 +149,9 @@ class DeserializeDataIdentifier_SWCL_A_DID_F190ReaddataRecord_vin {
     marshaller::Deserializer<marshaller::BEPayloadUint32LengthFieldPolicy, ParentDeserializer>
         deserializer__dataRecord_vin{parent};
     fixed_size_array_with_17_uint8_items dataRecord_vin{};
-    for (auto& element_n : dataRecord_vin) {
-      const auto ret = DeserializedataRecord_vin_Element(&deserializer__dataRecord_vin);
-      deserialization_ok &= ret.second;
-      if (!deserialization_ok) {
-        break;
-      }
-      element_n = ret.first;
-    }
+    // Elements are primitives: copy them in one go instead of one PopFront per element.
+    deserialization_ok = deserializer__dataRecord_vin.template PopFrontRange<marshaller::BEPayloadNoLengthFieldPolicy>(
+                             dataRecord_vin.data(), dataRecord_vin.size()) == sizeof(dataRecord_vin);
     return std::make_pair(dataRecord_vin, deserialization_ok);
   }
 
@@ -378,16 +360,9 @@ DataIdentifier_SWCL_A_DID_F190ProxySomeIpMethodManagerWrite::HandleMethodRequest
   {
     marshaller::Serializer<marshaller::BEPayloadUint32LengthFieldPolicy, decltype(serializer)>
         serializer_dataRecord_vin{&serializer};
-    for (const auto& dataRecord_vin_element : dataRecord_vin) {
-      /* ImplementationDataTypeValue serialization for element 'Element'
-       * (/ara/diag/types/fixed_size_array_with_17_uint8_items/Element) */
-      {
-        marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer_dataRecord_vin)>
-            serializer_dataRecord_vin_Element{&serializer_dataRecord_vin};
-        serializer_dataRecord_vin_Element.PushBack(dataRecord_vin_element);
-        serializer_dataRecord_vin_Element.Close();
-      }
-    }
+    /* Bulk ImplementationDataTypeValue serialization for elements 'Element'
+     * (/ara/diag/types/fixed_size_array_with_17_uint8_items/Element) */
+    serializer_dataRecord_vin.PushBackRange<marshaller::BEPayloadNoLengthFieldPolicy>(dataRecord_vin);
     serializer_dataRecord_vin.Close();
   }
 
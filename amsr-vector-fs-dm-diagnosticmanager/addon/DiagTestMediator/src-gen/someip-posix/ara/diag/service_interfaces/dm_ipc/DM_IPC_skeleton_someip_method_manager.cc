@@ -157,18 +157,6 @@ class DeserializeDM_IPCRequestDatarequest_data {
  public:
   explicit DeserializeDM_IPCRequestDatarequest_data(RootDeserializer* root) : deserializer_{root} {}
 
-  /* ImplementationDataTypeValue deserialization for element 'byte' (/ara/diag/types/DataArrayType/byte) */
-  template <typename ParentDeserializer>
-  std::pair<uint8, bool> Deserializerequest_data_byte(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    uint8 request_data_byte{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer>
-        deserializer__request_data_byte{parent};
-    deserialization_ok = deserializer__request_data_byte.PopFront(request_data_byte) > 0U;
-    return std::make_pair(request_data_byte, deserialization_ok);
-  }
-
   /* ImplementationDataTypeVector deserialization for element 'request_data' (/ara/diag/types/DataArrayType) */
   template <typename ParentDeserializer>
   std::pair<DataArrayType, bool> Deserializerequest_data(ParentDeserializer* parent) {
@@ -177,14 +165,15 @@ class DeserializeDM_IPCRequestDatarequest_data {
     marshaller::ComplexDataTypeDeserializer<marshaller::BEPayloadUint32LengthFieldPolicy, ParentDeserializer>
         deserializer__request_data{parent};
     DataArrayType request_data{};
-    while (deserializer__request_data.HasDataRemaining()) {
-      const auto ret = Deserializerequest_data_byte(&deserializer__request_data);
-      deserialization_ok &= ret.second;
-      if (!deserialization_ok) {
-        break;
-      }
-
-      request_data.push_back(ret.first);
+    // Elements are primitives: copy them in one go instead of one PopFront per element.
+    const std::size_t request_data_bytes{deserializer__request_data.GetDataRemaining()};
+    // The length field is set by the peer: reject it before allocating if the message does not contain that much data.
+    deserialization_ok = (request_data_bytes <= deserializer__request_data.GetRemainingLength()) &&
+                         ((request_data_bytes % sizeof(DataArrayType::value_type)) == 0U);
+    if (deserialization_ok) {
+      request_data.resize(request_data_bytes / sizeof(DataArrayType::value_type));
+      deserialization_ok = deserializer__request_data.template PopFrontRange<marshaller::BEPayloadNoLengthFieldPolicy>(
+                               request_data.data(), request_data.size()) == request_data_bytes;
     }
     return std::make_pair(request_data, deserialization_ok);
   }
@@ -369,15 +358,8 @@ void DM_IPCSkeletonSomeIpMethodManagerRequestData::SendMethodResponse(
   {
     marshaller::ComplexDataTypeSerializer<marshaller::BEPayloadUint32LengthFieldPolicy, decltype(serializer)>
         serializer_response_data{&serializer};
-    for (const auto& out_val_response_data_element : out_val.response_data) {
-      /* ImplementationDataTypeValue serialization for element 'byte' (/ara/diag/types/DataArrayType/byte) */
-      {
-        marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer_response_data)>
-            serializer_response_data_byte{&serializer_response_data};
-        serializer_response_data_byte.PushBack(out_val_response_data_element);
-        serializer_response_data_byte.Close();
-      }
-    }
+    /* Bulk ImplementationDataTypeValue serialization for elements 'byte' (/ara/diag/types/DataArrayType/byte) */
+    serializer_response_data.PushBackRange<marshaller::BEPayloadNoLengthFieldPolicy>(out_val.response_data);
     serializer_response_data.Close();
   }
 
@@ -30,22 +30,21 @@
 #include <type_traits>
 #include <utility>
 
-#include "udstransport/uds_message.h"
-#include "vac/container/container_aggregator.h"
+#include "udstransport/uds_meta_info_store.h"
 
 namespace ara {
 namespace diag {
 namespace udstransport {
 
 /**
- * \brief Converts the MetaInfoMaps to a map that can by processed by ara::com
+ * \brief Converts the meta information of a UdsMessage to a map that can by processed by ara::com
  *
  * If the key string cannot be converted to the target (integer) key type due to an overflow, the corresponding
  * key-value-pair is not converted.
  *
  * \remark This is temporary workaround until ara::com interfaces can be adapted.
  *
- * \param container container for all the meta info maps
+ * \param container meta info store of a UdsMessage
  * \return the new meta info map
  */
 template <typename AraComMetaInfoMap, typename MapContainerType>
@@ -55,15 +54,12 @@ AraComMetaInfoMap ConvertToAraComMetaInfo(const MapContainerType &container) {
 
   AraComMetaInfoMap meta_info{};
 
-  auto iter = container.begin();
-  while (iter != container.end()) {
-    const std::pair<std::string, std::string> &key_value_pair = *iter;
+  for (const MetaInfoEntry &entry : container) {
     char *end = nullptr;
-    std::uint64_t value = std::strtoul(key_value_pair.second.c_str(), &end, 10);
+    std::uint64_t value = std::strtoul(entry.GetValueCString(), &end, 10);
     if (value <= std::numeric_limits<UnderlyingKeyType>::max()) {
-      meta_info.emplace(static_cast<KeyType>(value), key_value_pair.second);
+      meta_info.emplace(static_cast<KeyType>(value), std::string(entry.GetValueCString()));
     }
-    ++iter;
   }
   return meta_info;
 }
@@ -32,9 +32,10 @@
 #include <utility>
 #include <vector>
 
+#include "udstransport/uds_meta_info_store.h"
 #include "udstransport/uds_transport_protocol_types.h"
 #include "vac/container/array_view.h"
-#include "vac/container/container_aggregator.h"
+#include "vac/container/string_view.h"
 #include "vac/memory/buffer_provider.h"
 #include "vac/memory/leaky_array_allocator.h"
 #include "vac/memory/object_pool.h"
@@ -81,10 +82,6 @@ class UdsMessage {
    */
   using ConstPtr = vac::memory::SmartObjectPoolUniquePtrToConst<UdsMessage>;
 
-  // TODO(PAASR-3036): Create header for compile time config parameters
-  /// Maximum number of AddMetaInfo calls
-  static constexpr std::size_t kMaxNumberOfMetaInfoMaps = 3;
-
   /**
    * \brief Overloaded constructor.
    */
@@ -134,21 +131,32 @@ class UdsMessage {
   /**
    * \brief Returns the meta information.
    *
-   * \return meta info map container.
+   * \return meta info store.
    */
-  const vac::container::ContainerAggregator<MetaInfoMapPointer>& GetMetaInfo() const { return meta_info_; }
+  const MetaInfoStore& GetMetaInfo() const { return meta_info_; }
 
   /**
    * \brief add new metaInfo to this message.
    *
    * \note typically called by the transport plugin to add channel specific meta-info.
    * (see SWS - there are already predefined meta-info keys for DoIP....)
-   * If the meta info map storage is full already, the call is ignored.
+   * The entries are copied into the meta info store of the message. Entries not fitting into the store are ignored.
    *
    * \param metaInfo meta information relevant for UdsMessage
    */
   void AddMetaInfo(std::shared_ptr<MetaInfoMap> metaInfo);
 
+  /**
+   * \brief add a single meta information entry to this message without allocating memory.
+   *
+   * If the meta info store is full or the key or value is too long, the call is ignored.
+   *
+   * \param key key of the meta information
+   * \param value value of the meta information
+   * \return true if the entry was stored, false otherwise.
+   */
+  bool AddMetaInfo(vac::container::string_view key, vac::container::string_view value);
+
   /**
    * \brief Return the global channel identifier
    */
@@ -190,12 +198,10 @@ class UdsMessage {
    */
   const GlobalChannelIdentifier global_channel_identifier_;
 
-  /** backend storage for Meta info maps*/
-  std::array<MetaInfoMapPointer, kMaxNumberOfMetaInfoMaps> meta_info_storage_;
-
-  /** front-end object for accessing stored meta info maps */
-  vac::container::ContainerAggregator<MetaInfoMapPointer> meta_info_{
-      vac::container::array_view<MetaInfoMapPointer>(meta_info_storage_)};
+  /**
+   * \brief Meta information of the message.
+   */
+  MetaInfoStore meta_info_;
 };
 
 } /* namespace udstransport */
@@ -0,0 +1,204 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  uds_meta_info_store.h
+ *        \brief  Fixed capacity key/value store for the meta information of a UdsMessage.
+ *
+ *      \details  The store is embedded in the UdsMessage, which lives in the object pool of the UdsMessageProvider.
+ *                Adding or reading meta information therefore never allocates memory.
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_LIBDM_INCLUDE_UDSTRANSPORT_UDS_META_INFO_STORE_H_
+#define LIB_LIBDM_INCLUDE_UDSTRANSPORT_UDS_META_INFO_STORE_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+#include "vac/container/string_view.h"
+
+namespace ara {
+namespace diag {
+namespace udstransport {
+
+// TODO(PAASR-3036): Create header for compile time config parameters
+/// Maximum number of meta information entries of one UdsMessage
+constexpr std::size_t kMaxNumberOfMetaInfoEntries = 8;
+
+/// Maximum length of a meta information key, excluding the terminating null character
+constexpr std::size_t kMaxMetaInfoKeyLength = 31;
+
+/// Maximum length of a meta information value, excluding the terminating null character
+constexpr std::size_t kMaxMetaInfoValueLength = 63;
+
+/**
+ * \brief One key/value pair of meta information. Key and value are stored null-terminated.
+ */
+class MetaInfoEntry {
+ public:
+  /**
+   * \brief Returns the key.
+   */
+  vac::container::string_view GetKey() const { return vac::container::string_view(key_.data(), key_length_); }
+
+  /**
+   * \brief Returns the value.
+   */
+  vac::container::string_view GetValue() const { return vac::container::string_view(value_.data(), value_length_); }
+
+  /**
+   * \brief Returns the value as null-terminated string.
+   */
+  const char* GetValueCString() const { return value_.data(); }
+
+ private:
+  friend class MetaInfoStore;
+
+  /**
+   * \brief Copies a string into a buffer and terminates it.
+   * \param destination the buffer, it must be larger than source
+   * \param source the string to copy
+   */
+  template <std::size_t N>
+  static void Assign(std::array<char, N>& destination, vac::container::string_view source) {
+    std::copy(source.begin(), source.end(), destination.begin());
+    destination[source.size()] = '\0';
+  }
+
+  /**
+   * \brief The key.
+   */
+  std::array<char, kMaxMetaInfoKeyLength + 1> key_;
+
+  /**
+   * \brief The value.
+   */
+  std::array<char, kMaxMetaInfoValueLength + 1> value_;
+
+  /**
+   * \brief Length of the key.
+   */
+  std::size_t key_length_;
+
+  /**
+   * \brief Length of the value.
+   */
+  std::size_t value_length_;
+};
+
+/**
+ * \brief Flat store of up to kMaxNumberOfMetaInfoEntries key/value pairs.
+ */
+class MetaInfoStore {
+ public:
+  /// Type of the stored entries
+  using value_type = MetaInfoEntry;
+
+  /// Iterator over the stored entries
+  using const_iterator = const MetaInfoEntry*;
+
+  /**
+   * \brief Adds a key/value pair. The value of an existing key is replaced.
+   *
+   * \param key key of the meta information
+   * \param value value of the meta information
+   * \return false if the key or value is too long or the store is full, true otherwise.
+   */
+  bool Insert(vac::container::string_view key, vac::container::string_view value) {
+    if ((key.size() > kMaxMetaInfoKeyLength) || (value.size() > kMaxMetaInfoValueLength)) {
+      return false;
+    }
+    const std::size_t index = IndexOf(key);
+    if ((index == size_) && (size_ == entries_.size())) {
+      return false;
+    }
+    MetaInfoEntry& entry = entries_[index];
+    if (index == size_) {
+      MetaInfoEntry::Assign(entry.key_, key);
+      entry.key_length_ = key.size();
+      ++size_;
+    }
+    MetaInfoEntry::Assign(entry.value_, value);
+    entry.value_length_ = value.size();
+    return true;
+  }
+
+  /**
+   * \brief Looks up the entry of a key.
+   *
+   * \param key key of the meta information
+   * \return the entry, nullptr if the key is not stored.
+   */
+  const MetaInfoEntry* Find(vac::container::string_view key) const {
+    const std::size_t index = IndexOf(key);
+    return (index == size_) ? nullptr : &entries_[index];
+  }
+
+  /**
+   * \brief Removes all entries.
+   */
+  void Clear() { size_ = 0; }
+
+  /**
+   * \brief Returns the number of stored entries.
+   */
+  std::size_t size() const { return size_; }
+
+  /**
+   * \brief Checks if no entry is stored.
+   */
+  bool empty() const { return size_ == 0; }
+
+  /**
+   * \brief Returns an iterator to the first entry.
+   */
+  const_iterator begin() const { return entries_.data(); }
+
+  /**
+   * \brief Returns an iterator behind the last entry.
+   */
+  const_iterator end() const { return entries_.data() + size_; }
+
+ private:
+  /**
+   * \brief Linear search for a key, the number of entries is small.
+   * \param key key of the meta information
+   * \return index of the entry, size() if the key is not stored.
+   */
+  std::size_t IndexOf(vac::container::string_view key) const {
+    const const_iterator entry = std::find_if(begin(), end(), [&key](const MetaInfoEntry& candidate) {
+      return (candidate.key_length_ == key.size()) && std::equal(key.begin(), key.end(), candidate.key_.begin());
+    });
+    return static_cast<std::size_t>(entry - begin());
+  }
+
+  /**
+   * \brief Storage of the entries, only the first size_ entries are valid.
+   */
+  std::array<MetaInfoEntry, kMaxNumberOfMetaInfoEntries> entries_;
+
+  /**
+   * \brief Number of stored entries.
+   */
+  std::size_t size_{0};
+};
+
+} /* namespace udstransport */
+} /* namespace diag */
+} /* namespace ara */
+
+#endif  // LIB_LIBDM_INCLUDE_UDSTRANSPORT_UDS_META_INFO_STORE_H_
@@ -50,13 +50,23 @@ const ByteVector& UdsMessage::GetPayload() const { return this->data_; }
 ByteVector& UdsMessage::GetPayload() { return this->data_; }
 
 void UdsMessage::AddMetaInfo(std::shared_ptr<MetaInfoMap> meta_info) {
-  if (meta_info_.NumberOfRegisteredContainers() < meta_info_.capacity()) {
-    meta_info_.push_back(meta_info);
-  } else {
-    ara::log::LogError() << "UdsMessage::" << __func__ << " : MetaInfo storage is full. AddMetaInfo is ignored.";
+  if (meta_info) {
+    for (const MetaInfoMap::value_type& key_value_pair : *meta_info) {
+      AddMetaInfo(vac::container::string_view(key_value_pair.first),
+                  vac::container::string_view(key_value_pair.second));
+    }
   }
 }
 
+bool UdsMessage::AddMetaInfo(vac::container::string_view key, vac::container::string_view value) {
+  const bool stored = meta_info_.Insert(key, value);
+  if (!stored) {
+    ara::log::LogError() << "UdsMessage::" << __func__
+                         << " : MetaInfo storage is full or entry is too long. AddMetaInfo is ignored.";
+  }
+  return stored;
+}
+
 } /* namespace udstransport */
 } /* namespace diag */
 } /* namespace ara */
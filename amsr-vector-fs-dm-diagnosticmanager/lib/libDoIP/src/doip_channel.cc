@@ -21,7 +21,9 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <memory>
 #include <utility>
 
@@ -81,6 +83,8 @@ void DoIPChannel::ResetDoIPChannel() {
   NotifyTransportProtocolMgrWithFailure();  // Notify the Transport Protocol Manager with UDS message reception failure,
                                             // if any.
   ResetReader();                            // Read the socket reader.
+  receive_buffer_read_position_ = 0;        // Drop the bytes received on the closed connection.
+  receive_buffer_fill_level_ = 0;
   SetSourceAddress(kSourceAddressInit);     // Set the source address to the default one that no tester can use.
   SetChannelId(tcp::kDefaultChannelID);     // Set the channel ID to the default value.
   diagnostic_response_code_ = processors::DiagnosticMessageResponseCode::kReserved;
@@ -134,29 +138,14 @@ bool DoIPChannel::HandleRead(int handle) {
     throw std::runtime_error("DoIPChannel::HandleRead : active reader is nullptr");
   }
 
-  if (AllObsoleteBytesAreDiscardedFromSocket()) {
-    if (NewReaderSetUponFirstCallOrDoIPMessageWasJustFinished()) {
-      InitializeReader();
-    }
-    if (!TryToFillBufferRequestedFromReaderWithBytesFromSocket()) {
-      TryChangeState(tcp::StateHandle::kFinalize);
-      return IsValid();
-    }
-    if (BufferFromReaderIsFull()) {
-      params_from_readers_ = active_reader_->Evaluate();
-      if (NewReaderIsSetWhileReadingTheMessage()) {
-        InitializeReader();
-      }
-      if (AllObsoleteBytesAreDiscardedFromSocket()) {
-        TryToFinalizeDoIPMessageProcessing(params_from_readers_.action);
-      }
-    }
-  } else {
-    TryToDiscardAllObsoleteBytesFromTheSocket();
-    if (AllObsoleteBytesAreDiscardedFromSocket()) {
-      TryToFinalizeDoIPMessageProcessing(params_from_readers_.action);
-    }
+  if (AllObsoleteBytesAreDiscardedFromSocket() && NewReaderSetUponFirstCallOrDoIPMessageWasJustFinished()) {
+    InitializeReader();
   }
+  if (!ReceiveFromConnection()) {
+    TryChangeState(tcp::StateHandle::kFinalize);
+    return IsValid();
+  }
+  ProcessReceivedBytes();
 
   return IsValid();
 }
@@ -178,13 +167,22 @@ void DoIPChannel::SetUdsMessage(ara::diag::udstransport::UdsMessage::Ptr uds_mes
 
 ara::diag::udstransport::UdsMessage::Ptr DoIPChannel::ReleaseUdsMessage() { return std::move(uds_message_); }
 
-bool DoIPChannel::ReadSpecificLengthFromConnection(std::size_t size_to_read, std::size_t position_to_write) {
-  assert(buffer_.data());
-  assert(buffer_.size() >= size_to_read);
+bool DoIPChannel::ReceiveFromConnection() {
+  assert(ReceivedBytesAvailable() == 0);
+  receive_buffer_read_position_ = 0;
+  receive_buffer_fill_level_ = 0;
+  // While bytes are discarded, nothing is written into the buffer from the reader.
+  const std::size_t bytes_missing_in_reader_buffer =
+      AllObsoleteBytesAreDiscardedFromSocket() ? (buffer_.size() - bytes_read_) : 0;
+  std::array<iovec, 2> receive_targets{{{buffer_.data() + bytes_read_, bytes_missing_in_reader_buffer},
+                                        {receive_buffer_.data(), receive_buffer_.size()}}};
   bool connection_status = true;
   try {
-    std::size_t n = GetTCPSocket().Receive(&buffer_.at(position_to_write), size_to_read);
-    bytes_read_ += n;
+    std::size_t n =
+        GetTCPSocket().Receive(osabstraction::io::network::socket::Socket::IovecContainer(receive_targets));
+    const std::size_t bytes_for_reader = std::min(n, bytes_missing_in_reader_buffer);
+    bytes_read_ += bytes_for_reader;
+    receive_buffer_fill_level_ = n - bytes_for_reader;
   } catch (const std::system_error& e) {
     ara::log::LogDebug() << "DoIPChannel::" << __func__ << e.code().value() << " - " << e.what();
     ara::log::LogDebug() << "Connection suddenly closed while reading message Payload.";
@@ -196,6 +194,51 @@ bool DoIPChannel::ReadSpecificLengthFromConnection(std::size_t size_to_read, std
   return connection_status;
 }
 
+void DoIPChannel::ProcessReceivedBytes() {
+  // Finalizing a message may close the socket and reset the channel, remaining bytes belong to the old connection.
+  while (tcp_socket_.has_value()) {
+    if (!AllObsoleteBytesAreDiscardedFromSocket()) {
+      DiscardReceivedBytes();
+      if (!AllObsoleteBytesAreDiscardedFromSocket()) {
+        break;
+      }
+      TryToFinalizeDoIPMessageProcessing(params_from_readers_.action);
+      continue;
+    }
+    if (NewReaderSetUponFirstCallOrDoIPMessageWasJustFinished()) {
+      InitializeReader();
+    }
+    CopyReceivedBytesToBufferFromReader();
+    if (!BufferFromReaderIsFull()) {
+      // All received bytes are consumed, wait for the next read event.
+      break;
+    }
+    params_from_readers_ = active_reader_->Evaluate();
+    if (NewReaderIsSetWhileReadingTheMessage()) {
+      InitializeReader();
+    }
+    if (AllObsoleteBytesAreDiscardedFromSocket()) {
+      TryToFinalizeDoIPMessageProcessing(params_from_readers_.action);
+    }
+  }
+}
+
+void DoIPChannel::CopyReceivedBytesToBufferFromReader() {
+  const std::size_t bytes_to_copy = std::min(ReceivedBytesAvailable(), buffer_.size() - bytes_read_);
+  if (bytes_to_copy > 0) {
+    std::memcpy(buffer_.data() + bytes_read_, receive_buffer_.data() + receive_buffer_read_position_, bytes_to_copy);
+    bytes_read_ += bytes_to_copy;
+    receive_buffer_read_position_ += bytes_to_copy;
+  }
+}
+
+void DoIPChannel::DiscardReceivedBytes() {
+  const std::size_t bytes_to_discard =
+      std::min(ReceivedBytesAvailable(), params_from_readers_.number_of_bytes_to_discard);
+  params_from_readers_.number_of_bytes_to_discard -= bytes_to_discard;
+  receive_buffer_read_position_ += bytes_to_discard;
+}
+
 void DoIPChannel::ResetReader() {
   active_reader_->Reset();
   bytes_read_ = 0;
@@ -352,24 +395,6 @@ void DoIPChannel::Transmit(ara::diag::udstransport::UdsMessage::Ptr message) {
   tcp_handler_.GetConnectionProvider().GetUdsTransportProtocolMgr().TransmitConfirmation(std::move(message), result);
 }
 
-std::size_t DoIPChannel::FlushSocket(std::size_t bytes_to_flush) {
-  std::array<std::uint8_t, kBufferSizeForDiscardingMessages> buffer;
-  if (bytes_to_flush > kBufferSizeForDiscardingMessages) {
-    bytes_to_flush = kBufferSizeForDiscardingMessages;
-  }
-  std::size_t discarded_bytes = 0;
-  try {
-    discarded_bytes = GetTCPSocket().Receive(buffer.begin(), bytes_to_flush);
-    assert(discarded_bytes <= bytes_to_flush);
-  } catch (const std::system_error& e) {
-    ara::log::LogDebug() << "DoIPChannel::" << __func__ << e.code().value() << " - " << e.what();
-    ara::log::LogDebug() << "Connection suddenly closed while reading message Payload.";
-  } catch (const osabstraction::io::network::socket::SocketEOFException& e) {
-    ara::log::LogDebug() << "DoIPChannel::" << __func__ << " channel closed by Tester.";
-  }
-  return discarded_bytes;
-}
-
 bool DoIPChannel::NewReaderSetUponFirstCallOrDoIPMessageWasJustFinished() const {
   return params_from_readers_.action == channelreader::ActionForReader::kFinishedReading;
 }
@@ -380,15 +405,6 @@ bool DoIPChannel::NewReaderIsSetWhileReadingTheMessage() const {
   return ret;
 }
 
-void DoIPChannel::TryToDiscardAllObsoleteBytesFromTheSocket() {
-  params_from_readers_.number_of_bytes_to_discard -= FlushSocket(params_from_readers_.number_of_bytes_to_discard);
-}
-
-bool DoIPChannel::TryToFillBufferRequestedFromReaderWithBytesFromSocket() {
-  const std::size_t bytes_to_fill_within_the_buffer = buffer_.size() - bytes_read_;
-  return ReadSpecificLengthFromConnection(bytes_to_fill_within_the_buffer, bytes_read_);
-}
-
 bool DoIPChannel::TryToFinalizeDoIPMessageProcessing(channelreader::ActionForReader action) {
   switch (action) {
     case channelreader::ActionForReader::kCloseSocket:
@@ -102,9 +102,9 @@ constexpr uint8_t kReservedValue = 0x00;
 constexpr uint32_t kSaTaSize = 4;
 
 /**
- * \brief Size of array for discarding diagnostic message.
+ * \brief Size of the per-channel buffer receiving the bytes beyond the buffer of the active reader.
  */
-constexpr std::size_t kBufferSizeForDiscardingMessages = 1024;
+constexpr std::size_t kReceiveBufferSize = 4096;
 
 /**
  * \brief Constant for the size of DoIP routing activation response message's payload size.
@@ -282,14 +282,18 @@ class DoIPChannel : public osabstraction::io::EventHandler,
 
  private:
   /**
-   * \brief Read specific number of bytes from the message body from Connection.
+   * \brief Reads all bytes available on the socket with a single receive call. The bytes still missing in the buffer
+   * of the active reader are written directly into it, all following bytes are stored in the receive buffer.
    *
-   * \param size_to_read The size needed to be read from the message body.
-   * \param position_to_write The location in the buffer_ to write on.
-   *
-   * \return False if the connection is not available; true if read the complete length of bytes or less.
+   * \return False if the connection is not available; true otherwise.
+   */
+  bool ReceiveFromConnection();
+
+  /**
+   * \brief Hands the received bytes to the readers until all of them are consumed or the socket is closed. Each
+   * complete DoIP message is processed right away, so one receive call may process several messages.
    */
-  bool ReadSpecificLengthFromConnection(std::size_t size_to_read, std::size_t position_to_write);
+  void ProcessReceivedBytes();
 
   /**
    * \brief Closes the TCP Socket attached to the DoIPChannel.
@@ -345,25 +349,27 @@ class DoIPChannel : public osabstraction::io::EventHandler,
   bool NewReaderIsSetWhileReadingTheMessage() const;
 
   /**
-     * \brief Determines if the DoIPChannel has filled completely the buffer from the reader.
-     * \return true if buffer is full, else false
-     */
+   * \brief Determines if the DoIPChannel has filled completely the buffer from the reader.
+   * \return true if buffer is full, else false
+   */
   bool BufferFromReaderIsFull() const { return bytes_read_ == buffer_.size(); }
 
   /**
-   * \brief Tries to fill the buffer from the reader with bytes requested from the socket.
-   * If all requested bytes from the buffer could be received from the socket the buffer is full afterwards.
-   *
-   * \return True if it was possible to fill the buffer or part of it, false if can't read at all.
+   * \brief Returns the number of received bytes not yet handed to a reader.
    */
-  bool TryToFillBufferRequestedFromReaderWithBytesFromSocket();
+  std::size_t ReceivedBytesAvailable() const { return receive_buffer_fill_level_ - receive_buffer_read_position_; }
 
   /**
-   * \brief Tries to flush obsolete bytes from the socket.
-   * If the request could be fully satisfied the the DoIPMessage can processed further, else this methods needs to be
-   * called again.
+   * \brief Copies as many received bytes as possible into the buffer from the reader.
    */
-  void TryToDiscardAllObsoleteBytesFromTheSocket();
+  void CopyReceivedBytesToBufferFromReader();
+
+  /**
+   * \brief Drops as many received bytes as are still to be discarded.
+   * If all of them could be dropped the DoIPMessage can be processed further, else more bytes need to be received
+   * first.
+   */
+  void DiscardReceivedBytes();
 
   /**
    * Finalizes the processing of the current message if the action is either "kCloseTheSocket" or "kFinalize"
@@ -372,13 +378,6 @@ class DoIPChannel : public osabstraction::io::EventHandler,
    */
   bool TryToFinalizeDoIPMessageProcessing(channelreader::ActionForReader action);
 
-  /**
-   * Flushes a certain number of bytes (up to the bufferSize) and discarding them.
-   * \param bytes_to_flush number of bytes to discard
-   * \return returns the number of actually flushed bytes
-   */
-  std::size_t FlushSocket(std::size_t bytes_to_flush);
-
   /**
    * \brief Getter for the TCP Socket. By design the TCP Socket should have a value before calling this method. I.e. the
    * RegisterTCPSocket method would be called by the TCP handler.
@@ -439,6 +438,22 @@ class DoIPChannel : public osabstraction::io::EventHandler,
    */
   ara::diag::udstransport::ByteVector buffer_;
 
+  /**
+   * \brief Bytes received beyond the buffer from the reader. The buffer is owned by the channel and reused for all
+   * connections handled by it.
+   */
+  std::array<uint8_t, kReceiveBufferSize> receive_buffer_;
+
+  /**
+   * \brief Position of the first received byte not yet handed to a reader.
+   */
+  std::size_t receive_buffer_read_position_ = 0;
+
+  /**
+   * \brief Number of bytes stored in the receive buffer.
+   */
+  std::size_t receive_buffer_fill_level_ = 0;
+
   /*
    * \brief the Connection time which is used for both Initial and General Inactivities.
    */
@@ -511,13 +526,10 @@ class DoIPChannel : public osabstraction::io::EventHandler,
   FRIEND_TEST(DoIPChannelTestFixture, NewReaderSetUponFirstCallOrDoIPMessageWasJustFinishedWillReturnFinishedReading);
   FRIEND_TEST(DoIPChannelTestFixture, SendResponseWillCallSendResponseOfTcpHandler);
   FRIEND_TEST(DoIPChannelTestFixture, SendResponseWillCallSendResponseOfTcpHandlerAndCatchSystemException);
-  FRIEND_TEST(DoIPChannelTestFixture, ReadSpecificLengthFromConnectionWillReceiveDataFromSocket);
-  FRIEND_TEST(DoIPChannelTestFixture, ReadSpecificLengthFromConnectionWillCatchSystemErrorException);
-  FRIEND_TEST(DoIPChannelTestFixture, ReadSpecificLengthFromConnectionWillCatchSocketEOFException);
-  FRIEND_TEST(DoIPChannelTestFixture, FlushSocketWillReceiveDataFromSocket);
-  FRIEND_TEST(DoIPChannelTestFixture, FlushSocketWillReceiveDataFromSocketEqualsTokBufferSizeForDiscardingMessages);
-  FRIEND_TEST(DoIPChannelTestFixture, FlushSocketWillCatchSystemErrorException);
-  FRIEND_TEST(DoIPChannelTestFixture, FlushSocketWillCatchSocketEOFException);
+  FRIEND_TEST(DoIPChannelTestFixture, ReceiveFromConnectionWillReceiveDataFromSocket);
+  FRIEND_TEST(DoIPChannelTestFixture, ReceiveFromConnectionWillCatchSystemErrorException);
+  FRIEND_TEST(DoIPChannelTestFixture, ReceiveFromConnectionWillCatchSocketEOFException);
+  FRIEND_TEST(DoIPChannelTestFixture, ProcessReceivedBytesWillHandleSeveralMessages);
   FRIEND_TEST(DoIPChannelTestFixture, HandleReadThrowsRuntime_errorExceptionWhenActiveReaderIsNullptr);
   FRIEND_TEST(DoIPChannelTestFixture, HandleReadReceivesDoIPMsgAndSendNACK);
   FRIEND_TEST(DoIPChannelTestFixture, HandleReadWillResetChannelWhenSocketThrowsException);
@@ -128,15 +128,8 @@ ara::com::Future<proxy::methods::RequestData::Output> DM_IPCProxySomeIpMethodMan
   {
     marshaller::ComplexDataTypeSerializer<marshaller::BEPayloadUint32LengthFieldPolicy, decltype(serializer)>
         serializer_request_data{&serializer};
-    for (const auto& request_data_element : request_data) {
-      /* ImplementationDataTypeValue serialization for element 'byte' (/ara/diag/types/DataArrayType/byte) */
-      {
-        marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer_request_data)>
-            serializer_request_data_byte{&serializer_request_data};
-        serializer_request_data_byte.PushBack(request_data_element);
-        serializer_request_data_byte.Close();
-      }
-    }
+    /* Bulk ImplementationDataTypeValue serialization for elements 'byte' (/ara/diag/types/DataArrayType/byte) */
+    serializer_request_data.PushBackRange<marshaller::BEPayloadNoLengthFieldPolicy>(request_data);
     serializer_request_data.Close();
   }
 
@@ -162,18 +155,6 @@ class DeserializeDM_IPCRequestDataresponse_data {
  public:
   explicit DeserializeDM_IPCRequestDataresponse_data(RootDeserializer* root) : deserializer_{root} {}
 
-  /* ImplementationDataTypeValue deserialization for element 'byte' (/ara/diag/types/DataArrayType/byte) */
-  template <typename ParentDeserializer>
-  std::pair<uint8, bool> Deserializeresponse_data_byte(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    uint8 response_data_byte{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer>
-        deserializer__response_data_byte{parent};
-    deserialization_ok = deserializer__response_data_byte.PopFront(response_data_byte) > 0U;
-    return std::make_pair(response_data_byte, deserialization_ok);
-  }
-
   /* ImplementationDataTypeVector deserialization for element 'response_data' (/ara/diag/types/DataArrayType) */
   template <typename ParentDeserializer>
   std::pair<DataArrayType, bool> Deserializeresponse_data(ParentDeserializer* parent) {
@@ -182,14 +163,15 @@ class DeserializeDM_IPCRequestDataresponse_data {
     marshaller::ComplexDataTypeDeserializer<marshaller::BEPayloadUint32LengthFieldPolicy, ParentDeserializer>
         deserializer__response_data{parent};
     DataArrayType response_data{};
-    while (deserializer__response_data.HasDataRemaining()) {
-      const auto ret = Deserializeresponse_data_byte(&deserializer__response_data);
-      deserialization_ok &= ret.second;
-      if (!deserialization_ok) {
-        break;
-      }
-
-      response_data.push_back(ret.first);
+    // Elements are primitives: copy them in one go instead of one PopFront per element.
+    const std::size_t response_data_bytes{deserializer__response_data.GetDataRemaining()};
+    // The length field is set by the peer: reject it before allocating if the message does not contain that much data.
+    deserialization_ok = (response_data_bytes <= deserializer__response_data.GetRemainingLength()) &&
+                         ((response_data_bytes % sizeof(DataArrayType::value_type)) == 0U);
+    if (deserialization_ok) {
+      response_data.resize(response_data_bytes / sizeof(DataArrayType::value_type));
+      deserialization_ok = deserializer__response_data.template PopFrontRange<marshaller::BEPayloadNoLengthFieldPolicy>(
+                               response_data.data(), response_data.size()) == response_data_bytes;
     }
     return std::make_pair(response_data, deserialization_ok);
   }
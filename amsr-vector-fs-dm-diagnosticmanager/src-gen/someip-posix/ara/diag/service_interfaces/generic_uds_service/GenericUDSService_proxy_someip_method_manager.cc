@@ -92,15 +92,8 @@ ara::com::Future<proxy::methods::Service::Output> GenericUDSServiceProxySomeIpMe
   {
     marshaller::ComplexDataTypeSerializer<marshaller::BEPayloadUint32LengthFieldPolicy, decltype(serializer)>
         serializer_RequestData{&serializer};
-    for (const auto& RequestData_element : RequestData) {
-      /* ImplementationDataTypeValue serialization for element 'byte' (/ara/diag/types/DataArrayType/byte) */
-      {
-        marshaller::Serializer<marshaller::BEPayloadNoLengthFieldPolicy, decltype(serializer_RequestData)>
-            serializer_RequestData_byte{&serializer_RequestData};
-        serializer_RequestData_byte.PushBack(RequestData_element);
-        serializer_RequestData_byte.Close();
-      }
-    }
+    /* Bulk ImplementationDataTypeValue serialization for elements 'byte' (/ara/diag/types/DataArrayType/byte) */
+    serializer_RequestData.PushBackRange<marshaller::BEPayloadNoLengthFieldPolicy>(RequestData);
     serializer_RequestData.Close();
   }
   /* ImplementationDataTypeMap serialization for element 'MetaInfo' (/ara/diag/types/MetaInfoType) */
@@ -161,18 +154,6 @@ class DeserializeGenericUDSServiceServiceResponseData {
  public:
   explicit DeserializeGenericUDSServiceServiceResponseData(RootDeserializer* root) : deserializer_{root} {}
 
-  /* ImplementationDataTypeValue deserialization for element 'byte' (/ara/diag/types/DataArrayType/byte) */
-  template <typename ParentDeserializer>
-  std::pair<uint8, bool> DeserializeResponseData_byte(ParentDeserializer* parent) {
-    namespace marshaller = someip_posix_common::someip::serialization;
-    bool deserialization_ok{true};
-    uint8 ResponseData_byte{};
-    marshaller::Deserializer<marshaller::BEPayloadNoLengthFieldPolicy, ParentDeserializer>
-        deserializer__ResponseData_byte{parent};
-    deserialization_ok = deserializer__ResponseData_byte.PopFront(ResponseData_byte) > 0U;
-    return std::make_pair(ResponseData_byte, deserialization_ok);
-  }
-
   /* ImplementationDataTypeVector deserialization for element 'ResponseData' (/ara/diag/types/DataArrayType) */
   template <typename ParentDeserializer>
   std::pair<DataArrayType, bool> DeserializeResponseData(ParentDeserializer* parent) {
@@ -181,14 +162,15 @@ class DeserializeGenericUDSServiceServiceResponseData {
     marshaller::ComplexDataTypeDeserializer<marshaller::BEPayloadUint32LengthFieldPolicy, ParentDeserializer>
         deserializer__ResponseData{parent};
     DataArrayType ResponseData{};
-    while (deserializer__ResponseData.HasDataRemaining()) {
-      const auto ret = DeserializeResponseData_byte(&deserializer__ResponseData);
-      deserialization_ok &= ret.second;
-      if (!deserialization_ok) {
-        break;
-      }
-
-      ResponseData.push_back(ret.first);
+    // Elements are primitives: copy them in one go instead of one PopFront per element.
+    const std::size_t ResponseData_bytes{deserializer__ResponseData.GetDataRemaining()};
+    // The length field is set by the peer: reject it before allocating if the message does not contain that much data.
+    deserialization_ok = (ResponseData_bytes <= deserializer__ResponseData.GetRemainingLength()) &&
+                         ((ResponseData_bytes % sizeof(DataArrayType::value_type)) == 0U);
+    if (deserialization_ok) {
+      ResponseData.resize(ResponseData_bytes / sizeof(DataArrayType::value_type));
+      deserialization_ok = deserializer__ResponseData.template PopFrontRange<marshaller::BEPayloadNoLengthFieldPolicy>(
+                               ResponseData.data(), ResponseData.size()) == ResponseData_bytes;
     }
     return std::make_pair(ResponseData, deserialization_ok);
   }
@@ -25,9 +25,10 @@ namespace diag {
 void ArgumentsParser::Usage(const char* progname) {
   ara::log::Logger& logger = ara::log::CreateLogger("Usage", "");
   logger.LogInfo() << "usage: " << progname <<
-      R"( [-h] [-v] [-a <ara::com communication file path>] [-m <meta configuration file path>] [-t <transport protocol configuration file path>]
+      R"( [-h] [-v] [-e] [-a <ara::com communication file path>] [-m <meta configuration file path>] [-t <transport protocol configuration file path>]
          -h                                                   Print this message and exit.
          -v                                                   Specify the verbosity level.
+         -e                                                   Use the epoll based reactor.
          -a <ara::com communication file path>                Specify the location of the ara::com communication file.
          -m <meta configuration file path>                    Specify the location of the meta configuration file.
          -t <transport protocol configuration file path>      Specify the location of the transport protocol configuration file.
@@ -41,7 +42,7 @@ CommandLineArguments ArgumentsParser::ParseArguments(int argc, char* const argv[
   int c;
   ara::log::Logger& logger = ara::log::CreateLogger("Arguments parser", "");
 
-  while ((c = osabstraction::commandlineparser::CommandLineParser(argc, argv, "ha:m:t:v")) != -1) {
+  while ((c = osabstraction::commandlineparser::CommandLineParser(argc, argv, "ha:m:t:ve")) != -1) {
     switch (c) {
       case 'h':
         Usage(argv[0]);
@@ -62,6 +63,9 @@ CommandLineArguments ArgumentsParser::ParseArguments(int argc, char* const argv[
           verbose++;
         }
         break;
+      case 'e':
+        args.use_epoll_reactor = true;
+        break;
       case '?':
       default:
         Usage(argv[0]);
@@ -52,7 +52,7 @@ struct CommandLineArguments {
   /**
    * \brief Ctor.
    */
-  CommandLineArguments() : verbosity_level(ara::log::LogLevel::kWarn) {}
+  CommandLineArguments() : verbosity_level(ara::log::LogLevel::kWarn), use_epoll_reactor(false) {}
   /**
    * \brief The path where the meta configuration file is located.
    */
@@ -69,6 +69,10 @@ struct CommandLineArguments {
    * \brief The verbosity level.
    */
   ara::log::LogLevel verbosity_level;
+  /**
+   * \brief Use the epoll based reactor instead of the select based one.
+   */
+  bool use_epoll_reactor;
 };
 
 /**
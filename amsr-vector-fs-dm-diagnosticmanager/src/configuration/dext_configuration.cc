@@ -284,6 +284,10 @@ DidConfiguration DextConfiguration::ParseDidConfigurationObject(
   // Get Read preconditions.
   if (json_object.HasMember("Read")) {
     did_configuration.read_preconditions.emplace(ParsePreconditions(json_object["Read"].GetObject()));
+    // Get the optional lifetime of cached read values.
+    if (json_object["Read"].GetObject().HasMember("CacheLifetime")) {
+      did_configuration.cache_lifetime = GetUInt32Value(json_object["Read"].GetObject(), "CacheLifetime");
+    }
   }
   // Get Write preconditions.
   if (json_object.HasMember("Write")) {
@@ -414,6 +414,11 @@ struct DidConfiguration {
    */
   vac::memory::optional<Preconditions> write_preconditions;
 
+  /**
+   * \brief Lifetime of a cached read value in milliseconds, 0 if the DID is not cached.
+   */
+  std::uint32_t cache_lifetime{0};
+
   /**
    * \brief Ctor.
    */
@@ -56,7 +56,7 @@ int main(int argc, char* argv[]) {
                         args.verbosity_level, ara::log::LogMode::kConsole, "log");
 
   /* Create the runtime object */
-  amsr::diag::Runtime application;
+  amsr::diag::Runtime application(args.use_epoll_reactor);
 /* Execute the application lifecycle */
 
 #if defined(ENABLE_EXEC_MANAGER_SUPPORT_AUTOSAR) || defined(ENABLE_EXEC_MANAGER_SUPPORT_VECTOR)
@@ -36,6 +36,8 @@
 #include "ara/com/runtime.h"
 #include "ara/log/logging.hpp"
 #include "configuration/diagnostic_configuration.h"
+#include "osabstraction/io/epoll_reactor.h"
+#include "osabstraction/io/reactor.h"
 #include "server/conversation/conversation.h"
 #include "vac/memory/three_phase_allocator.h"
 
@@ -45,7 +47,12 @@ namespace diag {
 /** alias for AllocationPhaseManager */
 using vac::memory::AllocationPhaseManager;
 
-Runtime::Runtime() : exit_requested_(false), timer_manager_(&reactor_) {}
+Runtime::Runtime(bool use_epoll_reactor)
+    : exit_requested_(false),
+      reactor_(use_epoll_reactor
+                   ? std::unique_ptr<osabstraction::io::ReactorInterface>(new osabstraction::io::EpollReactor())
+                   : std::unique_ptr<osabstraction::io::ReactorInterface>(new osabstraction::io::Reactor())),
+      timer_manager_(reactor_.get()) {}
 
 void Runtime::SignalHandlerThread() {
   sigset_t signal_set;
@@ -73,7 +80,7 @@ void Runtime::SignalHandlerThread() {
     }
   }
 
-  reactor_.Unblock();
+  reactor_->Unblock();
 
   ara::log::LogDebug() << "Runtime::" << __func__ << ": signal handler thread stopped";
 }
@@ -107,7 +114,7 @@ void Runtime::Initialize(CommandLineArguments args) {
 
   /* Setup components */
   // Transport protocol manager.
-  uds_transport_protocol_mgr_impl_.Initialize(args.path_to_transport_protocol_configuration_file, &reactor_,
+  uds_transport_protocol_mgr_impl_.Initialize(args.path_to_transport_protocol_configuration_file, reactor_.get(),
                                               &timer_manager_);
 
   // Diagnostic managers.
@@ -135,9 +142,9 @@ void Runtime::Run() {
   while (!exit_requested_) {
     const std::pair<bool, struct timeval> expiry = timer_manager_.GetNextExpiry();
     if (expiry.first) {
-      reactor_.HandleEvents(&expiry.second);
+      reactor_->HandleEvents(&expiry.second);
     } else {
-      reactor_.HandleEvents(nullptr);
+      reactor_->HandleEvents(nullptr);
     }
     timer_manager_.HandleTimerExpiry();
   }
@@ -157,7 +164,7 @@ void Runtime::Shutdown() {
 
   /* do application clean-up in here */
   uds_transport_protocol_mgr_impl_.Shutdown();
-  reactor_.Unblock();
+  reactor_->Unblock();
 
   /* wait till other threads are finished */
   for (std::vector<std::thread>::reference thread : threads_) {
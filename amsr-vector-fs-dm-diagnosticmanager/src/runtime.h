@@ -30,12 +30,13 @@
 #include <atomic>
 #include <chrono>
 #include <csignal>
+#include <memory>
 #include <string>
 #include <thread>
 #include <vector>
 
 #include "arguments_parser.h"
-#include "osabstraction/io/reactor.h"
+#include "osabstraction/io/reactor_interface.h"
 #include "server/diagnostic_server.h"
 #include "udstransport/uds_transport_protocol_manager_impl.h"
 #include "vac/container/static_list.h"
@@ -51,7 +52,11 @@ constexpr uint_least8_t kNumOfThreads = 1; /**< Number of Threads used in Runtim
  */
 class Runtime {
  public:
-  Runtime();
+  /**
+   * \brief Constructor of Runtime.
+   * \param use_epoll_reactor Use the epoll based reactor instead of the select based one.
+   */
+  explicit Runtime(bool use_epoll_reactor = false);
   virtual ~Runtime() = default;
   /**
    * \brief Lifecycle Method for Initialization.
@@ -100,7 +105,7 @@ class Runtime {
   /**
    * \brief A reactor for asynchronous event notification on file descriptors.
    */
-  osabstraction::io::Reactor reactor_;
+  std::unique_ptr<osabstraction::io::ReactorInterface> reactor_;
 
   /**
    * \brief A timer manager for managing timers used by the DoIP.
@@ -78,7 +78,7 @@ Conversation::Conversation(ara::diag::udstransport::UdsTransportProtocolMgr::Glo
       source_address_(source_address),
       conversation_manager_(conversation_manager),
       max_number_of_response_pending_(response_pending_limit),
-      message_handler_(*this) {}
+      message_handler_(*this, conversation_manager.GetMessageExecutor()) {}
 
 ConversationManager& Conversation::GetConversationManager() { return conversation_manager_; }
 
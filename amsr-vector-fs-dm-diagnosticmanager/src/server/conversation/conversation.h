@@ -218,6 +218,11 @@ class Conversation : public service::ServiceProcessingContext,
    */
   proxys::ProxysPool& GetProxysPool() const override;
 
+  /**
+   * \brief Return a callback resuming the message handler.
+   */
+  ResumeCallback GetResumeCallback() const override { return message_handler_.GetResumeCallback(); }
+
   /**
    * \returns the current conversation state.
    */
@@ -46,7 +46,8 @@ ConversationManager::ConversationManager(
       uds_transport_protocol_mgr_(uds_transport_protocol_mgr),
       uds_message_provider_(kNumberUDSBuffer, dext_config.uds_message_length),
       diagnostic_server_(diagnostic_server),
-      access_notification_manager_(kMaxNumberOfNotificationManagerSubscribers) {
+      access_notification_manager_(kMaxNumberOfNotificationManagerSubscribers),
+      message_executor_(std::min<std::size_t>(dext_config.number_conversations, kMaxNumberOfMessageExecutorThreads)) {
   conversations_list_.reserve(dext_config.number_conversations);
 }
 
@@ -115,6 +116,7 @@ void ConversationManager::Shutdown() {
   for (vac::container::StaticList<Conversation>::reference conversation : conversations_list_) {
     conversation.Shutdown();
   }
+  message_executor_.Shutdown();
 }
 }  // namespace conversation
 }  // namespace server
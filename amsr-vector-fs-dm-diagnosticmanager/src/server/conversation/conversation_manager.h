@@ -32,6 +32,7 @@
 #include "configuration/dext_configuration.h"
 #include "server/conversation/access/access_state_notification_manager.h"
 #include "server/conversation/conversation.h"
+#include "server/conversation/message_executor.h"
 #include "server/conversation/state_manager.h"
 #include "server/conversation/uds_message_provider.h"
 #include "udstransport/protocol_manager_with_conversation_manager_handling.h"
@@ -119,9 +120,14 @@ class ConversationManager {
     return access_notification_manager_;
   }
 
+  /**
+   * \brief Returns the executor processing the messages of all conversations.
+   */
+  MessageExecutor& GetMessageExecutor() { return message_executor_; }
+
   /**
    * \brief Method to be called when application is terminating.
-   * Currently calling shutdown method of every message handlers.
+   * Currently calling shutdown method of every message handlers and of the message executor.
    */
   void Shutdown();
 
@@ -170,6 +176,11 @@ class ConversationManager {
 
   access::AccessStateNotificationManager access_notification_manager_;
 
+  /**
+   * \brief Worker threads processing the messages of all conversations.
+   */
+  MessageExecutor message_executor_;
+
   /**> \brief Friend declaration for testing. */
   FRIEND_TEST(ConversationManagerTestFixture, CheckInitialStateOfConversationManager);
 };
@@ -0,0 +1,119 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  message_executor.cc
+ *        \brief  Fixed pool of worker threads processing the UDS messages of all conversations.
+ *
+ *      \details  -
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "server/conversation/message_executor.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "ara/log/logging.hpp"
+
+namespace amsr {
+namespace diag {
+namespace server {
+namespace conversation {
+
+MessageExecutor::MessageExecutor(std::size_t number_of_threads) {
+  const std::size_t count = std::max<std::size_t>(number_of_threads, 1);
+  workers_.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    workers_.emplace_back(&MessageExecutor::Run, this);
+  }
+}
+
+MessageExecutor::~MessageExecutor() { Shutdown(); }
+
+void MessageExecutor::Schedule(RunnablePtr runnable) {
+  {
+    std::lock_guard<std::mutex> lk(mutex_);
+    if (exit_requested_) {
+      return;
+    }
+    ready_.push_back(std::move(runnable));
+  }
+  condition_variable_.notify_one();
+}
+
+void MessageExecutor::ScheduleAfter(RunnablePtr runnable, std::chrono::milliseconds delay) {
+  {
+    std::lock_guard<std::mutex> lk(mutex_);
+    if (exit_requested_) {
+      return;
+    }
+    delayed_.push(DelayedRunnable{Clock::now() + delay, std::move(runnable)});
+  }
+  // A worker may wait for a later due time, wake it up to recompute its timeout.
+  condition_variable_.notify_one();
+}
+
+void MessageExecutor::Shutdown() {
+  {
+    std::lock_guard<std::mutex> lk(mutex_);
+    exit_requested_ = true;
+    ready_.clear();
+    while (!delayed_.empty()) {
+      delayed_.pop();
+    }
+  }
+  condition_variable_.notify_all();
+  for (std::thread& worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+}
+
+void MessageExecutor::Run() {
+  std::unique_lock<std::mutex> lk(mutex_);
+  while (!exit_requested_) {
+    // move all delayed items which are due to the ready queue
+    const Clock::time_point now = Clock::now();
+    while (!delayed_.empty() && (delayed_.top().due_ <= now)) {
+      ready_.push_back(delayed_.top().runnable_);
+      delayed_.pop();
+    }
+
+    if (!ready_.empty()) {
+      RunnablePtr runnable = std::move(ready_.front());
+      ready_.pop_front();
+      lk.unlock();
+      try {
+        runnable->Run();
+      } catch (const std::exception& ex) {
+        ara::log::LogError() << "MessageExecutor::" << __func__ << " : Exception in work item: " << ex.what();
+      }
+      // release the work item before taking the lock again
+      runnable.reset();
+      lk.lock();
+    } else if (!delayed_.empty()) {
+      condition_variable_.wait_until(lk, delayed_.top().due_);
+    } else {
+      condition_variable_.wait(lk);
+    }
+  }
+}
+
+}  // namespace conversation
+}  // namespace server
+}  // namespace diag
+}  // namespace amsr
@@ -0,0 +1,172 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  message_executor.h
+ *        \brief  Fixed pool of worker threads processing the UDS messages of all conversations.
+ *
+ *      \details  A conversation does not own a thread. Its MessageHandler is queued to the executor whenever there is
+ *                something to do: a new UDS message or the completion of an asynchronous operation. A worker runs
+ *                one processing step and returns to the queue.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SRC_SERVER_CONVERSATION_MESSAGE_EXECUTOR_H_
+#define SRC_SERVER_CONVERSATION_MESSAGE_EXECUTOR_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace amsr {
+namespace diag {
+namespace server {
+namespace conversation {
+
+/**
+ * \brief Maximum number of worker threads of the MessageExecutor.
+ */
+constexpr std::size_t kMaxNumberOfMessageExecutorThreads = 4;
+
+/**
+ * \brief Executor with a fixed number of worker threads.
+ */
+class MessageExecutor {
+ public:
+  /**
+   * \brief Clock used for delayed execution.
+   */
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * \brief Work item of the executor.
+   */
+  class Runnable {
+   public:
+    /**
+     * \brief Destructor.
+     */
+    virtual ~Runnable() = default;
+
+    /**
+     * \brief Called by a worker thread.
+     */
+    virtual void Run() = 0;
+  };
+
+  /**
+   * \brief Shared pointer to a work item. The executor keeps the item alive until it has been run.
+   */
+  using RunnablePtr = std::shared_ptr<Runnable>;
+
+  /**
+   * \brief Constructor. Starts the worker threads.
+   * \param number_of_threads number of worker threads, at least one thread is started.
+   */
+  explicit MessageExecutor(std::size_t number_of_threads);
+
+  /**
+   * \brief Destructor. Joins the worker threads if Shutdown() has not been called.
+   */
+  virtual ~MessageExecutor();
+
+  MessageExecutor(const MessageExecutor&) = delete;
+  MessageExecutor& operator=(const MessageExecutor&) = delete;
+
+  /**
+   * \brief Queues a work item to be run as soon as a worker is free.
+   * \param runnable The work item.
+   */
+  void Schedule(RunnablePtr runnable);
+
+  /**
+   * \brief Queues a work item to be run after a delay.
+   * \param runnable The work item.
+   * \param delay The minimum time until the work item is run.
+   */
+  void ScheduleAfter(RunnablePtr runnable, std::chrono::milliseconds delay);
+
+  /**
+   * \brief Stops and joins all worker threads. Queued work items are dropped.
+   */
+  void Shutdown();
+
+  /**
+   * \brief Returns the number of worker threads.
+   */
+  std::size_t GetNumberOfThreads() const { return workers_.size(); }
+
+ private:
+  /**
+   * \brief Work item queued for delayed execution.
+   */
+  struct DelayedRunnable {
+    Clock::time_point due_;  ///< Time at which the item is moved to the ready queue.
+    RunnablePtr runnable_;   ///< The work item.
+
+    /**
+     * \brief Orders the delayed items so that std::priority_queue returns the earliest one first.
+     */
+    bool operator<(const DelayedRunnable& other) const { return due_ > other.due_; }
+  };
+
+  /**
+   * \brief Run method of the worker threads.
+   */
+  void Run();
+
+  /**
+   * \brief Work items ready to run.
+   */
+  std::deque<RunnablePtr> ready_;
+
+  /**
+   * \brief Work items waiting for their delay to elapse.
+   */
+  std::priority_queue<DelayedRunnable> delayed_;
+
+  /**
+   * \brief Set when the workers shall terminate.
+   */
+  bool exit_requested_{false};
+
+  /**
+   * \brief Mutex protecting both queues and exit_requested_.
+   */
+  std::mutex mutex_;
+
+  /**
+   * \brief Signals new work items to the workers.
+   */
+  std::condition_variable condition_variable_;
+
+  /**
+   * \brief The worker threads.
+   */
+  std::vector<std::thread> workers_;
+};
+
+}  // namespace conversation
+}  // namespace server
+}  // namespace diag
+}  // namespace amsr
+
+#endif  // SRC_SERVER_CONVERSATION_MESSAGE_EXECUTOR_H_
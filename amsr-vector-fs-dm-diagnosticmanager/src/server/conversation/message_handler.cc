@@ -23,6 +23,8 @@
  *********************************************************************************************************************/
 #include "server/conversation/message_handler.h"
 #include <chrono>
+#include <condition_variable>
+#include <thread>
 
 #include "ara/log/logging.hpp"
 #include "server/conversation/conversation.h"
@@ -36,100 +38,252 @@ namespace diag {
 namespace server {
 namespace conversation {
 
-MessageHandler::MessageHandler(Conversation& conversation)
-    : conversation_(conversation), uds_message_(nullptr), exit_requested_(false), thread_(&MessageHandler::Run, this) {}
+/**
+ * \brief Interval after which a pending service processor is called again if it has not resumed the handler before.
+ * Covers service processors waiting for operations which do not signal their completion.
+ */
+constexpr std::chrono::milliseconds kFallbackPollingInterval(10);
 
-void MessageHandler::HandleMessage(ara::diag::udstransport::UdsMessage::Ptr uds_message) {
-  ara::log::LogDebug() << "MessageHandler::" << __func__;
-  std::unique_lock<std::mutex> lk(mutex_);
-  ara::log::LogDebug() << "MessageHandler::" << __func__ << " : After lock.";
-  uds_message_ = std::move(uds_message);
-  condition_variable_.notify_one();
-}
+/**
+ * \brief Work item of the executor, shared with the resume callbacks.
+ *
+ * Guarantees that at most one processing step of a message handler runs at a time and that a resume request arriving
+ * while a step runs is not lost: the step is repeated right afterwards.
+ */
+class MessageHandler::Activation : public MessageExecutor::Runnable,
+                                   public std::enable_shared_from_this<MessageHandler::Activation> {
+ public:
+  /**
+   * \brief Constructor.
+   * \param handler the message handler to run
+   * \param executor the executor to queue to
+   */
+  Activation(MessageHandler& handler, MessageExecutor& executor) : handler_(&handler), executor_(executor) {}
 
-void MessageHandler::Shutdown() {
-  exit_requested_ = true;
-  {
+  /**
+   * \brief Requests a processing step as soon as possible.
+   */
+  void Resume() {
     std::lock_guard<std::mutex> lk(mutex_);
-    condition_variable_.notify_one();
-  }
-  if (thread_.joinable()) {
-    thread_.join();
-  } else {
-    ara::log::LogError() << "MessageHandler::Shutdown: Handler thread is not joinable!";
+    if (handler_ == nullptr) {
+      return;
+    }
+    if (running_) {
+      rerun_ = true;
+    } else if (!queued_) {
+      queued_ = true;
+      executor_.Schedule(shared_from_this());
+    }
   }
-}
 
-void MessageHandler::Run() {
-  ara::log::LogDebug() << "MessageHandler::" << __func__;
-  // process incoming requests until exit is requested
-  while (!exit_requested_) {
-    // handle exceptions (e. g. from ara::com) gracefully
+  /**
+   * \brief Runs a processing step. Called by a worker of the executor.
+   */
+  void Run() override {
+    std::unique_lock<std::mutex> lk(mutex_);
+    MessageHandler* handler = handler_;
+    if (handler == nullptr) {
+      return;
+    }
+    if (queued_) {
+      queued_ = false;
+    } else if (running_ || (MessageExecutor::Clock::now() < poll_due_)) {
+      // fallback polling entry which has been superseded by a resume request
+      return;
+    }
+    if (running_) {
+      rerun_ = true;
+      return;
+    }
+    running_ = true;
+    rerun_ = false;
+    running_thread_ = std::this_thread::get_id();
+    poll_due_ = MessageExecutor::Clock::time_point::max();
+    lk.unlock();
+
+    bool pending{false};
     try {
-      std::unique_lock<std::mutex> lk(mutex_);
-      // wait for the next message
-      condition_variable_.wait(lk, [this]() { return (this->exit_requested_ || (this->uds_message_ != nullptr)); });
-      if (!exit_requested_) {
-        ara::log::LogDebug() << "MessageHandler::" << __func__ << " : inside conditioning on exist_requested.";
-        // Get the service dispatcher.
-        service::ServiceDispatcher& service_dispatcher =
-            conversation_.GetConversationManager().GetDiagnosticServer().GetServiceDispatcher();
-
-        // Get the pair of ServiceProcessor and NRC
-        service::ServiceDispatcher::PairProcessorNRC pair_processor_nrc =
-            service_dispatcher.FindServiceProcessor(std::move(uds_message_), conversation_);
-
-        // unlock the mutex, because the UDS message (uds_message_) is now owned by the service processor
-        lk.unlock();
-
-        // check if the message can be proccessed
-        ara::diag::udstransport::UdsNegativeResponseCode nrc_code = pair_processor_nrc.second;
-        if (nrc_code != ara::diag::udstransport::UdsNegativeResponseCode::kPositiveResponse) {
-          // stop further processing (no matching ServiceProcessor instance found)
-          conversation_.FinishProcessing(nrc_code);
-        } else {
-          assert(pair_processor_nrc.first);
-          // process the positive response
-          ProcessMessage(std::move(pair_processor_nrc.first));
-        }
+      pending = handler->ProcessStep();
+    } catch (...) {
+      // The step must end in any case, Detach() would wait forever otherwise.
+      ara::log::LogError() << "MessageHandler::Activation::" << __func__ << ": processing step aborted by an exception";
+    }
+
+    lk.lock();
+    running_ = false;
+    running_thread_ = std::thread::id();
+    if (handler_ != nullptr) {
+      if (rerun_) {
+        rerun_ = false;
+        queued_ = true;
+        executor_.Schedule(shared_from_this());
+      } else if (pending) {
+        poll_due_ = MessageExecutor::Clock::now() + kFallbackPollingInterval;
+        executor_.ScheduleAfter(shared_from_this(), kFallbackPollingInterval);
       }
-    } catch (const std::exception& ex) {
-      // exception while handling a message (log + call FinishProcessing)
-      ara::log::LogError() << "MessageHandler::Run: Exception occurred while handling UDS message: " << ex.what();
+    }
+    idle_.notify_all();
+  }
 
-      // call finish processing to signal the problem to the tester (kGeneralReject: 0x10  -> ara::com not running)
-      // Alternatives could be busyRepeatRequest (0x21), conditionsNotCorrect (0x22) or a code from the manufacturer
-      // specific range (e. g. reservedForSpecificConditionsNotCorrect range; see Table A.1 in ISO 14229-1 for details)
-      conversation_.FinishProcessing(ara::diag::udstransport::UdsNegativeResponseCode::kGeneralReject);
+  /**
+   * \brief Waits for a running processing step. No further step is run afterwards.
+   */
+  void Detach() {
+    std::unique_lock<std::mutex> lk(mutex_);
+    handler_ = nullptr;
+    if (running_thread_ != std::this_thread::get_id()) {
+      idle_.wait(lk, [this]() { return !running_; });
     }
   }
-}
 
-void MessageHandler::ProcessMessage(amsr::diag::server::service::processor::ServiceProcessor::Ptr service_processor) {
-  // check if the provided ServiceProcessor is valid
-  if (service_processor == nullptr) {
-    throw std::invalid_argument("MessageHandler::ProcessMessage: Provided service_processor is nullptr!");
+ private:
+  /**
+   * \brief mutex protecting all members below.
+   */
+  std::mutex mutex_;
+
+  /**
+   * \brief Signals the end of a processing step to Detach().
+   */
+  std::condition_variable idle_;
+
+  /**
+   * \brief The message handler, nullptr once detached.
+   */
+  MessageHandler* handler_;
+
+  /**
+   * \brief The executor running the processing steps.
+   */
+  MessageExecutor& executor_;
+
+  /**
+   * \brief Set while a resume request is in the ready queue of the executor.
+   */
+  bool queued_{false};
+
+  /**
+   * \brief Set while a processing step runs.
+   */
+  bool running_{false};
+
+  /**
+   * \brief Set if a resume request arrived while a processing step was running.
+   */
+  bool rerun_{false};
+
+  /**
+   * \brief Thread running the current processing step.
+   */
+  std::thread::id running_thread_;
+
+  /**
+   * \brief Due time of the fallback polling entry which is still valid.
+   */
+  MessageExecutor::Clock::time_point poll_due_{MessageExecutor::Clock::time_point::max()};
+};
+
+MessageHandler::MessageHandler(Conversation& conversation, MessageExecutor& executor)
+    : conversation_(conversation),
+      uds_message_(nullptr),
+      service_processor_(nullptr),
+      activation_(std::make_shared<Activation>(*this, executor)) {}
+
+void MessageHandler::HandleMessage(ara::diag::udstransport::UdsMessage::Ptr uds_message) {
+  ara::log::LogDebug() << "MessageHandler::" << __func__;
+  {
+    std::lock_guard<std::mutex> lk(mutex_);
+    uds_message_ = std::move(uds_message);
   }
+  activation_->Resume();
+}
 
-  // Call HandleMessage of processor until kDone Status is received.
-  std::chrono::milliseconds sleep_duration(10);
-  while (!exit_requested_ && (service_processor->HandleMessage() != service::processor::ProcessingStatus::kDone)) {
-    std::this_thread::sleep_for(sleep_duration);
+void MessageHandler::Resume() { activation_->Resume(); }
+
+std::function<void()> MessageHandler::GetResumeCallback() const {
+  std::weak_ptr<Activation> activation = activation_;
+  return [activation]() {
+    std::shared_ptr<Activation> active = activation.lock();
+    if (active) {
+      active->Resume();
+    }
+  };
+}
+
+void MessageHandler::Shutdown() {
+  shutdown_called_ = true;
+  activation_->Detach();
+  // no processing step runs anymore, drop the message in progress
+  service_processor_.reset();
+  std::lock_guard<std::mutex> lk(mutex_);
+  uds_message_.reset();
+}
+
+bool MessageHandler::ProcessStep() {
+  // handle exceptions (e. g. from ara::com) gracefully
+  try {
+    if (service_processor_ == nullptr) {
+      ara::diag::udstransport::UdsMessage::Ptr uds_message;
+      {
+        std::lock_guard<std::mutex> lk(mutex_);
+        uds_message = std::move(uds_message_);
+      }
+      if (uds_message == nullptr) {
+        return false;
+      }
+      ara::log::LogDebug() << "MessageHandler::" << __func__ << " : dispatching new message.";
+      // Get the service dispatcher.
+      service::ServiceDispatcher& service_dispatcher =
+          conversation_.GetConversationManager().GetDiagnosticServer().GetServiceDispatcher();
+
+      // Get the pair of ServiceProcessor and NRC
+      service::ServiceDispatcher::PairProcessorNRC pair_processor_nrc =
+          service_dispatcher.FindServiceProcessor(std::move(uds_message), conversation_);
+
+      // check if the message can be proccessed
+      ara::diag::udstransport::UdsNegativeResponseCode nrc_code = pair_processor_nrc.second;
+      if (nrc_code != ara::diag::udstransport::UdsNegativeResponseCode::kPositiveResponse) {
+        // stop further processing (no matching ServiceProcessor instance found)
+        conversation_.FinishProcessing(nrc_code);
+        return false;
+      }
+      if (pair_processor_nrc.first == nullptr) {
+        throw std::invalid_argument("MessageHandler::ProcessStep: Provided service_processor is nullptr!");
+      }
+      service_processor_ = std::move(pair_processor_nrc.first);
+    }
+
+    // Call HandleMessage of processor once, the next call is triggered by Resume() or the fallback polling.
+    if (service_processor_->HandleMessage() == service::processor::ProcessingStatus::kDone) {
+      service_processor_.reset();
+      return false;
+    }
+    return true;
+  } catch (const std::exception& ex) {
+    // exception while handling a message (log + call FinishProcessing)
+    ara::log::LogError() << "MessageHandler::" << __func__
+                         << ": Exception occurred while handling UDS message: " << ex.what();
+    service_processor_.reset();
+
+    // call finish processing to signal the problem to the tester (kGeneralReject: 0x10  -> ara::com not running)
+    // Alternatives could be busyRepeatRequest (0x21), conditionsNotCorrect (0x22) or a code from the manufacturer
+    // specific range (e. g. reservedForSpecificConditionsNotCorrect range; see Table A.1 in ISO 14229-1 for details)
+    try {
+      conversation_.FinishProcessing(ara::diag::udstransport::UdsNegativeResponseCode::kGeneralReject);
+    } catch (const std::exception& finish_ex) {
+      // e. g. the processor already finished the conversation before throwing
+      ara::log::LogError() << "MessageHandler::" << __func__
+                           << ": Failed to reject the UDS message: " << finish_ex.what();
+    }
+    return false;
   }
 }
 
 MessageHandler::~MessageHandler() {
-  // Call thread_.join() if Shutdown has not been called.
-  exit_requested_ = true;
-  {
-    std::lock_guard<std::mutex> lk(mutex_);
-    condition_variable_.notify_one();
-  }
-  if (thread_.joinable()) {
-    ara::log::LogError()
-        << "MessageHandler::~MessageHandler : Shutdown has not been previously called. Joining thread ...";
-    thread_.join();
+  if (!shutdown_called_) {
+    ara::log::LogError() << "MessageHandler::~MessageHandler : Shutdown has not been previously called. Detaching ...";
   }
+  activation_->Detach();
 }
 
 }  // namespace conversation
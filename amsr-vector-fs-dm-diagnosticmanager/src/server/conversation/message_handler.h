@@ -24,13 +24,12 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
-#include <atomic>
-#include <condition_variable>
+#include <functional>
 #include <memory>
 #include <mutex>
-#include <thread>
 #include <utility>
 
+#include "server/conversation/message_executor.h"
 #include "udstransport/uds_message.h"
 #include "udstransport/uds_negative_response_code.h"
 #include "vac/memory/smart_base_type_object_pool.h"
@@ -54,45 +53,63 @@ class Conversation;  //< forward declaration (required to solve circular depende
 
 /**
  * \brief Implementation of Message Handler class.
+ *
+ * The message handler does not own a thread. Each time there is something to do it is queued to the MessageExecutor,
+ * which calls HandleMessage() of the current service processor once. When the processor returns kNotDone, the next
+ * call happens when the processor resumes the handler on completion of its asynchronous operation, at the latest after
+ * a fallback polling interval.
  */
 class MessageHandler {
  public:
   /**
    * \brief Constructor.
+   * \param conversation conversation owning this message handler
+   * \param executor executor running the processing steps
    */
-  explicit MessageHandler(Conversation& conversation);
+  MessageHandler(Conversation& conversation, MessageExecutor& executor);
 
   /**
    * \brief Destructor.
    */
   virtual ~MessageHandler();
 
+  MessageHandler(const MessageHandler&) = delete;
+  MessageHandler& operator=(const MessageHandler&) = delete;
+
   /**
-   * \brief Inform the thread that a message is ready to be processed.
+   * \brief Queue a message to be processed.
    */
   VIRTUALMOCK void HandleMessage(ara::diag::udstransport::UdsMessage::Ptr uds_message);
 
+  /**
+   * \brief Continue the processing of the current message as soon as possible.
+   * May be called from any thread.
+   */
+  void Resume();
+
+  /**
+   * \brief Return a callback calling Resume(), which does nothing once the message handler is shut down or destroyed.
+   */
+  std::function<void()> GetResumeCallback() const;
+
   /**
    * \brief Shutdown to be called when application is terminating.
-   * Running thread is joined.
+   * Waits for a running processing step, no further step is started afterwards.
    */
   void Shutdown();
 
  private:
   /**
-   * \brief Run method for thread.
+   * \brief Work item of the executor, shared with the resume callbacks.
    */
-  void Run();
-
-  void ProcessMessage(
-      vac::memory::SmartBaseTypeObjectPoolUniquePtr<amsr::diag::server::service::processor::ServiceProcessor>
-          service_processor);
+  class Activation;
 
   /**
-   * \brief Processes the message dependent to the provided input.
-   * \param service_processor: A unique_ptr with the service processor
+   * \brief Runs one processing step.
+   * Dispatches a newly received message to its service processor or continues the current service processor.
+   * \return true if the current service processor is still pending, false otherwise.
    */
-  // void HandleMessage(amsr::diag::server::service::processor::ServiceProcessor::Ptr service_processor);
+  bool ProcessStep();
 
   /**
    * \brief Reference to conversation owning this message handler.
@@ -100,29 +117,31 @@ class MessageHandler {
   Conversation& conversation_;
 
   /**
-   * \brief uds message to be processed.
+   * \brief mutex protecting uds_message_
    */
-  ara::diag::udstransport::UdsMessage::Ptr uds_message_;
+  std::mutex mutex_;
 
   /**
-   * \brief atomic boolean for shutdown
+   * \brief uds message to be processed.
    */
-  std::atomic_bool exit_requested_;
+  ara::diag::udstransport::UdsMessage::Ptr uds_message_;
 
   /**
-   * \brief mutex for the condition variable
+   * \brief service processor of the message currently processed.
+   * Only accessed by the processing step, which never runs concurrently.
    */
-  std::mutex mutex_;
+  vac::memory::SmartBaseTypeObjectPoolUniquePtr<amsr::diag::server::service::processor::ServiceProcessor>
+      service_processor_;
 
   /**
-   * \brief condition variable
+   * \brief Work item queued to the executor.
    */
-  std::condition_variable condition_variable_;
+  std::shared_ptr<Activation> activation_;
 
   /**
-   * \brief thread to be executed.
+   * \brief Set by Shutdown().
    */
-  std::thread thread_;
+  bool shutdown_called_{false};
 };
 
 }  // namespace conversation
@@ -23,11 +23,17 @@
  *********************************************************************************************************************/
 #include "did_info.h"
 
+#include <chrono>
+#include <numeric>
+
 namespace amsr {
 namespace diag {
 namespace server {
 namespace data {
-DidInfo::DidInfo(const configuration::DidConfiguration& did_conf) : did_(did_conf.id) {
+
+DidInfo::DidInfo(const configuration::DidConfiguration& did_conf)
+    : did_(did_conf.id),
+      value_cache_(std::chrono::milliseconds(did_conf.cache_lifetime)) {
   // Instantiate operations if available.
   if (did_conf.read_preconditions.has_value()) {
     read_operation_.emplace(did_conf.read_preconditions);
@@ -43,6 +49,7 @@ DidInfo::DidInfo(const configuration::DidConfiguration& did_conf) : did_(did_con
   for (const auto& data_elem_config : did_conf.did_data_elements) {
     data_element_info_list_.emplace_back(data_elem_config);
   }
+  value_cache_.SetValueSize(GetMaxSize());
 }
 
 ara::diag::udstransport::UdsNegativeResponseCode DidInfo::CheckConditions(
@@ -97,13 +104,13 @@ ara::diag::udstransport::UdsNegativeResponseCode DidInfo::CheckConditionsFor(
 
 std::size_t DidInfo::GetMaxSize() const {
   return std::accumulate(
-      data_element_info_list_.begin(), data_element_info_list_.end(), 0,
+      data_element_info_list_.begin(), data_element_info_list_.end(), std::size_t{0},
       [](std::size_t size, DataElementInfoList::const_reference data_elem) { return size + data_elem.GetMaxSize(); });
 }
 
 std::size_t DidInfo::GetMinSize() const {
   return std::accumulate(
-      data_element_info_list_.begin(), data_element_info_list_.end(), 0,
+      data_element_info_list_.begin(), data_element_info_list_.end(), std::size_t{0},
       [](std::size_t size, DataElementInfoList::const_reference data_elem) { return size + data_elem.GetMinSize(); });
 }
 
@@ -27,6 +27,7 @@
 #include "configuration/dext_configuration.h"
 #include "did_data_element_info.h"
 #include "did_operation.h"
+#include "did_value_cache.h"
 #include "server/conversation/access/access_state.h"
 #include "server/service/service_processing_context.h"
 #include "udstransport/uds_negative_response_code.h"
@@ -112,6 +113,11 @@ class DidInfo {
    */
   const DataElementInfoList& GetDataElementInfoList() const { return data_element_info_list_; }
 
+  /**
+   * \brief Get the cache of read values. The cache is disabled if no CacheLifetime is configured.
+   */
+  DidValueCache& GetValueCache() const { return value_cache_; }
+
  private:
   /**
    * \brief Return the did operation associated to the operation type.
@@ -138,6 +144,11 @@ class DidInfo {
    */
   DataElementInfoList data_element_info_list_;
 
+  /**
+   * \brief Cache of read values, reading does not change the DID configuration.
+   */
+  mutable DidValueCache value_cache_;
+
  private:
   FRIEND_TEST(DidInfoTestFixture, ConstructOnlyReadOperation);
   FRIEND_TEST(DidInfoTestFixture, ConstructOnlyWriteOperation);
@@ -34,11 +34,31 @@ namespace server {
 namespace data {
 
 DidManager::DidManager(const configuration::DidsTableConfiguration& dids_table_conf) {
-  // Initialize the did_info_map_
-  did_info_map_.reserve(dids_table_conf.dids.size());
+  // Count the index pages first, they are referenced by did_index_ and the vector must not reallocate afterwards.
+  std::array<bool, kNumberOfDidIndexPages> page_used;
+  page_used.fill(false);
   for (const auto& did_config : dids_table_conf.dids) {
-    did_info_map_.emplace(std::piecewise_construct, std::forward_as_tuple(did_config.id),
-                          std::forward_as_tuple(did_config));
+    page_used[did_config.id >> kDidIndexPageBits] = true;
+  }
+  did_index_pages_.reserve(static_cast<std::size_t>(std::count(page_used.begin(), page_used.end(), true)));
+  did_index_.fill(nullptr);
+
+  // Initialize the DidInfo list and the index
+  did_infos_.reserve(dids_table_conf.dids.size());
+  for (const auto& did_config : dids_table_conf.dids) {
+    DidIndexPage*& page = did_index_[did_config.id >> kDidIndexPageBits];
+    if (page == nullptr) {
+      DidIndexPage empty_page;
+      empty_page.fill(nullptr);
+      did_index_pages_.push_back(empty_page);
+      page = &did_index_pages_.back();
+    }
+    const DidInfo*& entry = (*page)[did_config.id & kDidIndexPageMask];
+    // The first configuration of a duplicated did is used.
+    if (entry == nullptr) {
+      did_infos_.emplace_back(did_config);
+      entry = &did_infos_.back();
+    }
   }
 }
 
@@ -70,14 +90,14 @@ const DidInfo* DidManager::GetDidInfoIfSupported(const DidInfo::Did did,
                                                  service::ServiceProcessingContext& processing_context,
                                                  data::DidOperation::Type operation) {
   // Get the DidInfo associated to the did.
-  DidInfoMap::iterator did_info_it = did_info_map_.find(did);
-  if (did_info_it == did_info_map_.end()) {
+  const DidInfo* did_info_ptr = FindDidInfo(did);
+  if (did_info_ptr == nullptr) {
     ara::log::LogDebug() << "DidManager::" << __func__ << ": Did not found.";
     return nullptr;
   }
 
   // Check if write is supported in active session.
-  const DidInfo& did_info = did_info_it->second;
+  const DidInfo& did_info = *did_info_ptr;
   ara::diag::udstransport::UdsNegativeResponseCode nrc =
       did_info.CheckConditionsFor(conversation::access::AccessCategory::kSession, processing_context, operation);
   if (nrc != ara::diag::udstransport::UdsNegativeResponseCode::kPositiveResponse) {
@@ -24,9 +24,10 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <array>
 #include <functional>
-#include <map>
 #include <utility>
+#include <vector>
 
 #include "configuration/dext_configuration.h"
 #include "did_info.h"
@@ -34,7 +35,7 @@
 #include "operationhandler/write_did_operation_handler.h"
 #include "server/data/did_operation.h"
 #include "server/service/service_processing_context.h"
-#include "vac/container/static_map.h"
+#include "vac/container/static_list.h"
 #include "vac/memory/optional.h"
 #include "vac/memory/three_phase_allocator.h"
 
@@ -91,14 +92,59 @@ class DidManager {
                                        data::DidOperation::Type operation);
 
   /**
-   * \brief Type definition for map associating a did with DidInfo.
+   * \brief Returns the DidInfo of a did.
+   * \param did the data identifier
+   * \return pointer to the DidInfo, nullptr if the did is not configured.
+   */
+  const DidInfo* FindDidInfo(const DidInfo::Did did) const {
+    const DidIndexPage* page = did_index_[did >> kDidIndexPageBits];
+    return (page == nullptr) ? nullptr : (*page)[did & kDidIndexPageMask];
+  }
+
+  /**
+   * \brief Number of low-order did bits selecting the entry of an index page.
+   */
+  static constexpr std::size_t kDidIndexPageBits = 8;
+
+  /**
+   * \brief Mask of the low-order did bits selecting the entry of an index page.
+   */
+  static constexpr DidInfo::Did kDidIndexPageMask = (1U << kDidIndexPageBits) - 1U;
+
+  /**
+   * \brief Number of dids covered by one index page.
+   */
+  static constexpr std::size_t kDidIndexPageSize = 1U << kDidIndexPageBits;
+
+  /**
+   * \brief Number of index pages covering the complete did range.
+   */
+  static constexpr std::size_t kNumberOfDidIndexPages = 1U << ((8U * sizeof(DidInfo::Did)) - kDidIndexPageBits);
+
+  /**
+   * \brief Index page associating the dids with the same high byte with their DidInfo, nullptr for unknown dids.
+   */
+  using DidIndexPage = std::array<const DidInfo*, kDidIndexPageSize>;
+
+  /**
+   * \brief Type definition for the list of DidInfo.
+   */
+  using DidInfoList = vac::container::StaticList<DidInfo, vac::memory::ThreePhaseAllocator<DidInfo>>;
+
+  /**
+   * \brief The DidInfo of all configured dids.
+   */
+  DidInfoList did_infos_;
+
+  /**
+   * \brief Index pages of the high bytes used by configured dids.
    */
-  using DidInfoMap = vac::container::StaticMap<DidInfo::Did, DidInfo>;
+  std::vector<DidIndexPage, vac::memory::ThreePhaseAllocator<DidIndexPage>> did_index_pages_;
 
   /**
-   * \brief Map associating a did with DidInfo.
+   * \brief Direct index indexed by the high byte of a did, nullptr if no did with that high byte is configured.
    */
-  DidInfoMap did_info_map_;
+  std::array<DidIndexPage*, kNumberOfDidIndexPages> did_index_;
 };
 
 }  // namespace data
@@ -0,0 +1,83 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  did_value_cache.cc
+ *        \brief  Time-bounded cache for the last value read of a DID.
+ *
+ *      \details  -
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "did_value_cache.h"
+
+#include <algorithm>
+
+namespace amsr {
+namespace diag {
+namespace server {
+namespace data {
+
+void DidValueCache::SetValueSize(std::size_t value_size) {
+  if (IsEnabled()) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    value_.resize(value_size);
+    valid_ = false;
+  }
+}
+
+bool DidValueCache::TryRead(vac::container::array_view<std::uint8_t> out_buffer) const {
+  if (!IsEnabled()) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lk(mutex_);
+  if (!valid_ || (out_buffer.size() != value_.size()) || (Clock::now() >= expiry_)) {
+    return false;
+  }
+  std::copy(value_.begin(), value_.end(), out_buffer.begin());
+  return true;
+}
+
+DidValueCache::Generation DidValueCache::BeginRead() const {
+  std::lock_guard<std::mutex> lk(mutex_);
+  return generation_;
+}
+
+void DidValueCache::Store(vac::container::const_array_view<std::uint8_t> value, Generation generation) {
+  if (!IsEnabled()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lk(mutex_);
+  if ((generation != generation_) || (value.size() != value_.size())) {
+    return;
+  }
+  std::copy(value.begin(), value.end(), value_.begin());
+  expiry_ = Clock::now() + lifetime_;
+  valid_ = true;
+}
+
+void DidValueCache::Invalidate() {
+  if (!IsEnabled()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lk(mutex_);
+  valid_ = false;
+  ++generation_;
+}
+
+}  // namespace data
+}  // namespace server
+}  // namespace diag
+}  // namespace amsr
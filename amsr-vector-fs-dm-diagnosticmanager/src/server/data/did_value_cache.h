@@ -0,0 +1,142 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  did_value_cache.h
+ *        \brief  Time-bounded cache for the last value read of a DID.
+ *
+ *      \details  A DID configured with a CacheLifetime answers read requests from the cache until the lifetime of the
+ *                cached value has elapsed, so repeated reads do not reach the diagnostic application. Writing the DID
+ *                invalidates the cache.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SRC_SERVER_DATA_DID_VALUE_CACHE_H_
+#define SRC_SERVER_DATA_DID_VALUE_CACHE_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "vac/container/array_view.h"
+
+namespace amsr {
+namespace diag {
+namespace server {
+namespace data {
+
+/**
+ * \brief Cache of one DID value, shared by all conversations.
+ *
+ * A value read by the diagnostic application is only stored if the cache has not been invalidated since the read was
+ * started. A read overlapping a write therefore never stores the value from before the write.
+ */
+class DidValueCache {
+ public:
+  /**
+   * \brief Clock used for the lifetime of a cached value.
+   */
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * \brief Counter identifying the invalidations of the cache.
+   */
+  using Generation = std::uint32_t;
+
+  /**
+   * \brief Constructor. SetValueSize() must be called before the cache is used.
+   * \param lifetime time a stored value stays valid, the cache is disabled for 0.
+   */
+  explicit DidValueCache(std::chrono::milliseconds lifetime) : lifetime_(lifetime) {}
+
+  DidValueCache(const DidValueCache&) = delete;
+  DidValueCache& operator=(const DidValueCache&) = delete;
+  DidValueCache(DidValueCache&&) = delete;
+  DidValueCache& operator=(DidValueCache&&) = delete;
+
+  /**
+   * \brief Checks if values are cached at all.
+   */
+  bool IsEnabled() const { return lifetime_.count() > 0; }
+
+  /**
+   * \brief Allocates the cached value.
+   * \param value_size size of the DID value in bytes.
+   */
+  void SetValueSize(std::size_t value_size);
+
+  /**
+   * \brief Copies the cached value if it is still valid.
+   * \param out_buffer buffer the value is copied to, its size must match the size of the DID value.
+   * \return true if the value was copied, false otherwise.
+   */
+  bool TryRead(vac::container::array_view<std::uint8_t> out_buffer) const;
+
+  /**
+   * \brief Returns the generation to be passed to Store() once the value read now is available.
+   */
+  Generation BeginRead() const;
+
+  /**
+   * \brief Stores a value read from the diagnostic application.
+   * \param value the value, its size must match the size of the DID value.
+   * \param generation the generation returned by BeginRead() when the read was started.
+   */
+  void Store(vac::container::const_array_view<std::uint8_t> value, Generation generation);
+
+  /**
+   * \brief Drops the cached value and rejects all values of reads started before.
+   */
+  void Invalidate();
+
+ private:
+  /**
+   * \brief Time a stored value stays valid.
+   */
+  const std::chrono::milliseconds lifetime_;
+
+  /**
+   * \brief Mutex protecting the cached value, conversations run on several threads.
+   */
+  mutable std::mutex mutex_;
+
+  /**
+   * \brief The cached value, allocated once by SetValueSize().
+   */
+  std::vector<std::uint8_t> value_;
+
+  /**
+   * \brief Time the cached value becomes invalid.
+   */
+  Clock::time_point expiry_{};
+
+  /**
+   * \brief Set while value_ holds a value.
+   */
+  bool valid_{false};
+
+  /**
+   * \brief Incremented by every invalidation.
+   */
+  Generation generation_{0};
+};
+
+}  // namespace data
+}  // namespace server
+}  // namespace diag
+}  // namespace amsr
+
+#endif  // SRC_SERVER_DATA_DID_VALUE_CACHE_H_
@@ -35,6 +35,7 @@
 #include "ara/diag/service_interfaces/dm_ipc/DM_IPC_proxy.h"
 #include "common/diagnostic_service_polling_task_base.h"
 #include "server/data/ipc/ipc_polling_task.h"
+#include "server/service/resume_when_ready.h"
 #include "udstransport/uds_negative_response_code.h"
 #include "utility/string_helper.h"
 
@@ -82,6 +83,7 @@ class IpcPollingTaskImpl : public IpcPollingTask, public common::DiagnosticServi
             const service::ServiceProcessingContext& processing_context) override {
     in_buffer_ = in_buffer;
     out_buffer_ = out_buffer;
+    processing_context_ = &processing_context;
   }
 
  protected:
@@ -130,6 +132,10 @@ class IpcPollingTaskImpl : public IpcPollingTask, public common::DiagnosticServi
       nrc_.emplace(UdsNegativeResponseCode::kConditionsNotCorrect);
       return PollingStatus::kFailed;
     }
+    if (processing_context_ != nullptr) {
+      // Continue the service processor as soon as the result arrives instead of waiting for the next poll.
+      ipc_future_ = service::ResumeWhenReady(std::move(ipc_future_), *processing_context_);
+    }
     return PollingStatus::kPending;
   }
 
@@ -137,8 +143,7 @@ class IpcPollingTaskImpl : public IpcPollingTask, public common::DiagnosticServi
     using ara::diag::service_interfaces::dm_ipc::proxy::application_errors::Failed;
     // Check if future has value
     assert(ipc_future_.valid());
-    constexpr std::chrono::nanoseconds kWaitTimeFuture(10);
-    if (ara::com::FutureStatus::timeout == ipc_future_.wait_for(kWaitTimeFuture)) {
+    if (!ipc_future_.is_ready()) {
       ara::log::LogDebug() << "IpcPollingTaskImpl::" << __func__ << ": Still pending for future's return.";
       // no value available
       return PollingStatus::kPending;
@@ -208,6 +213,11 @@ class IpcPollingTaskImpl : public IpcPollingTask, public common::DiagnosticServi
    */
   vac::memory::optional<DM_IPCProxy>& ipc_proxy_;
 
+  /**
+   * \brief The context of the UDS message the task is processed for.
+   */
+  const service::ServiceProcessingContext* processing_context_{nullptr};
+
   /**
    * \brief Future that captures the result of reading the DID.
    */
@@ -76,23 +76,90 @@ class ReadDidOperationHandler : public DidOperationHandler {
   }
 
   /**
-   * \brief Start reading data
+   * \brief Start reading data. A valid cached value of the DID is copied without starting the read polling task.
    * \param out_buffer buffer where to store the read data
    * \param processing_context current service processing context.
-   * \return read did polling task.
+   * \return status of the reading.
    */
-  service::processor::ReadDidPollingTask& StartReading(service::processor::ReadDidPollingTask::BufferTypeOut out_buffer,
-                                                       const service::ServiceProcessingContext& processing_context) {
+  common::PollingStatus StartReading(service::processor::ReadDidPollingTask::BufferTypeOut out_buffer,
+                                     const service::ServiceProcessingContext& processing_context) {
+    DidValueCache& value_cache = did_info_.GetValueCache();
+    if (value_cache.TryRead(out_buffer)) {
+      ara::log::LogDebug() << "ReadDidOperationHandler::" << __func__ << ": Did read from cache.";
+      read_from_cache_ = true;
+      return common::PollingStatus::kComplete;
+    }
+    out_buffer_ = out_buffer;
+    cache_generation_ = value_cache.BeginRead();
     read_polling_task_.Init(out_buffer, processing_context);
-    read_polling_task_.Start();
-    return read_polling_task_;
+    return UpdateValueCache(read_polling_task_.Start());
   }
 
+  /**
+   * \brief Continue reading data. No action is performed if the reading is not pending.
+   * \return status of the reading.
+   */
+  common::PollingStatus ContinueReading() {
+    if (GetReadingStatus() != common::PollingStatus::kPending) {
+      return GetReadingStatus();
+    }
+    return UpdateValueCache(read_polling_task_.Continue());
+  }
+
+  /**
+   * \brief Cancels the reading. No action is performed if the reading is not pending.
+   */
+  void CancelReading() {
+    if (GetReadingStatus() == common::PollingStatus::kPending) {
+      read_polling_task_.Cancel();
+    }
+  }
+
+  /**
+   * \brief Returns the status of the reading started by StartReading().
+   */
+  common::PollingStatus GetReadingStatus() const {
+    return read_from_cache_ ? common::PollingStatus::kComplete : read_polling_task_.GetStatus();
+  }
+
+  /**
+   * \brief Returns the NRC in case the reading failed.
+   */
+  ara::diag::udstransport::UdsNegativeResponseCode GetNRC() const { return read_polling_task_.GetNRC(); }
+
  private:
+  /**
+   * \brief Stores the read data in the value cache of the DID once the reading is complete.
+   * \param status status of the read polling task.
+   * \return status.
+   */
+  common::PollingStatus UpdateValueCache(common::PollingStatus status) {
+    if (status == common::PollingStatus::kComplete) {
+      did_info_.GetValueCache().Store(
+          vac::container::const_array_view<std::uint8_t>(out_buffer_.data(), out_buffer_.size()), cache_generation_);
+    }
+    return status;
+  }
+
   /**
    * \brief The actual polling task returned to the processor selecting the delegated read polling task.
    */
   ReadDidOperationHandlerPollingTask read_polling_task_;
+
+  /**
+   * \brief The buffer the read data is stored to.
+   */
+  service::processor::ReadDidPollingTask::BufferTypeOut out_buffer_;
+
+  /**
+   * \brief Generation of the value cache when the reading was started.
+   */
+  DidValueCache::Generation cache_generation_{0};
+
+  /**
+   * \brief Set if the data has been copied from the value cache.
+   */
+  bool read_from_cache_{false};
 };
 }  // namespace operationhandler
 }  // namespace data
@@ -83,11 +83,18 @@ class WriteDidOperationHandler : public DidOperationHandler {
    */
   service::processor::WriteDidPollingTask& StartWriting(service::processor::WriteDidPollingTask::BufferTypeIn in_buffer,
                                                         const service::ServiceProcessingContext& processing_context) {
+    InvalidateValueCache();
     write_polling_task_.Init(in_buffer, processing_context);
     write_polling_task_.Start();
     return write_polling_task_;
   }
 
+  /**
+   * \brief Drops the cached read value of the DID. Called when writing starts and again when it has ended, so a read
+   * overlapping the write does not cache the value from before the write.
+   */
+  void InvalidateValueCache() { did_info_.GetValueCache().Invalidate(); }
+
  private:
   /**
    * \brief The actual polling task returned to the processor selecting the delegated read polling task.
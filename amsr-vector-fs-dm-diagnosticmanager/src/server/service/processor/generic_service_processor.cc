@@ -24,6 +24,7 @@
 #include "ara/log/logging.hpp"
 #include "server/conversation/conversation_manager.h"
 #include "server/conversation/uds_message_provider.h"
+#include "server/service/resume_when_ready.h"
 #include "udstransport/meta_info_map_conversion.h"
 
 namespace amsr {
@@ -41,11 +42,8 @@ ProcessingStatus GenericServiceProcessor::HandleMessage() {
     HandleMessageFirstCall();
   }
 
-  // Check if future is_ready.
-  // TODO(PAASSR-1627) : ara::com does not currently provide method is_ready(). Wait_for will be used until the method
-  // is available.
-  constexpr std::chrono::nanoseconds kWaitTimeFuture(10);
-  if (ara::com::FutureStatus::timeout == future_service_output_.wait_for(kWaitTimeFuture)) {
+  // Check if future is_ready. The message handler is resumed when it becomes ready.
+  if (!future_service_output_.is_ready()) {
     return ProcessingStatus::kNotDone;
   } else {
     // Future is ready.
@@ -82,11 +80,10 @@ void GenericServiceProcessor::HandleMessageFirstCall() {
     }
     generic_uds_service_proxy_.emplace(handles[0]);
   }
-  MetaInfo meta_info =
-      ara::diag::udstransport::ConvertToAraComMetaInfo<MetaInfo, decltype(uds_message_->GetMetaInfo())>(
-          uds_message_->GetMetaInfo());
-  future_service_output_ =
-      std::move(generic_uds_service_proxy_.value().Service(uds_payload[0], request_data, meta_info));
+  MetaInfo meta_info = ara::diag::udstransport::ConvertToAraComMetaInfo<MetaInfo>(uds_message_->GetMetaInfo());
+  future_service_output_ = ResumeWhenReady(
+      std::move(generic_uds_service_proxy_.value().Service(uds_payload[0], request_data, meta_info)),
+      processing_context_);
   // destroy UdsMessage
   uds_message_.reset();
 }
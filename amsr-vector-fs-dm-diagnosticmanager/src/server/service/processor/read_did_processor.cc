@@ -54,12 +54,11 @@ ProcessingStatus ReadDidProcessor::HandleMessage() {
         return ProcessingStatus::kDone;
       }
       handle_message_status_ = HandleMessageStatus::kContinue;
-      this->StartPollingTaskForNextDataIdentifier();
+      this->StartReadingAvailableDataIdentifiers();
       break;
     }
     case HandleMessageStatus::kContinue: {
-      assert(read_did_polling_task_);
-      read_did_polling_task_->Continue();
+      this->ContinueReadingAvailableDataIdentifiers();
       break;
     }
     case HandleMessageStatus::kDone:
@@ -69,11 +68,7 @@ ProcessingStatus ReadDidProcessor::HandleMessage() {
           "Invalid HandleMessage status. This case is not properly handled by the implementation and must not be "
           "reached.");
   }
-  // Evaluate task status
-  assert(read_did_polling_task_);
-  ara::log::LogDebug() << "ReadDidProcessor::" << __func__ << ": polling status "
-                       << amsr::diag::common::ToString(read_did_polling_task_->GetStatus());
-  return EvaluatePollingTaskStatus(read_did_polling_task_->GetStatus());
+  return EvaluateReadingStatus();
 }
 
 ProcessingStatus ReadDidProcessor::CheckRequestAndPrepareReading() {
@@ -160,44 +155,66 @@ ara::diag::udstransport::UdsNegativeResponseCode ReadDidProcessor::CheckConditio
   return UdsNegativeResponseCode::kPositiveResponse;
 }
 
-void ReadDidProcessor::StartPollingTaskForNextDataIdentifier() {
+void ReadDidProcessor::StartReadingAvailableDataIdentifiers() {
   assert(!available_data_identifiers_.empty());
-  data::operationhandler::ReadDidOperationHandler& current_operation_handler = available_data_identifiers_.front();
+  for (ReadDidOperationHandlerList::reference did_operation_handler : available_data_identifiers_) {
+    response_handler_.WriteDidToResponse(did_operation_handler.GetDid());
+    vac::container::array_view<std::uint8_t> write_buffer =
+        response_handler_.GetSubArrayViewForWriting(did_operation_handler.GetMaxSize());
+    assert(!write_buffer.empty());
+    static_cast<void>(did_operation_handler.StartReading(write_buffer, processing_context_));
+  }
+}
 
-  response_handler_.WriteDidToResponse(current_operation_handler.GetDid());
-  vac::container::array_view<std::uint8_t> write_buffer =
-      response_handler_.GetSubArrayViewForWriting(current_operation_handler.GetMaxSize());
-  assert(!write_buffer.empty());
-  read_did_polling_task_ = &current_operation_handler.StartReading(write_buffer, processing_context_);
+void ReadDidProcessor::ContinueReadingAvailableDataIdentifiers() {
+  for (ReadDidOperationHandlerList::reference did_operation_handler : available_data_identifiers_) {
+    static_cast<void>(did_operation_handler.ContinueReading());
+  }
 }
 
-ProcessingStatus ReadDidProcessor::EvaluatePollingTaskStatus(const common::PollingStatus polling_status) {
-  switch (polling_status) {
-    case common::PollingStatus::kComplete:
-      available_data_identifiers_.pop_front();
+void ReadDidProcessor::CancelReadingAvailableDataIdentifiers() {
+  for (ReadDidOperationHandlerList::reference did_operation_handler : available_data_identifiers_) {
+    did_operation_handler.CancelReading();
+  }
+}
 
-      if (available_data_identifiers_.empty()) {
-        processing_context_.FinishProcessing(std::move(response_message_));
+ProcessingStatus ReadDidProcessor::EvaluateReadingStatus() {
+  bool reading_pending = false;
+  // The DIDs are evaluated in request order, the first failed DID determines the NRC.
+  for (ReadDidOperationHandlerList::reference did_operation_handler : available_data_identifiers_) {
+    const common::PollingStatus polling_status = did_operation_handler.GetReadingStatus();
+    ara::log::LogDebug() << "ReadDidProcessor::" << __func__ << ": polling status of DID '"
+                         << did_operation_handler.GetDid() << "' " << amsr::diag::common::ToString(polling_status);
+    switch (polling_status) {
+      case common::PollingStatus::kComplete:
+        break;
+      case common::PollingStatus::kPending:
+        reading_pending = true;
+        break;
+      case common::PollingStatus::kCanceled:
+        CancelReadingAvailableDataIdentifiers();
         handle_message_status_ = HandleMessageStatus::kDone;
         return ProcessingStatus::kDone;
-      }
-      StartPollingTaskForNextDataIdentifier();
-      return ProcessingStatus::kNotDone;
-    case common::PollingStatus::kPending:
-      return ProcessingStatus::kNotDone;
-    case common::PollingStatus::kCanceled:
-      handle_message_status_ = HandleMessageStatus::kDone;
-      return ProcessingStatus::kDone;
-    case common::PollingStatus::kFailed:
-      handle_message_status_ = HandleMessageStatus::kDone;
-      return FinishServiceProcessing(read_did_polling_task_->GetNRC());
-    case common::PollingStatus::kNotStarted:
-      // This case is not expected to be called, but does not harm => error log.
-      ara::log::LogError() << "WriteDidProcessor::" << __func__ << ": Polling Task could not be started.";
-      return ProcessingStatus::kNotDone;
-    default:
-      throw std::out_of_range("Invalid polling status: " + std::to_string(read_did_polling_task_->GetStatus()) + "!");
+      case common::PollingStatus::kFailed:
+        CancelReadingAvailableDataIdentifiers();
+        handle_message_status_ = HandleMessageStatus::kDone;
+        return FinishServiceProcessing(did_operation_handler.GetNRC());
+      case common::PollingStatus::kNotStarted:
+        // This case is not expected to be called, but does not harm => error log.
+        ara::log::LogError() << "ReadDidProcessor::" << __func__ << ": Polling Task could not be started.";
+        reading_pending = true;
+        break;
+      default:
+        throw std::out_of_range("Invalid polling status: " + std::to_string(polling_status) + "!");
+    }
+  }
+
+  if (reading_pending) {
+    return ProcessingStatus::kNotDone;
   }
+  processing_context_.FinishProcessing(std::move(response_message_));
+  handle_message_status_ = HandleMessageStatus::kDone;
+  return ProcessingStatus::kDone;
 }
 
 }  // namespace processor
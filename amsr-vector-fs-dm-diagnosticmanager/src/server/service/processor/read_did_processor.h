@@ -84,8 +84,7 @@ class ReadDidProcessor : public processor::ServiceProcessorBase {
                    vac::memory::SmartObjectPoolDeleterContext* deleter_context = nullptr)
       : ServiceProcessorBase(std::move(uds_message), processing_context, deleter_context),
         max_number_of_dids_(max_number_of_dids),
-        max_payload_length_(kDidSizeInBytes * max_number_of_dids),
-        read_did_polling_task_(nullptr) {
+        max_payload_length_(kDidSizeInBytes * max_number_of_dids) {
     assert(uds_message_->GetPayload()[0] == ReadDidProcessor::kReadDidSid);
     available_data_identifiers_.reserve(max_number_of_dids_);
   }
@@ -195,16 +194,26 @@ class ReadDidProcessor : public processor::ServiceProcessorBase {
   std::size_t GetResponseSizeForAvailableDids();
 
   /**
-   * \brief Starts a new PollingTask for the current DID.
+   * \brief Starts reading all available DIDs at once, each DID is read into its own part of the response.
+   * The requests to the diagnostic applications are thereby processed in parallel instead of one after the other.
    */
-  void StartPollingTaskForNextDataIdentifier();
+  void StartReadingAvailableDataIdentifiers();
 
   /**
-   * Evaluates the status read_did_polling_task_
-   * \param polling_status Polling status that shall be evaluated
+   * \brief Continues the reading of all DIDs which are still pending.
+   */
+  void ContinueReadingAvailableDataIdentifiers();
+
+  /**
+   * \brief Cancels the reading of all DIDs which are still pending.
+   */
+  void CancelReadingAvailableDataIdentifiers();
+
+  /**
+   * Evaluates the reading status of all available DIDs.
    * \return processing status of the processor
    */
-  ProcessingStatus EvaluatePollingTaskStatus(const common::PollingStatus polling_status);
+  ProcessingStatus EvaluateReadingStatus();
 
   /**
    * Defines the maximum maximum number of DIDs.
@@ -238,8 +247,6 @@ class ReadDidProcessor : public processor::ServiceProcessorBase {
    */
   ara::diag::udstransport::UdsMessage::Ptr response_message_;
 
-  ReadDidPollingTask* read_did_polling_task_{nullptr};
-
   FRIEND_TEST(ReadDidServicePositiveResponseHandlerTest, ConstructorInitializesWithEmptyPayload);
   FRIEND_TEST(ReadDidServicePositiveResponseHandlerTest, WriteOneByteToResponseWritesToReferencedPayload);
   FRIEND_TEST(ReadDidServicePositiveResponseHandlerTest, WriteTwoDidsToResponse);
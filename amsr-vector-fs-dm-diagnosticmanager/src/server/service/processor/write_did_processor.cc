@@ -31,6 +31,10 @@ namespace server {
 namespace service {
 namespace processor {
 
+WriteDidProcessor::~WriteDidProcessor() { InvalidateValueCacheOfUnfinishedWrite(); }
+
+void WriteDidProcessor::Cancel() { InvalidateValueCacheOfUnfinishedWrite(); }
+
 ProcessingStatus WriteDidProcessor::HandleMessage() {
   ara::log::LogDebug() << __func__;
   switch (handle_message_status_) {
@@ -67,6 +71,10 @@ ProcessingStatus WriteDidProcessor::HandleMessage() {
 }
 
 ProcessingStatus WriteDidProcessor::EvaluatePollingTaskStatus(const common::PollingStatus polling_status) {
+  if ((polling_status != common::PollingStatus::kPending) && did_operation_handler_.has_value()) {
+    // Values read while writing must not stay cached.
+    did_operation_handler_->InvalidateValueCache();
+  }
   // Evaluate task status.
   switch (polling_status) {
     case common::PollingStatus::kComplete:
@@ -90,6 +98,12 @@ ProcessingStatus WriteDidProcessor::EvaluatePollingTaskStatus(const common::Poll
   }
 }
 
+void WriteDidProcessor::InvalidateValueCacheOfUnfinishedWrite() {
+  if ((handle_message_status_ == HandleMessageStatus::kContinue) && did_operation_handler_.has_value()) {
+    did_operation_handler_->InvalidateValueCache();
+  }
+}
+
 ProcessingStatus WriteDidProcessor::CheckRequestAndPrepareWriting() {
   ara::log::LogDebug() << "WriteDidProcessor::" << __func__;
   // First Call to HandleMessage.
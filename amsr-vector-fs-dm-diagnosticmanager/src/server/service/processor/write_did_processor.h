@@ -97,9 +97,17 @@ class WriteDidProcessor : public processor::ServiceProcessorBase {
   WriteDidProcessor(const WriteDidProcessor& that) = delete;
   WriteDidProcessor& operator=(const WriteDidProcessor& that) = delete;
 
+  /**
+   * \brief Destructor. Invalidates the cached value of the DID if a started write is abandoned.
+   */
+  ~WriteDidProcessor() override;
+
   ProcessingStatus HandleMessage() override;
 
-  void Cancel() override {}
+  /**
+   * \brief Invalidates the cached value of the DID if a write has been started.
+   */
+  void Cancel() override;
 
   void OnStateChange() override {}
 
@@ -113,6 +121,12 @@ class WriteDidProcessor : public processor::ServiceProcessorBase {
     */
   ProcessingStatus EvaluatePollingTaskStatus(const common::PollingStatus polling_status);
 
+  /**
+   * \brief Invalidates the cached value of the DID if the write has been started but its end has not been seen.
+   * The diagnostic application may still complete such a write, so a value read meanwhile must not stay cached.
+   */
+  void InvalidateValueCacheOfUnfinishedWrite();
+
   /**
    * \brief Method returning the DID.
    *
@@ -0,0 +1,103 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  resume_when_ready.h
+ *        \brief  Continues the processing of a UDS message when an ara::com::Future becomes ready.
+ *
+ *      \details  A service processor waiting for a method call of a diagnostic application replaces the returned
+ *                future by ResumeWhenReady(std::move(future), processing_context). The returned future becomes ready
+ *                together with the original one and the message handler is resumed right afterwards, so the result is
+ *                available in the next call of HandleMessage() without polling.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SRC_SERVER_SERVICE_RESUME_WHEN_READY_H_
+#define SRC_SERVER_SERVICE_RESUME_WHEN_READY_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <exception>
+#include <utility>
+
+#include "ara/com/future.h"
+#include "ara/com/promise.h"
+
+#include "server/service/service_processing_context.h"
+
+namespace amsr {
+namespace diag {
+namespace server {
+namespace service {
+
+/**
+ * \brief Continuation forwarding the result of a future and resuming the message processing afterwards.
+ * The result is forwarded before resuming, so the resumed processor always finds the returned future ready.
+ */
+template <typename T>
+class ResumeOnReady {
+ public:
+  /**
+   * \brief Constructor.
+   * \param promise promise of the future returned to the service processor
+   * \param resume callback resuming the message processing
+   */
+  ResumeOnReady(ara::com::Promise<T>&& promise, ServiceProcessingContext::ResumeCallback resume)
+      : promise_(std::move(promise)), resume_(std::move(resume)) {}
+
+  /**
+   * \brief Forwards the value or exception of the ready future and resumes the message processing.
+   * \param future the ready future
+   */
+  void operator()(ara::com::Future<T> future) {
+    try {
+      promise_.set_value(future.get());
+    } catch (...) {
+      promise_.set_exception(std::current_exception());
+    }
+    resume_();
+  }
+
+ private:
+  /**
+   * \brief Promise of the future returned to the service processor.
+   */
+  ara::com::Promise<T> promise_;
+
+  /**
+   * \brief Callback resuming the message processing.
+   */
+  ServiceProcessingContext::ResumeCallback resume_;
+};
+
+/**
+ * \brief Resume the processing of the current UDS message when a future becomes ready.
+ * \param future the future of an asynchronous operation, it is invalid afterwards
+ * \param processing_context the context of the current UDS message
+ * \return a future becoming ready with the same value or exception
+ */
+template <typename T>
+ara::com::Future<T> ResumeWhenReady(ara::com::Future<T>&& future, const ServiceProcessingContext& processing_context) {
+  ara::com::Promise<T> promise;
+  ara::com::Future<T> result = promise.get_future();
+  // The Future<void> of the continuation itself is not needed.
+  static_cast<void>(future.then(ResumeOnReady<T>(std::move(promise), processing_context.GetResumeCallback())));
+  return result;
+}
+
+}  // namespace service
+}  // namespace server
+}  // namespace diag
+}  // namespace amsr
+
+#endif  // SRC_SERVER_SERVICE_RESUME_WHEN_READY_H_
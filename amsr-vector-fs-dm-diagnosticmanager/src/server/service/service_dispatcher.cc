@@ -33,18 +33,64 @@ ServiceDispatcher::ServiceDispatcher(const DiagnosticServerConfiguration& server
                                      const amsr::diag::configuration::DextConfiguration& dext_config)
     : service_table_(server_config, dext_config) {
   service_preconditions_map_.reserve(dext_config.services.size());
+  std::size_t number_of_sub_services = 0;
+  std::size_t number_of_services_with_sub_services = 0;
   for (amsr::diag::configuration::DextConfiguration::ServicesArray::const_reference service_configuration :
        dext_config.services) {
     if (service_configuration.preconditions.has_value()) {
       service_preconditions_map_.emplace(std::piecewise_construct, std::forward_as_tuple(service_configuration.id),
                                          std::forward_as_tuple(service_configuration.preconditions.value()));
     }
+    if (!service_configuration.sub_services.empty()) {
+      number_of_sub_services += service_configuration.sub_services.size();
+      ++number_of_services_with_sub_services;
+    }
+  }
+  sub_function_preconditions_map_.reserve(number_of_sub_services);
+  // The tables are referenced by the dispatch table, the vector must not reallocate afterwards.
+  sub_function_tables_.reserve(number_of_services_with_sub_services);
+  BuildDispatchTable(dext_config);
+}
+
+void ServiceDispatcher::BuildDispatchTable(const amsr::diag::configuration::DextConfiguration& dext_config) {
+  dispatch_table_.fill(DispatchEntry{nullptr, nullptr, nullptr});
+  for (amsr::diag::configuration::DextConfiguration::ServicesArray::const_reference service_configuration :
+       dext_config.services) {
+    const std::uint8_t sid = service_configuration.id;
+    DispatchEntry& entry = dispatch_table_[sid];
+    entry.handler_ = service_table_.GetHandlerIfAvailable(sid);
+
+    ServicePreconditionsMap::iterator preconditions_iterator = service_preconditions_map_.find(sid);
+    if (preconditions_iterator != service_preconditions_map_.end()) {
+      entry.preconditions_ = &preconditions_iterator->second;
+    }
+
+    if ((!service_configuration.sub_services.empty()) && (entry.sub_functions_ == nullptr)) {
+      SubFunctionTable sub_function_table;
+      sub_function_table.fill(nullptr);
+      for (amsr::diag::configuration::ServiceConfiguration::ListSubServices::const_reference sub_service :
+           service_configuration.sub_services) {
+        if (sub_service.preconditions.has_value()) {
+          const std::uint8_t sub_function = static_cast<std::uint8_t>(sub_service.id & kSubFunctionMask);
+          std::pair<SubFunctionPreconditionsMap::iterator, bool> result = sub_function_preconditions_map_.emplace(
+              std::piecewise_construct, std::forward_as_tuple(SubFunctionKey(sid, sub_function)),
+              std::forward_as_tuple(sub_service.preconditions.value()));
+          sub_function_table[sub_function] = &result.first->second;
+        }
+      }
+      sub_function_tables_.push_back(sub_function_table);
+      entry.sub_functions_ = &sub_function_tables_.back();
+    }
   }
 }
 
 void ServiceDispatcher::Shutdown() {
+  // Clear the table first, it references the handlers and preconditions released below.
+  dispatch_table_.fill(DispatchEntry{nullptr, nullptr, nullptr});
   service_table_.Shutdown();
   service_preconditions_map_.clear();
+  sub_function_preconditions_map_.clear();
+  sub_function_tables_.clear();
 }
 
 ServiceDispatcher::PairProcessorNRC ServiceDispatcher::FindServiceProcessor(
@@ -61,37 +107,57 @@ ServiceDispatcher::PairProcessorNRC ServiceDispatcher::FindServiceProcessor(
     throw std::runtime_error("ServiceDispatcher::GetServiceProcessor SID not available.");
   }
 
-  // Get the service handler for the current SID and return the processor.
+  // Get the dispatch entry for the current SID.
   std::uint8_t sid = payload[0];
-  handler::ServiceHandler* service_handler = service_table_.GetHandlerIfAvailable(sid);
+  const DispatchEntry& entry = dispatch_table_[sid];
 
-  if (!service_handler) {
+  if (entry.handler_ == nullptr) {
+    ara::log::LogWarn() << "ServiceDispatcher::" << __func__ << " : service handler with sid : "
+                        << static_cast<std::uint16_t>(sid) << " is not available.";
     return PairProcessorNRC(nullptr, UdsNegativeResponseCode::kServiceNotSupported);
   }
 
-  // Get the current session and verify that SID is supported in active session.
-  if (!IsSidSupportedActiveSession(processing_context, sid)) {
-    return PairProcessorNRC(nullptr, UdsNegativeResponseCode::kServiceNotSupportedInActiveSession);
+  // Verify the preconditions of the service in the order of ISO 14229-1 (session before security access).
+  UdsNegativeResponseCode nrc = CheckPreconditions(entry.preconditions_, processing_context,
+                                                   UdsNegativeResponseCode::kServiceNotSupportedInActiveSession);
+  if (nrc != UdsNegativeResponseCode::kPositiveResponse) {
+    ara::log::LogWarn() << "ServiceDispatcher::" << __func__ << " : Service " << static_cast<std::uint16_t>(sid)
+                        << " not available in active session or security level.";
+    return PairProcessorNRC(nullptr, nrc);
+  }
+
+  // Verify the preconditions of the sub-function. Unconfigured sub-functions are left to the handler.
+  if ((entry.sub_functions_ != nullptr) && (payload_size > 1)) {
+    const std::uint8_t sub_function = static_cast<std::uint8_t>(payload[1] & kSubFunctionMask);
+    nrc = CheckPreconditions((*entry.sub_functions_)[sub_function], processing_context,
+                             UdsNegativeResponseCode::kSubfunctionNotSupportedInActiveSession);
+    if (nrc != UdsNegativeResponseCode::kPositiveResponse) {
+      ara::log::LogWarn() << "ServiceDispatcher::" << __func__ << " : Sub-function "
+                          << static_cast<std::uint16_t>(sub_function) << " of service "
+                          << static_cast<std::uint16_t>(sid) << " not available in active session or security level.";
+      return PairProcessorNRC(nullptr, nrc);
+    }
   }
 
   // Return the service processor.
-  return PairProcessorNRC(service_handler->CreateServiceProcessor(std::move(message), processing_context),
+  return PairProcessorNRC(entry.handler_->CreateServiceProcessor(std::move(message), processing_context),
                           UdsNegativeResponseCode::kPositiveResponse);
 }
 
-bool ServiceDispatcher::IsSidSupportedActiveSession(ServiceProcessingContext& processing_context, std::uint8_t sid) {
-  ServicePreconditionsMap::iterator preconditions_iterator = service_preconditions_map_.find(sid);
-  if (preconditions_iterator != service_preconditions_map_.end()) {
-    // Preconditions have to be checked.
-    ara::log::LogDebug() << "ServiceDispatcher::" << __func__ << " : Checking preconditions on active session.";
-    if (!preconditions_iterator->second.IsAllowedIn(processing_context,
-                                                    server::conversation::access::AccessCategory::kSession)) {
-      ara::log::LogWarn() << "ServiceDispatcher::" << __func__ << " : Service " << static_cast<std::uint16_t>(sid)
-                          << " not available in active sessions.";
-      return false;
-    }
+ara::diag::udstransport::UdsNegativeResponseCode ServiceDispatcher::CheckPreconditions(
+    const Preconditions* preconditions, const ServiceProcessingContext& processing_context,
+    ara::diag::udstransport::UdsNegativeResponseCode session_nrc) {
+  using UdsNegativeResponseCode = ara::diag::udstransport::UdsNegativeResponseCode;
+  if (preconditions == nullptr) {
+    return UdsNegativeResponseCode::kPositiveResponse;
+  }
+  if (!preconditions->IsAllowedIn(processing_context, server::conversation::access::AccessCategory::kSession)) {
+    return session_nrc;
+  }
+  if (!preconditions->IsAllowedIn(processing_context, server::conversation::access::AccessCategory::kSecurityLevel)) {
+    return UdsNegativeResponseCode::kSecurityAccessDenied;
   }
-  return true;
+  return UdsNegativeResponseCode::kPositiveResponse;
 }
 
 }  // namespace service
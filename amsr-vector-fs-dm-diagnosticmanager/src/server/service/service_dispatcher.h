@@ -24,9 +24,12 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <array>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <utility>
+#include <vector>
 
 #include "diagpreconditions/diag_preconditions.h"
 #include "server/conversation/conversation.h"
@@ -53,6 +56,9 @@ namespace service {
 
 /**
  * \brief Implementation of service dispatcher.
+ *
+ * The handlers and preconditions configured for each SID and sub-function are resolved once at construction into
+ * flat tables indexed by SID and sub-function. Admitting a request does not search any map.
  */
 class ServiceDispatcher {
  public:
@@ -97,11 +103,6 @@ class ServiceDispatcher {
   ServiceTable& GetServiceTable() { return service_table_; }
 
  private:
-  /**
-   * \brief This method is returning true if the SID is supported in active sessions.
-   * Otherwise false is returned.
-   */
-  bool IsSidSupportedActiveSession(ServiceProcessingContext& processing_context, std::uint8_t sid);
   /**
    * \brief Type definition for three phase allocator.
    */
@@ -113,6 +114,70 @@ class ServiceDispatcher {
    */
   using Preconditions = diagpreconditions::DiagPreconditions;
 
+  /**
+   * \brief Number of SIDs, the dispatch table has one entry per possible SID.
+   */
+  static constexpr std::size_t kNumberOfSids = 256;
+
+  /**
+   * \brief Number of sub-functions. Bit 7 of the sub-function byte is the suppressPosRspMsgIndicationBit.
+   */
+  static constexpr std::size_t kNumberOfSubFunctions = 128;
+
+  /**
+   * \brief Mask extracting the sub-function from the sub-function byte.
+   */
+  static constexpr std::uint8_t kSubFunctionMask = 0x7F;
+
+  /**
+   * \brief Preconditions of the sub-functions of one service, indexed by sub-function. nullptr means unrestricted.
+   */
+  using SubFunctionTable = std::array<const Preconditions*, kNumberOfSubFunctions>;
+
+  /**
+   * \brief Everything needed to admit a request for one SID.
+   */
+  struct DispatchEntry {
+    /**
+     * \brief Handler of the SID, nullptr if the SID is not supported.
+     */
+    handler::ServiceHandler* handler_;
+
+    /**
+     * \brief Preconditions of the SID, nullptr if the service is unrestricted.
+     */
+    const Preconditions* preconditions_;
+
+    /**
+     * \brief Preconditions of the sub-functions, nullptr if the service has no configured sub-functions.
+     */
+    const SubFunctionTable* sub_functions_;
+  };
+
+  /**
+   * \brief Fills the dispatch table from the service table and the preconditions.
+   * \param dext_config dext configuration
+   */
+  void BuildDispatchTable(const amsr::diag::configuration::DextConfiguration& dext_config);
+
+  /**
+   * \brief Checks the session and security access preconditions.
+   * \param preconditions the preconditions to check, nullptr is always fulfilled
+   * \param processing_context processing context of the request
+   * \param session_nrc negative response code if the active session is not allowed
+   * \return kPositiveResponse if the preconditions are fulfilled, the negative response code otherwise.
+   */
+  static ara::diag::udstransport::UdsNegativeResponseCode CheckPreconditions(
+      const Preconditions* preconditions, const ServiceProcessingContext& processing_context,
+      ara::diag::udstransport::UdsNegativeResponseCode session_nrc);
+
+  /**
+   * \brief Returns the key of a sub-function in the sub-function preconditions map.
+   */
+  static std::uint16_t SubFunctionKey(std::uint8_t sid, std::uint8_t sub_function) {
+    return static_cast<std::uint16_t>((static_cast<std::uint16_t>(sid) << 8U) | sub_function);
+  }
+
   /**
    * \brief Type def for map associating the SID with the preconditions.
    */
@@ -126,6 +191,26 @@ class ServiceDispatcher {
    * \brief Map associating the SID with the preconditions.
    */
   ServicePreconditionsMap service_preconditions_map_;
+
+  /**
+   * \brief Type def for map associating SID and sub-function with the preconditions.
+   */
+  using SubFunctionPreconditionsMap = vac::container::StaticMap<std::uint16_t, Preconditions>;
+
+  /**
+   * \brief Map associating SID and sub-function with the preconditions, the key is built by SubFunctionKey().
+   */
+  SubFunctionPreconditionsMap sub_function_preconditions_map_;
+
+  /**
+   * \brief Sub-function tables of the services with configured sub-functions.
+   */
+  std::vector<SubFunctionTable, ThreePhaseAllocator<SubFunctionTable>> sub_function_tables_;
+
+  /**
+   * \brief Dispatch table indexed by SID.
+   */
+  std::array<DispatchEntry, kNumberOfSids> dispatch_table_;
 };
 
 }  // namespace service
@@ -24,6 +24,7 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <functional>
 
 #include "server/proxys/proxys_pool.h"
 #include "server/service/processor/context/conversation_state.h"
@@ -56,6 +57,18 @@ class ServiceProcessingContext : public processor::context::UdsResponse, public
    * \brief Return a reference to the proxys pool.
    */
   virtual proxys::ProxysPool& GetProxysPool() const = 0;
+
+  /**
+   * \brief Callback continuing the processing of the current UDS message.
+   */
+  using ResumeCallback = std::function<void()>;
+
+  /**
+   * \brief Return a callback that continues the processing of the current UDS message.
+   * A service processor returning kNotDone while it waits for an asynchronous operation calls it when the operation
+   * completes. It may be called from any thread and stays safe to call after the conversation has been destroyed.
+   */
+  virtual ResumeCallback GetResumeCallback() const = 0;
 };
 
 }  // namespace service
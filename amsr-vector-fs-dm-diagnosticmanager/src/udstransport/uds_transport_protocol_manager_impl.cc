@@ -37,7 +37,7 @@ namespace udstransport {
 
 UdsTransportProtocolMgrImpl::UdsTransportProtocolMgrImpl() : reactor_(nullptr), timer_manager_(nullptr) {}
 
-void UdsTransportProtocolMgrImpl::Initialize(const std::string& path_tp_config, osabstraction::io::Reactor* reactor,
+void UdsTransportProtocolMgrImpl::Initialize(const std::string& path_tp_config, osabstraction::io::ReactorInterface* reactor,
                                              vac::timer::TimerManager* timer_manager) {
   ara::log::LogDebug() << "UdsTransportProtocolMgr: Initialize";
   /* Load ConnectionProvider, ConnectionProvider are supposed to register connection handling to reactor */
@@ -91,7 +91,7 @@ UdsTransportProtocolMgrImpl::IndicationPair UdsTransportProtocolMgrImpl::Indicat
     ara::diag::udstransport::UdsMessage::Address source_addr, ara::diag::udstransport::UdsMessage::Address target_addr,
     ara::diag::udstransport::UdsMessage::TargetAddressType type,
     ara::diag::udstransport::UdsTransportProtocolMgr::GlobalChannelIdentifier global_channel_id, std::size_t size,
-    std::shared_ptr<ara::diag::udstransport::UdsMessage::MetaInfoMap> /* meta_info */) {
+    std::shared_ptr<ara::diag::udstransport::UdsMessage::MetaInfoMap> meta_info) {
   // Preparing a pair of IndicationResult of kIndicationOverview (DM has no resources) and Null UdsMessage pointer.
   IndicationPair return_no_resources(
       ara::diag::udstransport::UdsTransportProtocolMgr::IndicationResult::kIndicationOverflow, nullptr);
@@ -126,7 +126,12 @@ UdsTransportProtocolMgrImpl::IndicationPair UdsTransportProtocolMgrImpl::Indicat
     return return_no_resources;
   }
 
-  return conversation->IndicateMessage(size, type);
+  IndicationPair indication = conversation->IndicateMessage(size, type);
+  if (indication.second != nullptr) {
+    // Copy the meta info into the store of the pooled UdsMessage, the map itself is not referenced afterwards.
+    indication.second->AddMetaInfo(std::move(meta_info));
+  }
+  return indication;
 }
 
 void UdsTransportProtocolMgrImpl::HandleMessage(ara::diag::udstransport::UdsMessage::Ptr message) {
@@ -32,7 +32,7 @@
 #include <utility>
 
 #include "configuration/diagnostic_configuration.h"
-#include "osabstraction/io/reactor.h"
+#include "osabstraction/io/reactor_interface.h"
 #include "udstransport/protocol_manager_with_conversation_manager_handling.h"
 #include "udstransport/uds_message.h"
 #include "udstransport/uds_transport_protocol_handler.h"
@@ -68,7 +68,7 @@ class UdsTransportProtocolMgrImpl : public ProtocolManagerWithConversationManage
    * \param reactor reactor
    * \param timer_manager timer manager
    */
-  VIRTUALMOCK void Initialize(const std::string& path_tp_config, osabstraction::io::Reactor* reactor,
+  VIRTUALMOCK void Initialize(const std::string& path_tp_config, osabstraction::io::ReactorInterface* reactor,
                               vac::timer::TimerManager* timer_manager);
 
   /**
@@ -218,7 +218,7 @@ class UdsTransportProtocolMgrImpl : public ProtocolManagerWithConversationManage
   /**
    * \brief Reactor used by DoIP for sockets and timers handling.
    */
-  osabstraction::io::Reactor* reactor_;
+  osabstraction::io::ReactorInterface* reactor_;
 
   /**
    * \brief Timer manager used by DoIP.
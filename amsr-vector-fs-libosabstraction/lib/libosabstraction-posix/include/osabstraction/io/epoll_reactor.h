@@ -0,0 +1,265 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file
+ *        \brief  Implementation of the reactor pattern interface based on epoll.
+ *
+ *      \details  In contrast to the select based Reactor, registrations are kept in the kernel between two calls of
+ *                HandleEvents(), so the cost of waiting does not grow with the number of registered file descriptors.
+ *                Ready events are fetched in batches of a configurable size.
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_LIBOSABSTRACTION_POSIX_INCLUDE_OSABSTRACTION_IO_EPOLL_REACTOR_H_
+#define LIB_LIBOSABSTRACTION_POSIX_INCLUDE_OSABSTRACTION_IO_EPOLL_REACTOR_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <sys/epoll.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "osabstraction/io/event_handler.h"
+#include "osabstraction/io/reactor_interface.h"
+
+namespace osabstraction {
+namespace io {
+
+/**
+ * \brief Reactor based on epoll.
+ *
+ * An implementation of the reactor design pattern which can be used in place of Reactor.
+ *
+ * Unlike Reactor, which checks every event handler on each iteration, an invalid event handler is removed when its
+ * file descriptor is reported ready, or when an event handler for its file descriptor is registered or unregistered.
+ */
+class EpollReactor : public ReactorInterface {
+ public:
+  /**
+   * \brief Trigger mode of all registrations of a reactor.
+   */
+  enum class TriggerMode {
+    /**
+     * \brief An event handler is called as long as the file descriptor is ready. Same behavior as Reactor.
+     */
+    kLevelTriggered,
+    /**
+     * \brief An event handler is only called when the file descriptor becomes ready. Event handlers must process all
+     *        pending data until the file descriptor reports EAGAIN, otherwise they are not called again.
+     */
+    kEdgeTriggered
+  };
+
+  /**
+   * \brief Default number of events fetched by a single epoll_wait call.
+   */
+  static constexpr std::size_t kDefaultMaxEvents = 64U;
+
+  /**
+   * \brief Constructor of EpollReactor.
+   *
+   * \param trigger_mode Trigger mode used for all registered file descriptors.
+   * \param max_events Maximum number of events fetched and dispatched by a single call of HandleEvents().
+   */
+  explicit EpollReactor(TriggerMode trigger_mode = TriggerMode::kLevelTriggered,
+                        std::size_t max_events = kDefaultMaxEvents);
+
+  /**
+   * \brief Destructor of EpollReactor.
+   */
+  ~EpollReactor();
+
+  /**
+   * \brief EpollReactor is not copy-constructable.
+   */
+  EpollReactor(const EpollReactor& other) = delete;
+
+  /**
+   * \brief EpollReactor is not copy-assignable.
+   */
+  EpollReactor& operator=(const EpollReactor& other) = delete;
+
+  /**
+   * \brief Registers an event handler for a file descriptor.
+   *
+   * \param handle A file descriptor.
+   * \param event_handler A pointer to an event handler.
+   * \param event_type_mask A mask of event types for which the passed event handler should be registered.
+   * \param removal_handler A callback that is notified after the successful removal of the event handler.
+   */
+  void RegisterEventHandler(HandleType handle, EventHandler* event_handler, unsigned int event_type_mask,
+                            EventHandlerRemovalHandler* removal_handler) override;
+
+  /**
+   * \brief Unregisters a previously registered event handler for a file descriptor.
+   *
+   * \param handle A file descriptor.
+   * \param event_type_mask A mask of event types for which the event handler should be unregistered.
+   */
+  void UnregisterEventHandler(HandleType handle, unsigned int event_type_mask) override;
+
+  /**
+   * \brief Waits for events on the registered file descriptors and dispatches the corresponding event handlers.
+   *
+   * \param timeout A pointer to a time value to wait for events. In case of the null pointer the reactor blocks
+   *                until an event occurs or Unblock() is called.
+   */
+  void HandleEvents(const struct timeval* timeout = nullptr) override;
+
+  /**
+   * \brief Causes the reactor to return from the blocking call of the function HandleEvents.
+   */
+  void Unblock() override;
+
+ private:
+  /**
+   * \brief Structure for storing a registered event handler.
+   */
+  struct EventHandlerMapEntry {
+    EventHandler* event_handler_;                  ///< Called in case of an I/O event on the file descriptor
+    EventHandlerRemovalHandler* removal_handler_;  ///< Called if the event handler has been removed by the reactor
+  };
+
+  /**
+   * \brief All event handlers registered for one file descriptor.
+   */
+  struct Registration {
+    EventHandlerMapEntry read_;       ///< Event handler for read events
+    EventHandlerMapEntry write_;      ///< Event handler for write events
+    EventHandlerMapEntry exception_;  ///< Event handler for exception events
+    std::uint32_t events_;            ///< Event mask currently registered in the kernel
+    std::uint32_t generation_;        ///< Distinguishes this registration from earlier ones for the same handle
+  };
+
+  /**
+   * \brief An event handler removed by the reactor whose removal handler still has to be notified.
+   */
+  struct RemovedEntry {
+    EventType event_type_;                         ///< Event type the event handler was registered for
+    EventHandlerRemovalHandler* removal_handler_;  ///< Called after the removal
+  };
+
+  /**
+   * \brief The event handlers removed from one registration, at most one per event type.
+   */
+  struct RemovedEntries {
+    std::array<RemovedEntry, 3> entries_;  ///< The removed event handlers
+    std::size_t count_;                    ///< Number of used elements of entries_
+  };
+
+  /**
+   * \brief Type for storing registrations.
+   */
+  using RegistrationMap = std::unordered_map<HandleType, Registration>;
+
+  /**
+   * \brief Returns the entry of a registration for an event type.
+   *
+   * \param registration A registration.
+   * \param event_type Exactly one event type.
+   * \return The entry for the event type.
+   */
+  static EventHandlerMapEntry& GetEntry(Registration& registration, EventType event_type);
+
+  /**
+   * \brief Clears all entries of a registration whose event handler has become invalid.
+   *
+   * Must be called with registrations_lock_ held, followed by UpdateRegistration().
+   *
+   * \param registration A registration.
+   * \param removed Receives the cleared entries.
+   */
+  static void ReclaimInvalidEntries(Registration& registration, RemovedEntries& removed);
+
+  /**
+   * \brief Notifies the removal handlers of removed event handlers. Must be called without registrations_lock_ held.
+   *
+   * \param handle The file descriptor the event handlers were registered for.
+   * \param removed The removed event handlers.
+   */
+  static void NotifyRemoved(HandleType handle, const RemovedEntries& removed);
+
+  /**
+   * \brief Brings the kernel event mask of a registration in line with its registered event handlers.
+   *
+   * Erases the registration if no event handler is left. Must be called with registrations_lock_ held.
+   *
+   * \param it The registration to update.
+   */
+  void UpdateRegistration(RegistrationMap::iterator it);
+
+  /**
+   * \brief Calls the event handler registered for an event type and removes it if requested.
+   *
+   * \param handle A file descriptor.
+   * \param generation The generation of the registration for which the event was reported.
+   * \param event_type Exactly one event type.
+   */
+  void Dispatch(HandleType handle, std::uint32_t generation, EventType event_type);
+
+  /**
+   * \brief Sends wakeup signal to unblock the epoll_wait system call being executed in HandleEvents.
+   */
+  void SendWakeup();
+
+  /**
+   * \brief Handles wakeup signal sent by SendWakeup.
+   */
+  void HandleWakeup();
+
+  /**
+   * \brief Trigger mode used for all registered file descriptors.
+   */
+  const TriggerMode trigger_mode_;
+
+  /**
+   * \brief The epoll instance.
+   */
+  int epoll_handle_;
+
+  /**
+   * \brief eventfd used for unblocking a blocked epoll_wait call.
+   */
+  int wakeup_handle_;
+
+  /**
+   * \brief Generation assigned to the next registration added to the kernel.
+   */
+  std::uint32_t next_generation_;
+
+  /**
+   * \brief Buffer for the events returned by epoll_wait.
+   */
+  std::vector<struct epoll_event> events_;
+
+  /**
+   * \brief Protects registrations_ and next_generation_. Never held while an event handler is called.
+   */
+  std::mutex registrations_lock_;
+
+  /**
+   * \brief Registered event handlers.
+   */
+  RegistrationMap registrations_;
+};
+
+}  // namespace io
+}  // namespace osabstraction
+
+#endif  // LIB_LIBOSABSTRACTION_POSIX_INCLUDE_OSABSTRACTION_IO_EPOLL_REACTOR_H_
@@ -32,6 +32,8 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <cstddef>
+
 #include "osabstraction/io/network/socket/client_socket.h"
 
 namespace osabstraction {
@@ -43,12 +45,81 @@ namespace socket {
  * \brief Represents a Socket of type SocketType::kDatagram.
  */
 class DatagramSocket : public ClientSocket {
+ public:
+  /**
+   * \brief A datagram to be sent with SendBatch().
+   */
+  struct OutboundDatagram {
+    IovecContainer iovec_;                          ///< Buffers holding the datagram
+    const address::SocketAddress* remote_address_;  ///< Destination or nullptr for the connected remote peer
+  };
+
+  /**
+   * \brief A datagram received with ReceiveBatch().
+   */
+  struct InboundDatagram {
+    struct iovec buffer_;                    ///< Buffer where the datagram is stored
+    std::size_t length_;                     ///< Length of the received datagram
+    address::SocketAddress remote_address_;  ///< The remote address of the socket that sent the datagram
+  };
+
+  /**
+   * \brief Container of datagrams to be sent.
+   */
+  using OutboundDatagramContainer = vac::container::array_view<const OutboundDatagram>;
+
+  /**
+   * \brief Container of datagrams to be received.
+   */
+  using InboundDatagramContainer = vac::container::array_view<InboundDatagram>;
+
+  /**
+   * \brief Maximum number of datagrams passed to a single system call.
+   */
+  static constexpr std::size_t kMaxBatchSize = 64U;
+
+  /**
+   * \brief Sends several datagrams with as few system calls as possible.
+   *
+   * \param datagrams The datagrams to send.
+   * \return The number of datagrams sent, which is less than the number of passed datagrams if sending the datagram
+   *         following the sent ones failed.
+   * \throws std::system_error if the first passed datagram cannot be sent.
+   */
+  virtual std::size_t SendBatch(OutboundDatagramContainer datagrams);
+
+  /**
+   * \brief Receives as many datagrams as are available, without blocking.
+   *
+   * \param datagrams Receive buffers. The length and the remote address of the first datagrams are set.
+   * \return The number of received datagrams, 0 if no datagram is available.
+   */
+  virtual std::size_t ReceiveBatch(InboundDatagramContainer datagrams);
+
  protected:
   /**
    * \brief Constructor for a DatagramSocket of a given Address Family.
    */
   explicit DatagramSocket(address::SocketAddressFamily address_family)
       : ClientSocket(address_family, SocketType::kDatagram) {}
+
+  /**
+   * \brief Returns whether SendBatch() may pass several equally sized datagrams to the same destination as a single
+   *        buffer which the network stack segments.
+   *
+   * \return false, segmentation offload is not supported by default.
+   */
+  virtual bool IsSegmentationOffloadEnabled() const { return false; }
+
+ private:
+  /**
+   * \brief Counts the datagrams following a given one which can be sent together with it as a single segmented buffer.
+   *
+   * \param datagrams The datagrams to send.
+   * \param first Index of the first datagram of the segmented buffer.
+   * \return The number of datagrams in the segmented buffer, at least 1.
+   */
+  static std::size_t CountSegments(const OutboundDatagramContainer& datagrams, std::size_t first);
 };
 
 }  // namespace socket
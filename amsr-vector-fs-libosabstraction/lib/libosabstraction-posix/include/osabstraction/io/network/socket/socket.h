@@ -200,6 +200,14 @@ class Socket : public FileDescriptor {
    */
   virtual std::size_t Send(const IovecContainer iovec, const address::SocketAddress& remote_address);
 
+  /**
+   * \brief Sends data to the connected remote peer without blocking, also on a socket in blocking mode.
+   *
+   * \param iovec A vector of buffers where the data to be sent is stored.
+   * \return The length of data sent to the remote peer, which is 0 if the socket cannot accept data right now.
+   */
+  virtual std::size_t TrySend(const IovecContainer iovec);
+
   /**
    * \brief Allows reusing of local addresses.
    *
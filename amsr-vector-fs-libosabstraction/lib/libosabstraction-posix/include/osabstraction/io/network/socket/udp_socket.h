@@ -91,6 +91,16 @@ class UDPSocket : public DatagramSocket {
    * \param enable Indicates whether the looping back will be enabled or not.
    */
   virtual void SetMulticastLoop(bool enable);
+  /**
+   * \brief Lets SendBatch() use UDP generic segmentation offload if the kernel supports it.
+   *
+   * \details With segmentation offload, consecutive datagrams of equal size to the same destination are passed to the
+   * kernel as a single buffer, which is split into datagrams as late as possible.
+   *
+   * \param enable Indicates whether segmentation offload shall be used.
+   * \return true if segmentation offload is used from now on and false otherwise.
+   */
+  virtual bool SetSegmentationOffload(bool enable);
 
  protected:
   UDPSocket() = default;
@@ -99,6 +109,17 @@ class UDPSocket : public DatagramSocket {
    * \brief Constructor for a UDPSocket of a given Address Family.
    */
   explicit UDPSocket(address::SocketAddressFamily address_family) : DatagramSocket(address_family) {}
+
+  /**
+   * \copydoc DatagramSocket::IsSegmentationOffloadEnabled
+   */
+  bool IsSegmentationOffloadEnabled() const override { return is_segmentation_offload_enabled_; }
+
+ private:
+  /**
+   * \brief Indicates whether UDP generic segmentation offload is used.
+   */
+  bool is_segmentation_offload_enabled_ = false;
 };
 
 }  // namespace socket
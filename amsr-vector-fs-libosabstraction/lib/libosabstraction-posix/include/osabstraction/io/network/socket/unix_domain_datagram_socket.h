@@ -32,6 +32,7 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <vector>
 #include "osabstraction/io/network/address/unix_domain_socket_address.h"
 #include "osabstraction/io/network/socket/datagram_socket.h"
 
@@ -70,6 +71,36 @@ class UnixDomainDatagramSocket : public DatagramSocket {
    */
   void Close() override;
 
+  /**
+   * \brief Sends data together with file descriptors to the connected remote peer.
+   *
+   * The file descriptors are duplicated into the receiving process (SCM_RIGHTS). The caller keeps ownership of the
+   * passed file descriptors.
+   *
+   * \param iovec A vector of buffers where the data to be sent is stored.
+   * \param handles File descriptors to be passed to the remote peer. At most kMaxPassedHandles.
+   * \return The length of data sent to the remote peer.
+   */
+  std::size_t SendWithHandles(const IovecContainer iovec, const std::vector<int>& handles);
+
+  /**
+   * \brief Returns received data together with file descriptors passed by the remote peer.
+   *
+   * The caller takes ownership of all returned file descriptors.
+   *
+   * \param iovec A vector of buffers where the received data is stored.
+   * \param remote_address The remote address of the socket that sent the received data.
+   * \param handles Receives the file descriptors passed along with the data. Cleared before receiving.
+   * \return The length of the received data.
+   */
+  std::size_t ReceiveWithHandles(const IovecContainer iovec, address::SocketAddress* remote_address,
+                                 std::vector<int>* handles);
+
+  /**
+   * \brief Maximum number of file descriptors which can be passed with a single message.
+   */
+  static constexpr std::size_t kMaxPassedHandles = 8U;
+
   UnixDomainDatagramSocket(UnixDomainDatagramSocket&&) = default;             ///< Move constructor
   UnixDomainDatagramSocket& operator=(UnixDomainDatagramSocket&&) = default;  ///< Move operator
 
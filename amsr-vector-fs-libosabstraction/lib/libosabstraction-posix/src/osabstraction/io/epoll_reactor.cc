@@ -0,0 +1,336 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file
+ *        \brief  Implementation of the reactor pattern interface based on epoll.
+ *
+ *      \details  -
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "osabstraction/io/epoll_reactor.h"
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <cerrno>
+#include <climits>
+#include <stdexcept>
+#include <system_error>
+
+namespace osabstraction {
+namespace io {
+
+constexpr std::size_t EpollReactor::kDefaultMaxEvents;
+
+/**
+ * \brief Generation stored in the event data of the wakeup eventfd. Never assigned to a registration.
+ */
+static constexpr std::uint32_t kWakeupGeneration = 0U;
+
+/**
+ * \brief Packs a file descriptor and the generation of its registration into the user data of an epoll event.
+ */
+static std::uint64_t MakeEventData(int handle, std::uint32_t generation) {
+  return (static_cast<std::uint64_t>(generation) << 32U) | static_cast<std::uint32_t>(handle);
+}
+
+EpollReactor::EpollReactor(TriggerMode trigger_mode, std::size_t max_events)
+    : trigger_mode_(trigger_mode),
+      epoll_handle_(-1),
+      wakeup_handle_(-1),
+      next_generation_(kWakeupGeneration + 1U),
+      events_(max_events > 0U ? max_events : 1U),
+      registrations_lock_(),
+      registrations_() {
+  epoll_handle_ = ::epoll_create1(EPOLL_CLOEXEC);
+  if (epoll_handle_ < 0) {
+    throw std::system_error(errno, std::generic_category(), "EpollReactor: epoll_create1");
+  }
+  wakeup_handle_ = ::eventfd(0U, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (wakeup_handle_ < 0) {
+    const int error = errno;
+    ::close(epoll_handle_);
+    throw std::system_error(error, std::generic_category(), "EpollReactor: eventfd");
+  }
+  // The wakeup eventfd is always level-triggered, so a wakeup is never lost if it is not consumed right away.
+  struct epoll_event event {};
+  event.events = EPOLLIN;
+  event.data.u64 = MakeEventData(wakeup_handle_, kWakeupGeneration);
+  if (::epoll_ctl(epoll_handle_, EPOLL_CTL_ADD, wakeup_handle_, &event) != 0) {
+    const int error = errno;
+    ::close(wakeup_handle_);
+    ::close(epoll_handle_);
+    throw std::system_error(error, std::generic_category(), "EpollReactor: epoll_ctl");
+  }
+}
+
+EpollReactor::~EpollReactor() {
+  Unblock();
+  // TODO(PAASR-606): Verify that no method of EpollReactor is still running when the object is destroyed.
+  ::close(wakeup_handle_);
+  ::close(epoll_handle_);
+}
+
+void EpollReactor::RegisterEventHandler(HandleType handle, EventHandler* event_handler, unsigned int event_type_mask,
+                                        EventHandlerRemovalHandler* removal_handler) {
+  if (event_handler == nullptr) {
+    throw std::invalid_argument("EpollReactor::RegisterEventHandler: event_handler is null");
+  }
+
+  RemovedEntries removed{};
+  {
+    std::lock_guard<std::mutex> lock(registrations_lock_);
+    auto result = registrations_.emplace(
+        handle, Registration{{nullptr, nullptr}, {nullptr, nullptr}, {nullptr, nullptr}, 0U, next_generation_});
+    RegistrationMap::iterator it = result.first;
+    Registration& registration = it->second;
+    if (result.second) {
+      ++next_generation_;
+      if (next_generation_ == kWakeupGeneration) {
+        ++next_generation_;
+      }
+    }
+
+    // Check all requested event types first, so that a failed registration leaves no partial state behind. An
+    // invalid event handler does not prevent the registration of a new one.
+    if (((event_type_mask & EventType::kReadEvent) != 0U) && (registration.read_.event_handler_ != nullptr) &&
+        registration.read_.event_handler_->IsValid()) {
+      throw std::invalid_argument(
+          "EpollReactor::RegisterEventHandler: read_event_handler already registered for handle");
+    }
+    if (((event_type_mask & EventType::kWriteEvent) != 0U) && (registration.write_.event_handler_ != nullptr) &&
+        registration.write_.event_handler_->IsValid()) {
+      throw std::invalid_argument(
+          "EpollReactor::RegisterEventHandler: write_event_handler already registered for handle");
+    }
+    if (((event_type_mask & EventType::kExceptionEvent) != 0U) &&
+        (registration.exception_.event_handler_ != nullptr) && registration.exception_.event_handler_->IsValid()) {
+      throw std::invalid_argument(
+          "EpollReactor::RegisterEventHandler: exception_event_handler already registered for handle");
+    }
+
+    const Registration previous = registration;
+    ReclaimInvalidEntries(registration, removed);
+    if ((event_type_mask & EventType::kReadEvent) != 0U) {
+      registration.read_ = EventHandlerMapEntry{event_handler, removal_handler};
+    }
+    if ((event_type_mask & EventType::kWriteEvent) != 0U) {
+      registration.write_ = EventHandlerMapEntry{event_handler, removal_handler};
+    }
+    if ((event_type_mask & EventType::kExceptionEvent) != 0U) {
+      registration.exception_ = EventHandlerMapEntry{event_handler, removal_handler};
+    }
+    try {
+      UpdateRegistration(it);
+    } catch (...) {
+      registration = previous;
+      if (registration.events_ == 0U) {
+        registrations_.erase(it);
+      }
+      throw;
+    }
+    // No wakeup required: epoll_ctl takes effect immediately, also for a concurrently blocked epoll_wait call.
+  }
+  NotifyRemoved(handle, removed);
+}
+
+void EpollReactor::UnregisterEventHandler(HandleType handle, unsigned int event_type_mask) {
+  RemovedEntries removed{};
+  {
+    std::lock_guard<std::mutex> lock(registrations_lock_);
+    RegistrationMap::iterator it = registrations_.find(handle);
+    if (it != registrations_.end()) {
+      Registration& registration = it->second;
+      if ((event_type_mask & EventType::kReadEvent) != 0U) {
+        registration.read_ = EventHandlerMapEntry{nullptr, nullptr};
+      }
+      if ((event_type_mask & EventType::kWriteEvent) != 0U) {
+        registration.write_ = EventHandlerMapEntry{nullptr, nullptr};
+      }
+      if ((event_type_mask & EventType::kExceptionEvent) != 0U) {
+        registration.exception_ = EventHandlerMapEntry{nullptr, nullptr};
+      }
+      // Also drop the other event handlers of the file descriptor which have become invalid, they would otherwise
+      // only be removed once the file descriptor is reported ready.
+      ReclaimInvalidEntries(registration, removed);
+      UpdateRegistration(it);
+    }
+  }
+  NotifyRemoved(handle, removed);
+}
+
+void EpollReactor::HandleEvents(const struct timeval* timeout) {
+  int timeout_ms = -1;
+  if (timeout != nullptr) {
+    // Round up, so that timers are not reported as expired before their deadline.
+    const long long milliseconds = (static_cast<long long>(timeout->tv_sec) * 1000LL) +
+                                   ((static_cast<long long>(timeout->tv_usec) + 999LL) / 1000LL);
+    timeout_ms = (milliseconds > INT_MAX) ? INT_MAX : static_cast<int>(milliseconds < 0LL ? 0LL : milliseconds);
+  }
+
+  const int count = ::epoll_wait(epoll_handle_, events_.data(), static_cast<int>(events_.size()), timeout_ms);
+  for (int i = 0; i < count; ++i) {
+    const std::uint32_t events = events_[i].events;
+    const HandleType handle = static_cast<HandleType>(static_cast<std::uint32_t>(events_[i].data.u64));
+    const std::uint32_t generation = static_cast<std::uint32_t>(events_[i].data.u64 >> 32U);
+    if (generation == kWakeupGeneration) {
+      HandleWakeup();
+      continue;
+    }
+    // Like select(), report hang-ups and errors as readiness, so that the event handler sees the error on its next
+    // system call.
+    if ((events & (EPOLLIN | EPOLLHUP | EPOLLERR)) != 0U) {
+      Dispatch(handle, generation, EventType::kReadEvent);
+    }
+    if ((events & (EPOLLOUT | EPOLLHUP | EPOLLERR)) != 0U) {
+      Dispatch(handle, generation, EventType::kWriteEvent);
+    }
+    if ((events & EPOLLPRI) != 0U) {
+      Dispatch(handle, generation, EventType::kExceptionEvent);
+    }
+  }
+}
+
+void EpollReactor::Unblock() { SendWakeup(); }
+
+EpollReactor::EventHandlerMapEntry& EpollReactor::GetEntry(Registration& registration, EventType event_type) {
+  switch (event_type) {
+    case EventType::kReadEvent:
+      return registration.read_;
+    case EventType::kWriteEvent:
+      return registration.write_;
+    default:
+      return registration.exception_;
+  }
+}
+
+void EpollReactor::ReclaimInvalidEntries(Registration& registration, RemovedEntries& removed) {
+  const EventType event_types[] = {EventType::kReadEvent, EventType::kWriteEvent, EventType::kExceptionEvent};
+  for (const EventType event_type : event_types) {
+    EventHandlerMapEntry& entry = GetEntry(registration, event_type);
+    if ((entry.event_handler_ != nullptr) && !entry.event_handler_->IsValid()) {
+      removed.entries_[removed.count_] = RemovedEntry{event_type, entry.removal_handler_};
+      ++removed.count_;
+      entry = EventHandlerMapEntry{nullptr, nullptr};
+    }
+  }
+}
+
+void EpollReactor::NotifyRemoved(HandleType handle, const RemovedEntries& removed) {
+  for (std::size_t i = 0U; i < removed.count_; ++i) {
+    if (removed.entries_[i].removal_handler_ != nullptr) {
+      removed.entries_[i].removal_handler_->EventHandlerRemoved(handle, removed.entries_[i].event_type_);
+    }
+  }
+}
+
+void EpollReactor::UpdateRegistration(RegistrationMap::iterator it) {
+  Registration& registration = it->second;
+  std::uint32_t events = 0U;
+  if (registration.read_.event_handler_ != nullptr) {
+    events |= EPOLLIN;
+  }
+  if (registration.write_.event_handler_ != nullptr) {
+    events |= EPOLLOUT;
+  }
+  if (registration.exception_.event_handler_ != nullptr) {
+    events |= EPOLLPRI;
+  }
+
+  if (events == 0U) {
+    if (registration.events_ != 0U) {
+      // Fails if the file descriptor has already been closed, which removes it from the epoll set anyway.
+      static_cast<void>(::epoll_ctl(epoll_handle_, EPOLL_CTL_DEL, it->first, nullptr));
+    }
+    registrations_.erase(it);
+  } else if (events != registration.events_) {
+    struct epoll_event event {};
+    event.events = events;
+    if (trigger_mode_ == TriggerMode::kEdgeTriggered) {
+      event.events |= EPOLLET;
+    }
+    event.data.u64 = MakeEventData(it->first, registration.generation_);
+    const int operation = (registration.events_ == 0U) ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+    if (::epoll_ctl(epoll_handle_, operation, it->first, &event) != 0) {
+      throw std::system_error(errno, std::generic_category(), "EpollReactor: epoll_ctl");
+    }
+    registration.events_ = events;
+  }
+}
+
+void EpollReactor::Dispatch(HandleType handle, std::uint32_t generation, EventType event_type) {
+  EventHandlerMapEntry entry{nullptr, nullptr};
+  {
+    // An earlier event handler of this batch may have unregistered the handle or even closed it and registered a new
+    // file descriptor with the same number. The generation check discards such stale events.
+    std::lock_guard<std::mutex> lock(registrations_lock_);
+    RegistrationMap::iterator it = registrations_.find(handle);
+    if ((it != registrations_.end()) && (it->second.generation_ == generation)) {
+      entry = GetEntry(it->second, event_type);
+    }
+  }
+  if (entry.event_handler_ == nullptr) {
+    return;
+  }
+
+  bool keep = false;
+  if (entry.event_handler_->IsValid()) {
+    switch (event_type) {
+      case EventType::kReadEvent:
+        keep = entry.event_handler_->HandleRead(handle);
+        break;
+      case EventType::kWriteEvent:
+        keep = entry.event_handler_->HandleWrite(handle);
+        break;
+      default:
+        keep = entry.event_handler_->HandleException(handle);
+        break;
+    }
+  }
+
+  if (!keep) {
+    bool removed = false;
+    {
+      std::lock_guard<std::mutex> lock(registrations_lock_);
+      RegistrationMap::iterator it = registrations_.find(handle);
+      // The event handler may have unregistered itself already.
+      if ((it != registrations_.end()) && (it->second.generation_ == generation) &&
+          (GetEntry(it->second, event_type).event_handler_ == entry.event_handler_)) {
+        GetEntry(it->second, event_type) = EventHandlerMapEntry{nullptr, nullptr};
+        UpdateRegistration(it);
+        removed = true;
+      }
+    }
+    if (removed && (entry.removal_handler_ != nullptr)) {
+      entry.removal_handler_->EventHandlerRemoved(handle, event_type);
+    }
+  }
+}
+
+void EpollReactor::SendWakeup() {
+  const std::uint64_t increment = 1U;
+  ssize_t ret = ::write(wakeup_handle_, &increment, sizeof(increment));
+  static_cast<void>(ret);
+}
+
+void EpollReactor::HandleWakeup() {
+  std::uint64_t value;
+  ssize_t ret = ::read(wakeup_handle_, &value, sizeof(value));
+  static_cast<void>(ret);
+}
+
+}  // namespace io
+}  // namespace osabstraction
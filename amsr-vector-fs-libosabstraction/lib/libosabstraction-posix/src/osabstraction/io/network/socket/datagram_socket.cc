@@ -0,0 +1,192 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file
+ *        \brief  Batched send and receive of datagrams.
+ *
+ *      \details  -
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "osabstraction/io/network/socket/datagram_socket.h"
+
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <sys/socket.h>
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+
+namespace osabstraction {
+namespace io {
+namespace network {
+namespace socket {
+
+constexpr std::size_t DatagramSocket::kMaxBatchSize;
+
+/**
+ * \brief Maximum number of datagrams combined into a single segmented buffer. Older kernels do not accept more.
+ */
+static constexpr std::size_t kMaxSegments = 64U;
+
+/**
+ * \brief Maximum total length of a segmented buffer, limited by the length of a single UDP datagram.
+ */
+static constexpr std::size_t kMaxSegmentedLength = 65507U;
+
+/**
+ * \brief Maximum number of buffers of all segmented datagrams passed to a single system call.
+ */
+static constexpr std::size_t kMaxSegmentedIovecs = 1024U;
+
+/**
+ * \brief Indicates whether two datagrams are sent to the same destination.
+ */
+static bool HasSameDestination(const DatagramSocket::OutboundDatagram& a, const DatagramSocket::OutboundDatagram& b) {
+  if ((a.remote_address_ == nullptr) || (b.remote_address_ == nullptr)) {
+    return a.remote_address_ == b.remote_address_;
+  }
+  return (a.remote_address_->Length() == b.remote_address_->Length()) &&
+         (std::memcmp(a.remote_address_->toSockAddr(), b.remote_address_->toSockAddr(), a.remote_address_->Length()) ==
+          0);
+}
+
+std::size_t DatagramSocket::SendBatch(OutboundDatagramContainer datagrams) {
+#ifdef UDP_SEGMENT
+  using ControlBuffer = std::array<char, CMSG_SPACE(sizeof(std::uint16_t))>;
+  std::array<ControlBuffer, kMaxBatchSize> controls;
+  std::array<struct iovec, kMaxSegmentedIovecs> segmented_iovecs;
+#endif
+  std::array<struct mmsghdr, kMaxBatchSize> messages;
+  std::array<std::size_t, kMaxBatchSize> segments;
+  std::size_t sent = 0U;
+  while (sent < datagrams.size()) {
+    std::size_t count = 0U;
+    std::size_t next = sent;
+#ifdef UDP_SEGMENT
+    std::size_t iovecs_used = 0U;
+#endif
+    while ((next < datagrams.size()) && (count < kMaxBatchSize)) {
+      const OutboundDatagram& datagram = datagrams[next];
+      struct msghdr& msg = messages[count].msg_hdr;
+      std::memset(&messages[count], 0, sizeof(messages[count]));
+      if (datagram.remote_address_ != nullptr) {
+        msg.msg_name = const_cast<struct sockaddr*>(datagram.remote_address_->toSockAddr());
+        msg.msg_namelen = datagram.remote_address_->Length();
+      }
+      msg.msg_iov = const_cast<struct iovec*>(datagram.iovec_.data());
+      msg.msg_iovlen = datagram.iovec_.size();
+      segments[count] = 1U;
+#ifdef UDP_SEGMENT
+      const std::size_t n = IsSegmentationOffloadEnabled() ? CountSegments(datagrams, next) : 1U;
+      // The buffers of all datagrams of a segmented buffer must be passed as a single I/O vector.
+      std::size_t iovecs = 0U;
+      std::size_t fitting = 0U;
+      while ((n > 1U) && (fitting < n) &&
+             ((iovecs_used + iovecs + datagrams[next + fitting].iovec_.size()) <= kMaxSegmentedIovecs)) {
+        const IovecContainer& iovec = datagrams[next + fitting].iovec_;
+        std::copy(iovec.cbegin(), iovec.cend(), &segmented_iovecs[iovecs_used + iovecs]);
+        iovecs += iovec.size();
+        ++fitting;
+      }
+      if (fitting > 1U) {
+        msg.msg_iov = &segmented_iovecs[iovecs_used];
+        msg.msg_iovlen = iovecs;
+        iovecs_used += iovecs;
+        msg.msg_control = controls[count].data();
+        msg.msg_controllen = controls[count].size();
+        struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = IPPROTO_UDP;
+        cmsg->cmsg_type = UDP_SEGMENT;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(std::uint16_t));
+        const std::uint16_t segment_size = static_cast<std::uint16_t>(GetDataLengthOfIovecContainer(datagram.iovec_));
+        std::memcpy(CMSG_DATA(cmsg), &segment_size, sizeof(segment_size));
+        segments[count] = fitting;
+      }
+#endif
+      next += segments[count];
+      ++count;
+    }
+
+    const int ret = ::sendmmsg(handle_, messages.data(), static_cast<unsigned int>(count), 0);
+    if (ret <= 0) {
+      if (sent == 0U) {
+        throw std::system_error((ret < 0) ? errno : EIO, std::generic_category());
+      }
+      break;
+    }
+    for (std::size_t i = 0U; i < static_cast<std::size_t>(ret); ++i) {
+      sent += segments[i];
+    }
+    if (static_cast<std::size_t>(ret) < count) {
+      // The next message failed. Its error is reported by the next call.
+      break;
+    }
+  }
+  return sent;
+}
+
+std::size_t DatagramSocket::ReceiveBatch(InboundDatagramContainer datagrams) {
+  std::array<struct mmsghdr, kMaxBatchSize> messages;
+  std::array<struct sockaddr_storage, kMaxBatchSize> addresses;
+  const std::size_t count = std::min(datagrams.size(), kMaxBatchSize);
+  for (std::size_t i = 0U; i < count; ++i) {
+    std::memset(&messages[i], 0, sizeof(messages[i]));
+    messages[i].msg_hdr.msg_name = &addresses[i];
+    messages[i].msg_hdr.msg_namelen = sizeof(addresses[i]);
+    messages[i].msg_hdr.msg_iov = &datagrams[i].buffer_;
+    messages[i].msg_hdr.msg_iovlen = 1U;
+  }
+  const int ret = ::recvmmsg(handle_, messages.data(), static_cast<unsigned int>(count), MSG_DONTWAIT, nullptr);
+  if (ret < 0) {
+    if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+      return 0U;
+    }
+    throw std::system_error(errno, std::generic_category());
+  }
+  for (std::size_t i = 0U; i < static_cast<std::size_t>(ret); ++i) {
+    datagrams[i].length_ = messages[i].msg_len;
+    datagrams[i].remote_address_ = address::SocketAddress(&addresses[i]);
+  }
+  return static_cast<std::size_t>(ret);
+}
+
+std::size_t DatagramSocket::CountSegments(const OutboundDatagramContainer& datagrams, std::size_t first) {
+  const std::size_t segment_size = GetDataLengthOfIovecContainer(datagrams[first].iovec_);
+  std::size_t total = segment_size;
+  std::size_t n = 1U;
+  // All segments but the last one must have the same size, the last one may be shorter.
+  bool is_last = false;
+  while (!is_last && ((first + n) < datagrams.size()) && (n < kMaxSegments) &&
+         HasSameDestination(datagrams[first], datagrams[first + n])) {
+    const std::size_t length = GetDataLengthOfIovecContainer(datagrams[first + n].iovec_);
+    if ((length == 0U) || (length > segment_size) || ((total + length) > kMaxSegmentedLength)) {
+      break;
+    }
+    is_last = (length < segment_size);
+    total += length;
+    ++n;
+  }
+  return n;
+}
+
+}  // namespace socket
+}  // namespace network
+}  // namespace io
+}  // namespace osabstraction
@@ -214,6 +214,21 @@ std::size_t Socket::Send(const IovecContainer iovec, const address::SocketAddres
   return static_cast<typename std::make_unsigned<ssize_t>::type>(ret);
 }
 
+std::size_t Socket::TrySend(const IovecContainer iovec) {
+  struct msghdr msg;
+  std::memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = const_cast<struct iovec*>(iovec.data());
+  msg.msg_iovlen = iovec.size();
+  ssize_t ret = ::sendmsg(handle_, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+  if (ret < 0) {
+    if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+      return 0U;
+    }
+    throw std::system_error(errno, std::generic_category());
+  }
+  return static_cast<typename std::make_unsigned<ssize_t>::type>(ret);
+}
+
 void Socket::SetReuseAddress(bool reuse) {
   int flag = reuse;
   int ret = ::setsockopt(handle_, SOL_SOCKET, SO_REUSEADDR, &flag, sizeof(flag));
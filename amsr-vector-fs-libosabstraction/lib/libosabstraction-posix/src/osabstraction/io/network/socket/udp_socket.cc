@@ -23,6 +23,8 @@
  *********************************************************************************************************************/
 #include "osabstraction/io/network/socket/udp_socket.h"
 
+#include <netinet/in.h>
+#include <netinet/udp.h>
 #include <system_error>
 
 #include "osabstraction/io/network/address/addrinfo_ptr.h"
@@ -225,6 +227,21 @@ void UDPSocket::SetMulticastLoop(bool enable) {
   }
 }
 
+bool UDPSocket::SetSegmentationOffload(bool enable) {
+  is_segmentation_offload_enabled_ = false;
+#ifdef UDP_SEGMENT
+  if (enable) {
+    // Only probes for kernel support. The segment size is passed with each send call instead of being set here.
+    int segment_size = 0;
+    socklen_t size = sizeof(segment_size);
+    is_segmentation_offload_enabled_ = (::getsockopt(handle_, IPPROTO_UDP, UDP_SEGMENT, &segment_size, &size) == 0);
+  }
+#else
+  static_cast<void>(enable);
+#endif
+  return is_segmentation_offload_enabled_;
+}
+
 }  // namespace socket
 }  // namespace network
 }  // namespace io
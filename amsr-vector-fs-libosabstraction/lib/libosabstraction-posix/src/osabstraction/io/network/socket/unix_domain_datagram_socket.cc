@@ -31,8 +31,14 @@
  *********************************************************************************************************************/
 #include "osabstraction/io/network/socket/unix_domain_datagram_socket.h"
 
+#include <sys/socket.h>
 #include <unistd.h>
+#include <array>
 #include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
 
 #include "osabstraction/io/network/address/unix_domain_socket_address.h"
 
@@ -66,6 +72,77 @@ void UnixDomainDatagramSocket::Close() {
   FileDescriptor::Close();
 }
 
+std::size_t UnixDomainDatagramSocket::SendWithHandles(const IovecContainer iovec, const std::vector<int>& handles) {
+  if (handles.size() > kMaxPassedHandles) {
+    throw std::invalid_argument("too many file descriptors");
+  }
+  union {
+    struct cmsghdr align_;
+    std::array<char, CMSG_SPACE(sizeof(int) * kMaxPassedHandles)> buffer_;
+  } control;
+  struct msghdr msg;
+  std::memset(&msg, 0, sizeof(msg));
+  std::memset(&control, 0, sizeof(control));
+  msg.msg_iov = const_cast<struct iovec*>(iovec.data());
+  msg.msg_iovlen = iovec.size();
+  if (!handles.empty()) {
+    msg.msg_control = control.buffer_.data();
+    msg.msg_controllen = CMSG_SPACE(sizeof(int) * handles.size());
+    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int) * handles.size());
+    std::memcpy(CMSG_DATA(cmsg), handles.data(), sizeof(int) * handles.size());
+  }
+  ssize_t ret = ::sendmsg(handle_, &msg, 0);
+  if (ret < 0) {
+    throw std::system_error(errno, std::generic_category());
+  }
+  return static_cast<typename std::make_unsigned<ssize_t>::type>(ret);
+}
+
+std::size_t UnixDomainDatagramSocket::ReceiveWithHandles(const IovecContainer iovec,
+                                                         address::SocketAddress* remote_address,
+                                                         std::vector<int>* handles) {
+  union {
+    struct cmsghdr align_;
+    std::array<char, CMSG_SPACE(sizeof(int) * kMaxPassedHandles)> buffer_;
+  } control;
+  struct msghdr msg;
+  struct sockaddr_storage sockaddr;
+  std::memset(&msg, 0, sizeof(msg));
+  msg.msg_name = &sockaddr;
+  msg.msg_namelen = sizeof(sockaddr);
+  msg.msg_iov = const_cast<struct iovec*>(iovec.data());
+  msg.msg_iovlen = iovec.size();
+  msg.msg_control = control.buffer_.data();
+  msg.msg_controllen = control.buffer_.size();
+  ssize_t ret = ::recvmsg(handle_, &msg, MSG_CMSG_CLOEXEC);
+  if (ret < 0) {
+    throw std::system_error(errno, std::generic_category());
+  }
+  handles->clear();
+  for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+    if ((cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SCM_RIGHTS)) {
+      const std::size_t count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+      const std::size_t offset = handles->size();
+      handles->resize(offset + count);
+      std::memcpy(&(*handles)[offset], CMSG_DATA(cmsg), sizeof(int) * count);
+    }
+  }
+  if ((msg.msg_flags & MSG_CTRUNC) != 0) {
+    // Some descriptors were discarded by the kernel, the received ones are useless on their own.
+    for (int handle : *handles) {
+      ::close(handle);
+    }
+    handles->clear();
+  }
+  *remote_address = address::SocketAddress(&sockaddr);
+  return static_cast<typename std::make_unsigned<ssize_t>::type>(ret);
+}
+
+constexpr std::size_t UnixDomainDatagramSocket::kMaxPassedHandles;
+
 }  // namespace socket
 }  // namespace network
 }  // namespace io
@@ -0,0 +1,193 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file
+ *        \brief  Compares the timer wheel of the TimerManager with the former binary heap implementation.
+ *
+ *      \details  For 1k, 10k and 100k running timers the benchmark measures starting all timers, restarting
+ *                randomly chosen timers, and firing a batch of expired timers.
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+#include "vac/timer/timer.h"
+#include "vac/timer/timer_manager.h"
+
+namespace {
+
+using vac::timer::Timer;
+using vac::timer::TimerManager;
+
+/**
+ * \brief Number of restarts measured per run.
+ */
+constexpr std::size_t kRestarts = 1000;
+
+/**
+ * \brief Number of timers which expire at once.
+ */
+constexpr std::size_t kExpiryBatch = 1000;
+
+/**
+ * \brief Orders the heap so that the timer expiring first is at its front.
+ */
+bool TimerExpiryCompare(const Timer* a, const Timer* b) { return a->GetNextExpiry() > b->GetNextExpiry(); }
+
+/**
+ * \brief TimerManager keeping the running timers in a binary heap, as done before the timer wheel was introduced.
+ */
+class HeapTimerManager : public TimerManager {
+ public:
+  HeapTimerManager() : TimerManager(nullptr), timers_() {}
+
+  void AddTimer(Timer* const timer) override {
+    timers_.push_back(timer);
+    Update();
+  }
+
+  void RemoveTimer(const Timer* timer) override {
+    auto it = std::find(timers_.begin(), timers_.end(), timer);
+    if (it != timers_.end()) {
+      timers_.erase(it);
+      Update();
+    }
+  }
+
+  void Update() override { std::make_heap(timers_.begin(), timers_.end(), TimerExpiryCompare); }
+
+  /**
+   * \brief Expiry loop of the heap based implementation.
+   */
+  void HandleHeapTimerExpiry() {
+    while (!timers_.empty() && timers_.front()->IsExpired()) {
+      timers_.front()->DoHandleTimer();
+    }
+  }
+
+  /**
+   * \brief Drop all timers, so destroying them does not have to search the heap.
+   */
+  void Clear() { timers_.clear(); }
+
+ private:
+  std::vector<Timer*> timers_;
+};
+
+/**
+ * \brief One-shot timer counting its expiries.
+ */
+class BenchmarkTimer : public Timer {
+ public:
+  explicit BenchmarkTimer(TimerManager* timer_manager) : Timer(timer_manager), fired_(0) {}
+
+  bool HandleTimer() override {
+    ++fired_;
+    return false;
+  }
+
+  std::size_t fired_;
+};
+
+/**
+ * \brief Result of one run in nanoseconds per operation.
+ */
+struct Result {
+  double start;
+  double restart;
+  double expire;
+};
+
+double NanosecondsPerOperation(std::chrono::steady_clock::time_point begin, std::size_t operations) {
+  const std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - begin;
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+         static_cast<double>(operations);
+}
+
+template <typename ExpiryFunction, typename ClearFunction>
+Result Run(TimerManager& timer_manager, std::size_t timer_count, ExpiryFunction handle_expiry, ClearFunction clear) {
+  std::mt19937 random(42);
+  std::uniform_int_distribution<int> timeout_ms(600000, 36000000);
+  std::uniform_int_distribution<std::size_t> pick(0, timer_count - 1);
+  Result result;
+
+  std::vector<std::unique_ptr<BenchmarkTimer>> timers;
+  timers.reserve(timer_count);
+  for (std::size_t i = 0; i < timer_count; ++i) {
+    timers.emplace_back(new BenchmarkTimer(&timer_manager));
+    timers.back()->SetOneShot(std::chrono::milliseconds(timeout_ms(random)));
+  }
+
+  std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+  for (std::unique_ptr<BenchmarkTimer>& timer : timers) {
+    timer->Start();
+  }
+  result.start = NanosecondsPerOperation(begin, timer_count);
+
+  begin = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < kRestarts; ++i) {
+    BenchmarkTimer& timer = *timers[pick(random)];
+    timer.Stop();
+    timer.SetOneShot(std::chrono::milliseconds(timeout_ms(random)));
+    timer.Start();
+  }
+  result.restart = NanosecondsPerOperation(begin, kRestarts);
+
+  const std::size_t batch = std::min(kExpiryBatch, timer_count);
+  const Timer::Clock::time_point expired = Timer::Clock::now() - std::chrono::milliseconds(1);
+  for (std::size_t i = 0; i < batch; ++i) {
+    timers[i]->Stop();
+    timers[i]->SetOneShot(expired);
+    timers[i]->Start();
+  }
+  begin = std::chrono::steady_clock::now();
+  handle_expiry();
+  result.expire = NanosecondsPerOperation(begin, batch);
+
+  std::size_t fired = 0;
+  for (std::unique_ptr<BenchmarkTimer>& timer : timers) {
+    fired += timer->fired_;
+  }
+  if (fired != batch) {
+    std::printf("unexpected number of fired timers: %zu instead of %zu\n", fired, batch);
+  }
+  clear();
+  return result;
+}
+
+}  // namespace
+
+int main() {
+  std::printf("%-8s %-6s %14s %14s %14s\n", "timers", "impl", "start [ns]", "restart [ns]", "expire [ns]");
+  for (std::size_t timer_count : {1000U, 10000U, 100000U}) {
+    HeapTimerManager heap;
+    const Result heap_result = Run(heap, timer_count, [&heap]() { heap.HandleHeapTimerExpiry(); },
+                                    [&heap]() { heap.Clear(); });
+    std::printf("%-8zu %-6s %14.1f %14.1f %14.1f\n", timer_count, "heap", heap_result.start, heap_result.restart,
+                heap_result.expire);
+
+    TimerManager wheel(nullptr);
+    const Result wheel_result = Run(wheel, timer_count, [&wheel]() { wheel.HandleTimerExpiry(); }, []() {});
+    std::printf("%-8zu %-6s %14.1f %14.1f %14.1f\n", timer_count, "wheel", wheel_result.start, wheel_result.restart,
+                wheel_result.expire);
+  }
+  return 0;
+}
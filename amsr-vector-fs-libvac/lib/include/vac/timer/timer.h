@@ -36,6 +36,7 @@
 #include <chrono>
 
 #include "vac/timer/timer_manager.h"
+#include "vac/timer/timer_wheel.h"
 
 namespace vac {
 namespace timer {
@@ -151,6 +152,13 @@ class Timer {
   bool one_shot_;
   Clock::duration period_;
   Clock::time_point next_expiry_;
+
+  /**
+   * \brief Links this timer into a slot of the TimerWheel of the TimerManager while it is running.
+   */
+  TimerWheelHook wheel_hook_;
+
+  friend class TimerWheel;
 };
 
 }  // namespace timer
@@ -26,29 +26,21 @@
  *********************************************************************************************************************/
 #include <sys/time.h>
 #include <cstddef>
-#include <queue>
 #include <utility>
-#include <vector>
 #include "vac/testing/test_adapter.h"
 #include "vac/timer/timer_reactor_interface.h"
+#include "vac/timer/timer_wheel.h"
 
 namespace vac {
 namespace timer {
 
 class Timer;
 
-/**
- * \brief Comparison operator that compares Timer pointers based on their expiry timestamps
- *
- * \param a left timer
- * \param b right timer
- *
- * \return true, in case a expires before b. False otherwise.
- */
-bool TimerExpiryCompare(const Timer* a, const Timer* b);
-
 /**
  * \brief An event queue for Timer objects
+ *
+ * Running timers are kept in a TimerWheel, so starting, stopping and restarting a timer takes constant time
+ * independent of the number of running timers.
  */
 class TimerManager {
  public:
@@ -65,6 +57,8 @@ class TimerManager {
   /**
    * \brief Add a timer to be considered when computing the next expiry.
    *
+   * Adding a timer which is already running reschedules it to its current expiry point.
+   *
    * \param timer Pointer to a Timer object.
    */
   virtual void AddTimer(Timer* const timer);
@@ -91,6 +85,8 @@ class TimerManager {
 
   /**
    * \brief Signals the TimerManager that any Timer has made changes to its expiry point.
+   *
+   * Re-sorts all running timers. Not needed after Timer::Start(), which reschedules the timer by itself.
    */
   virtual void Update();
 
@@ -98,22 +94,17 @@ class TimerManager {
    * \brief Determine whether there are any times currently running on this TimerManager.
    * \return true if there are active timers, false otherwise.
    */
-  bool empty() const { return timers_.empty(); }
+  bool empty() const { return wheel_.empty(); }
 
   /**
    * \brief Determine whether there are any times currently running on this TimerManager.
    * \return true if there are active timers, false otherwise.
    */
-  size_t size() const { return timers_.size(); }
+  size_t size() const { return wheel_.size(); }
 
  private:
   Timer* GetNextTimer() const;
 
-  /**
-   * \brief Container for storing active timers.
-   */
-  using TimerContainer = std::vector<Timer*>;
-
   /**
    * \brief The reactor which is linked to the timer manager.
    */
@@ -122,7 +113,14 @@ class TimerManager {
   /**
    * \brief The set of timers to consider for firing
    */
-  TimerContainer timers_;
+  TimerWheel wheel_;
+
+  /**
+   * \brief The expiry point last reported by GetNextExpiry(), i.e. the point the reactor waits for.
+   *
+   * The reactor only needs to be unblocked if a timer is added which expires earlier.
+   */
+  mutable TimerWheel::Clock::time_point reported_expiry_;
 
   FRIEND_TEST(TimerManager, AddTimer_MultipleDeadlines_1);
   FRIEND_TEST(TimerManager, AddTimer_MultipleDeadlines_2);
@@ -0,0 +1,280 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file
+ *        \brief  Hashed hierarchical timing wheel used by the TimerManager.
+ *
+ *      \details  Timers are linked into slots through an intrusive hook, so adding, removing and restarting a timer
+ *                does not depend on the number of running timers. The wheel only uses its tick to select a slot; the
+ *                exact expiry point of each timer is always checked before it fires.
+ *
+ *********************************************************************************************************************/
+
+#ifndef LIB_INCLUDE_VAC_TIMER_TIMER_WHEEL_H_
+#define LIB_INCLUDE_VAC_TIMER_TIMER_WHEEL_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace vac {
+namespace timer {
+
+class Timer;
+
+/**
+ * \brief Intrusive list hook embedded into every Timer.
+ *
+ * Only the TimerWheel accesses the hook.
+ */
+struct TimerWheelHook {
+  /**
+   * \brief Slot value of a timer which is not linked into the wheel.
+   */
+  static constexpr std::size_t kUnlinked = std::numeric_limits<std::size_t>::max();
+
+  /**
+   * \brief Previous timer in the same slot.
+   */
+  Timer* prev_{nullptr};
+
+  /**
+   * \brief Next timer in the same slot.
+   */
+  Timer* next_{nullptr};
+
+  /**
+   * \brief The slot the timer is linked into, or kUnlinked.
+   */
+  std::size_t slot_{kUnlinked};
+};
+
+/**
+ * \brief A hashed hierarchical timing wheel.
+ *
+ * The wheel has kLevels levels of kSlotsPerLevel slots each. A slot on level n covers kSlotsPerLevel^n ticks. Timers
+ * are placed on the lowest level whose range covers their distance to the current tick and move down one or more
+ * levels when the wheel reaches their slot (cascading). Timers that are further away than the top level covers are
+ * kept in an overflow list ordered by expiry point and are re-inserted each time the top level wraps around.
+ *
+ * Timers whose expiry tick has been reached are moved to a pending list. The owner takes them from there, checks
+ * their exact expiry point and fires or re-inserts them.
+ */
+class TimerWheel {
+ public:
+  /**
+   * \brief The clock the wheel operates on. Has to be the same as Timer::Clock.
+   */
+  using Clock = std::chrono::high_resolution_clock;
+
+  /**
+   * \brief Duration of a single tick of the lowest level.
+   */
+  using Tick = std::chrono::milliseconds;
+
+  /**
+   * \brief Number of bits of the tick counter handled by each level.
+   */
+  static constexpr std::size_t kBitsPerLevel = 6;
+
+  /**
+   * \brief Number of slots per level.
+   */
+  static constexpr std::size_t kSlotsPerLevel = 1U << kBitsPerLevel;
+
+  /**
+   * \brief Number of levels. With 1 ms ticks the wheel covers about 12 days.
+   */
+  static constexpr std::size_t kLevels = 5;
+
+  /**
+   * \brief Constructor. The wheel starts at the current time.
+   */
+  TimerWheel();
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+  ~TimerWheel() = default;
+
+  /**
+   * \brief Link a timer into the slot matching its expiry point.
+   *
+   * \param timer The timer. Must not be linked already.
+   */
+  void Insert(Timer* timer);
+
+  /**
+   * \brief Unlink a timer. Does nothing if the timer is not linked.
+   *
+   * \param timer The timer.
+   */
+  void Remove(Timer* timer);
+
+  /**
+   * \brief Move the current tick of an empty wheel to the given time.
+   *
+   * Keeps the distance of new timers to the current tick small after the wheel has been idle for a while.
+   *
+   * \param now The current time.
+   */
+  void Rebase(Clock::time_point now);
+
+  /**
+   * \brief Advance the wheel to the given time.
+   *
+   * Cascades all slots passed on the way and moves every timer whose expiry tick is reached to the pending list.
+   *
+   * \param now The current time.
+   */
+  void Advance(Clock::time_point now);
+
+  /**
+   * \brief Move all pending timers to the due list, which is drained by PopDue().
+   *
+   * Timers that become pending while the due list is drained are therefore not returned by the same run of PopDue().
+   */
+  void CollectPending();
+
+  /**
+   * \brief Unlink and return the first timer of the due list.
+   *
+   * \return The timer, or nullptr if the due list is empty.
+   */
+  Timer* PopDue();
+
+  /**
+   * \brief Find the timer with the earliest exact expiry point.
+   *
+   * Only the first occupied slot of each level, the pending and due lists and the head of the overflow list are
+   * searched.
+   *
+   * \return The timer, or nullptr if the wheel is empty.
+   */
+  Timer* GetEarliest() const;
+
+  /**
+   * \brief Re-insert all timers, e.g. after the expiry point of linked timers has been changed.
+   */
+  void Rehash();
+
+  /**
+   * \brief Determine whether any timer is linked.
+   * \return true if no timer is linked, false otherwise.
+   */
+  bool empty() const { return count_ == 0; }
+
+  /**
+   * \brief Number of linked timers.
+   * \return The number of linked timers.
+   */
+  std::size_t size() const { return count_; }
+
+ private:
+  /**
+   * \brief Doubly linked list of timers in one slot.
+   */
+  struct TimerList {
+    /**
+     * \brief First timer.
+     */
+    Timer* head_{nullptr};
+    /**
+     * \brief Last timer.
+     */
+    Timer* tail_{nullptr};
+  };
+
+  /**
+   * \brief Index of the pending list in lists_.
+   */
+  static constexpr std::size_t kPendingSlot = kLevels * kSlotsPerLevel;
+
+  /**
+   * \brief Index of the due list in lists_.
+   */
+  static constexpr std::size_t kDueSlot = kPendingSlot + 1;
+
+  /**
+   * \brief Index of the overflow list in lists_. Holds the timers beyond the range of the wheel, ordered by expiry.
+   */
+  static constexpr std::size_t kOverflowSlot = kDueSlot + 1;
+
+  /**
+   * \brief Total number of lists.
+   */
+  static constexpr std::size_t kListCount = kOverflowSlot + 1;
+
+  /**
+   * \brief Convert a time point into a tick count.
+   */
+  static std::uint64_t ToTick(Clock::time_point time_point);
+
+  /**
+   * \brief Append a timer to the given list.
+   */
+  void Link(Timer* timer, std::size_t slot);
+
+  /**
+   * \brief Link a timer into the overflow list in front of the first timer expiring later.
+   */
+  void LinkOverflow(Timer* timer);
+
+  /**
+   * \brief Remove a timer from its list.
+   */
+  void Unlink(Timer* timer);
+
+  /**
+   * \brief Unlink and return the first timer of the given list.
+   */
+  Timer* PopFront(std::size_t slot);
+
+  /**
+   * \brief Re-insert all timers of a slot or of the overflow list relative to the current tick.
+   */
+  void Cascade(std::size_t slot);
+
+  /**
+   * \brief Return the timer with the earliest expiry point of a list.
+   */
+  Timer* GetEarliestOf(std::size_t slot) const;
+
+  /**
+   * \brief All slots of all levels followed by the pending, the due and the overflow list.
+   */
+  std::array<TimerList, kListCount> lists_;
+
+  /**
+   * \brief One bit per occupied slot for every level.
+   */
+  std::array<std::uint64_t, kLevels> occupied_;
+
+  /**
+   * \brief The tick the wheel has been advanced to.
+   */
+  std::uint64_t current_tick_;
+
+  /**
+   * \brief Number of linked timers.
+   */
+  std::size_t count_;
+};
+
+}  // namespace timer
+}  // namespace vac
+
+#endif  // LIB_INCLUDE_VAC_TIMER_TIMER_WHEEL_H_
@@ -40,7 +40,7 @@ namespace vac {
 namespace timer {
 
 Timer::Timer(TimerManager* timer_manager)
-    : timer_manager_(timer_manager), one_shot_(true), period_(Clock::duration::zero()), next_expiry_() {}
+    : timer_manager_(timer_manager), one_shot_(true), period_(Clock::duration::zero()), next_expiry_(), wheel_hook_() {}
 
 Timer::~Timer() { Stop(); }
 
@@ -30,56 +30,55 @@
  *  INCLUDES
  *********************************************************************************************************************/
 #include "vac/timer/timer_manager.h"
-#include <algorithm>
 #include "vac/timer/timer.h"
 #include "vac/timer/timer_reactor_interface.h"
 
 namespace vac {
 namespace timer {
 
-bool TimerExpiryCompare(const Timer* a, const Timer* b) { return a->GetNextExpiry() > b->GetNextExpiry(); }
-
-TimerManager::TimerManager(TimerReactorInterface* reactor) : reactor_(reactor), timers_() {}
+TimerManager::TimerManager(TimerReactorInterface* reactor)
+    : reactor_(reactor), wheel_(), reported_expiry_(Timer::Clock::time_point::max()) {}
 
 TimerManager::~TimerManager() = default;
 
 void TimerManager::AddTimer(Timer* const timer) {
-  if (timers_.empty()) {
-    timers_.push_back(timer);
-    if (reactor_ != nullptr) {
-      reactor_->Unblock();
-    }
-  } else {
-    Timer::Clock::time_point existing_next_expiry = GetNextTimer()->GetNextExpiry();
-
-    // Heapified insert
-    timers_.push_back(timer);
-    Update();
+  // Restarting a running timer moves it instead of adding it a second time.
+  wheel_.Remove(timer);
+  if (wheel_.empty()) {
+    wheel_.Rebase(Timer::Clock::now());
+  }
+  wheel_.Insert(timer);
 
-    if (timer->GetNextExpiry() < existing_next_expiry && reactor_ != nullptr) {
-      // New timer will expire before any existing timer
+  if (timer->GetNextExpiry() < reported_expiry_) {
+    // New timer will expire before the point the reactor is waiting for
+    reported_expiry_ = timer->GetNextExpiry();
+    if (reactor_ != nullptr) {
       reactor_->Unblock();
     }
   }
 }
 
-void TimerManager::RemoveTimer(const Timer* timer) {
-  auto it = std::find(timers_.begin(), timers_.end(), timer);
-  if (it != timers_.end()) {
-    timers_.erase(it);
-  }
-  Update();
-}
+void TimerManager::RemoveTimer(const Timer* timer) { wheel_.Remove(const_cast<Timer*>(timer)); }
 
-void TimerManager::Update() { std::make_heap(timers_.begin(), timers_.end(), TimerExpiryCompare); }
+void TimerManager::Update() { wheel_.Rehash(); }
 
 void TimerManager::HandleTimerExpiry() {
-  // Loop over timers to find which ones have expired
-  // Do not use an iterator, as handling a timer may modify the timer queue.
-  for (Timer* next_timer = GetNextTimer(); next_timer != nullptr && next_timer->IsExpired();
-       next_timer = GetNextTimer()) {
-    next_timer->DoHandleTimer();
-    // No call to update - call has to be done by the timer
+  wheel_.Advance(Timer::Clock::now());
+  // Handling a timer may start or stop any other timer. Timers which become due meanwhile are handled in another
+  // round, as long as the previous round has fired any timer.
+  bool fired = true;
+  while (fired) {
+    fired = false;
+    wheel_.CollectPending();
+    for (Timer* next_timer = wheel_.PopDue(); next_timer != nullptr; next_timer = wheel_.PopDue()) {
+      if (next_timer->IsExpired()) {
+        next_timer->DoHandleTimer();
+        fired = true;
+      } else {
+        // Expires later within the current tick
+        wheel_.Insert(next_timer);
+      }
+    }
   }
 }
 
@@ -88,20 +87,16 @@ const std::pair<bool, struct timeval> TimerManager::GetNextExpiry() const {
   std::pair<bool, struct timeval> result;
   if (next_timer == nullptr) {
     result.first = false;
+    reported_expiry_ = Timer::Clock::time_point::max();
   } else {
     result.first = true;
     result.second = next_timer->ToTimeval();
+    reported_expiry_ = next_timer->GetNextExpiry();
   }
   return result;
 }
 
-Timer* TimerManager::GetNextTimer() const {
-  if (timers_.empty()) {
-    return nullptr;
-  } else {
-    return timers_.front();
-  }
-}
+Timer* TimerManager::GetNextTimer() const { return wheel_.GetEarliest(); }
 
 }  // namespace timer
 }  // namespace vac
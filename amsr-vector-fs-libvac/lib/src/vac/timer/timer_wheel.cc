@@ -0,0 +1,282 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2018 by Vector Informatik GmbH. All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file
+ *        \brief  Hashed hierarchical timing wheel used by the TimerManager.
+ *
+ *      \details  -
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "vac/timer/timer_wheel.h"
+#include <algorithm>
+#include <type_traits>
+#include "vac/timer/timer.h"
+
+namespace vac {
+namespace timer {
+
+static_assert(std::is_same<TimerWheel::Clock, Timer::Clock>::value, "TimerWheel must use the clock of the timers");
+static_assert(TimerWheel::kSlotsPerLevel <= 64, "Slot occupancy of a level must fit into 64 bits");
+
+constexpr std::size_t TimerWheelHook::kUnlinked;
+constexpr std::size_t TimerWheel::kBitsPerLevel;
+constexpr std::size_t TimerWheel::kSlotsPerLevel;
+constexpr std::size_t TimerWheel::kLevels;
+constexpr std::size_t TimerWheel::kPendingSlot;
+constexpr std::size_t TimerWheel::kDueSlot;
+constexpr std::size_t TimerWheel::kOverflowSlot;
+constexpr std::size_t TimerWheel::kListCount;
+
+namespace {
+
+/**
+ * \brief Mask selecting the slot index of a level from a shifted tick count.
+ */
+constexpr std::uint64_t kSlotMask = TimerWheel::kSlotsPerLevel - 1;
+
+/**
+ * \brief Number of ticks covered by all levels together.
+ */
+constexpr std::uint64_t kWheelRange = std::uint64_t{1} << (TimerWheel::kBitsPerLevel * TimerWheel::kLevels);
+
+/**
+ * \brief Number of bits the tick count is shifted by to get the slot index of a level.
+ */
+constexpr std::size_t LevelShift(std::size_t level) { return TimerWheel::kBitsPerLevel * level; }
+
+}  // namespace
+
+TimerWheel::TimerWheel() : lists_(), occupied_(), current_tick_(ToTick(Clock::now())), count_(0) {}
+
+std::uint64_t TimerWheel::ToTick(Clock::time_point time_point) {
+  const Tick::rep ticks = std::chrono::duration_cast<Tick>(time_point.time_since_epoch()).count();
+  return (ticks > 0) ? static_cast<std::uint64_t>(ticks) : 0U;
+}
+
+void TimerWheel::Insert(Timer* timer) {
+  const std::uint64_t expiry_tick = ToTick(timer->GetNextExpiry());
+  if (expiry_tick <= current_tick_) {
+    Link(timer, kPendingSlot);
+  } else if ((expiry_tick - current_tick_) >= kWheelRange) {
+    LinkOverflow(timer);
+  } else {
+    const std::uint64_t delta = expiry_tick - current_tick_;
+    std::size_t level = 0;
+    while ((delta >> LevelShift(level + 1)) != 0U) {
+      ++level;
+    }
+    const std::size_t index = static_cast<std::size_t>((expiry_tick >> LevelShift(level)) & kSlotMask);
+    Link(timer, (level * kSlotsPerLevel) + index);
+  }
+}
+
+void TimerWheel::Remove(Timer* timer) {
+  if (timer->wheel_hook_.slot_ != TimerWheelHook::kUnlinked) {
+    Unlink(timer);
+  }
+}
+
+void TimerWheel::Rebase(Clock::time_point now) {
+  if (empty()) {
+    current_tick_ = ToTick(now);
+  }
+}
+
+void TimerWheel::Advance(Clock::time_point now) {
+  const std::uint64_t now_tick = ToTick(now);
+  if (empty()) {
+    current_tick_ = std::max(current_tick_, now_tick);
+  }
+  while (current_tick_ < now_tick) {
+    // Skip ticks as long as the levels below the next boundary are empty.
+    std::uint64_t next_tick = current_tick_ + 1U;
+    for (std::size_t level = 0; ((level + 1) < kLevels) && (occupied_[level] == 0U); ++level) {
+      const std::size_t shift = LevelShift(level + 1);
+      next_tick = ((current_tick_ >> shift) + 1U) << shift;
+    }
+    current_tick_ = std::min(next_tick, now_tick);
+
+    // Cascade top-down, so timers coming from a higher level are already placed when the lower level is handled.
+    // Whenever the top level wraps around, the overflow list comes first.
+    if ((current_tick_ & (kWheelRange - 1U)) == 0U) {
+      Cascade(kOverflowSlot);
+    }
+    for (std::size_t level = kLevels - 1; level > 0; --level) {
+      const std::size_t shift = LevelShift(level);
+      if ((current_tick_ & ((std::uint64_t{1} << shift) - 1U)) == 0U) {
+        Cascade((level * kSlotsPerLevel) + static_cast<std::size_t>((current_tick_ >> shift) & kSlotMask));
+      }
+    }
+    Cascade(static_cast<std::size_t>(current_tick_ & kSlotMask));
+  }
+}
+
+void TimerWheel::CollectPending() {
+  for (Timer* timer = PopFront(kPendingSlot); timer != nullptr; timer = PopFront(kPendingSlot)) {
+    Link(timer, kDueSlot);
+  }
+}
+
+Timer* TimerWheel::PopDue() { return PopFront(kDueSlot); }
+
+Timer* TimerWheel::GetEarliest() const {
+  Timer* earliest = nullptr;
+  auto consider = [&earliest](Timer* candidate) {
+    if ((candidate != nullptr) &&
+        ((earliest == nullptr) || (candidate->GetNextExpiry() < earliest->GetNextExpiry()))) {
+      earliest = candidate;
+    }
+  };
+
+  consider(GetEarliestOf(kPendingSlot));
+  consider(GetEarliestOf(kDueSlot));
+  consider(lists_[kOverflowSlot].head_);
+  for (std::size_t level = 0; level < kLevels; ++level) {
+    const std::uint64_t occupied = occupied_[level];
+    if (occupied != 0U) {
+      // Slots are ordered by expiry starting with the one after the current position of the level.
+      const std::size_t start = static_cast<std::size_t>(((current_tick_ >> LevelShift(level)) + 1U) & kSlotMask);
+      const std::uint64_t rotated =
+          (occupied >> start) | (occupied << ((kSlotsPerLevel - start) & static_cast<std::size_t>(kSlotMask)));
+      const std::size_t offset = static_cast<std::size_t>(__builtin_ctzll(rotated));
+      const std::size_t index = (start + offset) & static_cast<std::size_t>(kSlotMask);
+      consider(GetEarliestOf((level * kSlotsPerLevel) + index));
+    }
+  }
+  return earliest;
+}
+
+void TimerWheel::Rehash() {
+  Timer* chain = nullptr;
+  for (std::size_t slot = 0; slot < kListCount; ++slot) {
+    for (Timer* timer = PopFront(slot); timer != nullptr; timer = PopFront(slot)) {
+      timer->wheel_hook_.next_ = chain;
+      chain = timer;
+    }
+  }
+  while (chain != nullptr) {
+    Timer* timer = chain;
+    chain = timer->wheel_hook_.next_;
+    timer->wheel_hook_.next_ = nullptr;
+    Insert(timer);
+  }
+}
+
+void TimerWheel::Link(Timer* timer, std::size_t slot) {
+  TimerList& list = lists_[slot];
+  TimerWheelHook& hook = timer->wheel_hook_;
+  hook.prev_ = list.tail_;
+  hook.next_ = nullptr;
+  hook.slot_ = slot;
+  if (list.tail_ == nullptr) {
+    list.head_ = timer;
+  } else {
+    list.tail_->wheel_hook_.next_ = timer;
+  }
+  list.tail_ = timer;
+  if (slot < kPendingSlot) {
+    occupied_[slot / kSlotsPerLevel] |= std::uint64_t{1} << (slot % kSlotsPerLevel);
+  }
+  ++count_;
+}
+
+void TimerWheel::LinkOverflow(Timer* timer) {
+  Timer* next = lists_[kOverflowSlot].head_;
+  while ((next != nullptr) && !(timer->GetNextExpiry() < next->GetNextExpiry())) {
+    next = next->wheel_hook_.next_;
+  }
+  if (next == nullptr) {
+    Link(timer, kOverflowSlot);
+  } else {
+    TimerWheelHook& hook = timer->wheel_hook_;
+    TimerWheelHook& next_hook = next->wheel_hook_;
+    hook.prev_ = next_hook.prev_;
+    hook.next_ = next;
+    hook.slot_ = kOverflowSlot;
+    if (next_hook.prev_ == nullptr) {
+      lists_[kOverflowSlot].head_ = timer;
+    } else {
+      next_hook.prev_->wheel_hook_.next_ = timer;
+    }
+    next_hook.prev_ = timer;
+    ++count_;
+  }
+}
+
+void TimerWheel::Unlink(Timer* timer) {
+  TimerWheelHook& hook = timer->wheel_hook_;
+  TimerList& list = lists_[hook.slot_];
+  if (hook.prev_ == nullptr) {
+    list.head_ = hook.next_;
+  } else {
+    hook.prev_->wheel_hook_.next_ = hook.next_;
+  }
+  if (hook.next_ == nullptr) {
+    list.tail_ = hook.prev_;
+  } else {
+    hook.next_->wheel_hook_.prev_ = hook.prev_;
+  }
+  if ((list.head_ == nullptr) && (hook.slot_ < kPendingSlot)) {
+    occupied_[hook.slot_ / kSlotsPerLevel] &= ~(std::uint64_t{1} << (hook.slot_ % kSlotsPerLevel));
+  }
+  hook.prev_ = nullptr;
+  hook.next_ = nullptr;
+  hook.slot_ = TimerWheelHook::kUnlinked;
+  --count_;
+}
+
+Timer* TimerWheel::PopFront(std::size_t slot) {
+  Timer* timer = lists_[slot].head_;
+  if (timer != nullptr) {
+    Unlink(timer);
+  }
+  return timer;
+}
+
+void TimerWheel::Cascade(std::size_t slot) {
+  // Detach the whole slot first: a timer may be placed into the same slot again if it is a full revolution away.
+  Timer* chain = lists_[slot].head_;
+  for (Timer* timer = chain; timer != nullptr; timer = timer->wheel_hook_.next_) {
+    timer->wheel_hook_.slot_ = TimerWheelHook::kUnlinked;
+    --count_;
+  }
+  lists_[slot] = TimerList();
+  if (slot < kPendingSlot) {
+    occupied_[slot / kSlotsPerLevel] &= ~(std::uint64_t{1} << (slot % kSlotsPerLevel));
+  }
+
+  while (chain != nullptr) {
+    Timer* timer = chain;
+    chain = timer->wheel_hook_.next_;
+    Insert(timer);
+  }
+}
+
+Timer* TimerWheel::GetEarliestOf(std::size_t slot) const {
+  Timer* earliest = lists_[slot].head_;
+  if (earliest != nullptr) {
+    for (Timer* timer = earliest->wheel_hook_.next_; timer != nullptr; timer = timer->wheel_hook_.next_) {
+      if (timer->GetNextExpiry() < earliest->GetNextExpiry()) {
+        earliest = timer;
+      }
+    }
+  }
+  return earliest;
+}
+
+}  // namespace timer
+}  // namespace vac